@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** @file  LoggedEvent.h
+* @brief This file contains the event restored from the event log of the EventNetwork.
+*
+* \details Archived events are spilled to an append-only event log, if they exceed the
+*          retention policy of the EventNetwork. When read back, they are represented by this
+*          generic event, which only keeps the output relevant information.
+* @} */
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include "basicEvent.h"
+
+//-----------------------------------------------------------------------------
+/** This class implements all functionality of the LoggedEvent.
+ *
+ * \ingroup Event */
+//-----------------------------------------------------------------------------
+class LoggedEvent : public BasicEvent
+{
+public:
+    LoggedEvent(int eventId,
+                int time,
+                int triggeringEventId,
+                std::string source,
+                std::string sequenceName,
+                EventDefinitions::EventType eventType,
+                std::list<std::pair<std::string, std::string>> eventParameters):
+        BasicEvent(time,
+                   source,
+                   sequenceName,
+                   eventType),
+        eventParameters(eventParameters)
+    {
+        SetEventId(eventId);
+        SetTriggeringEventId(triggeringEventId);
+    }
+    LoggedEvent(const LoggedEvent&) = delete;
+    LoggedEvent(LoggedEvent&&) = delete;
+    LoggedEvent& operator=(const LoggedEvent&) = delete;
+    LoggedEvent& operator=(LoggedEvent&&) = delete;
+    virtual ~LoggedEvent() = default;
+
+    /*!
+    * \brief Returns all parameters of the event as string list.
+    * \details Returns the parameters as they were logged.
+    *
+    * @return	     List of string pairs of the event parameters.
+    */
+    virtual std::list<std::pair<std::string, std::string>> GetEventParametersAsString()
+    {
+        return eventParameters;
+    }
+
+private:
+    const std::list<std::pair<std::string, std::string>> eventParameters;
+};
+
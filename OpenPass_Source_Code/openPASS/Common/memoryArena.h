@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//! \brief This file implements a monotonic memory arena for objects living until the end of an invocation.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Common
+{
+/*!
+ * \brief Monotonic memory arena
+ *
+ * Memory is handed out sequentially from large blocks and never freed individually.
+ * Release() frees all allocations at once, but keeps the blocks, so that an arena which
+ * is released at the end of every invocation does not allocate from the heap anymore
+ * once it reached the size needed by an invocation.
+ *
+ * Objects created by Create() have to be destroyed by Destroy() before the arena is released.
+ */
+class MemoryArena
+{
+public:
+    //! \param[in] blockSize    size of the blocks requested from the heap [byte]
+    explicit MemoryArena(std::size_t blockSize = 64 * 1024) :
+        blockSize(blockSize)
+    {
+    }
+
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena(MemoryArena&&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+    MemoryArena& operator=(MemoryArena&&) = delete;
+    ~MemoryArena() = default;
+
+    /*!
+     * \brief Allocates uninitialized memory
+     *
+     * \param[in] size          number of bytes
+     * \param[in] alignment     alignment of the memory, a power of two
+     * \return pointer to the memory, valid until Release()
+     */
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+        ++allocationCount;
+        allocatedBytes += size;
+
+        for (; currentBlock < blocks.size(); ++currentBlock, offset = 0)
+        {
+            if (void* memory = AllocateFromBlock(blocks[currentBlock], size, alignment))
+            {
+                return memory;
+            }
+        }
+
+        blocks.push_back({std::unique_ptr<unsigned char[]>(new unsigned char[std::max(blockSize, size + alignment)]),
+                          std::max(blockSize, size + alignment)});
+        reservedBytes += blocks.back().size;
+        return AllocateFromBlock(blocks.back(), size, alignment);
+    }
+
+    //! Constructs an object in the arena
+    template <typename T, typename... Args>
+    T* Create(Args&&... args)
+    {
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    //! Calls the destructor of an object created by Create(), its memory is reclaimed by Release()
+    template <typename T>
+    static void Destroy(T* object)
+    {
+        if (object)
+        {
+            object->~T();
+        }
+    }
+
+    //! Frees all allocations at once and resets the statistics, the blocks are kept for reuse
+    void Release()
+    {
+        currentBlock = 0;
+        offset = 0;
+        allocationCount = 0;
+        allocatedBytes = 0;
+    }
+
+    //! Returns the number of allocations since the last Release()
+    std::size_t GetAllocationCount() const
+    {
+        return allocationCount;
+    }
+
+    //! Returns the number of bytes allocated since the last Release()
+    std::size_t GetAllocatedBytes() const
+    {
+        return allocatedBytes;
+    }
+
+    //! Returns the size of all blocks requested from the heap
+    std::size_t GetReservedBytes() const
+    {
+        return reservedBytes;
+    }
+
+private:
+    struct Block
+    {
+        std::unique_ptr<unsigned char[]> memory;
+        std::size_t size;
+    };
+
+    void* AllocateFromBlock(const Block& block, std::size_t size, std::size_t alignment)
+    {
+        void* memory = block.memory.get() + offset;
+        std::size_t space = block.size - offset;
+
+        if (!std::align(alignment, size, memory, space))
+        {
+            return nullptr;
+        }
+
+        offset = block.size - space + size;
+        return memory;
+    }
+
+    std::size_t blockSize;
+    std::vector<Block> blocks;
+    std::size_t currentBlock {0};
+    std::size_t offset {0};
+
+    std::size_t allocationCount {0};
+    std::size_t allocatedBytes {0};
+    std::size_t reservedBytes {0};
+};
+
+} // namespace Common
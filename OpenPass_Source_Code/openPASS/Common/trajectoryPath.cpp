@@ -0,0 +1,273 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include "trajectoryPath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace Common
+{
+
+namespace
+{
+//! Maps an angle difference to [-pi, pi]
+double WrapAngle(double angle)
+{
+    return std::atan2(std::sin(angle), std::cos(angle));
+}
+} // namespace
+
+TrajectoryPath::TrajectoryPath(std::vector<Vector2d> points, std::vector<double> times) :
+    points(std::move(points)),
+    times(std::move(times))
+{
+    if (this->points.size() != this->times.size())
+    {
+        throw std::invalid_argument("TrajectoryPath: number of points and times differ");
+    }
+
+    const size_t size = this->points.size();
+    distances.assign(size, 0.0);
+    headings.assign(size, 0.0);
+    curvatures.assign(size, 0.0);
+
+    bool hasHeading = false;
+    for (size_t index = 1; index < size; ++index)
+    {
+        const Vector2d segment = this->points[index] - this->points[index - 1];
+        const double length = segment.Length();
+        distances[index] = distances[index - 1] + length;
+
+        if (length > 0.0)
+        {
+            headings[index - 1] = segment.Angle();
+            if (!hasHeading)
+            {
+                std::fill(headings.begin(), headings.begin() + static_cast<long>(index - 1), headings[index - 1]);
+                hasHeading = true;
+            }
+        }
+        else if (index > 1)
+        {
+            headings[index - 1] = headings[index - 2];
+        }
+    }
+
+    if (size > 1)
+    {
+        headings[size - 1] = headings[size - 2];
+    }
+
+    for (size_t index = 1; index + 1 < size; ++index)
+    {
+        const double meanLength = 0.5 * (distances[index + 1] - distances[index - 1]);
+        if (meanLength > 0.0)
+        {
+            curvatures[index] = WrapAngle(headings[index] - headings[index - 1]) / meanLength;
+        }
+    }
+}
+
+size_t TrajectoryPath::Size() const
+{
+    return points.size();
+}
+
+double TrajectoryPath::GetLength() const
+{
+    return distances.empty() ? 0.0 : distances.back();
+}
+
+const Vector2d &TrajectoryPath::GetPoint(size_t index) const
+{
+    return points[index];
+}
+
+double TrajectoryPath::GetTime(size_t index) const
+{
+    return times[index];
+}
+
+double TrajectoryPath::GetDistance(size_t index) const
+{
+    return distances[index];
+}
+
+double TrajectoryPath::GetHeading(size_t index) const
+{
+    return headings[index];
+}
+
+double TrajectoryPath::GetCurvature(size_t index) const
+{
+    return curvatures[index];
+}
+
+size_t TrajectoryPath::FindIndexAtDistance(double distance, size_t fromIndex) const
+{
+    const size_t size = distances.size();
+    if (size == 0)
+    {
+        return 0;
+    }
+    if (fromIndex + 1 >= size)
+    {
+        return size - 1;
+    }
+    if (distances[fromIndex] >= distance)
+    {
+        return fromIndex;
+    }
+
+    size_t lower = fromIndex;
+    size_t step = 1;
+    size_t upper = fromIndex + 1;
+    while (upper < size && distances[upper] < distance)
+    {
+        lower = upper;
+        step *= 2;
+        upper = std::min(size, lower + step);
+    }
+
+    const auto end = distances.begin() + static_cast<long>(std::min(size, upper + 1));
+    const auto found = std::lower_bound(distances.begin() + static_cast<long>(lower + 1), end, distance);
+    return std::min(size - 1, static_cast<size_t>(found - distances.begin()));
+}
+
+TrajectoryPath::Cursor::Cursor(const TrajectoryPath &path) :
+    path(&path),
+    segment(0),
+    fraction(0.0)
+{
+}
+
+TrajectoryPath::Cursor::Cursor(const TrajectoryPath &path, size_t segment, double fraction) :
+    path(&path),
+    segment(segment),
+    fraction(fraction)
+{
+}
+
+void TrajectoryPath::Cursor::AdvanceByDistance(double ds)
+{
+    if (ds > 0.0)
+    {
+        SetDistance(GetDistance() + ds);
+    }
+}
+
+void TrajectoryPath::Cursor::SetDistance(double distance)
+{
+    const size_t size = path->Size();
+    if (size < 2)
+    {
+        return;
+    }
+    if (distance >= path->GetLength())
+    {
+        segment = size - 2;
+        fraction = 1.0;
+        return;
+    }
+
+    while (segment + 2 < size && path->distances[segment + 1] <= distance)
+    {
+        ++segment;
+    }
+
+    const double length = path->distances[segment + 1] - path->distances[segment];
+    fraction = length > 0.0 ? std::min(1.0, std::max(0.0, (distance - path->distances[segment]) / length)) : 1.0;
+}
+
+void TrajectoryPath::Cursor::AdvanceByTime(double dt)
+{
+    const size_t size = path->Size();
+    if (size < 2 || dt <= 0.0)
+    {
+        return;
+    }
+
+    const double time = GetTime() + dt;
+    if (time >= path->times.back())
+    {
+        segment = size - 2;
+        fraction = 1.0;
+        return;
+    }
+
+    while (segment + 2 < size && path->times[segment + 1] <= time)
+    {
+        ++segment;
+    }
+
+    const double duration = path->times[segment + 1] - path->times[segment];
+    fraction = duration > 0.0 ? std::min(1.0, std::max(0.0, (time - path->times[segment]) / duration)) : 1.0;
+}
+
+bool TrajectoryPath::Cursor::IsAtEnd() const
+{
+    return path->Size() < 2 || (segment + 2 >= path->Size() && fraction >= 1.0);
+}
+
+size_t TrajectoryPath::Cursor::GetSegment() const
+{
+    return segment;
+}
+
+double TrajectoryPath::Cursor::GetFraction() const
+{
+    return fraction;
+}
+
+double TrajectoryPath::Cursor::GetDistance() const
+{
+    if (path->Size() < 2)
+    {
+        return 0.0;
+    }
+    return path->distances[segment] + fraction * (path->distances[segment + 1] - path->distances[segment]);
+}
+
+double TrajectoryPath::Cursor::GetTime() const
+{
+    if (path->Size() < 2)
+    {
+        return path->times.empty() ? 0.0 : path->times.front();
+    }
+    return path->times[segment] + fraction * (path->times[segment + 1] - path->times[segment]);
+}
+
+Vector2d TrajectoryPath::Cursor::GetPosition() const
+{
+    if (path->Size() < 2)
+    {
+        return path->points.empty() ? Vector2d() : path->points.front();
+    }
+    return path->points[segment] + (path->points[segment + 1] - path->points[segment]) * fraction;
+}
+
+double TrajectoryPath::Cursor::GetHeading() const
+{
+    return path->headings.empty() ? 0.0 : path->headings[segment];
+}
+
+double TrajectoryPath::Cursor::GetCurvature() const
+{
+    if (path->Size() < 2)
+    {
+        return 0.0;
+    }
+    return path->curvatures[segment] + fraction * (path->curvatures[segment + 1] - path->curvatures[segment]);
+}
+
+} // namespace Common
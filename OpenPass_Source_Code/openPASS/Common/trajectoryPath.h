@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//! \brief This file implements a polyline trajectory with precomputed arc length, heading and curvature.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "opExport.h"
+#include "vector2d.h"
+
+namespace Common
+{
+/*!
+ * \brief Polyline through timed points in a plane
+ *
+ * The cumulative arc length and the time of every point, the heading of every segment and
+ * the curvature at every point are computed once at construction. A Cursor moves along the
+ * trajectory by distance or by time in amortized constant time per step.
+ */
+class OPENPASSCOMMONEXPORT TrajectoryPath
+{
+public:
+    /*!
+     * \brief Position on the trajectory, defined by a segment and the traveled fraction of it
+     *
+     * The cursor only moves forward. Advancing past the last point stops at the last point.
+     */
+    class OPENPASSCOMMONEXPORT Cursor
+    {
+    public:
+        explicit Cursor(const TrajectoryPath &path);
+
+        //! Restores a position returned by GetSegment() and GetFraction()
+        Cursor(const TrajectoryPath &path, size_t segment, double fraction);
+
+        //! Moves the cursor by the arc length ds
+        void AdvanceByDistance(double ds);
+
+        //! Moves the cursor by dt along the time of the trajectory points
+        void AdvanceByTime(double dt);
+
+        //! Returns true, if the cursor reached the last point
+        bool IsAtEnd() const;
+
+        //! Returns the index of the first point of the current segment
+        size_t GetSegment() const;
+
+        //! Returns the traveled fraction [0,1] of the current segment
+        double GetFraction() const;
+
+        //! Returns the arc length from the first point to the cursor
+        double GetDistance() const;
+
+        //! Returns the time interpolated at the cursor
+        double GetTime() const;
+
+        Vector2d GetPosition() const;
+        double GetHeading() const;
+        double GetCurvature() const;
+
+    private:
+        void SetDistance(double distance);
+
+        const TrajectoryPath *path;
+        size_t segment;
+        double fraction;
+    };
+
+    TrajectoryPath() = default;
+
+    /*!
+     * \brief Creates the trajectory and precomputes its geometry
+     *
+     * \param[in] points    points of the trajectory
+     * \param[in] times     time of each point, not decreasing
+     *
+     * \throws std::invalid_argument if the number of points and times differ
+     */
+    TrajectoryPath(std::vector<Vector2d> points, std::vector<double> times);
+
+    //! Returns the number of points
+    size_t Size() const;
+
+    //! Returns the total arc length
+    double GetLength() const;
+
+    const Vector2d &GetPoint(size_t index) const;
+    double GetTime(size_t index) const;
+
+    //! Returns the arc length from the first point to the point at index
+    double GetDistance(size_t index) const;
+
+    //! Returns the heading of the segment starting at index
+    double GetHeading(size_t index) const;
+
+    //! Returns the curvature at the point at index, which is zero at the first and the last point
+    double GetCurvature(size_t index) const;
+
+    /*!
+     * \brief Finds the first point at least at the given arc length
+     *
+     * The search starts at fromIndex and gallops forward, so its cost only depends on how
+     * far the result lies ahead.
+     *
+     * \param[in] distance      arc length from the first point
+     * \param[in] fromIndex     index to start the search from
+     * \return index of the first point at or after distance, the last index if there is none
+     */
+    size_t FindIndexAtDistance(double distance, size_t fromIndex) const;
+
+private:
+    std::vector<Vector2d> points;
+    std::vector<double> times;
+    std::vector<double> distances;
+    std::vector<double> headings;
+    std::vector<double> curvatures;
+};
+
+} // namespace Common
@@ -8,8 +8,123 @@
 * SPDX-License-Identifier: EPL-2.0
 **********************************************************************/
 
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES
+#endif // _USE_MATH_DEFINES
+#include <math.h>
+#include <algorithm>
 #include "pcm_lineContainer.h"
 
+namespace {
+
+//! Containers with less segments are searched linearly
+constexpr size_t minIndexedSegments = 16;
+//! Upper limit of the grid cells per dimension
+constexpr int maxCellsPerDimension = 512;
+constexpr double minCellSize = 1e-3;
+//! Tolerances of the lower bounds against rounding in the exact distance calculation
+constexpr double distanceTolerance = 1e-6;
+constexpr double angleTolerance = 1e-6;
+
+//! Half opening angle of the view range, negative if the view is not restricted
+double GetHalfViewRange(double viewAngle, double range)
+{
+    if (!std::isfinite(viewAngle) || (range < 0) || (range >= 2 * M_PI))
+    {
+        return -1.0;
+    }
+
+    // no range means only the view direction itself
+    if (qFuzzyIsNull(range) || std::isinf(range))
+    {
+        return 0.0;
+    }
+
+    return range / 2;
+}
+
+//! Checks whether the convex hull of up to four points is completely outside of the view range.
+//! The base point must not be inside the hull.
+bool IsOutsideViewRange(double baseX, double baseY, double viewAngle, double halfRange,
+                        const double *xs, const double *ys, int count)
+{
+    // angles relative to the view direction in [-PI, PI]
+    double angles[4];
+    double lowest = INFINITY;
+    double highest = -INFINITY;
+
+    for (int i = 0; i < count; ++i)
+    {
+        double dx = xs[i] - baseX;
+        double dy = ys[i] - baseY;
+        if ((std::fabs(dx) < distanceTolerance) && (std::fabs(dy) < distanceTolerance))
+        {
+            return false;
+        }
+
+        angles[i] = std::remainder(std::atan2(dy, dx) - viewAngle, 2 * M_PI);
+        lowest = std::min(lowest, angles[i]);
+        highest = std::max(highest, angles[i]);
+    }
+
+    const double limit = halfRange + angleTolerance;
+
+    // base point on the boundary of the hull
+    if (std::fabs(highest - lowest - M_PI) <= angleTolerance)
+    {
+        return false;
+    }
+
+    if (highest - lowest < M_PI)
+    {
+        return (lowest > limit) || (highest < -limit);
+    }
+
+    // hull behind the base point, its angles wrap around at PI and are [lowest, highest] in [0, 2 PI]
+    lowest = INFINITY;
+    highest = -INFINITY;
+    for (int i = 0; i < count; ++i)
+    {
+        double angle = (angles[i] < 0) ? angles[i] + 2 * M_PI : angles[i];
+        lowest = std::min(lowest, angle);
+        highest = std::max(highest, angle);
+    }
+
+    return (lowest > limit) && (highest < 2 * M_PI - limit);
+}
+
+double CalcDistanceToBox(double x, double y, double minX, double minY, double maxX, double maxY)
+{
+    double dx = std::max({minX - x, 0.0, x - maxX});
+    double dy = std::max({minY - y, 0.0, y - maxY});
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+double CalcDistanceToSegment(double x, double y, const PCM_Point *firstPoint, const PCM_Point *secondPoint)
+{
+    double segmentX = secondPoint->GetX() - firstPoint->GetX();
+    double segmentY = secondPoint->GetY() - firstPoint->GetY();
+    double lengthSquared = segmentX * segmentX + segmentY * segmentY;
+
+    double t = 0.0;
+    if (lengthSquared > 0.0)
+    {
+        t = ((x - firstPoint->GetX()) * segmentX + (y - firstPoint->GetY()) * segmentY) / lengthSquared;
+        t = std::min(std::max(t, 0.0), 1.0);
+    }
+
+    double dx = firstPoint->GetX() + t * segmentX - x;
+    double dy = firstPoint->GetY() + t * segmentY - y;
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+bool IsPointFinite(const PCM_Point *point)
+{
+    return std::isfinite(point->GetX()) && std::isfinite(point->GetY());
+}
+
+} // namespace
+
 PCM_LineContainer::~PCM_LineContainer()
 {
     for (std::pair<int, PCM_Line *> pcmLinePair : lineMap)
@@ -22,6 +137,10 @@ PCM_LineContainer::~PCM_LineContainer()
 bool PCM_LineContainer::AddPCM_Line(PCM_Line *line)
 {
     bool success = lineMap.emplace(std::make_pair(line->GetId(), line)).second;
+    if (success)
+    {
+        ClearSegmentIndex();
+    }
     return success;
 }
 
@@ -68,6 +187,11 @@ PCM_LineSegment PCM_LineContainer::GetNearestLineSegment(const PCM_Point *point,
         return minLineSegment;
     }
 
+    if (!gridCells.empty())
+    {
+        return GetNearestIndexedLineSegment(point, viewAngle, range, calculateSubLine);
+    }
+
     double minDistance = INFINITY;
 
     for (std::pair<int, const PCM_Line *> pcmLinePair : lineMap)
@@ -94,3 +218,209 @@ PCM_Point PCM_LineContainer::GetNearestPoint(const PCM_Point *point, double view
     PCM_LineSegment minLineSegment = GetNearestLineSegment(point, viewAngle, range);
     return minLineSegment.GetNearestPointFromPoint(point, viewAngle, range);
 }
+
+void PCM_LineContainer::BuildSegmentIndex()
+{
+    ClearSegmentIndex();
+
+    for (const std::pair<const int, PCM_Line *> &pcmLinePair : lineMap)
+    {
+        const PCM_Point *previousPoint = nullptr;
+        for (const std::pair<const int, const PCM_Point *> &pcmPointPair : *pcmLinePair.second->GetPointMap())
+        {
+            if (previousPoint != nullptr)
+            {
+                segments.push_back({previousPoint, pcmPointPair.second});
+            }
+            previousPoint = pcmPointPair.second;
+        }
+    }
+
+    // segments with invalid points are never the nearest ones and are not added to the grid
+    size_t validSegments = 0;
+    gridMinX = INFINITY;
+    gridMinY = INFINITY;
+    gridMaxX = -INFINITY;
+    gridMaxY = -INFINITY;
+    for (const IndexedSegment &segment : segments)
+    {
+        if (IsPointFinite(segment.firstPoint) && IsPointFinite(segment.secondPoint))
+        {
+            ++validSegments;
+            gridMinX = std::min({gridMinX, segment.firstPoint->GetX(), segment.secondPoint->GetX()});
+            gridMinY = std::min({gridMinY, segment.firstPoint->GetY(), segment.secondPoint->GetY()});
+            gridMaxX = std::max({gridMaxX, segment.firstPoint->GetX(), segment.secondPoint->GetX()});
+            gridMaxY = std::max({gridMaxY, segment.firstPoint->GetY(), segment.secondPoint->GetY()});
+        }
+    }
+
+    if (validSegments < minIndexedSegments)
+    {
+        ClearSegmentIndex();
+        return;
+    }
+
+    // about two segments per cell for evenly distributed segments
+    const double width = gridMaxX - gridMinX;
+    const double height = gridMaxY - gridMinY;
+    cellSize = std::max({std::sqrt(2.0 * width * height / validSegments),
+                         std::max(width, height) / maxCellsPerDimension,
+                         minCellSize});
+    columns = std::min(maxCellsPerDimension, std::max(1, static_cast<int>(std::ceil(width / cellSize))));
+    rows = std::min(maxCellsPerDimension, std::max(1, static_cast<int>(std::ceil(height / cellSize))));
+
+    auto cellColumn = [this](double x)
+    {
+        return std::min(columns - 1, std::max(0, static_cast<int>(std::floor((x - gridMinX) / cellSize))));
+    };
+    auto cellRow = [this](double y)
+    {
+        return std::min(rows - 1, std::max(0, static_cast<int>(std::floor((y - gridMinY) / cellSize))));
+    };
+
+    gridCells.assign(static_cast<size_t>(columns * rows), std::vector<size_t>());
+    for (size_t index = 0; index < segments.size(); ++index)
+    {
+        const IndexedSegment &segment = segments[index];
+        if (!IsPointFinite(segment.firstPoint) || !IsPointFinite(segment.secondPoint))
+        {
+            continue;
+        }
+
+        const int firstColumn = cellColumn(std::min(segment.firstPoint->GetX(), segment.secondPoint->GetX()));
+        const int lastColumn = cellColumn(std::max(segment.firstPoint->GetX(), segment.secondPoint->GetX()));
+        const int firstRow = cellRow(std::min(segment.firstPoint->GetY(), segment.secondPoint->GetY()));
+        const int lastRow = cellRow(std::max(segment.firstPoint->GetY(), segment.secondPoint->GetY()));
+
+        for (int row = firstRow; row <= lastRow; ++row)
+        {
+            for (int column = firstColumn; column <= lastColumn; ++column)
+            {
+                gridCells[static_cast<size_t>(row * columns + column)].push_back(index);
+            }
+        }
+    }
+}
+
+void PCM_LineContainer::ClearSegmentIndex()
+{
+    segments.clear();
+    gridCells.clear();
+    columns = 0;
+    rows = 0;
+}
+
+PCM_LineSegment PCM_LineContainer::GetNearestIndexedLineSegment(const PCM_Point *point,
+                                                                double viewAngle, double range,
+                                                                bool calculateSubLine) const
+{
+    PCM_LineSegment minLineSegment;
+
+    const double baseX = point->GetX();
+    const double baseY = point->GetY();
+    if (!std::isfinite(baseX) || !std::isfinite(baseY))
+    {
+        return minLineSegment;
+    }
+
+    const double halfRange = GetHalfViewRange(viewAngle, range);
+    const bool restricted = (halfRange >= 0) && (halfRange < M_PI);
+
+    // the cells are searched in rings around the cell of the base point projected onto the grid,
+    // all cells of a ring are at least (ring - 1) * cellSize away from the base point
+    const double projectedX = std::min(std::max(baseX, gridMinX), gridMaxX);
+    const double projectedY = std::min(std::max(baseY, gridMinY), gridMaxY);
+    const int baseColumn = std::min(columns - 1, static_cast<int>(std::floor((projectedX - gridMinX) / cellSize)));
+    const int baseRow = std::min(rows - 1, static_cast<int>(std::floor((projectedY - gridMinY) / cellSize)));
+    const int maxRing = std::max(columns, rows);
+
+    double minDistance = INFINITY;
+    size_t minIndex = 0;
+    std::vector<size_t> testedSegments;
+
+    for (int ring = 0; ring <= maxRing; ++ring)
+    {
+        if ((ring > 0) && ((ring - 1) * cellSize > minDistance + distanceTolerance))
+        {
+            break;
+        }
+
+        for (int row = std::max(0, baseRow - ring); row <= std::min(rows - 1, baseRow + ring); ++row)
+        {
+            const bool borderRow = (row == baseRow - ring) || (row == baseRow + ring);
+            const int columnStep = borderRow ? 1 : 2 * ring;
+
+            for (int column = baseColumn - ring; column <= baseColumn + ring; column += columnStep)
+            {
+                if ((column < 0) || (column >= columns))
+                {
+                    continue;
+                }
+
+                const double cellMinX = gridMinX + column * cellSize;
+                const double cellMinY = gridMinY + row * cellSize;
+                const double cellMaxX = cellMinX + cellSize;
+                const double cellMaxY = cellMinY + cellSize;
+
+                if (CalcDistanceToBox(baseX, baseY, cellMinX, cellMinY, cellMaxX, cellMaxY) > minDistance + distanceTolerance)
+                {
+                    continue;
+                }
+
+                if (restricted && (CalcDistanceToBox(baseX, baseY, cellMinX, cellMinY, cellMaxX, cellMaxY) > distanceTolerance))
+                {
+                    const double xs[] = {cellMinX, cellMaxX, cellMaxX, cellMinX};
+                    const double ys[] = {cellMinY, cellMinY, cellMaxY, cellMaxY};
+                    if (IsOutsideViewRange(baseX, baseY, viewAngle, halfRange, xs, ys, 4))
+                    {
+                        continue;
+                    }
+                }
+
+                for (size_t index : gridCells[static_cast<size_t>(row * columns + column)])
+                {
+                    if (std::find(testedSegments.cbegin(), testedSegments.cend(), index) != testedSegments.cend())
+                    {
+                        continue;
+                    }
+                    testedSegments.push_back(index);
+
+                    const IndexedSegment &segment = segments[index];
+                    if (CalcDistanceToSegment(baseX, baseY, segment.firstPoint, segment.secondPoint) > minDistance + distanceTolerance)
+                    {
+                        continue;
+                    }
+
+                    if (restricted)
+                    {
+                        const double xs[] = {segment.firstPoint->GetX(), segment.secondPoint->GetX()};
+                        const double ys[] = {segment.firstPoint->GetY(), segment.secondPoint->GetY()};
+                        if (IsOutsideViewRange(baseX, baseY, viewAngle, halfRange, xs, ys, 2))
+                        {
+                            continue;
+                        }
+                    }
+
+                    PCM_LineSegment lineSegment(*segment.firstPoint, *segment.secondPoint);
+                    if (calculateSubLine)
+                    {
+                        lineSegment = lineSegment.CalcSubLineSegmentInViewRange(point, viewAngle, range);
+                    }
+
+                    double distance = lineSegment.CalcDistanceFromPoint(point, viewAngle, range);
+
+                    // equal distances are resolved by the order of the segments like in the linear search
+                    if (!std::isinf(distance)
+                            && ((minDistance > distance) || ((minDistance == distance) && (index < minIndex))))
+                    {
+                        minDistance = distance;
+                        minIndex = index;
+                        minLineSegment = lineSegment;
+                    }
+                }
+            }
+        }
+    }
+
+    return minLineSegment;
+}
@@ -19,6 +19,7 @@
 #define PCM_LINECONTAINER_H
 
 #include <QString>
+#include <vector>
 #include "pcm_line.h"
 #include "opExport.h"
 
@@ -111,8 +112,43 @@ public:
                               double viewAngle = INFINITY,
                               double range = INFINITY) const;
 
+    //-----------------------------------------------------------------------------
+    //! Builds a uniform grid over the line segments of all lines. Afterwards
+    //! GetNearestLineSegment only tests the segments of the cells around the base
+    //! point which are not outside of the view range, with the same result as
+    //! testing all segments.
+    //!
+    //! Has to be called after all lines and points are added, adding a line
+    //! discards the index. Containers with few segments are not indexed.
+    //-----------------------------------------------------------------------------
+    void BuildSegmentIndex();
+
 private:
+    //! Line segment of the index, the points are owned by the lines
+    struct IndexedSegment
+    {
+        const PCM_Point *firstPoint;
+        const PCM_Point *secondPoint;
+    };
+
+    PCM_LineSegment GetNearestIndexedLineSegment(const PCM_Point *point,
+                                                 double viewAngle,
+                                                 double range,
+                                                 bool calculateSubLine) const;
+
+    void ClearSegmentIndex();
+
     std::map<int, PCM_Line *> lineMap;    //!< map of lines
+
+    std::vector<IndexedSegment> segments;           //!< segments in the order of lines and points
+    std::vector<std::vector<size_t>> gridCells;     //!< indices of the segments touching a cell, row by row
+    double gridMinX = 0.0;
+    double gridMinY = 0.0;
+    double gridMaxX = 0.0;
+    double gridMaxY = 0.0;
+    double cellSize = 0.0;
+    int columns = 0;
+    int rows = 0;
 };
 
 #endif // PCM_LINECONTAINER_H
@@ -21,11 +21,10 @@ bool ScenarioImporterPCM::Import(const std::string &filename,
         return false;
     }
 
-    QByteArray xmlData(xmlFile.readAll());
     QDomDocument document;
     QString errorMsg;
     int errorLine;
-    if (!document.setContent(xmlData, &errorMsg, &errorLine))
+    if (!document.setContent(&xmlFile, &errorMsg, &errorLine))
     {
         return false;
     }
@@ -21,11 +21,10 @@ bool SceneryImporterPCM::Import(const std::string &filename, PCM_Data &pcmData,
         return false;
     }
 
-    QByteArray xmlData(xmlFile.readAll());
     QDomDocument document;
     QString errorMsg;
     int errorLine;
-    if (!document.setContent(xmlData, &errorMsg, &errorLine))
+    if (!document.setContent(&xmlFile, &errorMsg, &errorLine))
     {
         return false;
     }
@@ -154,6 +153,7 @@ bool SceneryImporterPCM::ParseMarks(QDomNode rootNode, PCM_Data &pcmData)
                     return false;
                 }
 
+                marks->BuildSegmentIndex();
                 pcmData.AddPCM_Marks(marks);
             }
             marksNode = marksNode.nextSibling();
@@ -191,6 +191,7 @@ bool SceneryImporterPCM::ParseObjects(QDomNode rootNode, PCM_Data &pcmData)
                 objectTypeNode = objectTypeNode.nextSibling();
             }
 
+            object->BuildSegmentIndex();
             pcmData.SetPCM_Object(object);
         }
         objectNode = objectNode.nextSibling();
@@ -218,6 +219,7 @@ bool SceneryImporterPCM::ParseViewObjects(QDomNode rootNode, PCM_Data &pcmData)
                 return false;
             }
 
+            viewObject->BuildSegmentIndex();
             pcmData.SetPCM_ViewObject(viewObject);
         }
         viewObjectNode = viewObjectNode.nextSibling();
@@ -15,6 +15,8 @@
 //-----------------------------------------------------------------------------
 
 #include <memory>
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 #include "action_longitudinalDriverImplementation.h"
 #include "Common/longitudinalSignal.h"
@@ -69,3 +71,22 @@ void ActionLongitudinalDriverImplementation::Trigger(int time)
     //! Set gear
     GetAgent()->SetGear(in_gear);
 }
+
+void ActionLongitudinalDriverImplementation::SaveState(std::ostream &state) const
+{
+    state << in_accPedalPos << ' ' << in_brakePedalPos << ' ' << in_gear << ' ';
+}
+
+void ActionLongitudinalDriverImplementation::RestoreState(std::istream &state)
+{
+    state >> in_accPedalPos >> in_brakePedalPos >> in_gear;
+}
+
+void ActionLongitudinalDriverImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    in_accPedalPos = 0;
+    in_brakePedalPos = 0;
+    in_gear = 0;
+}
@@ -15,6 +15,8 @@
 //-----------------------------------------------------------------------------
 
 #include <memory>
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 #include "action_secondaryDriverTasksImplementation.h"
 #include "Common/secondaryDriverTasksSignal.h"
@@ -79,3 +81,27 @@ void ActionSecondaryDriverTasksImplementation::Trigger(int time)
     GetAgent()->SetHorn(in_hornSwitch);
     GetAgent()->SetFlasher(in_flasherSwitch);
 }
+
+void ActionSecondaryDriverTasksImplementation::SaveState(std::ostream &state) const
+{
+    state << static_cast<int>(in_IndicatorState) << ' ' << in_hornSwitch << ' ' << in_headLightSwitch << ' '
+          << in_highBeamLightSwitch << ' ' << in_flasherSwitch << ' ';
+}
+
+void ActionSecondaryDriverTasksImplementation::RestoreState(std::istream &state)
+{
+    int indicatorState;
+    state >> indicatorState >> in_hornSwitch >> in_headLightSwitch >> in_highBeamLightSwitch >> in_flasherSwitch;
+    in_IndicatorState = static_cast<IndicatorState>(indicatorState);
+}
+
+void ActionSecondaryDriverTasksImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    in_IndicatorState = IndicatorState::IndicatorState_Off;
+    in_hornSwitch = false;
+    in_headLightSwitch = false;
+    in_highBeamLightSwitch = false;
+    in_flasherSwitch = false;
+}
@@ -15,6 +15,8 @@
 //-----------------------------------------------------------------------------
 
 #include "agentUpdaterImplementation.h"
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 
 void AgentUpdaterImplementation::UpdateInput(int localLinkId, const std::shared_ptr<SignalInterface const> &data, int time)
@@ -56,6 +58,32 @@ void AgentUpdaterImplementation::UpdateOutput(int localLinkId, std::shared_ptr<S
     Q_UNUSED(time);
 }
 
+void AgentUpdaterImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    acceleration = 0.0;
+    velocity = 0.0;
+    positionX = 0.0;
+    positionY = 0.0;
+    yaw = 0.0;
+    yawRate = 0.0;
+    steeringWheelAngle = 0.0;
+    travelDistance = 0.0;
+}
+
+void AgentUpdaterImplementation::SaveState(std::ostream &state) const
+{
+    state << acceleration << ' ' << velocity << ' ' << positionX << ' ' << positionY << ' '
+          << yaw << ' ' << yawRate << ' ' << steeringWheelAngle << ' ' << travelDistance << ' ';
+}
+
+void AgentUpdaterImplementation::RestoreState(std::istream &state)
+{
+    state >> acceleration >> velocity >> positionX >> positionY
+          >> yaw >> yawRate >> steeringWheelAngle >> travelDistance;
+}
+
 void AgentUpdaterImplementation::Trigger(int time)
 {
     Q_UNUSED(time);
@@ -116,6 +116,37 @@ public:
     */
     virtual void Trigger(int time);
 
+    /*!
+    * \brief Resets the component, so that it can be reused for another agent of the same agent type
+    *
+    * @param[in]     agent          Agent embedding this component from now on
+    */
+    virtual void Reset(AgentInterface *agent) override;
+
+    virtual bool SupportsReset() const override
+    {
+        return true;
+    }
+
+    virtual bool SupportsCheckpoint() const override
+    {
+        return true;
+    }
+
+    /*!
+    * \brief Writes the state of the component, see ModelInterface::SaveState()
+    *
+    * @param[out]    state          Stream receiving the state
+    */
+    virtual void SaveState(std::ostream &state) const override;
+
+    /*!
+    * \brief Restores the state written by SaveState()
+    *
+    * @param[in]     state          Stream providing the state
+    */
+    virtual void RestoreState(std::istream &state) override;
+
 private:
     double acceleration {0.0};
     double velocity {0.0};
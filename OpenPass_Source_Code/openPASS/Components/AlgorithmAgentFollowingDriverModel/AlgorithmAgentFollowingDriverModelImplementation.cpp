@@ -201,3 +201,12 @@ void AlgorithmAgentFollowingDriverModelImplementation::Trigger(int time)
     }
 }
 
+void AlgorithmAgentFollowingDriverModelImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    ownVehicleInformation = {};
+    geometryInformation = {};
+    surroundingObjects = {};
+}
+
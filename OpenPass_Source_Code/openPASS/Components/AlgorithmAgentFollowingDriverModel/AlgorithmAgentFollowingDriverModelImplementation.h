@@ -115,6 +115,22 @@ public:
     */
     void Trigger(int time);
 
+    //! The outputs only depend on the sensor data received before each Trigger(), so there is no state to save
+    bool SupportsCheckpoint() const override
+    {
+        return true;
+    }
+
+    //! \brief Resets the component, so that it can be reused for another agent of the same agent type
+    //!
+    //! \param[in]     agent          Agent embedding this component from now on
+    void Reset(AgentInterface *agent) override;
+
+    bool SupportsReset() const override
+    {
+        return true;
+    }
+
     //----------------------------------------------------------------
 
 private:
@@ -13,6 +13,8 @@
 //-----------------------------------------------------------------------------
 
 #include <memory>
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 #include <QCoreApplication>
 #include <limits>
@@ -162,6 +164,28 @@ void AlgorithmAutonomousEmergencyBrakingImplementation::Trigger(int time)
     }
 }
 
+void AlgorithmAutonomousEmergencyBrakingImplementation::SaveState(std::ostream &state) const
+{
+    state << static_cast<int>(componentState) << ' ' << activeAcceleration << ' ';
+}
+
+void AlgorithmAutonomousEmergencyBrakingImplementation::RestoreState(std::istream &state)
+{
+    int componentStateValue;
+    state >> componentStateValue >> activeAcceleration;
+    componentState = static_cast<ComponentState>(componentStateValue);
+}
+
+void AlgorithmAutonomousEmergencyBrakingImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    detectedMovingObjects.clear();
+    detectedStationaryObjects.clear();
+    componentState = ComponentState::Disabled;
+    activeAcceleration = 0.0;
+}
+
 bool AlgorithmAutonomousEmergencyBrakingImplementation::ShouldBeActivated(const double ttc) const
 {
     return ttc < ttcBrake;
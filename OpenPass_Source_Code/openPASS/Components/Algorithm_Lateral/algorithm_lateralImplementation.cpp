@@ -15,6 +15,8 @@
 //-----------------------------------------------------------------------------
 
 #include <memory>
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 #include "algorithm_lateralImplementation.h"
 #include "Common/steeringSignal.h"
@@ -167,3 +169,38 @@ void AlgorithmLateralImplementation::Trigger(int time)
 
     timeLast = time;
 }
+
+void AlgorithmLateralImplementation::SaveState(std::ostream &state) const
+{
+    state << in_lateralDeviation << ' ' << in_gainLateralDeviation << ' ' << in_headingError << ' '
+          << in_gainHeadingError << ' ' << in_kappaSet << ' ' << velocity << ' ' << steeringWheelAngle << ' '
+          << in_steeringRatio << ' ' << in_steeringMax << ' ' << in_wheelBase << ' '
+          << isActive << ' ' << timeLast << ' ';
+}
+
+void AlgorithmLateralImplementation::RestoreState(std::istream &state)
+{
+    state >> in_lateralDeviation >> in_gainLateralDeviation >> in_headingError
+          >> in_gainHeadingError >> in_kappaSet >> velocity >> steeringWheelAngle
+          >> in_steeringRatio >> in_steeringMax >> in_wheelBase
+          >> isActive >> timeLast;
+}
+
+void AlgorithmLateralImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    in_lateralDeviation = 0;
+    in_gainLateralDeviation = 20.0;
+    in_headingError = 0;
+    in_gainHeadingError = 7.5;
+    in_kappaSet = 0;
+    velocity = 0.0;
+    steeringWheelAngle = 0.0;
+    out_desiredSteeringWheelAngle = 0;
+    in_steeringRatio = 10.7;
+    in_steeringMax = 180.0;
+    in_wheelBase = 2.89;
+    isActive = false;
+    timeLast = -100;
+}
@@ -163,6 +163,37 @@ public:
     */
     void Trigger(int time);
 
+    bool SupportsCheckpoint() const override
+    {
+        return true;
+    }
+
+    /*!
+    * \brief Writes the state of the component, see ModelInterface::SaveState()
+    *
+    * @param[out]    state          Stream receiving the state
+    */
+    void SaveState(std::ostream &state) const override;
+
+    /*!
+    * \brief Restores the state written by SaveState()
+    *
+    * @param[in]     state          Stream providing the state
+    */
+    void RestoreState(std::istream &state) override;
+
+    /*!
+    * \brief Resets the component, so that it can be reused for another agent of the same agent type
+    *
+    * @param[in]     agent          Agent embedding this component from now on
+    */
+    void Reset(AgentInterface *agent) override;
+
+    bool SupportsReset() const override
+    {
+        return true;
+    }
+
 private:
     // --- module internal functions
 
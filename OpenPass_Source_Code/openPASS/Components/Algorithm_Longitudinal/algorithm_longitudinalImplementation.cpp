@@ -14,6 +14,8 @@
 //-----------------------------------------------------------------------------
 
 #include <memory>
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 #include <cassert>
 #include "algorithm_longitudinalImplementation.h"
@@ -133,6 +135,37 @@ void AlgorithmLongitudinalImplementation::Trigger(int time)
     }
 }
 
+void AlgorithmLongitudinalImplementation::SaveState(std::ostream &state) const
+{
+    state << static_cast<int>(componentState) << ' ' << initializedAccelerationInput << ' ' << initializedSensorDriverData << ' '
+          << accelerationWish << ' ' << currentVelocity << ' ';
+}
+
+void AlgorithmLongitudinalImplementation::RestoreState(std::istream &state)
+{
+    int componentStateValue;
+    state >> componentStateValue >> initializedAccelerationInput >> initializedSensorDriverData
+          >> accelerationWish >> currentVelocity;
+    componentState = static_cast<ComponentState>(componentStateValue);
+    initializedVehicleModelParameters = false;
+}
+
+void AlgorithmLongitudinalImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    componentState = ComponentState::Armed;
+    initializedAccelerationInput = false;
+    initializedVehicleModelParameters = false;
+    initializedSensorDriverData = false;
+    accelerationWish = 0.0;
+    currentVelocity = 0.0;
+    out_accPedalPos = 0.0;
+    out_brakePedalPos = 0.0;
+    out_gear = 0;
+    vehicleModelParameters = VehicleModelParameters();
+}
+
 void AlgorithmLongitudinalImplementation::CalculatePedalPositionAndGear()
 {
     if (currentVelocity == 0 && accelerationWish == 0)
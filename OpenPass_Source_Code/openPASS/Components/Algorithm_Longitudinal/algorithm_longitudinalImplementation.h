@@ -128,6 +128,29 @@ public:
 
     void Trigger(int time) override;
 
+    bool SupportsCheckpoint() const override
+    {
+        return true;
+    }
+
+    //! \brief Writes the held inputs, see ModelInterface::SaveState()
+    //!
+    //! The vehicle parameters are not saved. They are taken from the next signal of the vehicle parameters again.
+    void SaveState(std::ostream &state) const override;
+
+    //! \brief Restores the state written by SaveState()
+    void RestoreState(std::istream &state) override;
+
+    //! \brief Resets the component, so that it can be reused for another agent of the same agent type
+    //!
+    //! \param[in]     agent          Agent embedding this component from now on
+    void Reset(AgentInterface *agent) override;
+
+    bool SupportsReset() const override
+    {
+        return true;
+    }
+
 private:
 
     //! \brief Calculate the pedal positions and gear
@@ -122,21 +122,17 @@ void ComponentControllerImplementation::Trigger(int time)
 {
     Q_UNUSED(time);
 
-    // get the event list and filter by ComponentChangeEvents and this agent's id
-    const auto stateChangeEventList = GetEventNetwork()->GetActiveEventCategory(EventDefinitions::EventCategory::ComponentStateChange);
-    const auto agentId = GetAgent()->GetId();
+    // get the ComponentChangeEvents targeting this agent (indexed by the event network)
+    const auto& stateChangeEventList = GetEventNetwork()->GetActiveEventsForAgent(EventDefinitions::EventCategory::ComponentStateChange,
+                                                                                  GetAgent()->GetId());
     std::list<std::shared_ptr<ComponentChangeEvent const>> castedStateChangeEventListForAgentId;
-    if (stateChangeEventList)
+    for (const auto &stateChangeEvent : stateChangeEventList)
     {
-        // filter state change event list by this agentid
-        for (const auto &stateChangeEvent : *stateChangeEventList)
-        {
-            const auto &castedStateChangeEvent = std::dynamic_pointer_cast<ComponentChangeEvent>(stateChangeEvent);
+        const auto &castedStateChangeEvent = std::dynamic_pointer_cast<ComponentChangeEvent>(stateChangeEvent);
 
-            if (castedStateChangeEvent && castedStateChangeEvent->agentId == agentId)
-            {
-               castedStateChangeEventListForAgentId.push_back(castedStateChangeEvent);
-            }
+        if (castedStateChangeEvent)
+        {
+           castedStateChangeEventListForAgentId.push_back(castedStateChangeEvent);
         }
     }
 
@@ -146,3 +142,20 @@ void ComponentControllerImplementation::Trigger(int time)
     //   state dependent on each other component's current state
     stateManager.UpdateMaxReachableStatesForRegisteredComponents(castedStateChangeEventListForAgentId);
 }
+
+void ComponentControllerImplementation::SaveState(std::ostream &state) const
+{
+    stateManager.SaveState(state);
+}
+
+void ComponentControllerImplementation::RestoreState(std::istream &state)
+{
+    stateManager.RestoreState(state);
+}
+
+void ComponentControllerImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    stateManager.Clear();
+}
@@ -8,6 +8,8 @@
 * SPDX-License-Identifier: EPL-2.0
 *******************************************************************************/
 
+#include <iomanip>
+
 #include "stateManager.h"
 
 using namespace ComponentControl;
@@ -168,3 +170,68 @@ std::map<std::string, std::pair<ComponentType, ComponentState>>
 
     return vehicleComponentStates;
 }
+
+void StateManager::SaveState(std::ostream &state) const
+{
+    state << vehicleComponentStateInformations.size() << ' ';
+
+    for (const auto& [localLinkId, componentStateInformation] : vehicleComponentStateInformations)
+    {
+        const auto adasComponentStateInformation = std::dynamic_pointer_cast<AdasComponentStateInformation const>(componentStateInformation);
+
+        state << localLinkId << ' '
+              << static_cast<int>(componentStateInformation->GetComponentType()) << ' '
+              << std::quoted(componentStateInformation->GetComponentName()) << ' '
+              << static_cast<int>(componentStateInformation->GetCurrentState()) << ' '
+              << static_cast<int>(componentStateInformation->GetMaxReachableState()) << ' '
+              << componentStateInformation->GetMaxReachableStateSetByEvent() << ' '
+              << (adasComponentStateInformation != nullptr) << ' '
+              << (adasComponentStateInformation ? static_cast<int>(adasComponentStateInformation->GetAdasType()) : 0) << ' ';
+    }
+}
+
+void StateManager::RestoreState(std::istream &state)
+{
+    size_t numberOfComponents = 0;
+    state >> numberOfComponents;
+
+    vehicleComponentStateInformations.clear();
+    for (size_t index = 0; index < numberOfComponents; ++index)
+    {
+        int localLinkId = 0;
+        int componentType = 0;
+        std::string componentName;
+        int currentState = 0;
+        int maxReachableState = 0;
+        bool maxReachableStateSetByEvent = false;
+        bool isAdas = false;
+        int adasType = 0;
+
+        state >> localLinkId >> componentType >> std::quoted(componentName) >> currentState
+              >> maxReachableState >> maxReachableStateSetByEvent >> isAdas >> adasType;
+
+        std::shared_ptr<ComponentStateInformation> componentStateInformation;
+        if (isAdas)
+        {
+            componentStateInformation = std::make_shared<AdasComponentStateInformation>(static_cast<ComponentType>(componentType),
+                                                                                        componentName,
+                                                                                        static_cast<ComponentState>(currentState),
+                                                                                        static_cast<AdasType>(adasType));
+        }
+        else
+        {
+            componentStateInformation = std::make_shared<ComponentStateInformation>(static_cast<ComponentType>(componentType),
+                                                                                    componentName,
+                                                                                    static_cast<ComponentState>(currentState));
+        }
+
+        componentStateInformation->SetMaxReachableState(static_cast<ComponentState>(maxReachableState));
+        componentStateInformation->SetMaxReachableStateSetByEvent(maxReachableStateSetByEvent);
+        vehicleComponentStateInformations.insert({localLinkId, componentStateInformation});
+    }
+}
+
+void StateManager::Clear()
+{
+    vehicleComponentStateInformations.clear();
+}
@@ -10,8 +10,10 @@
 
 #pragma once
 
-#include <utility>
+#include <istream>
 #include <memory>
+#include <ostream>
+#include <utility>
 #include "Interfaces/callbackInterface.h"
 #include "componentControllerCommon.h"
 #include "componentStateInformation.h"
@@ -108,6 +110,26 @@ public:
      *        of the controlling ComponentController and only including ComponentChangeEvents
      */
     void UpdateMaxReachableStatesForRegisteredComponents(const std::list<std::shared_ptr<ComponentChangeEvent const>> &componentStateChangeEventListFilteredByAgent);
+
+    /*!
+     * \brief SaveState writes the registered components and their states
+     * \param state the stream receiving the state
+     */
+    void SaveState(std::ostream &state) const;
+
+    /*!
+     * \brief RestoreState replaces the registered components by the ones written by SaveState()
+     *
+     * Conditions are not restored, as none are registered at runtime.
+     *
+     * \param state the stream providing the state
+     */
+    void RestoreState(std::istream &state);
+
+    /*!
+     * \brief Clear removes all registered components, e.g. before the controller is reused for another agent
+     */
+    void Clear();
 private:
     //-----------------------------------------------------------------------------
     //! Provides callback to LOG() macro
@@ -15,6 +15,8 @@
 //-----------------------------------------------------------------------------
 
 #include "dynamics_collisionImplementation.h"
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 
 DynamicsCollisionImplementation::DynamicsCollisionImplementation(std::string componentName,
@@ -46,6 +48,47 @@ DynamicsCollisionImplementation::DynamicsCollisionImplementation(std::string com
     dynamicsSignal.componentState = ComponentState::Disabled;
 }
 
+void DynamicsCollisionImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    dynamicsSignal.componentState = ComponentState::Disabled;
+    dynamicsSignal.acceleration = 0.0;
+    dynamicsSignal.velocity = 0.0;
+    dynamicsSignal.positionX = 0.0;
+    dynamicsSignal.positionY = 0.0;
+    dynamicsSignal.yaw = 0.0;
+    dynamicsSignal.yawRate = 0.0;
+    dynamicsSignal.steeringWheelAngle = 0.0;
+    dynamicsSignal.travelDistance = 0.0;
+    velocity = 0.0;
+    movingDirection = 0.0;
+    numberOfCollisionPartners = 0;
+    isActive = false;
+}
+
+void DynamicsCollisionImplementation::SaveState(std::ostream &state) const
+{
+    state << static_cast<int>(dynamicsSignal.componentState) << ' '
+          << dynamicsSignal.acceleration << ' ' << dynamicsSignal.velocity << ' '
+          << dynamicsSignal.positionX << ' ' << dynamicsSignal.positionY << ' '
+          << dynamicsSignal.yaw << ' ' << dynamicsSignal.yawRate << ' '
+          << dynamicsSignal.steeringWheelAngle << ' ' << dynamicsSignal.travelDistance << ' '
+          << velocity << ' ' << movingDirection << ' ' << numberOfCollisionPartners << ' ' << isActive << ' ';
+}
+
+void DynamicsCollisionImplementation::RestoreState(std::istream &state)
+{
+    int componentState;
+    state >> componentState
+          >> dynamicsSignal.acceleration >> dynamicsSignal.velocity
+          >> dynamicsSignal.positionX >> dynamicsSignal.positionY
+          >> dynamicsSignal.yaw >> dynamicsSignal.yawRate
+          >> dynamicsSignal.steeringWheelAngle >> dynamicsSignal.travelDistance
+          >> velocity >> movingDirection >> numberOfCollisionPartners >> isActive;
+    dynamicsSignal.componentState = static_cast<ComponentState>(componentState);
+}
+
 void DynamicsCollisionImplementation::UpdateInput(int localLinkId, const std::shared_ptr<SignalInterface const> &data, int time)
 {
     Q_UNUSED(localLinkId);
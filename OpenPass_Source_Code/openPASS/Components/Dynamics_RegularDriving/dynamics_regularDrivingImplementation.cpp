@@ -14,6 +14,8 @@
 //-----------------------------------------------------------------------------
 
 #include <memory>
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 #include <cassert>
 #include <cmath>
@@ -283,3 +285,35 @@ void DynamicsRegularDrivingImplementation::Trigger(int time)
     double psi = agent->GetYaw() + dpsi;
     dynamicsSignal.yaw = psi;
 }
+
+void DynamicsRegularDrivingImplementation::SaveState(std::ostream &state) const
+{
+    state << in_accPedalPos << ' ' << in_brakePedalPos << ' ' << in_gear << ' ' << in_steeringWheelAngle << ' ';
+}
+
+void DynamicsRegularDrivingImplementation::RestoreState(std::istream &state)
+{
+    state >> in_accPedalPos >> in_brakePedalPos >> in_gear >> in_steeringWheelAngle;
+}
+
+void DynamicsRegularDrivingImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    in_accPedalPos = 0;
+    in_brakePedalPos = 0;
+    in_gear = 0;
+    in_steeringWheelAngle = 0;
+
+    dynamicsSignal.componentState = ComponentState::Acting;
+    dynamicsSignal.acceleration = 0.0;
+    dynamicsSignal.velocity = 0.0;
+    dynamicsSignal.positionX = 0.0;
+    dynamicsSignal.positionY = 0.0;
+    dynamicsSignal.yaw = 0.0;
+    dynamicsSignal.yawRate = 0.0;
+    dynamicsSignal.steeringWheelAngle = 0.0;
+    dynamicsSignal.travelDistance = 0.0;
+
+    vehicleModelParameters = VehicleModelParameters();
+}
@@ -34,6 +34,7 @@ INCLUDEPATH += $$SUBDIRS \
 SOURCES += $$getFiles(SUBDIRS, cpp) \
            $$getFiles(SUBDIRS, c) \
             ../../Common/vector2d.cpp \
+            ../../Common/trajectoryPath.cpp \
             ../../CoreFramework/CoreShare/log.cpp \
             ../../CoreFramework/CoreShare/xmlParser.cpp \
            ../../CoreFramework/OpenPassSlave/importer/csvParser.cpp \
@@ -42,6 +43,7 @@ SOURCES += $$getFiles(SUBDIRS, cpp) \
 
 HEADERS += $$getFiles(SUBDIRS, h) \
             ../../Common/vector2d.h \
+            ../../Common/trajectoryPath.h \
             ../../CoreFramework/CoreShare/log.h \
             ../../CoreFramework/CoreShare/xmlParser.h \
            ../../CoreFramework/OpenPassSlave/importer/csvParser.h \
@@ -62,27 +62,7 @@ public:
     virtual void Trigger(int time);
 
 private:
-    Common::Vector2d CalculateScaledVector(const Position &previousPosition, const Position &nextPosition, const double &factor);
-    double CalculateScaledDeltaYawAngle(const Position &previousPosition, const Position &nextPosition, const double &factor);
-
-    Position CalculateStartPosition(const Position &previousPosition, const Position &nextPosition);
-    std::pair<int, Position> CalculateStartCoordinate(const std::pair<int, Position> &previousPosition, const std::pair<int, Position> &nextPosition);
-    double CalculateDistanceBetweenWorldCoordinates(Position previousPosition, Position nextPosition);
-
-    void TriggerWithActiveAccelerationInput();
-    void TriggerWithInactiveAccelerationInput();
-
-    void UpdateDynamics(const Position &previousPosition,
-                        const Common::Vector2d &direction,
-                        const double &deltaYawAngle,
-                        const double &velocity,
-                        const double &acceleration);
-
-    WorldCoordinateTrajectory absoluteWorldTrajectory {};
-    WorldCoordinateTrajectory::iterator previousTrajectoryIterator {};
-    WorldCoordinateTrajectory::iterator nextTrajectoryIterator {};
-
-    double percentageTraveledBetweenCoordinates {0};
+    void UpdateDynamics();
 };
 
 
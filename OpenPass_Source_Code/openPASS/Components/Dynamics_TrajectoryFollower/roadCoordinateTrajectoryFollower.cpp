@@ -12,6 +12,9 @@
 /** \file  roadCoordinateTrajectoryFollower.cpp */
 //-----------------------------------------------------------------------------
 
+#include <istream>
+#include <ostream>
+
 #include "roadCoordinateTrajectoryFollower.h"
 
 RoadCoordinateTrajectoryFollower::RoadCoordinateTrajectoryFollower(std::string componentName,
@@ -41,9 +44,24 @@ RoadCoordinateTrajectoryFollower::RoadCoordinateTrajectoryFollower(std::string c
         callbacks,
         agent)
 {
-    roadTrajectory = *(trajectory->GetRoadCoordinates());
-    previousTrajectoryIterator = roadTrajectory.begin();
-    nextTrajectoryIterator = ++(roadTrajectory.begin());
+    const RoadCoordinateTrajectory &roadCoordinates = *(trajectory->GetRoadCoordinates());
+
+    std::vector<Common::Vector2d> points;
+    std::vector<double> times;
+    std::vector<double> headings;
+    points.reserve(roadCoordinates.size());
+    times.reserve(roadCoordinates.size());
+    headings.reserve(roadCoordinates.size());
+
+    //The arc length in s/t contains a slight error since road curvature is not considered
+    for (const auto &coordinate : roadCoordinates)
+    {
+        points.emplace_back(coordinate.second.s, coordinate.second.t);
+        times.push_back(coordinate.first);
+        headings.push_back(coordinate.second.hdg);
+    }
+
+    SetTrajectory(std::move(points), std::move(times), std::move(headings));
     isRelativeTrajectory = trajectory->GetTrajectoryType() == TrajectoryType::RoadCoordinatesRelative;
 }
 
@@ -58,226 +76,70 @@ void RoadCoordinateTrajectoryFollower::Trigger(int time)
 
     lastVelocity = currentVelocity;
 
-    if (previousTrajectoryIterator != roadTrajectory.end() &&
-            (nextTrajectoryIterator) != roadTrajectory.end())
+    if (trajectoryCursor.IsAtEnd())
+    {
+        Halt();
+        return;
+    }
+
+    if (initialization)
     {
-        if (initialization)
+        if (isRelativeTrajectory)
         {
-            lastRoadPosition = (*previousTrajectoryIterator).second;
+            startPosition = GetAgent()->GetRoadPosition();
 
-            if (isRelativeTrajectory)
+            //Adjust t-coordinate to middle of the road by subtracting lane widths
+            startPosition.t -= 0.5 * GetAgent()->GetLaneWidth();
+            startLaneId = GetAgent()->GetMainLaneId(MeasurementPoint::Reference);
+            const int numberOfLanesToTheLeft = -startLaneId - 1;
+            for (int i = 1; i <= numberOfLanesToTheLeft; i++)
             {
-                startPosition = GetAgent()->GetRoadPosition();
-
-                //Adjust t-coordinate to middle of the road by subtracting lane widths
-                startPosition.t -= 0.5 * GetAgent()->GetLaneWidth();
-                startLaneId = GetAgent()->GetMainLaneId(MeasurementPoint::Reference);
-                const int numberOfLanesToTheLeft = -startLaneId - 1;
-                for (int i = 1; i <= numberOfLanesToTheLeft; i++)
-                {
-                    startPosition.t -= GetAgent()->GetLaneWidth(i);
-                }
+                startPosition.t -= GetAgent()->GetLaneWidth(i);
             }
-            lastCoordinateTimestamp = (*previousTrajectoryIterator).first;
-            UpdateDynamics((*previousTrajectoryIterator).second, {0,0}, 0, 0, 0);
-
-            initialization = false;
-            return;
         }
+        UpdateDynamics();
 
-        if (inputAccelerationActive)
-        {
-            TriggerWithActiveAccelerationInput();
-        }
-        else
-        {
-            TriggerWithInactiveAccelerationInput();
-        }
+        initialization = false;
+        return;
     }
 
-    else
+    if (!AdvanceTrajectoryCursor())
     {
-        currentVelocity = 0;
-        currentAcceleration = 0;
-        currentYawRate = 0;
-        distance = 0;
-
-        if(automaticDeactivation)
-        {
-            UpdateState(ComponentState::Disabled);
-        }
+        Halt();
+        return;
     }
-}
 
-Common::Vector2d RoadCoordinateTrajectoryFollower::CalculateScaledVector(const RoadPosition &previousPosition, const RoadPosition &nextPosition, const double &factor)
-{
-    Common::Vector2d result (nextPosition.s - previousPosition.s, nextPosition.t - previousPosition.t);
-    result.Scale(factor);
-
-    return result;
+    UpdateDynamics();
 }
 
-double RoadCoordinateTrajectoryFollower::CalculateScaledDeltaHeading(const RoadPosition &previousPosition, const RoadPosition &nextPosition, const double &factor)
+void RoadCoordinateTrajectoryFollower::SaveState(std::ostream &state) const
 {
-    const double result = (nextPosition.hdg - previousPosition.hdg) * factor;
-
-    return result;
+    TrajectoryFollowerCommonBase::SaveState(state);
+    state << startPosition.s << ' ' << startPosition.t << ' ' << startPosition.hdg << ' ' << startLaneId << ' ';
 }
 
-RoadPosition RoadCoordinateTrajectoryFollower::CalculateStartPosition(const RoadPosition &previousPosition, const RoadPosition &nextPosition)
+void RoadCoordinateTrajectoryFollower::RestoreState(std::istream &state)
 {
-    const auto startDirection = CalculateScaledVector(previousPosition, nextPosition, percentageTraveledBetweenCoordinates);
-    const double startDeltaHeading = CalculateScaledDeltaHeading(previousPosition, nextPosition, percentageTraveledBetweenCoordinates);
-
-    RoadPosition startPosition = previousPosition;
-    startPosition.s += startDirection.x;
-    startPosition.t += startDirection.y;
-    startPosition.hdg += startDeltaHeading;
-
-    return startPosition;
+    TrajectoryFollowerCommonBase::RestoreState(state);
+    state >> startPosition.s >> startPosition.t >> startPosition.hdg >> startLaneId;
 }
 
-std::pair<int, RoadPosition> RoadCoordinateTrajectoryFollower::CalculateStartCoordinate(const std::pair<int, RoadPosition> &previousPosition, const std::pair<int, RoadPosition> &nextPosition)
+void RoadCoordinateTrajectoryFollower::Reset(AgentInterface *agent)
 {
-    const auto startPosition = CalculateStartPosition(previousPosition.second, nextPosition.second);
-
-    const double timeDifference = nextPosition.first - previousPosition.first;
-    const double startTime = previousPosition.first + timeDifference * percentageTraveledBetweenCoordinates;
+    TrajectoryFollowerCommonBase::Reset(agent);
 
-    const std::pair<int, RoadPosition> result(startTime, startPosition);
-
-    return result;
+    startPosition = RoadPosition();
+    startLaneId = 0;
 }
 
-void RoadCoordinateTrajectoryFollower::TriggerWithActiveAccelerationInput()
+void RoadCoordinateTrajectoryFollower::UpdateDynamics()
 {
-    RoadPosition previousPosition = lastRoadPosition;
-    if (isRelativeTrajectory)
-    {
-        previousPosition.s -= startPosition.s;
-        previousPosition.t -= startPosition.t;
-        previousPosition.hdg -= startPosition.hdg;
-    }
-    RoadPosition nextPosition = (*nextTrajectoryIterator).second;
-
-    const double velocity = lastVelocity + inputAcceleration * cycleTimeInSeconds;
-
-    if(velocity <= 0.0)
-    {
-        currentVelocity = 0;
-        currentAcceleration = 0;
-        currentYawRate = 0;
-        distance = 0;
-
-        if(automaticDeactivation)
-        {
-            UpdateState(ComponentState::Disabled);
-        }
-
-        return;
-    }
+    const Common::Vector2d position = trajectoryCursor.GetPosition();
 
-    double distanceRemaining = velocity * cycleTimeInSeconds;
-    distance = distanceRemaining;
-    double percentageTraveledBetweenCoordinates = 0.0;
-
-    while (distanceRemaining > 0.0)
-    {
-        double distanceBetweenPoints = std::hypot(nextPosition.s - previousPosition.s, nextPosition.t - previousPosition.t);
-        if (distanceBetweenPoints < distanceRemaining)
-        {
-            previousTrajectoryIterator++;
-            nextTrajectoryIterator++;
-
-            previousPosition = (*previousTrajectoryIterator).second;
-
-            if(nextTrajectoryIterator != roadTrajectory.end())
-            {
-                nextPosition = (*nextTrajectoryIterator).second;
-            }
-        }
-        else
-        {
-            percentageTraveledBetweenCoordinates = distanceRemaining / distanceBetweenPoints;
-
-        }
-        distanceRemaining -= distanceBetweenPoints;
-    }
-    Common::Vector2d direction = CalculateScaledVector(previousPosition, nextPosition, percentageTraveledBetweenCoordinates);
-    const double deltaHeading = CalculateScaledDeltaHeading(previousPosition, nextPosition, percentageTraveledBetweenCoordinates);
-
-    UpdateDynamics(previousPosition, direction, deltaHeading, velocity, inputAcceleration);
-}
-
-void RoadCoordinateTrajectoryFollower::TriggerWithInactiveAccelerationInput()
-{
-    std::pair<int, RoadPosition> previousCoordinate = {lastCoordinateTimestamp, lastRoadPosition};
-    if (isRelativeTrajectory)
-    {
-        previousCoordinate.second.s -= startPosition.s;
-        previousCoordinate.second.t -= startPosition.t;
-        previousCoordinate.second.hdg -= startPosition.hdg;
-    }
-    std::pair<int, RoadPosition> nextCoordinate = *nextTrajectoryIterator;
-
-    double remainingTime = GetCycleTime();
-    double timeBetweenCoordinates = nextCoordinate.first - previousCoordinate.first;
-    double deltaS {0};
-
-    while (timeBetweenCoordinates <= remainingTime &&
-           (nextTrajectoryIterator) != roadTrajectory.end())
-    {
-        //This contains a slight error since road curvature is not considered
-        deltaS += std::hypot(nextCoordinate.second.s - previousCoordinate.second.s, nextCoordinate.second.t - previousCoordinate.second.t);
-
-        previousTrajectoryIterator++;
-        previousCoordinate = *previousTrajectoryIterator;
-        lastCoordinateTimestamp = previousCoordinate.first;
-
-        nextTrajectoryIterator++;
-        if(nextTrajectoryIterator != roadTrajectory.end())
-        {
-            nextCoordinate = *nextTrajectoryIterator;
-            remainingTime -= timeBetweenCoordinates;
-            timeBetweenCoordinates = nextCoordinate.first - previousCoordinate.first;
-        }
-        else
-        {
-            remainingTime = 0;
-            timeBetweenCoordinates = 1.0;
-        }
-    }
-
-    const auto& previousPosition = previousCoordinate.second;
-    const auto& nextPosition = nextCoordinate.second;
-
-    percentageTraveledBetweenCoordinates = remainingTime / timeBetweenCoordinates;
-    Common::Vector2d direction = CalculateScaledVector(previousPosition, nextPosition, percentageTraveledBetweenCoordinates);
-    const double deltaYawAngle = CalculateScaledDeltaHeading(previousPosition, nextPosition, percentageTraveledBetweenCoordinates);
-
-    deltaS += direction.Length();
-    distance = deltaS;
-
-    const double velocity = deltaS / cycleTimeInSeconds;
-    const double acceleration = (velocity - lastVelocity) / cycleTimeInSeconds;
-
-    const double deltaTimestamp = (nextCoordinate.first - lastCoordinateTimestamp) * percentageTraveledBetweenCoordinates;
-    lastCoordinateTimestamp = lastCoordinateTimestamp + static_cast<int>(deltaTimestamp);
-
-    UpdateDynamics(previousPosition, direction, deltaYawAngle, velocity, acceleration);
-}
-
-void RoadCoordinateTrajectoryFollower::UpdateDynamics(const RoadPosition &previousPosition,
-                                                              const Common::Vector2d &direction,
-                                                              const double &deltaHeading,
-                                                              const double &velocity,
-                                                              const double &acceleration)
-{
     RoadPosition currentRoadPosition;
-
-    currentRoadPosition.s = previousPosition.s + direction.x;
-    currentRoadPosition.t = previousPosition.t + direction.y;
-    currentRoadPosition.hdg = previousPosition.hdg + deltaHeading;
+    currentRoadPosition.s = position.x;
+    currentRoadPosition.t = position.y;
+    currentRoadPosition.hdg = GetCursorHeading();
 
     if(isRelativeTrajectory)
     {
@@ -294,9 +156,5 @@ void RoadCoordinateTrajectoryFollower::UpdateDynamics(const RoadPosition &previo
 
     currentYawRate = (currentWorldPosition.yawAngle - lastWorldPosition.yawAngle) / cycleTimeInSeconds;
 
-    currentVelocity = velocity;
-    currentAcceleration = acceleration;
-
-    lastRoadPosition = currentRoadPosition;
     lastWorldPosition = currentWorldPosition;
 }
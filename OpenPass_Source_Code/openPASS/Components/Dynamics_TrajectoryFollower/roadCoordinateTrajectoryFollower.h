@@ -61,28 +61,30 @@ public:
     */
     virtual void Trigger(int time);
 
-private:
-    Common::Vector2d CalculateScaledVector(const RoadPosition &previousPosition, const RoadPosition &nextPosition, const double &factor);
-    double CalculateScaledDeltaHeading(const RoadPosition &previousPosition, const RoadPosition &nextPosition, const double &factor);
-
-    RoadPosition CalculateStartPosition(const RoadPosition &previousPosition, const RoadPosition &nextPosition);
-    std::pair<int, RoadPosition> CalculateStartCoordinate(const std::pair<int, RoadPosition> &previousPosition, const std::pair<int, RoadPosition> &nextPosition);
+    /*!
+    * \brief Writes the common state and the start position of a relative trajectory
+    *
+    * @param[out]    state          Stream receiving the state
+    */
+    void SaveState(std::ostream &state) const override;
 
-    void TriggerWithActiveAccelerationInput();
-    void TriggerWithInactiveAccelerationInput();
+    /*!
+    * \brief Restores the state written by SaveState()
+    *
+    * @param[in]     state          Stream providing the state
+    */
+    void RestoreState(std::istream &state) override;
 
-    void UpdateDynamics(const RoadPosition &previousPosition,
-                        const Common::Vector2d &direction,
-                        const double &deltaHeading,
-                        const double &velocity,
-                        const double &acceleration);
+    /*!
+    * \brief Resets the common state and the start position of a relative trajectory
+    *
+    * @param[in]     agent          Agent embedding this component from now on
+    */
+    void Reset(AgentInterface *agent) override;
 
-    RoadCoordinateTrajectory roadTrajectory {};
-    RoadCoordinateTrajectory::iterator previousTrajectoryIterator {};
-    RoadCoordinateTrajectory::iterator nextTrajectoryIterator {};
+private:
+    void UpdateDynamics();
 
-    double percentageTraveledBetweenCoordinates {0};
-    RoadPosition lastRoadPosition;
     bool isRelativeTrajectory {false};
     RoadPosition startPosition {};
     int startLaneId {};
@@ -13,6 +13,8 @@
 //-----------------------------------------------------------------------------
 
 #include <memory>
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 
 #include "trajectoryFollowerCommonBase.h"
@@ -165,6 +167,123 @@ void TrajectoryFollowerCommonBase::UpdateOutput(int localLinkId, std::shared_ptr
     }
 }
 
+void TrajectoryFollowerCommonBase::SaveState(std::ostream &state) const
+{
+    state << initialization << ' '
+          << currentWorldPosition.xPos << ' ' << currentWorldPosition.yPos << ' ' << currentWorldPosition.yawAngle << ' '
+          << currentVelocity << ' ' << currentAcceleration << ' ' << currentYawRate << ' ' << distance << ' '
+          << lastWorldPosition.xPos << ' ' << lastWorldPosition.yPos << ' ' << lastWorldPosition.yawAngle << ' '
+          << lastVelocity << ' ' << trajectoryCursor.GetSegment() << ' ' << trajectoryCursor.GetFraction() << ' '
+          << inputAccelerationActive << ' ' << inputAcceleration << ' '
+          << static_cast<int>(componentState) << ' ' << canBeActivated << ' ' << currentTime << ' ';
+}
+
+void TrajectoryFollowerCommonBase::RestoreState(std::istream &state)
+{
+    size_t segment = 0;
+    double fraction = 0.0;
+    int componentStateValue = 0;
+
+    state >> initialization
+          >> currentWorldPosition.xPos >> currentWorldPosition.yPos >> currentWorldPosition.yawAngle
+          >> currentVelocity >> currentAcceleration >> currentYawRate >> distance
+          >> lastWorldPosition.xPos >> lastWorldPosition.yPos >> lastWorldPosition.yawAngle
+          >> lastVelocity >> segment >> fraction
+          >> inputAccelerationActive >> inputAcceleration
+          >> componentStateValue >> canBeActivated >> currentTime;
+
+    trajectoryCursor = Common::TrajectoryPath::Cursor(trajectoryPath, segment, fraction);
+    componentState = static_cast<ComponentState>(componentStateValue);
+}
+
+void TrajectoryFollowerCommonBase::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    initialization = true;
+    currentWorldPosition = Position();
+    currentVelocity = 0.0;
+    currentAcceleration = 0.0;
+    currentYawRate = 0.0;
+    distance = 0.0;
+    lastWorldPosition = Position();
+    lastVelocity = 0.0;
+    trajectoryCursor = Common::TrajectoryPath::Cursor(trajectoryPath);
+    inputAccelerationActive = false;
+    inputAcceleration = 0.0;
+    currentTime = 0;
+    componentState = ComponentState::Disabled;
+    canBeActivated = true;
+}
+
+void TrajectoryFollowerCommonBase::SetTrajectory(std::vector<Common::Vector2d> points,
+                                                 std::vector<double> times,
+                                                 std::vector<double> headings)
+{
+    trajectoryPath = Common::TrajectoryPath(std::move(points), std::move(times));
+    trajectoryCursor = Common::TrajectoryPath::Cursor(trajectoryPath);
+    trajectoryHeadings = std::move(headings);
+}
+
+bool TrajectoryFollowerCommonBase::AdvanceTrajectoryCursor()
+{
+    const double previousDistance = trajectoryCursor.GetDistance();
+
+    if (inputAccelerationActive)
+    {
+        const double velocity = lastVelocity + inputAcceleration * cycleTimeInSeconds;
+
+        if (velocity <= 0.0)
+        {
+            return false;
+        }
+
+        trajectoryCursor.AdvanceByDistance(velocity * cycleTimeInSeconds);
+        distance = trajectoryCursor.GetDistance() - previousDistance;
+        currentVelocity = velocity;
+        currentAcceleration = inputAcceleration;
+    }
+    else
+    {
+        trajectoryCursor.AdvanceByTime(GetCycleTime());
+        distance = trajectoryCursor.GetDistance() - previousDistance;
+        currentVelocity = distance / cycleTimeInSeconds;
+        currentAcceleration = (currentVelocity - lastVelocity) / cycleTimeInSeconds;
+    }
+
+    return true;
+}
+
+double TrajectoryFollowerCommonBase::GetCursorHeading() const
+{
+    if (trajectoryHeadings.empty())
+    {
+        return 0.0;
+    }
+
+    const size_t segment = trajectoryCursor.GetSegment();
+    if (segment + 1 >= trajectoryHeadings.size())
+    {
+        return trajectoryHeadings[segment];
+    }
+
+    return trajectoryHeadings[segment] +
+           (trajectoryHeadings[segment + 1] - trajectoryHeadings[segment]) * trajectoryCursor.GetFraction();
+}
+
+void TrajectoryFollowerCommonBase::Halt()
+{
+    currentVelocity = 0;
+    currentAcceleration = 0;
+    currentYawRate = 0;
+    distance = 0;
+
+    if (automaticDeactivation)
+    {
+        UpdateState(ComponentState::Disabled);
+    }
+}
+
 Position TrajectoryFollowerCommonBase::GetLastWorldPosition()
 {
     return currentWorldPosition;
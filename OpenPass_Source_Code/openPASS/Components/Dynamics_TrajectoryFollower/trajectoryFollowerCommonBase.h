@@ -57,6 +57,7 @@
 
 #include "Interfaces/modelInterface.h"
 #include "globalDefinitions.h"
+#include "trajectoryPath.h"
 #include "CoreFramework/OpenPassSlave/importer/trajectory.h"
 
 #include "Common/lateralSignal.h"
@@ -133,6 +134,41 @@ public:
     */
     virtual void Trigger(int time) = 0;
 
+    bool SupportsCheckpoint() const override
+    {
+        return true;
+    }
+
+    /*!
+    * \brief Writes the dynamic state and the position on the trajectory, see ModelInterface::SaveState()
+    *
+    * @param[out]    state          Stream receiving the state
+    */
+    void SaveState(std::ostream &state) const override;
+
+    /*!
+    * \brief Restores the state written by SaveState()
+    *
+    * The trajectory itself is not saved, as it is set again at construction.
+    *
+    * @param[in]     state          Stream providing the state
+    */
+    void RestoreState(std::istream &state) override;
+
+    /*!
+    * \brief Resets the component, so that it can be reused for another agent of the same agent type
+    *
+    * The trajectory is kept, as it is the same for all agents of the agent type.
+    *
+    * @param[in]     agent          Agent embedding this component from now on
+    */
+    void Reset(AgentInterface *agent) override;
+
+    bool SupportsReset() const override
+    {
+        return true;
+    }
+
     //only for unit tests
     Position GetLastWorldPosition();
     double GetLastVelocity();
@@ -148,9 +184,12 @@ protected:
     double distance {0.0};
 
     Position lastWorldPosition;
-    int lastCoordinateTimestamp {0};
     double lastVelocity {0.0};
 
+    Common::TrajectoryPath trajectoryPath;                      //!< trajectory with precomputed arc length
+    Common::TrajectoryPath::Cursor trajectoryCursor {trajectoryPath};   //!< current position on the trajectory
+    std::vector<double> trajectoryHeadings;                     //!< heading of each trajectory point
+
     bool inputAccelerationActive {false};
     double inputAcceleration {0.0};
 
@@ -161,6 +200,31 @@ protected:
 
     int currentTime{0};
 
+    /*!
+    * \brief Sets the trajectory and moves the cursor to its first point
+    *
+    * @param[in]     points         trajectory points
+    * @param[in]     times          time of each point [ms]
+    * @param[in]     headings       heading of each point
+    */
+    void SetTrajectory(std::vector<Common::Vector2d> points, std::vector<double> times, std::vector<double> headings);
+
+    /*!
+    * \brief Advances the cursor by the distance driven in this time step
+    *
+    * Without acceleration input the trajectory is played back along its timestamps,
+    * otherwise the velocity results from the acceleration input.
+    *
+    * @return   true if the agent moves, false if it came to a halt
+    */
+    bool AdvanceTrajectoryCursor();
+
+    //! Returns the heading interpolated linearly at the cursor
+    double GetCursorHeading() const;
+
+    //! Stops the agent and deactivates the module if AutomaticDeactivation is set
+    void Halt();
+
     void HandleCompCtrlSignalInput(const std::shared_ptr<SignalInterface const> &data);
     void HandleCompCtrlSignalOutput(std::shared_ptr<SignalInterface const> &data);
 
@@ -14,6 +14,8 @@
 //-----------------------------------------------------------------------------
 
 #include "limiterAccelerationVehicleComponentsImplementation.h"
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 
 void LimiterAccelerationVehicleComponentsImplementation::UpdateInput(int localLinkId, const std::shared_ptr<SignalInterface const> &data, int time)
@@ -94,6 +96,30 @@ void LimiterAccelerationVehicleComponentsImplementation::Trigger(int time)
     outgoingAcceleration = std::max(std::min(incomingAcceleration, accelerationLimit), decelerationLimit);
 }
 
+void LimiterAccelerationVehicleComponentsImplementation::SaveState(std::ostream &state) const
+{
+    state << static_cast<int>(componentState) << ' ' << incomingAcceleration << ' ';
+}
+
+void LimiterAccelerationVehicleComponentsImplementation::RestoreState(std::istream &state)
+{
+    int componentStateValue;
+    state >> componentStateValue >> incomingAcceleration;
+    componentState = static_cast<ComponentState>(componentStateValue);
+}
+
+void LimiterAccelerationVehicleComponentsImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    componentState = ComponentState::Armed;
+    vehicleModelParameters = VehicleModelParameters();
+    engineTorqueReferences.clear();
+    engineSpeedReferences.clear();
+    incomingAcceleration = 0.0;
+    outgoingAcceleration = 0.0;
+}
+
 double LimiterAccelerationVehicleComponentsImplementation::InterpolateEngineTorqueBasedOnSpeed(const double &engineSpeed)
 {
     if(engineSpeedReferences.size() != engineTorqueReferences.size() || engineSpeedReferences.empty())
@@ -14,6 +14,8 @@
 //-----------------------------------------------------------------------------
 
 #include <memory>
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 
 #include "parameters_vehicleImplementation.h"
@@ -57,6 +59,29 @@ void ParametersVehicleImplementation::Initialize()
     out_vehicleParameters = GetAgent()->GetVehicleModelParameters();
 }
 
+void ParametersVehicleImplementation::Reset(AgentInterface* agent)
+{
+    SetAgent(agent);
+
+    initialisation = true;
+}
+
+void ParametersVehicleImplementation::SaveState(std::ostream &state) const
+{
+    state << initialisation << ' ';
+}
+
+void ParametersVehicleImplementation::RestoreState(std::istream &state)
+{
+    state >> initialisation;
+
+    // the parameters are still sent every cycle, so they have to be taken from the restored agent again
+    if (!initialisation)
+    {
+        Initialize();
+    }
+}
+
 void ParametersVehicleImplementation::UpdateInput(int localLinkId, const std::shared_ptr<SignalInterface const>& data,
         int time)
 {
@@ -106,6 +106,22 @@ public:
 
     virtual void Trigger(int time);
 
+    virtual void Reset(AgentInterface* agent) override;
+
+    virtual bool SupportsReset() const override
+    {
+        return true;
+    }
+
+    virtual bool SupportsCheckpoint() const override
+    {
+        return true;
+    }
+
+    virtual void SaveState(std::ostream &state) const override;
+
+    virtual void RestoreState(std::istream &state) override;
+
 protected:
 
     /*!
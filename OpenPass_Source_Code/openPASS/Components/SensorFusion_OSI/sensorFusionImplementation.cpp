@@ -13,6 +13,8 @@
 //-----------------------------------------------------------------------------
 
 #include "sensorFusionImplementation.h"
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 
 SensorFusionImplementation::SensorFusionImplementation(
@@ -112,3 +114,29 @@ void SensorFusionImplementation::Trigger(int time)
 {
     Q_UNUSED(time);
 }
+
+void SensorFusionImplementation::SaveState(std::ostream &state) const
+{
+    const std::string serializedSensorData = out_sensorData.SerializeAsString();
+    state << previousTimeStamp << ' ' << serializedSensorData.size() << ' ';
+    state.write(serializedSensorData.data(), static_cast<std::streamsize>(serializedSensorData.size()));
+}
+
+void SensorFusionImplementation::RestoreState(std::istream &state)
+{
+    size_t size;
+    state >> previousTimeStamp >> size;
+    state.ignore(1);
+
+    std::string serializedSensorData(size, '\0');
+    state.read(&serializedSensorData[0], static_cast<std::streamsize>(size));
+    out_sensorData.ParseFromString(serializedSensorData);
+}
+
+void SensorFusionImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    previousTimeStamp = 0;
+    out_sensorData.Clear();
+}
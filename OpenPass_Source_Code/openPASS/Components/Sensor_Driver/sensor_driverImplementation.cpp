@@ -88,10 +88,25 @@ void SensorDriverImplementation::UpdateOutput(int localLinkId,
 void SensorDriverImplementation::Trigger(int time)
 {
     Q_UNUSED(time);
+
+    // all lane related data is taken from a single query of the surroundings
+    const AgentSurroundings surroundings = GetAgent()->GetSurroundings(GetWorld()->GetVisibilityDistance());
+
     GetOwnVehicleInformation();
-    GetTrafficRuleInformation();
-    GetGeometryInformation();
-    GetSurroundingObjectsInformation();
+    GetTrafficRuleInformation(surroundings);
+    GetGeometryInformation(surroundings);
+    GetSurroundingObjectsInformation(surroundings);
+}
+
+void SensorDriverImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    sensorDriverCalculations = SensorDriverCalculations(agent);
+    ownVehicleInformation = {};
+    trafficRuleInformation = {};
+    geometryInformation = {};
+    surroundingObjects = {};
 }
 
 void SensorDriverImplementation::GetOwnVehicleInformation()
@@ -107,104 +122,52 @@ void SensorDriverImplementation::GetOwnVehicleInformation()
     ownVehicleInformation.collision                     = GetAgent()->GetCollisionPartners().size() > 0;
 }
 
-void SensorDriverImplementation::GetTrafficRuleInformation()
+void SensorDriverImplementation::GetTrafficRuleInformation(const AgentSurroundings &surroundings)
 {
-    trafficRuleInformation.laneEgo    = GetTrafficRuleLaneInformationEgo();
-    trafficRuleInformation.laneLeft   = GetTrafficRuleLaneInformationLeft();
-    trafficRuleInformation.laneRight  = GetTrafficRuleLaneInformationRight();
+    trafficRuleInformation.laneEgo    = GetTrafficRuleLaneInformation(surroundings.laneEgo);
+    trafficRuleInformation.laneLeft   = GetTrafficRuleLaneInformation(surroundings.laneLeft);
+    trafficRuleInformation.laneRight  = GetTrafficRuleLaneInformation(surroundings.laneRight);
 }
 
-LaneInformationTrafficRules SensorDriverImplementation::GetTrafficRuleLaneInformationEgo()
+LaneInformationTrafficRules SensorDriverImplementation::GetTrafficRuleLaneInformation(const LaneSurroundings &lane)
 {
     LaneInformationTrafficRules laneInformation;
-    const double visibilityDistance = GetWorld()->GetVisibilityDistance();
 
-    laneInformation.trafficSigns            = GetAgent()->GetTrafficSignsInRange(visibilityDistance);
+    laneInformation.trafficSigns            = lane.trafficSigns;
 
     return laneInformation;
 }
 
-LaneInformationTrafficRules SensorDriverImplementation::GetTrafficRuleLaneInformationLeft()
-{
-    LaneInformationTrafficRules laneInformation;
-    const int relativeLaneId = 1;
-    const double visibilityDistance = GetWorld()->GetVisibilityDistance();
-
-    laneInformation.trafficSigns            = GetAgent()->GetTrafficSignsInRange(visibilityDistance, relativeLaneId);
-
-    return laneInformation;
-}
-
-LaneInformationTrafficRules SensorDriverImplementation::GetTrafficRuleLaneInformationRight()
-{
-    LaneInformationTrafficRules laneInformation;
-    const int relativeLaneId = -1;
-    const double visibilityDistance = GetWorld()->GetVisibilityDistance();
-
-    laneInformation.trafficSigns            = GetAgent()->GetTrafficSignsInRange(visibilityDistance, relativeLaneId);
-
-    return laneInformation;
-}
-
-void SensorDriverImplementation::GetGeometryInformation()
+void SensorDriverImplementation::GetGeometryInformation(const AgentSurroundings &surroundings)
 {
     geometryInformation.visibilityDistance            = GetWorld()->GetVisibilityDistance();
-    geometryInformation.laneEgo    = GetGeometryLaneInformationEgo();
-    geometryInformation.laneLeft   = GetGeometryLaneInformationLeft();
-    geometryInformation.laneRight  = GetGeometryLaneInformationRight();
-}
-
-LaneInformationGeometry SensorDriverImplementation::GetGeometryLaneInformationEgo()
-{
-    LaneInformationGeometry laneInformation;
-    const double visibilityDistance = GetWorld()->GetVisibilityDistance();
-
-    laneInformation.exists                  = true;     // Ego lane must exist by definition, or else vehicle would have despawned by now. Information not necessary atm!
-    laneInformation.curvature               = GetAgent()->GetLaneCurvature();
-    laneInformation.width                   = GetAgent()->GetLaneWidth();
-    laneInformation.distanceToEndOfLane     = GetAgent()->GetDistanceToEndOfLane(visibilityDistance);
+    geometryInformation.laneEgo    = GetGeometryLaneInformation(surroundings.laneEgo);
+    geometryInformation.laneLeft   = GetGeometryLaneInformation(surroundings.laneLeft);
+    geometryInformation.laneRight  = GetGeometryLaneInformation(surroundings.laneRight);
 
-    return laneInformation;
-}
-
-LaneInformationGeometry SensorDriverImplementation::GetGeometryLaneInformationLeft()
-{
-    LaneInformationGeometry laneInformation;
-    const int relativeLaneId = 1;
-    const double visibilityDistance = GetWorld()->GetVisibilityDistance();
-
-    laneInformation.exists                  = GetAgent()->ExistsLaneLeft();
-    laneInformation.curvature               = GetAgent()->GetLaneCurvature(relativeLaneId);
-    laneInformation.width                   = GetAgent()->GetLaneWidth(relativeLaneId);
-    laneInformation.distanceToEndOfLane     = GetAgent()->GetDistanceToEndOfLane(visibilityDistance, relativeLaneId);
-
-    return laneInformation;
+    geometryInformation.laneEgo.exists = true;     // Ego lane must exist by definition, or else vehicle would have despawned by now. Information not necessary atm!
 }
 
-LaneInformationGeometry SensorDriverImplementation::GetGeometryLaneInformationRight()
+LaneInformationGeometry SensorDriverImplementation::GetGeometryLaneInformation(const LaneSurroundings &lane)
 {
     LaneInformationGeometry laneInformation;
-    const int relativeLaneId = -1;
-    const double visibilityDistance = GetWorld()->GetVisibilityDistance();
 
-    laneInformation.exists                  = GetAgent()->ExistsLaneRight();
-    laneInformation.curvature               = GetAgent()->GetLaneCurvature(relativeLaneId);
-    laneInformation.width                   = GetAgent()->GetLaneWidth(relativeLaneId);
-    laneInformation.distanceToEndOfLane     = GetAgent()->GetDistanceToEndOfLane(visibilityDistance, relativeLaneId);
+    laneInformation.exists                  = lane.exists;
+    laneInformation.curvature               = lane.curvature;
+    laneInformation.width                   = lane.width;
+    laneInformation.distanceToEndOfLane     = lane.distanceToEndOfLane;
 
     return laneInformation;
 }
 
-void SensorDriverImplementation::GetSurroundingObjectsInformation()
+void SensorDriverImplementation::GetSurroundingObjectsInformation(const AgentSurroundings &surroundings)
 {
-    const double visibilityDistance = GetWorld()->GetVisibilityDistance();
-
-    surroundingObjects.objectFront = GetOtherObjectInformation(GetAgent()->GetObjectInFront(visibilityDistance));
-    surroundingObjects.objectRear = GetOtherObjectInformation(GetAgent()->GetObjectBehind(visibilityDistance));
-    surroundingObjects.objectFrontLeft = GetOtherObjectInformation(GetAgent()->GetObjectInFront(visibilityDistance, 1));
-    surroundingObjects.objectRearLeft = GetOtherObjectInformation(GetAgent()->GetObjectBehind(visibilityDistance, 1));
-    surroundingObjects.objectFrontRight = GetOtherObjectInformation(GetAgent()->GetObjectInFront(visibilityDistance, -1));
-    surroundingObjects.objectRearRight = GetOtherObjectInformation(GetAgent()->GetObjectBehind(visibilityDistance, -1));
+    surroundingObjects.objectFront = GetOtherObjectInformation(surroundings.laneEgo.objectInFront);
+    surroundingObjects.objectRear = GetOtherObjectInformation(surroundings.laneEgo.objectBehind);
+    surroundingObjects.objectFrontLeft = GetOtherObjectInformation(surroundings.laneLeft.objectInFront);
+    surroundingObjects.objectRearLeft = GetOtherObjectInformation(surroundings.laneLeft.objectBehind);
+    surroundingObjects.objectFrontRight = GetOtherObjectInformation(surroundings.laneRight.objectInFront);
+    surroundingObjects.objectRearRight = GetOtherObjectInformation(surroundings.laneRight.objectBehind);
 }
 
 ObjectInformation SensorDriverImplementation::GetOtherObjectInformation(const WorldObjectInterface* surroundingObject)
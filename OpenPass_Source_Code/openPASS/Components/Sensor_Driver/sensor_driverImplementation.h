@@ -102,6 +102,22 @@ public:
 
     virtual void Trigger(int time);
 
+    //! All information is queried from the world again in each Trigger(), so there is no state to save
+    virtual bool SupportsCheckpoint() const override
+    {
+        return true;
+    }
+
+    //! \brief Resets the component, so that it can be reused for another agent of the same agent type
+    //!
+    //! \param[in]     agent          Agent embedding this component from now on
+    virtual void Reset(AgentInterface *agent) override;
+
+    virtual bool SupportsReset() const override
+    {
+        return true;
+    }
+
     //! Name of the component for debug output
     const std::string COMPONENTNAME = "SensorDriver";
 
@@ -111,31 +127,22 @@ private:
     virtual void GetOwnVehicleInformation();
 
     //! \brief Get sensor data containing traffic rule information.
-    virtual void GetTrafficRuleInformation();
-
-    //! \brief Get traffic rule sensor data from the ego lane.
-    LaneInformationTrafficRules GetTrafficRuleLaneInformationEgo();
-
-    //! \brief Get traffic rule sensor data from the lane left of ego.
-    LaneInformationTrafficRules GetTrafficRuleLaneInformationLeft();
+    //! \param [in] surroundings    Surroundings of the agent queried in this cycle
+    virtual void GetTrafficRuleInformation(const AgentSurroundings &surroundings);
 
-    //! \brief Get traffic rule sensor data from the lane right of ego.
-    LaneInformationTrafficRules GetTrafficRuleLaneInformationRight();
+    //! \brief Get traffic rule sensor data from one lane.
+    LaneInformationTrafficRules GetTrafficRuleLaneInformation(const LaneSurroundings &lane);
 
     //! \brief Get lane geometry sensor data.
-    virtual void GetGeometryInformation();
-
-    //! \brief Get lane geometry sensor data from the ego lane.
-    LaneInformationGeometry GetGeometryLaneInformationEgo();
-
-    //! \brief Get lane geometry sensor data from the lane left of ego.
-    LaneInformationGeometry GetGeometryLaneInformationLeft();
+    //! \param [in] surroundings    Surroundings of the agent queried in this cycle
+    virtual void GetGeometryInformation(const AgentSurroundings &surroundings);
 
-    //! \brief Get lane geometry sensor data from the lane right of ego.
-    LaneInformationGeometry GetGeometryLaneInformationRight();
+    //! \brief Get lane geometry sensor data from one lane.
+    LaneInformationGeometry GetGeometryLaneInformation(const LaneSurroundings &lane);
 
     //! \brief Get sensor data of surrounding objects.
-    virtual void GetSurroundingObjectsInformation();
+    //! \param [in] surroundings    Surroundings of the agent queried in this cycle
+    virtual void GetSurroundingObjectsInformation(const AgentSurroundings &surroundings);
 
     //! \brief Get information of one object.
     virtual ObjectInformation GetOtherObjectInformation(const WorldObjectInterface *surroundingObject);
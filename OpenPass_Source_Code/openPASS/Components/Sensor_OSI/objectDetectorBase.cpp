@@ -13,9 +13,36 @@
 //-----------------------------------------------------------------------------
 
 #include <memory>
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 #include <cassert>
 #include "objectDetectorBase.h"
+#include "sharedSensorView.h"
+
+namespace {
+
+//! Writes the sensor data as binary, preceded by its size
+void WriteSensorData(std::ostream &state, const osi3::SensorData &sensorData)
+{
+    const std::string serializedSensorData = sensorData.SerializeAsString();
+    state << serializedSensorData.size() << ' ';
+    state.write(serializedSensorData.data(), static_cast<std::streamsize>(serializedSensorData.size()));
+    state << ' ';
+}
+
+//! Reads sensor data written by WriteSensorData()
+void ReadSensorData(std::istream &state, osi3::SensorData &sensorData)
+{
+    size_t size = 0;
+    state >> size;
+    state.ignore(1);
+    std::string serializedSensorData(size, '\0');
+    state.read(&serializedSensorData[0], static_cast<std::streamsize>(size));
+    sensorData.ParseFromString(serializedSensorData);
+}
+
+} // namespace
 
 ObjectDetectorBase::ObjectDetectorBase(
     std::string componentName,
@@ -101,6 +128,44 @@ void ObjectDetectorBase::UpdateOutput(int localLinkId, std::shared_ptr<SignalInt
     }
 }
 
+void ObjectDetectorBase::SaveState(std::ostream &state) const
+{
+    WriteSensorData(state, sensorData);
+    state << detectedObjectsBuffer.size() << ' ';
+
+    for (const auto& detectedObjects : detectedObjectsBuffer)
+    {
+        state << detectedObjects.first << ' ';
+        WriteSensorData(state, detectedObjects.second);
+    }
+}
+
+void ObjectDetectorBase::RestoreState(std::istream &state)
+{
+    size_t numberOfBufferedEntries = 0;
+
+    ReadSensorData(state, sensorData);
+    state >> numberOfBufferedEntries;
+
+    detectedObjectsBuffer.clear();
+    for (size_t index = 0; index < numberOfBufferedEntries; ++index)
+    {
+        int time = 0;
+        osi3::SensorData bufferedSensorData;
+        state >> time;
+        ReadSensorData(state, bufferedSensorData);
+        detectedObjectsBuffer.emplace_back(time, bufferedSensorData);
+    }
+}
+
+void ObjectDetectorBase::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    detectedObjectsBuffer.clear();
+    sensorData.Clear();
+}
+
 Position ObjectDetectorBase::GetAbsolutePosition()
 {
     Position absolutePosition;
@@ -168,37 +233,7 @@ osi3::SensorViewConfiguration ObjectDetectorBase::GenerateSensorViewConfiguratio
 
 polygon_t ObjectDetectorBase::CalculateBoundingBox(const osi3::Dimension3d dimension, const  osi3::Vector3d position, const osi3::Orientation3d orientation)
 {
-    double halfLength = dimension.length() / 2.0;
-    double halfWidth = dimension.width() / 2.0;
-    double rotation = orientation.yaw();
-
-    double x = position.x();
-    double y = position.y();
-
-
-    point_t boxPoints[]
-    {
-        {-halfLength, -halfWidth},
-        {-halfLength,  halfWidth},
-        {halfLength,  halfWidth},
-        {halfLength, -halfWidth},
-        {-halfLength, -halfWidth}
-    };
-
-    polygon_t box;
-    polygon_t boxTemp;
-    bg::append(box, boxPoints);
-
-    bt::translate_transformer<double, 2, 2> translate(x, y);
-
-    // rotation in mathematical negativ order (boost) -> invert to match
-    bt::rotate_transformer<bg::radian, double, 2, 2> rotate(-rotation);
-
-    bg::transform(box, boxTemp, rotate);
-    bg::transform(boxTemp, box, translate);
-    bg::correct(box);
-
-    return box;
+    return SharedSensorView::CalculateBoundingBox(dimension, position, orientation);
 }
 
 point_t ObjectDetectorBase::TransformPointToLocalCoordinates(point_t point, point_t sensorPositionGlobal, double yaw)
@@ -14,8 +14,8 @@
 
 #include "sensorGeometric2D.h"
 #include "boostGeometryCommon.h"
+#include "visualObstruction.h"
 #include <QtGlobal>
-#include "CoreModules/World_OSI/WorldData.h"
 
 SensorGeometric2D::SensorGeometric2D(
         std::string componentName,
@@ -54,6 +54,16 @@ SensorGeometric2D::SensorGeometric2D(
         {
             requiredPercentageOfVisibleArea = parameters->GetParametersDouble().at("RequiredPercentageOfVisibleArea");
         }
+
+        if (parameters->GetParametersBool().count("UseAngularDepthBuffer") == 1)
+        {
+            useAngularDepthBuffer = parameters->GetParametersBool().at("UseAngularDepthBuffer");
+        }
+
+        if (parameters->GetParametersDouble().count("AngularDepthBufferResolution") == 1)
+        {
+            angularDepthBufferResolution = parameters->GetParametersDouble().at("AngularDepthBufferResolution");
+        }
     }
     catch (const std::out_of_range& e)
     {
@@ -62,6 +72,8 @@ SensorGeometric2D::SensorGeometric2D(
         LOG(CbkLogLevel::Error, msg);
         throw std::runtime_error(msg);
     }
+
+    sharedSensorView = SharedSensorView::Register(agent, world, GenerateSensorViewConfiguration());
 }
 
 void SensorGeometric2D::Trigger(int time)
@@ -69,10 +81,17 @@ void SensorGeometric2D::Trigger(int time)
     sensorData = {};
     sensorData.mutable_timestamp()->set_seconds((time + latencyInMs) / 1000);
     sensorData.mutable_timestamp()->set_nanos(((time + latencyInMs) % 1000) * 1e6);
+    sharedSensorView->Update(time);
     DetectObjects();
     sensorData = ApplyLatency(time, sensorData);
 }
 
+void SensorGeometric2D::Reset(AgentInterface *agent)
+{
+    ObjectDetectorBase::Reset(agent);
+    sharedSensorView->Rebind(agent);
+}
+
 void SensorGeometric2D::UpdateInput(int, const std::shared_ptr<SignalInterface const> &, int)
 {
 }
@@ -142,22 +161,7 @@ void SensorGeometric2D::DetectObjects()
         bg::append(detectionField, point_t{0, 0});
     }
 
-    osi3::SensorViewConfiguration sensorViewConfig = GenerateSensorViewConfiguration();
-    osi3::SensorView sensorView = static_cast<OWL::Interfaces::WorldData*>(world->GetWorldData())->GetSensorView(sensorViewConfig, GetAgent()->GetId());
-
-    const auto hostVehicleIt = std::find_if(sensorView.global_ground_truth().moving_object().cbegin(),
-                                            sensorView.global_ground_truth().moving_object().cend(),
-                                            [sensorView](const osi3::MovingObject& object)
-                                            {
-                                                return object.id().value() == sensorView.host_vehicle_id().value();
-                                            });
-
-    if (hostVehicleIt == sensorView.global_ground_truth().moving_object().cend())
-    {
-        throw std::runtime_error("Host vehicle not in SensorView");
-    }
-
-    osi3::MovingObject hostVehicle = *hostVehicleIt;
+    const osi3::MovingObject& hostVehicle = sharedSensorView->GetHostVehicle();
     double yaw = hostVehicle.base().orientation().yaw();
     double yawRate = hostVehicle.base().orientation_rate().yaw();
 
@@ -175,36 +179,26 @@ void SensorGeometric2D::DetectObjects()
     point_t ownAcceleration{hostVehicle.base().acceleration().x(), hostVehicle.base().acceleration().y()};
 
     std::vector<osi3::MovingObject> movingObjectsInDetectionField;
-    for (const osi3::MovingObject& object : sensorView.global_ground_truth().moving_object())
+    for (const auto& candidate : sharedSensorView->GetMovingObjects())
     {
-        if (object.id().value() == sensorView.host_vehicle_id().value())
-        {
-            continue;
-        }
-        polygon_t objectBoundingBox = CalculateBoundingBox(object.base().dimension(), object.base().position(),
-                                                      object.base().orientation());
-
-        double distanceToObjectBoundary = bg::distance(sensorPositionGlobal, objectBoundingBox);
+        double distanceToObjectBoundary = bg::distance(sensorPositionGlobal, candidate.boundingBox);
 
         if (distanceToObjectBoundary <= detectionRange &&
-           (openingAngleH>= 2 * M_PI || bg::intersects(detectionField, objectBoundingBox)))
+           (openingAngleH>= 2 * M_PI || bg::intersects(detectionField, candidate.boundingBox)))
         {
-            movingObjectsInDetectionField.push_back(object);
+            movingObjectsInDetectionField.push_back(*candidate.object);
         }
     }
 
     std::vector<osi3::StationaryObject> stationaryObjectsInDetectionField;
-    for (const osi3::StationaryObject& object : sensorView.global_ground_truth().stationary_object())
+    for (const auto& candidate : sharedSensorView->GetStationaryObjects())
     {
-        polygon_t objectBoundingBox = CalculateBoundingBox(object.base().dimension(), object.base().position(),
-                                                      object.base().orientation());
-
-        double distanceToObjectBoundary = bg::distance(sensorPositionGlobal, objectBoundingBox);
+        double distanceToObjectBoundary = bg::distance(sensorPositionGlobal, candidate.boundingBox);
 
         if (distanceToObjectBoundary <= detectionRange &&
-           (openingAngleH>= 2 * M_PI || bg::intersects(detectionField, objectBoundingBox)))
+           (openingAngleH>= 2 * M_PI || bg::intersects(detectionField, candidate.boundingBox)))
         {
-            stationaryObjectsInDetectionField.push_back(object);
+            stationaryObjectsInDetectionField.push_back(*candidate.object);
         }
     }
 
@@ -238,68 +232,70 @@ osi3::SensorViewConfiguration SensorGeometric2D::GenerateSensorViewConfiguration
 
 void SensorGeometric2D::CalcVisualObstruction(std::vector<osi3::MovingObject> &movingObjects, std::vector<osi3::StationaryObject> &stationaryObjects, point_t sensorPositionGlobal)
 {
-    multi_polygon_t brightArea{CalcInitialBrightArea(sensorPositionGlobal)};
-    bg::correct(brightArea);
-
-    //Remove shadows from brightArea
-    for (auto &object : movingObjects)
+    std::vector<polygon_t> boundingBoxes;
+    boundingBoxes.reserve(movingObjects.size() + stationaryObjects.size());
+    for (const auto &object : movingObjects)
     {
-        polygon_t objectBoundingBoxGlobal = CalculateBoundingBox(object.base().dimension(), object.base().position(),
-                                                      object.base().orientation());
-        auto temporaryShadow = CalcObjectShadow(objectBoundingBoxGlobal, sensorPositionGlobal);
-        multi_polygon_t newBrightArea;
-        bg::difference(brightArea, temporaryShadow, newBrightArea);
-        brightArea = newBrightArea;
+        boundingBoxes.push_back(CalculateBoundingBox(object.base().dimension(), object.base().position(),
+                                                     object.base().orientation()));
     }
-    for (auto &object : stationaryObjects)
+    for (const auto &object : stationaryObjects)
     {
-        polygon_t objectBoundingBoxGlobal = CalculateBoundingBox(object.base().dimension(), object.base().position(),
-                                                      object.base().orientation());
-        auto temporaryShadow = CalcObjectShadow(objectBoundingBoxGlobal, sensorPositionGlobal);
-        multi_polygon_t newBrightArea;
-        bg::difference(brightArea, temporaryShadow, newBrightArea);
-        brightArea = newBrightArea;
+        boundingBoxes.push_back(CalculateBoundingBox(object.base().dimension(), object.base().position(),
+                                                     object.base().orientation()));
     }
 
+    const std::vector<double> visibleFractions = useAngularDepthBuffer ?
+                                                 CalcVisibleFractionsByDepthBuffer(boundingBoxes, sensorPositionGlobal) :
+                                                 CalcVisibleFractionsByShadowCasting(boundingBoxes, sensorPositionGlobal);
+
     //Remove shadowed objects
-    auto movingObjectsCopy = movingObjects;
-    auto stationaryObjectsCopy = stationaryObjects;
+    auto visibleFraction = visibleFractions.cbegin();
+    movingObjects.erase(std::remove_if(movingObjects.begin(),
+                                       movingObjects.end(),
+                                       [this, &visibleFraction](const osi3::MovingObject&)
+                                       {
+                                           return *visibleFraction++ < requiredPercentageOfVisibleArea;
+                                       }),
+                        movingObjects.end());
+    stationaryObjects.erase(std::remove_if(stationaryObjects.begin(),
+                                           stationaryObjects.end(),
+                                           [this, &visibleFraction](const osi3::StationaryObject&)
+                                           {
+                                               return *visibleFraction++ < requiredPercentageOfVisibleArea;
+                                           }),
+                            stationaryObjects.end());
+}
 
-    for (auto &object : movingObjectsCopy)
-    {
-        polygon_t objectBoundingBoxGlobal = CalculateBoundingBox(object.base().dimension(),
-                                                                 object.base().position(),
-                                                                 object.base().orientation());
+std::vector<double> SensorGeometric2D::CalcVisibleFractionsByShadowCasting(const std::vector<polygon_t> &boundingBoxes, point_t sensorPositionGlobal)
+{
+    const double direction = position.yaw + GetAgent()->GetYaw();
+    multi_polygon_t brightArea{VisualObstruction::CalcInitialBrightArea(sensorPositionGlobal, direction, openingAngleH, detectionRange)};
+    bg::correct(brightArea);
 
-        if (CalcObjectVisibilityPercentage(objectBoundingBoxGlobal, brightArea) < requiredPercentageOfVisibleArea)
-        {
-            movingObjects.erase(std::remove_if(movingObjects.begin(),
-                                               movingObjects.end(),
-                                               [object](const osi3::MovingObject& listObject)
-                                               {
-                                                  return object.id().value() == listObject.id().value();
-                                               }),
-                                movingObjects.end());
-        }
+    //Remove shadows from brightArea
+    for (const auto &boundingBox : boundingBoxes)
+    {
+        auto temporaryShadow = VisualObstruction::CalcObjectShadow(boundingBox, sensorPositionGlobal, detectionRange);
+        multi_polygon_t newBrightArea;
+        bg::difference(brightArea, temporaryShadow, newBrightArea);
+        brightArea = newBrightArea;
     }
 
-    for (auto &object : stationaryObjectsCopy)
+    std::vector<double> visibleFractions;
+    visibleFractions.reserve(boundingBoxes.size());
+    for (const auto &boundingBox : boundingBoxes)
     {
-        polygon_t objectBoundingBoxGlobal = CalculateBoundingBox(object.base().dimension(),
-                                                                 object.base().position(),
-                                                                 object.base().orientation());
-
-        if (CalcObjectVisibilityPercentage(objectBoundingBoxGlobal, brightArea) < requiredPercentageOfVisibleArea)
-        {
-            stationaryObjects.erase(std::remove_if(stationaryObjects.begin(),
-                                                   stationaryObjects.end(),
-                                                   [object](const osi3::StationaryObject& listObject)
-                                                   {
-                                                       return object.id().value() == listObject.id().value();
-                                                   }),
-                                    stationaryObjects.end());
-        }
+        visibleFractions.push_back(VisualObstruction::CalcObjectVisibilityPercentage(boundingBox, brightArea));
     }
+    return visibleFractions;
+}
+
+std::vector<double> SensorGeometric2D::CalcVisibleFractionsByDepthBuffer(const std::vector<polygon_t> &boundingBoxes, point_t sensorPositionGlobal)
+{
+    const double direction = position.yaw + GetAgent()->GetYaw();
+    AngularDepthBuffer depthBuffer(sensorPositionGlobal, direction, openingAngleH, detectionRange, angularDepthBufferResolution);
+    return depthBuffer.CalcVisibleFractions(boundingBoxes);
 }
 
 void SensorGeometric2D::AddMovingObjectToSensorData(osi3::MovingObject object, point_t ownVelocity, point_t ownAcceleration, point_t ownPosition, double yaw, double yawRate)
@@ -340,101 +336,3 @@ void SensorGeometric2D::AddStationaryObjectToSensorData(osi3::StationaryObject o
     detectedObject->mutable_base()->mutable_position()->set_y(objectReferencePointLocal.y());
     detectedObject->mutable_base()->mutable_orientation()->set_yaw(object.base().orientation().yaw() - yaw);
 }
-
-polygon_t SensorGeometric2D::CalcInitialBrightArea(point_t sensorPosition)
-{
-    const double stepSize = 0.1;
-    double sensorX = sensorPosition.x();
-    double sensorY = sensorPosition.y();
-    polygon_t brightArea;
-    bg::append(brightArea, sensorPosition);
-
-    double angle = position.yaw + GetAgent()->GetYaw() - 0.5 * openingAngleH;
-    double maxAngle = position.yaw + GetAgent()->GetYaw() + 0.5 * openingAngleH;
-
-    while (angle < maxAngle)
-    {
-        double x = sensorX + detectionRange * std::cos(angle);
-        double y = sensorY + detectionRange * std::sin(angle);
-        bg::append(brightArea, point_t{x,y});
-        angle += stepSize;
-    }
-
-    double x = sensorX + detectionRange * std::cos(maxAngle);
-    double y = sensorY + detectionRange * std::sin(maxAngle);
-    bg::append(brightArea, point_t{x,y});
-
-    bg::append(brightArea, sensorPosition);
-    return brightArea;
-}
-
-multi_polygon_t SensorGeometric2D::CalcObjectShadow(const polygon_t& boundingBox, point_t sensorPosition)
-{
-    //get an arbitrary point of the object as reference point
-    point_t referencePoint = boundingBox.outer()[0];
-    point_t referenceVector{referencePoint.x() - sensorPosition.x(), referencePoint.y() - sensorPosition.y()};
-    double referenceVectorLength = std::hypot(referenceVector.x(), referenceVector.y());
-    double normalX = -referenceVector.y();
-
-    //using this reference point, calculate the leftmost and rightmost point of the object
-    double maxLeftAngle = 0;
-    point_t leftPoint = referencePoint;
-    point_t leftVector = referenceVector; //vector from the sensor to the leftPoint
-    double maxRightAngle = 0;
-    point_t rightPoint = referencePoint;
-    point_t rightVector = referenceVector; //vector from the sensor to the rightPoint
-    for (const point_t &point : boundingBox.outer())
-    {
-        point_t vector{point.x() - sensorPosition.x(), point.y() - sensorPosition.y()};
-        double vectorLength = std::hypot(vector.x(), vector.y());
-        double scalarProduct = referenceVector.x() * vector.x() + referenceVector.y() * vector.y();
-        double angle = std::acos(scalarProduct / (referenceVectorLength * vectorLength));
-        double perpendicularFootX = sensorPosition.x() + referenceVector.x() * scalarProduct / (referenceVectorLength * referenceVectorLength);
-        double perpendicularX = point.x() - perpendicularFootX;
-        bool isLeft = (perpendicularX / normalX) > 0; //point is left, if the perpendicular points in the same direction as the normal
-        if (isLeft && (angle > maxLeftAngle))
-        {
-            maxLeftAngle = angle;
-            leftPoint = point;
-            leftVector = vector;
-        }
-        if (!isLeft && (angle > maxRightAngle))
-        {
-            maxRightAngle = angle;
-            rightPoint = point;
-            rightVector = vector;
-        }
-    }
-
-    //the outer points are obtained by stretching the leftVector and rightVector
-    double stretchFactor = 1e9;
-    point_t leftOuterPoint{sensorPosition.x() + stretchFactor * leftVector.x(), sensorPosition.y() + stretchFactor * leftVector.y()};
-    point_t rightOuterPoint{sensorPosition.x() + stretchFactor * rightVector.x(), sensorPosition.y() + stretchFactor * rightVector.y()};
-
-    //build the shadow polygon
-    polygon_t shadow;
-    bg::append (shadow, leftPoint);
-    bg::append (shadow, leftOuterPoint);
-    bg::append (shadow, rightOuterPoint);
-    bg::append (shadow, rightPoint);
-    bg::append (shadow, leftPoint);
-
-    //remove the object boundingBox from its own shadow
-    multi_polygon_t shadowM;
-    polygon_t tmpBBox = boundingBox;
-    bg::correct(tmpBBox);
-    bg::difference (shadow, tmpBBox, shadowM);
-
-    return shadowM;
-}
-
-double SensorGeometric2D::CalcObjectVisibilityPercentage(const polygon_t &boundingBox, multi_polygon_t &brightArea)
-{
-    polygon_t tmpBBox = boundingBox;
-    bg::correct(tmpBBox);
-    double totalArea = bg::area(tmpBBox);
-    multi_polygon_t visibleBoundingBox;
-    bg::intersection(tmpBBox, brightArea, visibleBoundingBox);
-    double visibleArea = bg::area(visibleBoundingBox);
-    return visibleArea / totalArea;
-}
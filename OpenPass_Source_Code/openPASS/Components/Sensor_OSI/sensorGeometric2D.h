@@ -17,6 +17,7 @@
 #pragma once
 
 #include "objectDetectorBase.h"
+#include "sharedSensorView.h"
 #include "osi/osi_sensorview.pb.h"
 #include "osi/osi_sensordata.pb.h"
 
@@ -61,9 +62,17 @@ public:
     void UpdateInput(int, const std::shared_ptr<SignalInterface const> &, int);
     void Trigger(int time);
 
+    /**
+     * \brief Resets the sensor and moves its shared SensorView to the agent
+     *
+     * \param[in]     agent          Agent embedding this component from now on
+     */
+    void Reset(AgentInterface *agent) override;
+
     /**
      * \brief Calculate which objects are inside the detection field
      *
+     * The candidates are taken from the SensorView shared by all sensors of the agent, which has to be updated before.
      * For further explanation of the calculation see the [documentation](\ref dev_agent_modules_geometric2d)
     */
     void DetectObjects();
@@ -93,29 +102,23 @@ private:
     void CalcVisualObstruction(std::vector<osi3::MovingObject> &movingObjects, std::vector<osi3::StationaryObject> &stationaryObjects, point_t sensorPositionGlobal);
 
     /**
-     * Calculate the polygon to approximate the detection area
+     * Calculate the visible fraction of each object using shadow-casting
      *
-     * \returns bright area polygon
+     * \param boundingBoxes         bounding boxes of all objects in the detection field
+     * \param sensorPositionGlobal  sensor postion in global coordinates
+     * \returns visible fraction of the area of each object
     */
-    polygon_t CalcInitialBrightArea(point_t sensorPosition);
+    std::vector<double> CalcVisibleFractionsByShadowCasting(const std::vector<polygon_t> &boundingBoxes, point_t sensorPositionGlobal);
 
     /**
-     * Calculate the shadow drawn by an object with the sensorPosition as light source
+     * Calculate the visible fraction of each object using an angular depth buffer
      *
-     * \param boundingBox  boundingBox of the objects which draws the shadow
-     * \param sensorPosition Position of the sensor (light source)
-     * \returns shadow polygon
+     * \param boundingBoxes         bounding boxes of all objects in the detection field
+     * \param sensorPositionGlobal  sensor postion in global coordinates
+     * \returns visible fraction of the angular extent of each object
     */
-    multi_polygon_t CalcObjectShadow(const polygon_t& boundingBox, point_t sensorPosition);
+    std::vector<double> CalcVisibleFractionsByDepthBuffer(const std::vector<polygon_t> &boundingBoxes, point_t sensorPositionGlobal);
 
-    /**
-     * Calculate how many percent of an object are inside the bright area
-     * \param boundingBox boundingBox of the object
-     * \param brightArea
-     * \returns percentage of the visible area of the object
-     */
-    double CalcObjectVisibilityPercentage(const polygon_t& boundingBox, multi_polygon_t& brightArea);
-    
     /*!
      * \brief Adds the information of a detected moving object as DetectedMovingObject to the sensor data
      *
@@ -157,7 +160,11 @@ private:
      */
     polygon_t CreateFivePointDetectionField();
 
+    std::shared_ptr<SharedSensorView> sharedSensorView;
+
     bool enableVisualObstruction = false;
+    bool useAngularDepthBuffer = false;
+    double angularDepthBufferResolution = 0.001;
     double requiredPercentageOfVisibleArea = 0.001;
     double detectionRange;
     double openingAngleH;
@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** \brief sharedSensorView.cpp */
+//-----------------------------------------------------------------------------
+
+#include "sharedSensorView.h"
+
+#include <stdexcept>
+#include "CoreModules/World_OSI/WorldData.h"
+
+std::map<const AgentInterface*, std::weak_ptr<SharedSensorView>> SharedSensorView::sharedSensorViews;
+
+SharedSensorView::SharedSensorView(AgentInterface* agent, WorldInterface* world) :
+    agent(agent),
+    agentId(agent->GetId()),
+    world(world)
+{
+}
+
+std::shared_ptr<SharedSensorView> SharedSensorView::Register(AgentInterface* agent, WorldInterface* world, const osi3::SensorViewConfiguration& conf)
+{
+    for (auto iter = sharedSensorViews.begin(); iter != sharedSensorViews.end();)
+    {
+        iter = iter->second.expired() ? sharedSensorViews.erase(iter) : std::next(iter);
+    }
+
+    auto sharedSensorView = sharedSensorViews[agent].lock();
+    if (!sharedSensorView || !sharedSensorView->isRegistrationOpen || sharedSensorView->agentId != agent->GetId())
+    {
+        sharedSensorView.reset(new SharedSensorView(agent, world));
+        sharedSensorViews[agent] = sharedSensorView;
+    }
+
+    sharedSensorView->configurations.push_back(conf);
+    sharedSensorView->updateTime = std::numeric_limits<int>::min();
+
+    return sharedSensorView;
+}
+
+void SharedSensorView::Rebind(AgentInterface* agent)
+{
+    const auto entry = sharedSensorViews.find(this->agent);
+    if (entry != sharedSensorViews.end() && entry->second.lock().get() == this)
+    {
+        sharedSensorViews.erase(entry);
+    }
+
+    this->agent = agent;
+    agentId = agent->GetId();
+    isRegistrationOpen = false;
+
+    updateTime = std::numeric_limits<int>::min();
+    sensorView.Clear();
+    hostVehicle = nullptr;
+    movingObjects.clear();
+    stationaryObjects.clear();
+}
+
+void SharedSensorView::Update(int time)
+{
+    if (time == updateTime)
+    {
+        return;
+    }
+
+    isRegistrationOpen = false;
+    sensorView = static_cast<OWL::Interfaces::WorldData*>(world->GetWorldData())->GetSensorView(configurations, agent->GetId());
+
+    hostVehicle = nullptr;
+    movingObjects.clear();
+    stationaryObjects.clear();
+
+    for (const osi3::MovingObject& object : sensorView.global_ground_truth().moving_object())
+    {
+        if (object.id().value() == sensorView.host_vehicle_id().value())
+        {
+            hostVehicle = &object;
+            continue;
+        }
+
+        movingObjects.push_back({&object, CalculateBoundingBox(object.base().dimension(),
+                                                               object.base().position(),
+                                                               object.base().orientation())});
+    }
+
+    if (hostVehicle == nullptr)
+    {
+        throw std::runtime_error("Host vehicle not in SensorView");
+    }
+
+    for (const osi3::StationaryObject& object : sensorView.global_ground_truth().stationary_object())
+    {
+        stationaryObjects.push_back({&object, CalculateBoundingBox(object.base().dimension(),
+                                                                   object.base().position(),
+                                                                   object.base().orientation())});
+    }
+
+    updateTime = time;
+}
+
+const osi3::MovingObject& SharedSensorView::GetHostVehicle() const
+{
+    return *hostVehicle;
+}
+
+const SharedSensorView::MovingCandidates& SharedSensorView::GetMovingObjects() const
+{
+    return movingObjects;
+}
+
+const SharedSensorView::StationaryCandidates& SharedSensorView::GetStationaryObjects() const
+{
+    return stationaryObjects;
+}
+
+polygon_t SharedSensorView::CalculateBoundingBox(const osi3::Dimension3d& dimension, const osi3::Vector3d& position, const osi3::Orientation3d& orientation)
+{
+    double halfLength = dimension.length() / 2.0;
+    double halfWidth = dimension.width() / 2.0;
+    double rotation = orientation.yaw();
+
+    double x = position.x();
+    double y = position.y();
+
+    point_t boxPoints[]
+    {
+        {-halfLength, -halfWidth},
+        {-halfLength,  halfWidth},
+        {halfLength,  halfWidth},
+        {halfLength, -halfWidth},
+        {-halfLength, -halfWidth}
+    };
+
+    polygon_t box;
+    polygon_t boxTemp;
+    bg::append(box, boxPoints);
+
+    bt::translate_transformer<double, 2, 2> translate(x, y);
+
+    // rotation in mathematical negativ order (boost) -> invert to match
+    bt::rotate_transformer<bg::radian, double, 2, 2> rotate(-rotation);
+
+    bg::transform(box, boxTemp, rotate);
+    bg::transform(boxTemp, box, translate);
+    bg::correct(box);
+
+    return box;
+}
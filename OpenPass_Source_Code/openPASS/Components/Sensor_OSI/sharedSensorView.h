@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** \file  sharedSensorView.h
+*	\brief This file contains the SensorView shared by all sensors of an agent
+*/
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "boostGeometryCommon.h"
+#include "Interfaces/agentInterface.h"
+#include "Interfaces/worldInterface.h"
+
+#include "osi/osi_sensorview.pb.h"
+#include "osi/osi_sensorviewconfiguration.pb.h"
+
+//-----------------------------------------------------------------------------
+/** \brief SensorView shared by all sensors of an agent
+*
+*   Each sensor registers its SensorViewConfiguration. The first sensor triggered at a
+*   time step requests one SensorView for the union of all registered fields of view
+*   and calculates the bounding boxes of the contained objects. All sensors of the agent
+*   then filter their detection field from these candidates instead of requesting a
+*   SensorView each.
+*
+* 	\ingroup SensorObjectDetector
+*/
+//-----------------------------------------------------------------------------
+class SharedSensorView
+{
+public:
+    //! Object of the SensorView together with its bounding box in global coordinates
+    template <typename T>
+    struct Candidate
+    {
+        const T* object;
+        polygon_t boundingBox;
+    };
+
+    using MovingCandidates = std::vector<Candidate<osi3::MovingObject>>;
+    using StationaryCandidates = std::vector<Candidate<osi3::StationaryObject>>;
+
+    /*!
+     * \brief Adds a sensor to the SensorView of its agent
+     *
+     * \param agent     agent carrying the sensor
+     * \param world     world providing the SensorView
+     * \param conf      SensorViewConfiguration of the sensor
+     * \return SensorView shared with the other sensors of the agent
+     */
+    static std::shared_ptr<SharedSensorView> Register(AgentInterface* agent, WorldInterface* world, const osi3::SensorViewConfiguration& conf);
+
+    /*!
+     * \brief Moves the SensorView to another agent, when its sensors are reused for that agent
+     *
+     * The registered configurations are kept, as the reused agent has the same sensors.
+     *
+     * \param agent     agent carrying the sensors from now on
+     */
+    void Rebind(AgentInterface* agent);
+
+    /*!
+     * \brief Requests the SensorView from the world, if it was not yet requested at this time
+     *
+     * \param time  current scheduling time
+     */
+    void Update(int time);
+
+    //! Returns the host vehicle as contained in the SensorView
+    const osi3::MovingObject& GetHostVehicle() const;
+
+    //! Returns all moving objects of the SensorView except the host vehicle
+    const MovingCandidates& GetMovingObjects() const;
+
+    //! Returns all stationary objects of the SensorView
+    const StationaryCandidates& GetStationaryObjects() const;
+
+    /*!
+     * \brief Calculates the bounding box of an object from the osi information
+     *
+     * \param dimension     osi dimension
+     * \param position      osi position
+     * \param orientation   osi orientation
+     * \return bounding box of object
+     */
+    static polygon_t CalculateBoundingBox(const osi3::Dimension3d& dimension, const osi3::Vector3d& position, const osi3::Orientation3d& orientation);
+
+private:
+    SharedSensorView(AgentInterface* agent, WorldInterface* world);
+
+    AgentInterface* agent;
+    int agentId;
+    WorldInterface* world;
+    std::vector<osi3::SensorViewConfiguration> configurations;
+
+    //! Sensors can only join the view until it is updated first, afterwards the address of its agent may be taken by another agent
+    bool isRegistrationOpen {true};
+
+    int updateTime {std::numeric_limits<int>::min()};
+    osi3::SensorView sensorView;
+    const osi3::MovingObject* hostVehicle {nullptr};
+    MovingCandidates movingObjects;
+    StationaryCandidates stationaryObjects;
+
+    //! SensorViews of all agents, the slave runs the sensors of all agents in one thread
+    static std::map<const AgentInterface*, std::weak_ptr<SharedSensorView>> sharedSensorViews;
+};
@@ -0,0 +1,339 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** \brief visualObstruction.cpp */
+//-----------------------------------------------------------------------------
+
+#include "visualObstruction.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace VisualObstruction {
+
+polygon_t CalcInitialBrightArea(point_t sensorPosition, double direction, double openingAngle, double range)
+{
+    const double stepSize = 0.1;
+    double sensorX = sensorPosition.x();
+    double sensorY = sensorPosition.y();
+    polygon_t brightArea;
+    bg::append(brightArea, sensorPosition);
+
+    double angle = direction - 0.5 * openingAngle;
+    double maxAngle = direction + 0.5 * openingAngle;
+
+    while (angle < maxAngle)
+    {
+        double x = sensorX + range * std::cos(angle);
+        double y = sensorY + range * std::sin(angle);
+        bg::append(brightArea, point_t{x,y});
+        angle += stepSize;
+    }
+
+    double x = sensorX + range * std::cos(maxAngle);
+    double y = sensorY + range * std::sin(maxAngle);
+    bg::append(brightArea, point_t{x,y});
+
+    bg::append(brightArea, sensorPosition);
+    return brightArea;
+}
+
+multi_polygon_t CalcObjectShadow(const polygon_t& boundingBox, point_t sensorPosition, double range)
+{
+    //get an arbitrary point of the object as reference point
+    point_t referencePoint = boundingBox.outer()[0];
+    point_t referenceVector{referencePoint.x() - sensorPosition.x(), referencePoint.y() - sensorPosition.y()};
+    double referenceVectorLength = std::hypot(referenceVector.x(), referenceVector.y());
+    double normalX = -referenceVector.y();
+
+    //using this reference point, calculate the leftmost and rightmost point of the object
+    double maxLeftAngle = 0;
+    point_t leftPoint = referencePoint;
+    point_t leftVector = referenceVector; //vector from the sensor to the leftPoint
+    double maxRightAngle = 0;
+    point_t rightPoint = referencePoint;
+    point_t rightVector = referenceVector; //vector from the sensor to the rightPoint
+    for (const point_t &point : boundingBox.outer())
+    {
+        point_t vector{point.x() - sensorPosition.x(), point.y() - sensorPosition.y()};
+        double vectorLength = std::hypot(vector.x(), vector.y());
+        double scalarProduct = referenceVector.x() * vector.x() + referenceVector.y() * vector.y();
+        double angle = std::acos(scalarProduct / (referenceVectorLength * vectorLength));
+        double perpendicularFootX = sensorPosition.x() + referenceVector.x() * scalarProduct / (referenceVectorLength * referenceVectorLength);
+        double perpendicularX = point.x() - perpendicularFootX;
+        bool isLeft = (perpendicularX / normalX) > 0; //point is left, if the perpendicular points in the same direction as the normal
+        if (isLeft && (angle > maxLeftAngle))
+        {
+            maxLeftAngle = angle;
+            leftPoint = point;
+            leftVector = vector;
+        }
+        if (!isLeft && (angle > maxRightAngle))
+        {
+            maxRightAngle = angle;
+            rightPoint = point;
+            rightVector = vector;
+        }
+    }
+
+    //the outer points are obtained by stretching the leftVector and rightVector well beyond the detection range
+    //the stretch is limited, since the set operations on the bright area lose precision for huge coordinates
+    double leftStretchFactor = std::max(1.0, 10.0 * range / std::hypot(leftVector.x(), leftVector.y()));
+    double rightStretchFactor = std::max(1.0, 10.0 * range / std::hypot(rightVector.x(), rightVector.y()));
+    point_t leftOuterPoint{sensorPosition.x() + leftStretchFactor * leftVector.x(), sensorPosition.y() + leftStretchFactor * leftVector.y()};
+    point_t rightOuterPoint{sensorPosition.x() + rightStretchFactor * rightVector.x(), sensorPosition.y() + rightStretchFactor * rightVector.y()};
+
+    //build the shadow polygon
+    polygon_t shadow;
+    bg::append (shadow, leftPoint);
+    bg::append (shadow, leftOuterPoint);
+    bg::append (shadow, rightOuterPoint);
+    bg::append (shadow, rightPoint);
+    bg::append (shadow, leftPoint);
+
+    //remove the object boundingBox from its own shadow
+    multi_polygon_t shadowM;
+    polygon_t tmpBBox = boundingBox;
+    bg::correct(tmpBBox);
+    bg::difference (shadow, tmpBBox, shadowM);
+
+    return shadowM;
+}
+
+double CalcObjectVisibilityPercentage(const polygon_t &boundingBox, const multi_polygon_t &brightArea)
+{
+    polygon_t tmpBBox = boundingBox;
+    bg::correct(tmpBBox);
+    double totalArea = bg::area(tmpBBox);
+    multi_polygon_t visibleBoundingBox;
+    bg::intersection(tmpBBox, brightArea, visibleBoundingBox);
+    double visibleArea = bg::area(visibleBoundingBox);
+    return visibleArea / totalArea;
+}
+
+} // namespace VisualObstruction
+
+namespace {
+
+constexpr double TWO_PI = 2.0 * PI;
+
+double Cross(double ax, double ay, double bx, double by)
+{
+    return ax * by - ay * bx;
+}
+
+} // namespace
+
+AngularDepthBuffer::AngularDepthBuffer(point_t sensorPosition, double direction, double openingAngle, double range, double resolution) :
+    sensorPosition(sensorPosition),
+    openingAngle(std::min(openingAngle, TWO_PI)),
+    range(range)
+{
+    const size_t cellCount = std::max<size_t>(1, static_cast<size_t>(std::ceil(this->openingAngle / resolution)));
+    cellWidth = this->openingAngle / cellCount;
+    startAngle = direction - 0.5 * this->openingAngle;
+
+    cellDirections.reserve(cellCount);
+    for (size_t cell = 0; cell < cellCount; ++cell)
+    {
+        const double angle = startAngle + (cell + 0.5) * cellWidth;
+        cellDirections.emplace_back(std::cos(angle), std::sin(angle));
+    }
+}
+
+std::vector<double> AngularDepthBuffer::CalcVisibleFractions(const std::vector<polygon_t>& boundingBoxes)
+{
+    std::vector<Extent> extents;
+    extents.reserve(boundingBoxes.size());
+    for (const auto& boundingBox : boundingBoxes)
+    {
+        extents.push_back(CalcExtent(boundingBox));
+    }
+
+    std::vector<size_t> order(boundingBoxes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&extents](size_t lhs, size_t rhs)
+    {
+        return extents[lhs].distance < extents[rhs].distance;
+    });
+
+    depth.assign(cellDirections.size(), std::numeric_limits<double>::infinity());
+    hits.clear();
+
+    //rasterize from near to far, cells already covered by a nearer object need no ray
+    std::vector<size_t> hitOffsets(boundingBoxes.size());
+    for (size_t index : order)
+    {
+        const Extent& extent = extents[index];
+        hitOffsets[index] = hits.size();
+
+        if (extent.containsSensor)
+        {
+            continue;
+        }
+
+        for (size_t rangeIndex = 0; rangeIndex < extent.rangeCount; ++rangeIndex)
+        {
+            for (size_t cell = extent.ranges[rangeIndex].first; cell < extent.ranges[rangeIndex].end; ++cell)
+            {
+                double distance = std::numeric_limits<double>::infinity();
+                if (depth[cell] >= extent.distance)
+                {
+                    distance = CastRay(boundingBoxes[index], cell);
+                    depth[cell] = std::min(depth[cell], distance);
+                }
+                hits.push_back(distance);
+            }
+        }
+    }
+
+    //an object is visible in a cell, if no other object is nearer
+    std::vector<double> visibleFractions(boundingBoxes.size(), 1.0);
+    for (size_t index = 0; index < boundingBoxes.size(); ++index)
+    {
+        const Extent& extent = extents[index];
+
+        if (extent.containsSensor)
+        {
+            continue;
+        }
+
+        const double totalCells = std::floor(extent.upperAngle / cellWidth - 0.5) - std::ceil(extent.lowerAngle / cellWidth - 0.5) + 1.0;
+        if (totalCells < 1.0)
+        {
+            visibleFractions[index] = CalcNarrowObjectVisibility(extent);
+            continue;
+        }
+
+        size_t visibleCells = 0;
+        const double* hit = hits.data() + hitOffsets[index];
+        for (size_t rangeIndex = 0; rangeIndex < extent.rangeCount; ++rangeIndex)
+        {
+            for (size_t cell = extent.ranges[rangeIndex].first; cell < extent.ranges[rangeIndex].end; ++cell, ++hit)
+            {
+                if (*hit <= depth[cell] && *hit <= range)
+                {
+                    ++visibleCells;
+                }
+            }
+        }
+
+        visibleFractions[index] = std::min(1.0, visibleCells / totalCells);
+    }
+
+    return visibleFractions;
+}
+
+AngularDepthBuffer::Extent AngularDepthBuffer::CalcExtent(const polygon_t& boundingBox) const
+{
+    Extent extent{};
+    extent.distance = bg::distance(sensorPosition, boundingBox);
+    extent.containsSensor = extent.distance <= 0.0;
+
+    if (extent.containsSensor)
+    {
+        return extent;
+    }
+
+    //angles of the corners relative to the first corner, the extent of a convex object not containing the sensor is below pi
+    const auto& corners = boundingBox.outer();
+    const double referenceAngle = std::atan2(corners.front().y() - sensorPosition.y(), corners.front().x() - sensorPosition.x());
+    double minDelta = 0.0;
+    double maxDelta = 0.0;
+    for (const point_t& corner : corners)
+    {
+        const double angle = std::atan2(corner.y() - sensorPosition.y(), corner.x() - sensorPosition.x());
+        const double delta = std::remainder(angle - referenceAngle, TWO_PI);
+        minDelta = std::min(minDelta, delta);
+        maxDelta = std::max(maxDelta, delta);
+    }
+
+    double relativeAngle = std::fmod(referenceAngle - startAngle, TWO_PI);
+    if (relativeAngle < 0.0)
+    {
+        relativeAngle += TWO_PI;
+    }
+    extent.lowerAngle = relativeAngle + minDelta;
+    extent.upperAngle = relativeAngle + maxDelta;
+
+    //the extent may overlap the field of view shifted by a full turn on either side
+    const double cellCount = static_cast<double>(cellDirections.size());
+    for (double shift : {-TWO_PI, 0.0, TWO_PI})
+    {
+        const double lower = extent.lowerAngle + shift;
+        const double upper = extent.upperAngle + shift;
+        if (upper < 0.0 || lower > openingAngle)
+        {
+            continue;
+        }
+
+        const double firstCell = std::max(0.0, std::ceil(lower / cellWidth - 0.5));
+        const double lastCell = std::min(cellCount - 1.0, std::floor(upper / cellWidth - 0.5));
+        if (firstCell <= lastCell)
+        {
+            extent.ranges[extent.rangeCount++] = {static_cast<size_t>(firstCell), static_cast<size_t>(lastCell) + 1};
+        }
+    }
+
+    return extent;
+}
+
+double AngularDepthBuffer::CastRay(const polygon_t& boundingBox, size_t cell) const
+{
+    const point_t& rayDirection = cellDirections[cell];
+    const auto& corners = boundingBox.outer();
+    double distance = std::numeric_limits<double>::infinity();
+
+    for (size_t corner = 0; corner < corners.size(); ++corner)
+    {
+        const point_t& start = corners[corner];
+        const point_t& end = corners[(corner + 1) % corners.size()];
+
+        const double edgeX = end.x() - start.x();
+        const double edgeY = end.y() - start.y();
+        const double denominator = Cross(rayDirection.x(), rayDirection.y(), edgeX, edgeY);
+        if (denominator == 0.0)
+        {
+            continue;
+        }
+
+        const double offsetX = start.x() - sensorPosition.x();
+        const double offsetY = start.y() - sensorPosition.y();
+        const double rayParameter = Cross(offsetX, offsetY, edgeX, edgeY) / denominator;
+        const double edgeParameter = Cross(offsetX, offsetY, rayDirection.x(), rayDirection.y()) / denominator;
+
+        if (rayParameter >= 0.0 && edgeParameter >= 0.0 && edgeParameter <= 1.0)
+        {
+            distance = std::min(distance, rayParameter);
+        }
+    }
+
+    return distance;
+}
+
+double AngularDepthBuffer::CalcNarrowObjectVisibility(const Extent& extent) const
+{
+    //the object lies between two cell centers, it is visible unless the nearest cell is covered by a nearer object
+    double centerAngle = std::fmod(0.5 * (extent.lowerAngle + extent.upperAngle), TWO_PI);
+    if (centerAngle < 0.0)
+    {
+        centerAngle += TWO_PI;
+    }
+    if (centerAngle > openingAngle)
+    {
+        return 0.0;
+    }
+
+    const size_t cell = std::min(cellDirections.size() - 1, static_cast<size_t>(centerAngle / cellWidth));
+    return depth[cell] >= extent.distance ? 1.0 : 0.0;
+}
@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** \file  visualObstruction.h
+*	\brief This file contains the algorithms calculating the visual obstruction of objects
+*
+*   Two algorithms are available: shadow-casting subtracts the shadow polygon of every object
+*   from the bright area of the sensor, the angular depth buffer rasterizes the objects into
+*   angular cells around the sensor. See the [documentation](\ref dev_agent_modules_geometric2d_obstruction).
+*/
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include "boostGeometryCommon.h"
+
+namespace VisualObstruction {
+
+/**
+ * Calculate the polygon to approximate the detection area
+ *
+ * \param sensorPosition    position of the sensor in global coordinates
+ * \param direction         global direction of the center of the field of view
+ * \param openingAngle      opening angle of the field of view
+ * \param range             detection range
+ * \returns bright area polygon
+*/
+polygon_t CalcInitialBrightArea(point_t sensorPosition, double direction, double openingAngle, double range);
+
+/**
+ * Calculate the shadow drawn by an object with the sensorPosition as light source
+ *
+ * \param boundingBox  boundingBox of the objects which draws the shadow
+ * \param sensorPosition Position of the sensor (light source)
+ * \param range detection range, the shadow reaches beyond it
+ * \returns shadow polygon
+*/
+multi_polygon_t CalcObjectShadow(const polygon_t& boundingBox, point_t sensorPosition, double range);
+
+/**
+ * Calculate how many percent of an object are inside the bright area
+ * \param boundingBox boundingBox of the object
+ * \param brightArea
+ * \returns percentage of the visible area of the object
+ */
+double CalcObjectVisibilityPercentage(const polygon_t& boundingBox, const multi_polygon_t& brightArea);
+
+} // namespace VisualObstruction
+
+//-----------------------------------------------------------------------------
+/** \brief One dimensional depth buffer over the field of view of a sensor
+*
+*   The field of view is divided into angular cells. Each cell stores the distance to the
+*   nearest object hit by the ray through the center of the cell. An object is visible in
+*   a cell, if it is the nearest object of this cell and within the detection range.
+*   The visible fraction of an object is the share of its angular extent that is visible.
+*
+*   Objects are rasterized in order of their distance to the sensor, so that cells already
+*   covered by a nearer object are skipped without casting a ray.
+*
+* 	\ingroup SensorObjectDetector
+*/
+//-----------------------------------------------------------------------------
+class AngularDepthBuffer
+{
+public:
+    /*!
+     * \param sensorPosition    position of the sensor in global coordinates
+     * \param direction         global direction of the center of the field of view
+     * \param openingAngle      opening angle of the field of view (at most 2 pi)
+     * \param range             detection range
+     * \param resolution        angular width of a cell
+     */
+    AngularDepthBuffer(point_t sensorPosition, double direction, double openingAngle, double range, double resolution);
+
+    /*!
+     * \brief Calculates the visible fraction of each object
+     *
+     * Every object also occludes the others.
+     *
+     * \param boundingBoxes     convex bounding boxes of the objects in global coordinates
+     * \return visible fraction of each object in the order of the bounding boxes
+     */
+    std::vector<double> CalcVisibleFractions(const std::vector<polygon_t>& boundingBoxes);
+
+private:
+    //! Cells [first, end) covered by an object
+    struct CellRange
+    {
+        size_t first;
+        size_t end;
+    };
+
+    //! Angular extent of an object relative to the start of the field of view
+    struct Extent
+    {
+        double lowerAngle;
+        double upperAngle;
+        double distance;            //!< minimal distance of the object to the sensor
+        bool containsSensor;
+        size_t rangeCount;
+        CellRange ranges[3];        //!< covered cells, the extent may wrap around the field of view
+    };
+
+    Extent CalcExtent(const polygon_t& boundingBox) const;
+
+    //! Returns the distance along the center ray of a cell to the object, infinity if it is not hit
+    double CastRay(const polygon_t& boundingBox, size_t cell) const;
+
+    //! Visible fraction of an object too narrow to contain a cell center
+    double CalcNarrowObjectVisibility(const Extent& extent) const;
+
+    point_t sensorPosition;
+    double startAngle;
+    double openingAngle;
+    double range;
+    double cellWidth;
+
+    std::vector<point_t> cellDirections;    //!< unit vector through the center of each cell
+    std::vector<double> depth;              //!< distance to the nearest object of each cell
+    std::vector<double> hits;               //!< distance of each object in each of its cells
+};
@@ -15,6 +15,8 @@
 //-----------------------------------------------------------------------------
 
 #include <memory>
+#include <istream>
+#include <ostream>
 #include <qglobal.h>
 #include "sensor_recordStateImplementation.h"
 
@@ -64,6 +66,25 @@ SensorRecordStateImplementation::SensorRecordStateImplementation(
 
 }
 
+void SensorRecordStateImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    agentId = GetAgent()->GetId();
+    timeMSec = 0;
+    indexLaneEgo = 0;
+}
+
+void SensorRecordStateImplementation::SaveState(std::ostream &state) const
+{
+    state << timeMSec << ' ' << indexLaneEgo << ' ';
+}
+
+void SensorRecordStateImplementation::RestoreState(std::istream &state)
+{
+    state >> timeMSec >> indexLaneEgo;
+}
+
 void SensorRecordStateImplementation::UpdateInput(int, const std::shared_ptr<SignalInterface const> &, int)
 {
 }
@@ -112,6 +112,13 @@ void SignalPrioritizerImplementation::UpdateOutput(int localLinkId, Signal &sign
     }
 }
 
+void SignalPrioritizerImplementation::Reset(AgentInterface *agent)
+{
+    SetAgent(agent);
+
+    holdSignals.clear();
+}
+
 std::shared_ptr<SignalInterface const> SignalPrioritizerImplementation::GetSignalWithHighestPriority() const
 {
     Signal signalWithHighestPriority = nullptr;
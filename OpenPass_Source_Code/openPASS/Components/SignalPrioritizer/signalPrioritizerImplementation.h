@@ -80,6 +80,24 @@ public:
 
     void Trigger(int) override {}
 
+    //! The held signals are not saved, as all senders are scheduled before the prioritizer and send them again
+    bool SupportsCheckpoint() const override
+    {
+        return true;
+    }
+
+    /*!
+    * \brief Resets the component, so that it can be reused for another agent of the same agent type
+    *
+    * @param[in]     agent          Agent embedding this component from now on
+    */
+    void Reset(AgentInterface *agent) override;
+
+    bool SupportsReset() const override
+    {
+        return true;
+    }
+
 private:
     /*!
     * \brief Translates the string/int parameter representation to the internally used representation of priorities
@@ -38,53 +38,40 @@ inline double limitValue(double value, double min, double max)
     return value < min ? min : (value < max ? value : max);
 }
 
-//! Function calculating the all distances between consecutive way points
-//!
-//! @return                         vector of distances
-vector<double> TrajectoryFollowingControl::computeDistancesBetweenConsecutiveWayPoints()
+//! Function precomputing the arc length of the way points
+void TrajectoryFollowingControl::updatePath()
 {
-    if (numWayPoints_ <= 1)
-    {
-        return vector<double>(0);
-    }
-    vector<double> distances(numWayPoints_ - 1);
-    Common::Vector2d u;
-    for (int i = 0; i < numWayPoints_ - 1; ++i)
+    vector<Common::Vector2d> positions(numWayPoints_);
+    vector<double> times(numWayPoints_);
+    for (size_t i = 0; i < numWayPoints_; ++i)
     {
-        u = waypoints_[i + 1].position - waypoints_[i].position;
-        distances[i] = u.Length();
+        positions[i] = waypoints_[i].position;
+        times[i] = waypoints_[i].time;
     }
-    return distances;
+    path_ = Common::TrajectoryPath(positions, times);
 }
 
 //! Function calculating how many indices the look ahead time corresponds to
 //!
 //! @param[in]     totalDistance        distance that is looked ahead (v*t)
-//! @param[in]     distances            vector of distances between consecutive way points
 //! @param[in]     fromWayPointIndex    index of the 'starting' waypoint
 //! @return                             index surplus
 int TrajectoryFollowingControl::computeNumberOfLookaheadPoints(double totalDistance,
-                                                               const vector<double> &distances,
                                                                int fromWayPointIndex)
 {
-    size_t n = distances.size();
     if (totalDistance <= 0)
     {
         return 1;
     }
-    if (n <= fromWayPointIndex)
+    if (numWayPoints_ <= static_cast<size_t>(fromWayPointIndex) + 1)
     {
         return 0;
     }
 
-    int count = 1;
-    int i = fromWayPointIndex;
-    while (totalDistance > 0 && i < n)
-    {
-        totalDistance -= distances[i++];
-        count++;
-    }
-    return count;
+    //first way point at least totalDistance ahead, or the last one
+    size_t lookAheadIndex = path_.FindIndexAtDistance(path_.GetDistance(fromWayPointIndex) + totalDistance,
+                                                      fromWayPointIndex);
+    return 1 + static_cast<int>(lookAheadIndex) - fromWayPointIndex;
 }
 
 //! Function calculating the index of the waypoint ahead that should be targeted at
@@ -104,9 +91,10 @@ int TrajectoryFollowingControl::findClosestWayPointAheadIndex(Common::Vector2d &
     }
     double dist, mindist;
     int index = fromIndex;
-    Common::Vector2d u = waypoints_[index].position - position;
+    const Common::Vector2d &first = path_.GetPoint(index);
 
-    mindist = u.Length();
+    //squared distances suffice for the comparison
+    mindist = (first.x - position.x) * (first.x - position.x) + (first.y - position.y) * (first.y - position.y);
     int currentIndex = index;
     size_t d = numWayPoints_ - 1 - index;
     if (d < numPointsLookAhead)
@@ -117,8 +105,8 @@ int TrajectoryFollowingControl::findClosestWayPointAheadIndex(Common::Vector2d &
     for (int i = 0; i < numPointsLookAhead; ++i)
     {
         currentIndex = currentIndex + 1;
-        u = waypoints_[currentIndex].position - position;
-        dist = u.Length();
+        const Common::Vector2d &point = path_.GetPoint(currentIndex);
+        dist = (point.x - position.x) * (point.x - position.x) + (point.y - position.y) * (point.y - position.y);
 
         if (dist < mindist)
         {
@@ -222,9 +210,6 @@ TrajectoryFollowingControl::TrajectoryFollowingControl(std::vector<WaypointData>
 {
     setWaypoints(waypoints);
 
-    distancesBetweenConsecutiveWayPoints = computeDistancesBetweenConsecutiveWayPoints();
-    currentWayPointIndex_ = 0;
-
     //initialize the lowpass filter with duplicates of the initial value
     for (int i = 0; i < filterWindowSize; ++i)
     {
@@ -312,7 +297,6 @@ double TrajectoryFollowingControl::lateralControl()
     {
         //could be set to numWaypoints_ to use maximum forward look distance (computation time tradeoff)
         int numLookAheadPoints = computeNumberOfLookaheadPoints(arcLength,
-                                                                distancesBetweenConsecutiveWayPoints,
                                                                 previousWayPointIndex_);
 
         nextWayPointIndex = findClosestWayPointAheadIndex(PredictedPosition,
@@ -478,7 +462,7 @@ bool TrajectoryFollowingControl::setWaypoints(std::vector<WaypointData> &Waypoin
 
     waypoints_ = Waypoints;
     numWayPoints_ = waypoints_.size();
-    distancesBetweenConsecutiveWayPoints = computeDistancesBetweenConsecutiveWayPoints();
+    updatePath();
     previousWayPointIndex_ = 0;
     currentWayPointIndex_ = 0;
     return true;
@@ -510,6 +494,7 @@ bool TrajectoryFollowingControl::setWaypoints(std::vector<double> &X,
     }
 
     numWayPoints_ = n;
+    updatePath();
     previousWayPointIndex_ = 0;
     currentWayPointIndex_ = 0;
     return true;
@@ -24,6 +24,7 @@
 #include <math.h>
 
 #include "vector2d.h"
+#include "trajectoryPath.h"
 #include "pid_controller.h"
 #include "lowpass.h"
 #include "PCM_Data/pcm_trajectory.h"
@@ -454,22 +455,17 @@ private:
     double lookAheadTime_;                          //!< how far does the algorithm plan in advance
     int currentWayPointIndex_;                      //!< current target waypoint
     int previousWayPointIndex_;                     //!< waypoint previously passed
-    std::vector<double>
-    distancesBetweenConsecutiveWayPoints;     //!< distances of consecutive way points
+    Common::TrajectoryPath path_;                   //!< way point positions with precomputed arc length
 
-    //! Function calculating the all distances between consecutive way points
-    //!
-    //! @return                         vector of distances
-    std::vector<double> computeDistancesBetweenConsecutiveWayPoints();
+    //! Function precomputing the arc length of the way points
+    void updatePath();
 
     //! Function calculating how many indices the look ahead time corresponds to
     //!
     //! @param[in]     totalDistance        distance that is looked ahead (v*t)
-    //! @param[in]     distances            vector of distances between consecutive way points
     //! @param[in]     fromWayPointIndex    index of the 'starting' waypoint
     //! @return                             index surplus
     int computeNumberOfLookaheadPoints(double totalDistance,
-                                       const std::vector<double> &distances,
                                        int fromWayPointIndex);
 
     //! Function calculating the index of the waypoint ahead that should be targeted at
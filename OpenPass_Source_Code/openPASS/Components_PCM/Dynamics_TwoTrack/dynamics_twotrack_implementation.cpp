@@ -36,6 +36,8 @@
  * @defgroup sim_step_20_tt Output
 */
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <qglobal.h>
 #include "dynamics_twotrack_implementation.h"
@@ -80,10 +82,16 @@ Dynamics_TwoTrack_Implementation::Dynamics_TwoTrack_Implementation(
     int id_torque = torqueBrakeMin.GetId();
     parameterMapDouble.at(id_torque)->SetValue(-std::fabs(parameterMapDoubleExternal.at(id_torque)));
 
-    timeStep = (double)GetCycleTime() / 1000.0;
+    // optional, the explicit Euler scheme is kept as default
+    std::map<int, int> parameterMapIntExternal = GetParameters()->GetParametersInt();
+    auto integratorParameter = parameterMapIntExternal.find(integratorId);
+    if (integratorParameter != parameterMapIntExternal.end()
+            && integratorParameter->second == static_cast<int>(IntegratorTwoTrack::LinearlyImplicitEuler))
+    {
+        integrator = IntegratorTwoTrack::LinearlyImplicitEuler;
+    }
 
-    yawVelocity = 0.0;
-    yawAcceleration = 0.0;
+    timeStep = (double)GetCycleTime() / 1000.0;
     vehicle = new VehicleSimpleTT();
 
     /** @addtogroup init_tt
@@ -236,54 +244,48 @@ void Dynamics_TwoTrack_Implementation::Trigger(int time)
      *  - vehicle's rotational acceleration
     */
     ReadPreviousState();
-    vehicle->SetVelocity(velocityCar, yawVelocity);
 
     LOGINFO(QString().sprintf("time %d, agent %d: positionCar (%.4f, %.2f), velocityCar (%.4f, %.2f)", time, GetAgent()->GetAgentId(),
-                                  positionCar.x, positionCar.y, velocityCar.x, velocityCar.y).toStdString());
-
-    /** @addtogroup sim_step_10_tt
-     * Apply acceleration/deceleration intentions:
-     *  - calculate tire torques due to engine
-     *  - calculate tire torques due to braking by
-     *      - driver (pedal state)
-     *      - assistant systems (selective single wheel braking)
-    */
-    vehicle->DriveTrain(Saturate(throttlePedal.GetValue(), 0.0, 1.0),
-                        Saturate(brakePedal.GetValue(), 0.0, 1.0),
-                        brakeSuperpose.GetValue());
-
-    /** @addtogroup sim_step_10_tt
-     * Apply tire forces at the tire/road interface:
-     *  - calculate longitudinal tire slips and forces
-     *  - calculate lateral tire slips and forces
-     *  - calculate friction forces
-    */
-    vehicle->ForceLocal(timeStep, angleTireFront.GetValue(), forceWheelVertical.GetValue());
-
-    /** @addtogroup sim_step_10_tt
-     * Combine local tire forces to a global force at the vehicle's body:
-     *  - total longitudinal force
-     *  - total lateral force
-     *  - air drag
-     *  - total rotational momentum
-    */
-    vehicle->ForceGlobal();
+                                  state.position.x, state.position.y, state.velocity.x, state.velocity.y).toStdString());
 
-    /** @addtogroup sim_step_20_tt
-     * Perform a translational Euler step:
-     *  - calculate next vehicle's position from prevoius velocity values
-     *  - calculate new velocity from previous acceleration values
-     *  - calculate new acceleration from global forces
-    */
-    NextStateTranslation();
+    InputTwoTrack input;
+    input.throttlePedal = throttlePedal.GetValue();
+    input.brakePedal = brakePedal.GetValue();
+    input.brakeSuperpose = brakeSuperpose.GetValue();
+    input.angleTireFront = angleTireFront.GetValue();
+    input.forceVertical = forceWheelVertical.GetValue();
 
-    /** @addtogroup sim_step_20_tt
-     * Perform a rotational Euler step:
-     *  - calculate vehicle's orientation from previous rotational velocity
-     *  - calculate vehicle's rotational velocity from previous rotational acceleration
-     *  - calculate vehicle's rotational acceleration from the total rotational momentum
-    */
-    NextStateRotation();
+    if (integrator == IntegratorTwoTrack::LinearlyImplicitEuler)
+    {
+        /** @addtogroup sim_step_10_tt
+         * With the linearly implicit integrator, divide the time step into substeps of at most timeStepMax
+         * and perform for each substep:
+         *  - apply acceleration/deceleration intentions (tire torques due to engine and braking by
+         *    the driver and by assistant systems)
+         *  - calculate the accelerations from the tire forces at the tire/road interface,
+         *    combined to a global force and momentum at the vehicle's body including air drag
+         *  - calculate the jacobian of the accelerations with respect to the velocities
+         *  - calculate new velocities and accelerations
+         *  - calculate next vehicle's position and orientation from the new velocities
+        */
+        StepLinearlyImplicitEuler(*vehicle, GetAgent()->GetWeight(), GetAgent()->GetMomentInertiaYaw(),
+                                  input, timeStep, timeStepMax, state);
+    }
+    else
+    {
+        /** @addtogroup sim_step_10_tt
+         * With the explicit integrator (default), perform one step per time step:
+         *  - apply acceleration/deceleration intentions (tire torques due to engine and braking by
+         *    the driver and by assistant systems)
+         *  - calculate the tire forces at the tire/road interface, combined to a global force
+         *    and momentum at the vehicle's body including air drag
+         *  - calculate next vehicle's position and orientation from the previous velocities
+         *  - calculate new velocities from the previous accelerations
+         *  - calculate new accelerations from the global force and momentum
+        */
+        StepExplicitEuler(*vehicle, GetAgent()->GetWeight(), GetAgent()->GetMomentInertiaYaw(),
+                          input, timeStep, state);
+    }
 
     /** @addtogroup sim_step_20_tt
      * Write actual vehicle's state:
@@ -299,7 +301,7 @@ void Dynamics_TwoTrack_Implementation::Trigger(int time)
 
 #ifdef QT_DEBUG
     *logStream << QString().sprintf("%d;%d;%.4f;%.2f;%.4f;%.2f\n", clockCount, GetAgent()->GetAgentId(),
-                                    positionCar.x, positionCar.y, velocityCar.x, velocityCar.y);
+                                    state.position.x, state.position.y, state.velocity.x, state.velocity.y);
     clockCount += timeStep_ms;
 #endif
 
@@ -308,88 +310,17 @@ void Dynamics_TwoTrack_Implementation::Trigger(int time)
 void Dynamics_TwoTrack_Implementation::ReadPreviousState()
 {
     // actual state
-    positionCar.x = GetAgent()->GetPositionX(); // global CS
-    positionCar.y = GetAgent()->GetPositionY(); // global CS
-    yawAngle = GetAgent()->GetYawAngle(); // global CS
-
-    velocityCar.x = GetAgent()->GetVelocityX(); // car's CS
-    velocityCar.y = GetAgent()->GetVelocityY(); // car's CS
-    yawVelocity = GetAgent()->GetYawVelocity();
-
-    accelerationCar.x = GetAgent()->GetAccelerationX(); // car's CS
-    accelerationCar.y = GetAgent()->GetAccelerationY(); // car's CS
-    yawAcceleration = GetAgent()->GetYawAcceleration();
-
-}
-
-void Dynamics_TwoTrack_Implementation::NextStateTranslation()
-{
-
-    // update position (constant velocity step)
-    velocityCar.Rotate(yawAngle); // global CS
-    positionCar =  positionCar + velocityCar*timeStep;
-    velocityCar.Rotate(- yawAngle); // vehicle CS
-
-
-    // update velocity
-    Vector2d velocityCarNew = velocityCar + accelerationCar*timeStep;
+    state.position.x = GetAgent()->GetPositionX(); // global CS
+    state.position.y = GetAgent()->GetPositionY(); // global CS
+    state.yawAngle = GetAgent()->GetYawAngle(); // global CS
 
-    // update acceleration
-    accelerationCar = vehicle->forceTotalXY * (1 / GetAgent()->GetWeight() );
-
-    // correct velocity and acceleration for zero-crossing
-    if (velocityCarNew.x*velocityCar.x<0.0)
-    {
-        velocityCar.x = 0.0;
-        accelerationCar.x = 0.0;
-    }
-    else
-    {
-        velocityCar.x = velocityCarNew.x;
-    }
-    if (velocityCarNew.y*velocityCar.y<0.0)
-    {
-        velocityCar.y = 0.0;
-        accelerationCar.y = 0.0;
-    }
-    else
-    {
-        velocityCar.y = velocityCarNew.y;
-    }
-
-
-}
-
-void Dynamics_TwoTrack_Implementation::NextStateRotation()
-{
-
-    // preserve directions of velocity and acceleration
-    velocityCar.Rotate(yawAngle);
-    accelerationCar.Rotate(yawAngle);
-
-    // update yaw angle
-    yawAngle = yawAngle + timeStep * yawVelocity;
-
-    // update yaw velocity
-    double yawVelocityNew = yawVelocity + yawAcceleration * timeStep;
-
-    // update acceleration
-    yawAcceleration = vehicle->momentTotalZ / GetAgent()->GetMomentInertiaYaw();
-
-    // correct velocity and acceleration for zero-crossing
-    if (yawVelocityNew*yawVelocity<0.0)
-    {
-        yawVelocity = 0.0;
-        yawAcceleration = 0.0;
-    }
-    else
-    {
-        yawVelocity = yawVelocityNew;
-    }
+    state.velocity.x = GetAgent()->GetVelocityX(); // car's CS
+    state.velocity.y = GetAgent()->GetVelocityY(); // car's CS
+    state.yawVelocity = GetAgent()->GetYawVelocity();
 
-    // reassign directions of velocity and acceleration
-    velocityCar.Rotate(-yawAngle);
-    accelerationCar.Rotate(-yawAngle);
+    state.acceleration.x = GetAgent()->GetAccelerationX(); // car's CS
+    state.acceleration.y = GetAgent()->GetAccelerationY(); // car's CS
+    state.yawAcceleration = GetAgent()->GetYawAcceleration();
 
 }
 
@@ -397,20 +328,20 @@ void Dynamics_TwoTrack_Implementation::NextStateSet()
 {
 
     // update position (constant acceleration step)
-    GetAgent()->SetPositionX( positionCar.x );
-    GetAgent()->SetPositionY( positionCar.y );
-    GetAgent()->SetYawAngle( yawAngle );
+    GetAgent()->SetPositionX( state.position.x );
+    GetAgent()->SetPositionY( state.position.y );
+    GetAgent()->SetYawAngle( state.yawAngle );
 
     // update velocity
-    GetAgent()->SetVelocityX( velocityCar.x );
-    GetAgent()->SetVelocityY( velocityCar.y );
-    GetAgent()->SetYawVelocity( yawVelocity );
+    GetAgent()->SetVelocityX( state.velocity.x );
+    GetAgent()->SetVelocityY( state.velocity.y );
+    GetAgent()->SetYawVelocity( state.yawVelocity );
 
     // update forces
     // transfer to trajectory and/or world CS ??? -> NOPE !!!
-    GetAgent()->SetAccelerationX( accelerationCar.x  );
-    GetAgent()->SetAccelerationY( accelerationCar.y  );
-    GetAgent()->SetYawAcceleration( yawAcceleration );
+    GetAgent()->SetAccelerationX( state.acceleration.x  );
+    GetAgent()->SetAccelerationY( state.acceleration.y  );
+    GetAgent()->SetYawAcceleration( state.yawAcceleration );
 
     // update outputs
     std::vector<double> forceInert = {-vehicle->forceTotalXY.x, -vehicle->forceTotalXY.y};
@@ -18,6 +18,7 @@
 #include "vectorSignals.h"
 #include "vector2d.h"
 #include "componentPorts.h"
+#include "dynamics_twotrack_local.h"
 #include "dynamics_twotrack_vehicle.h"
 
 #ifdef QT_DEBUG
@@ -165,18 +166,10 @@ private:
     */
     //! Time step as double in s
     double timeStep;
-    //! Yaw angle
-    double yawAngle;
-    //! Car's position
-    Common::Vector2d positionCar;
-    //! Yaw rate
-    double yawVelocity;
-    //! Car's velocity
-    Common::Vector2d velocityCar;
-    //! Yaw acceleration
-    double yawAcceleration;
-    //! Car's acceleration
-    Common::Vector2d accelerationCar;
+    //! Integration scheme
+    IntegratorTwoTrack integrator {IntegratorTwoTrack::ExplicitEuler};
+    //! Car's position, velocity and acceleration
+    StateTwoTrack state;
     /**
      *    @}
      *  @}
@@ -194,15 +187,23 @@ private:
      *  @}
     */
 
+    /** \addtogroup Dynamics_TwoTrack
+     *  @{
+     *    \name Constants
+     *    @{
+    */
+    //! Id of the optional int parameter selecting the integrator, see IntegratorTwoTrack
+    const int integratorId = 6;
+    //! Maximum integration step of the linearly implicit integrator [s], longer cycle times are divided into substeps
+    const double timeStepMax = 0.02;
+    /**
+     *    @}
+     *  @}
+    */
+
     //! Update data on agent's actual position, velocity and acceleration
     void ReadPreviousState();
 
-    //! Calculate next position, translation velocity and translation acceleration of the agent
-    void NextStateTranslation();
-
-    //! Calculate next yaw angle, rotation velocity and rotation acceleration of the agent
-    void NextStateRotation();
-
     //! Write next position, velocity and acceleration of the agent
     void NextStateSet();
 
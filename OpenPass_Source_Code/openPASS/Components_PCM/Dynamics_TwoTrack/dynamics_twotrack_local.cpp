@@ -9,4 +9,185 @@
 **********************************************************************/
 
 #include <QtGlobal>
+#include <algorithm>
+#include <cmath>
 #include "dynamics_twotrack_local.h"
+#include "dynamics_twotrack_vehicle.h"
+
+namespace {
+//! Velocity perturbation for the numerical jacobian of the accelerations [m/s], [rad/s]
+constexpr double velocityPerturbation = 1e-4;
+
+double Determinant(const std::array<std::array<double, 3>, 3> &matrix)
+{
+    return matrix[0][0] * (matrix[1][1] * matrix[2][2] - matrix[1][2] * matrix[2][1])
+         - matrix[0][1] * (matrix[1][0] * matrix[2][2] - matrix[1][2] * matrix[2][0])
+         + matrix[0][2] * (matrix[1][0] * matrix[2][1] - matrix[1][1] * matrix[2][0]);
+}
+
+//! Accelerations of the vehicle for the given velocities, the remembered tire rotation is not changed
+std::array<double, 3> CalculateAcceleration(VehicleSimpleTT &vehicle, double mass, double momentInertiaYaw,
+                                            const std::array<double, 3> &velocities, const InputTwoTrack &input)
+{
+    vehicle.SetVelocity(Common::Vector2d(velocities[0], velocities[1]), velocities[2]);
+    vehicle.EvaluateForceLocal(input.angleTireFront, input.forceVertical);
+    vehicle.ForceGlobal();
+
+    return {vehicle.forceTotalXY.x / mass,
+            vehicle.forceTotalXY.y / mass,
+            vehicle.momentTotalZ / momentInertiaYaw};
+}
+
+//! Takes the new value, unless the value changes its sign, then value and derivative are set to zero
+void CorrectZeroCrossing(double valueNew, double &value, double &derivative)
+{
+    if (valueNew * value < 0.0)
+    {
+        value = 0.0;
+        derivative = 0.0;
+    }
+    else
+    {
+        value = valueNew;
+    }
+}
+} // namespace
+
+bool SolveLinear(const std::array<std::array<double, 3>, 3> &matrix, const std::array<double, 3> &rhs,
+                 std::array<double, 3> &solution)
+{
+    const double determinant = Determinant(matrix);
+    if (!(std::fabs(determinant) > 1e-6)) // also catches NaN
+    {
+        return false;
+    }
+
+    std::array<double, 3> result;
+    for (int column = 0; column < 3; ++column)
+    {
+        std::array<std::array<double, 3>, 3> replaced = matrix;
+        for (int row = 0; row < 3; ++row)
+        {
+            replaced[row][column] = rhs[row];
+        }
+        result[column] = Determinant(replaced) / determinant;
+    }
+
+    solution = result;
+    return true;
+}
+
+std::array<double, 3> LinearlyImplicitStep(const std::array<double, 3> &accelerations,
+                                           const std::array<std::array<double, 3>, 3> &accelerationsPerturbed,
+                                           double perturbation, double timeStep)
+{
+    // solve (I - h * J) * delta = h * a
+    std::array<std::array<double, 3>, 3> matrix;
+    std::array<double, 3> rhs;
+    for (int row = 0; row < 3; ++row)
+    {
+        for (int column = 0; column < 3; ++column)
+        {
+            double jacobian = (accelerationsPerturbed[column][row] - accelerations[row]) / perturbation;
+            matrix[row][column] = (row == column ? 1.0 : 0.0) - timeStep * jacobian;
+        }
+        rhs[row] = timeStep * accelerations[row];
+    }
+
+    std::array<double, 3> delta;
+    if (!SolveLinear(matrix, rhs, delta))
+    {
+        // tire model not differentiable here (e.g. at standstill), fall back to an explicit step
+        delta = rhs;
+    }
+    return delta;
+}
+
+void StepExplicitEuler(VehicleSimpleTT &vehicle, double mass, double momentInertiaYaw,
+                       const InputTwoTrack &input, double timeStep, StateTwoTrack &state)
+{
+    vehicle.SetVelocity(state.velocity, state.yawVelocity);
+    vehicle.DriveTrain(Saturate(input.throttlePedal, 0.0, 1.0),
+                       Saturate(input.brakePedal, 0.0, 1.0),
+                       input.brakeSuperpose);
+    vehicle.ForceLocal(timeStep, input.angleTireFront, input.forceVertical);
+    vehicle.ForceGlobal();
+
+    // translation: position with previous velocity, velocity with previous acceleration
+    state.velocity.Rotate(state.yawAngle); // global CS
+    state.position = state.position + state.velocity * timeStep;
+    state.velocity.Rotate(-state.yawAngle); // car's CS
+
+    Common::Vector2d velocityNew = state.velocity + state.acceleration * timeStep;
+    state.acceleration = vehicle.forceTotalXY * (1 / mass);
+    CorrectZeroCrossing(velocityNew.x, state.velocity.x, state.acceleration.x);
+    CorrectZeroCrossing(velocityNew.y, state.velocity.y, state.acceleration.y);
+
+    // rotation, preserving the directions of velocity and acceleration
+    state.velocity.Rotate(state.yawAngle);
+    state.acceleration.Rotate(state.yawAngle);
+
+    state.yawAngle = state.yawAngle + timeStep * state.yawVelocity;
+
+    double yawVelocityNew = state.yawVelocity + state.yawAcceleration * timeStep;
+    state.yawAcceleration = vehicle.momentTotalZ / momentInertiaYaw;
+    CorrectZeroCrossing(yawVelocityNew, state.yawVelocity, state.yawAcceleration);
+
+    state.velocity.Rotate(-state.yawAngle);
+    state.acceleration.Rotate(-state.yawAngle);
+}
+
+void StepLinearlyImplicitEuler(VehicleSimpleTT &vehicle, double mass, double momentInertiaYaw,
+                               const InputTwoTrack &input, double timeStep, double timeStepMax,
+                               StateTwoTrack &state)
+{
+    const int numberOfSubSteps = std::max(1, static_cast<int>(std::ceil(timeStep / timeStepMax - 1e-9)));
+    const double timeStepInternal = timeStep / numberOfSubSteps;
+
+    for (int subStep = 0; subStep < numberOfSubSteps; ++subStep)
+    {
+        vehicle.DriveTrain(Saturate(input.throttlePedal, 0.0, 1.0),
+                           Saturate(input.brakePedal, 0.0, 1.0),
+                           input.brakeSuperpose);
+
+        const std::array<double, 3> velocities = {state.velocity.x, state.velocity.y, state.yawVelocity};
+
+        // accelerations for perturbed velocities (forward differences)
+        std::array<std::array<double, 3>, 3> accelerationsPerturbed;
+        for (int column = 0; column < 3; ++column)
+        {
+            std::array<double, 3> velocitiesPerturbed = velocities;
+            velocitiesPerturbed[column] += velocityPerturbation;
+            accelerationsPerturbed[column] = CalculateAcceleration(vehicle, mass, momentInertiaYaw,
+                                                                   velocitiesPerturbed, input);
+        }
+
+        // evaluated last, so that the vehicle keeps the forces of the actual velocities
+        const std::array<double, 3> accelerations = CalculateAcceleration(vehicle, mass, momentInertiaYaw,
+                                                                          velocities, input);
+        vehicle.UpdateTireRotation(timeStepInternal);
+
+        const std::array<double, 3> delta = LinearlyImplicitStep(accelerations, accelerationsPerturbed,
+                                                                  velocityPerturbation, timeStepInternal);
+
+        state.acceleration.x = delta[0] / timeStepInternal;
+        state.acceleration.y = delta[1] / timeStepInternal;
+        state.yawAcceleration = delta[2] / timeStepInternal;
+
+        CorrectZeroCrossing(velocities[0] + delta[0], state.velocity.x, state.acceleration.x);
+        CorrectZeroCrossing(velocities[1] + delta[1], state.velocity.y, state.acceleration.y);
+        CorrectZeroCrossing(velocities[2] + delta[2], state.yawVelocity, state.yawAcceleration);
+
+        // translation with the new velocity
+        state.velocity.Rotate(state.yawAngle); // global CS
+        state.position = state.position + state.velocity * timeStepInternal;
+        state.velocity.Rotate(-state.yawAngle); // car's CS
+
+        // rotation with the new yaw rate, preserving the directions of velocity and acceleration
+        state.velocity.Rotate(state.yawAngle);
+        state.acceleration.Rotate(state.yawAngle);
+        state.yawAngle = state.yawAngle + timeStepInternal * state.yawVelocity;
+        state.velocity.Rotate(-state.yawAngle);
+        state.acceleration.Rotate(-state.yawAngle);
+    }
+}
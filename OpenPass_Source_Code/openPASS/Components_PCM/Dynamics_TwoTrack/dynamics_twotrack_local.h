@@ -12,8 +12,12 @@
 #define DYNAMICS_TWOTRACK_LOCAL_H
 
 
+#include <array>
+#include <vector>
 #include "vector2d.h"
 
+class VehicleSimpleTT;
+
 template<typename DT>
 DT Saturate(const DT value, const DT limitLow, const DT limitHigh)
 {
@@ -26,4 +30,87 @@ DT Saturate(const DT value, const DT limitLow, const DT limitHigh)
     }
 }
 
+//! Solve the linear system matrix * solution = rhs of dimension 3 by Cramer's rule
+//!
+//! @param[in]     matrix     Coefficients
+//! @param[in]     rhs        Right-hand side
+//! @param[out]    solution   Solution, unchanged if the matrix is singular
+//! @return                   False if the matrix is singular
+bool SolveLinear(const std::array<std::array<double, 3>, 3> &matrix, const std::array<double, 3> &rhs,
+                 std::array<double, 3> &solution);
+
+//! Velocity increment of a linearly implicit Euler step, timeStep * (I - timeStep * J)^-1 * accelerations
+//!
+//! The Jacobian J of the accelerations with respect to the velocities is approximated by forward differences.
+//! Falls back to the explicit increment timeStep * accelerations if I - timeStep * J is singular.
+//!
+//! @param[in]     accelerations            Accelerations at the actual velocities
+//! @param[in]     accelerationsPerturbed   Accelerations with the velocity of the respective index increased by perturbation
+//! @param[in]     perturbation             Velocity perturbation of the forward differences
+//! @param[in]     timeStep                 Step size
+//! @return                                 Increment of the velocities
+std::array<double, 3> LinearlyImplicitStep(const std::array<double, 3> &accelerations,
+                                           const std::array<std::array<double, 3>, 3> &accelerationsPerturbed,
+                                           double perturbation, double timeStep);
+
+//! Integration scheme of the vehicle's body dynamics
+enum class IntegratorTwoTrack
+{
+    //! One explicit Euler step per cycle with the accelerations of the previous cycle
+    ExplicitEuler = 0,
+    //! Linearly implicit Euler steps, the cycle is divided into substeps of at most timeStepMax
+    LinearlyImplicitEuler = 1
+};
+
+//! Planar state of the vehicle's body
+struct StateTwoTrack
+{
+    Common::Vector2d position;          //!< Position in global CS [m]
+    double yawAngle = 0.0;              //!< Yaw angle in global CS [rad]
+    Common::Vector2d velocity;          //!< Velocity in car's CS [m/s]
+    double yawVelocity = 0.0;           //!< Yaw rate [rad/s]
+    Common::Vector2d acceleration;      //!< Acceleration in car's CS [m/s^2]
+    double yawAcceleration = 0.0;       //!< Yaw acceleration [rad/s^2]
+};
+
+//! Inputs of the vehicle, which are constant during a cycle
+struct InputTwoTrack
+{
+    double throttlePedal = 0.0;                 //!< State of the gas pedal, saturated to [0...1]
+    double brakePedal = 0.0;                    //!< State of the brake pedal, saturated to [0...1]
+    std::vector<double> brakeSuperpose;         //!< Brake superposition per wheel
+    double angleTireFront = 0.0;                //!< Mean pointing angle of the front tires [rad]
+    std::vector<double> forceVertical;          //!< Vertical force on the wheels [N]
+};
+
+//! Advance the vehicle's body by one cycle with a translational and a rotational explicit Euler step
+//!
+//! The position is advanced with the previous velocity and the velocity with the previous acceleration,
+//! the acceleration is then taken from the forces at the previous velocity.
+//!
+//! @param[in,out] vehicle            Vehicle model, keeps the forces of the cycle
+//! @param[in]     mass               Mass of the vehicle [kg]
+//! @param[in]     momentInertiaYaw   Moment of inertia around the z-axis [kg*m^2]
+//! @param[in]     input              Pedals, steering and wheel loads
+//! @param[in]     timeStep           Cycle time [s]
+//! @param[in,out] state              State of the vehicle's body
+void StepExplicitEuler(VehicleSimpleTT &vehicle, double mass, double momentInertiaYaw,
+                       const InputTwoTrack &input, double timeStep, StateTwoTrack &state);
+
+//! Advance the vehicle's body by one cycle with linearly implicit Euler substeps
+//!
+//! The velocities are advanced first, so that the position and the yaw angle are advanced with the new ones.
+//! A velocity component crossing zero within a substep is set to zero together with its acceleration.
+//!
+//! @param[in,out] vehicle            Vehicle model, keeps the forces at the velocities of the last substep
+//! @param[in]     mass               Mass of the vehicle [kg]
+//! @param[in]     momentInertiaYaw   Moment of inertia around the z-axis [kg*m^2]
+//! @param[in]     input              Pedals, steering and wheel loads
+//! @param[in]     timeStep           Cycle time [s]
+//! @param[in]     timeStepMax        Maximum substep [s]
+//! @param[in,out] state              State of the vehicle's body
+void StepLinearlyImplicitEuler(VehicleSimpleTT &vehicle, double mass, double momentInertiaYaw,
+                               const InputTwoTrack &input, double timeStep, double timeStepMax,
+                               StateTwoTrack &state);
+
 #endif // DYNAMICS_TWOTRACK_LOCAL_H
@@ -15,7 +15,6 @@
 #include "dynamics_twotrack_vehicle.h"
 #include "dynamics_twotrack_local.h"
 #include <cmath>
-#include <QFile>
 
 
 VehicleSimpleTT::VehicleSimpleTT()
@@ -89,7 +88,7 @@ void VehicleSimpleTT::SetVelocity(Common::Vector2d velocityCars, const double w)
 }
 
 void VehicleSimpleTT::DriveTrain(double throttlePedal, double brakePedal,
-                                 std::vector<double> brakeSuperpose)
+                                 const std::vector<double>& brakeSuperpose)
 {
 
     double torqueEngineMax;
@@ -130,7 +129,13 @@ void VehicleSimpleTT::DriveTrain(double throttlePedal, double brakePedal,
     }
 }
 
-void VehicleSimpleTT::ForceLocal(double timeStep, double angleTireFront, std::vector<double> forceVertical)
+void VehicleSimpleTT::ForceLocal(double timeStep, double angleTireFront, const std::vector<double>& forceVertical)
+{
+    EvaluateForceLocal(angleTireFront, forceVertical);
+    UpdateTireRotation(timeStep);
+}
+
+void VehicleSimpleTT::EvaluateForceLocal(double angleTireFront, const std::vector<double>& forceVertical)
 {
 
     double angleTire[NUMBER_OF_WHEELS];
@@ -141,7 +146,7 @@ void VehicleSimpleTT::ForceLocal(double timeStep, double angleTireFront, std::ve
 
     Tire *tire_tmp;
     Common::Vector2d velocityTire(0.0, 0.0);
-    double rotVelNew, forceAbs, torqueTireSum;
+    double forceAbs, torqueTireSum;
 
     // slips + forces
     for (int i = 0; i < NUMBER_OF_WHEELS; ++i)
@@ -152,9 +157,8 @@ void VehicleSimpleTT::ForceLocal(double timeStep, double angleTireFront, std::ve
         slipTire[i].Scale(0.0);
 
         // global rotation of the tire
-        velocityTire = positionTire[i];
-        velocityTire.Rotate(M_PI / 2.0);
-        velocityTire.Scale(yawVelocity);
+        velocityTire.x = -positionTire[i].y * yawVelocity;
+        velocityTire.y = positionTire[i].x * yawVelocity;
 
         // translation superposition
         velocityTire.Add(velocityCar);
@@ -202,17 +206,23 @@ void VehicleSimpleTT::ForceLocal(double timeStep, double angleTireFront, std::ve
         // local plane momentum (around z-axis)
         momentTireZ[i] = positionTire[i].Cross(forceTire[i]);
 
-        // rotational velocity
-        rotVelNew = velocityTire.x / (1 - slipTire[i].x) / tire_tmp->radius;
+        // rotational velocity, committed by UpdateTireRotation
+        rotationVelocityTireXNew[i] = velocityTire.x / (1 - slipTire[i].x) / tire_tmp->radius;
 
+    }
+
+}
+
+void VehicleSimpleTT::UpdateTireRotation(double timeStep)
+{
+    for (int i = 0; i < NUMBER_OF_WHEELS; ++i)
+    {
         // memorize rotation velocity derivative for inertia torque
-        rotationVelocityGradTireX[i] = (rotVelNew - rotationVelocityTireX[i]) / timeStep;
+        rotationVelocityGradTireX[i] = (rotationVelocityTireXNew[i] - rotationVelocityTireX[i]) / timeStep;
 
         // memorize rotation velocity
-        rotationVelocityTireX[i] = rotVelNew;
-
+        rotationVelocityTireX[i] = rotationVelocityTireXNew[i];
     }
-
 }
 
 void VehicleSimpleTT::ForceGlobal()
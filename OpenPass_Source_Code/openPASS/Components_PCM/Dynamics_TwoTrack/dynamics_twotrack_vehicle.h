@@ -63,9 +63,13 @@ public:
      *    @{
     */
     //! Calculate local tire torques
-    void DriveTrain(double throttlePedal, double brakePedal, std::vector<double> brakeSuperpose);
-    //! Local forces and moments transferred onto road
-    void ForceLocal(double timeStep, double, std::vector<double> forceVertical);
+    void DriveTrain(double throttlePedal, double brakePedal, const std::vector<double>& brakeSuperpose);
+    //! Local forces and moments transferred onto road, including the update of the tire rotation
+    void ForceLocal(double timeStep, double, const std::vector<double>& forceVertical);
+    //! Local forces and moments transferred onto road, the remembered tire rotation stays untouched
+    void EvaluateForceLocal(double, const std::vector<double>& forceVertical);
+    //! Commit the tire rotation of the last force evaluation
+    void UpdateTireRotation(double timeStep);
     //! Global force and moment
     void ForceGlobal();
     /**
@@ -139,6 +143,7 @@ private:
     // Dynamics to remember
     double rotationVelocityTireX[NUMBER_OF_WHEELS];
     double rotationVelocityGradTireX[NUMBER_OF_WHEELS];
+    double rotationVelocityTireXNew[NUMBER_OF_WHEELS];
     double yawVelocity;
     Common::Vector2d velocityCar;
     Common::Vector2d forceTire[NUMBER_OF_WHEELS];
@@ -11,3 +11,6 @@
 #include "log.h"
 
 QMap<int, std::ofstream *> LogOutputPolicy::logStreamMap;
+QMap<int, int> LogOutputPolicy::forwardedThreadMap;
+int LogOutputPolicy::defaultThreadId = 0;
+QMutex LogOutputPolicy::logStreamGuard;
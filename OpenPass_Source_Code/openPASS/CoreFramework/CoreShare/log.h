@@ -194,6 +194,10 @@ std::string Log<T>::ToString(LogLevel level)
 }
 
 //! Handles access of file
+//!
+//! Each thread which sets a file writes into its own file. Other threads (e.g. worker threads
+//! started by the framework) write into the file of the thread they are forwarded to, or into
+//! the first file opened by the process if they are not forwarded.
 class LogOutputPolicy
 {
 public:
@@ -218,29 +222,89 @@ public:
     //-----------------------------------------------------------------------------
     static void Output(const std::string &message);
 
+    //-----------------------------------------------------------------------------
+    //! Forwards the logs of the current thread into the file of another thread.
+    //!
+    //! @param[in]     threadId     Thread owning the file
+    //-----------------------------------------------------------------------------
+    static void ForwardTo(Qt::HANDLE threadId);
+
+    //-----------------------------------------------------------------------------
+    //! Stops forwarding the logs of the current thread.
+    //-----------------------------------------------------------------------------
+    static void StopForwarding();
+
 private:
+    //-----------------------------------------------------------------------------
+    //! Retrieves the file of the current thread, logStreamGuard has to be locked.
+    //!
+    //! @return      File of the current thread, nullptr if there is none
+    //-----------------------------------------------------------------------------
+    static std::ofstream *GetStream();
+
     static QMap<int, std::ofstream *> logStreamMap; //!< output file stream
+    static QMap<int, int> forwardedThreadMap; //!< thread owning the file of a forwarded thread
+    static int defaultThreadId; //!< thread owning the first file opened by the process
+    static QMutex logStreamGuard; //!< protects the files and maps from concurrent access
+};
+
+//! Forwards the logs of the constructing thread into the file of another thread during its lifetime
+class LogForwarding
+{
+public:
+    //! @param[in]     threadId     Thread owning the file
+    explicit LogForwarding(Qt::HANDLE threadId)
+    {
+        LogOutputPolicy::ForwardTo(threadId);
+    }
+    LogForwarding(const LogForwarding &) = delete;
+    LogForwarding(LogForwarding &&) = delete;
+    LogForwarding &operator=(const LogForwarding &) = delete;
+    LogForwarding &operator=(LogForwarding &&) = delete;
+
+    ~LogForwarding()
+    {
+        LogOutputPolicy::StopForwarding();
+    }
 };
 
 inline void LogOutputPolicy::SetFile(const std::string &fileName)
 {
+    QMutexLocker locker(&logStreamGuard);
+
     long long threadId = (long long)QThread::currentThreadId();
+    if (logStreamMap.contains(threadId))
+    {
+        delete logStreamMap.take(threadId);
+    }
+
     std::ofstream *logStream = new std::ofstream();
     logStream->open(fileName);
     logStreamMap.insert(threadId, logStream);
+
+    if (!logStreamMap.contains(defaultThreadId))
+    {
+        defaultThreadId = threadId;
+    }
 }
 
-inline bool LogOutputPolicy::IsOpen()
+inline std::ofstream *LogOutputPolicy::GetStream()
 {
     long long threadId = (long long)QThread::currentThreadId();
-    if (logStreamMap.contains(threadId))
+    if (!logStreamMap.contains(threadId))
     {
-        return logStreamMap[threadId]->is_open();
-    }
-    else
-    {
-        return false;
+        threadId = forwardedThreadMap.value(threadId, defaultThreadId);
     }
+
+    return logStreamMap.value(threadId, nullptr);
+}
+
+inline bool LogOutputPolicy::IsOpen()
+{
+    QMutexLocker locker(&logStreamGuard);
+
+    std::ofstream *logStream = GetStream();
+    return logStream && logStream->is_open();
 }
 
 inline void LogOutputPolicy::Output(const std::string &message)
@@ -249,14 +313,28 @@ inline void LogOutputPolicy::Output(const std::string &message)
 //    std::cout << message.c_str();
 
     // print to file
-    long long threadId = (long long)QThread::currentThreadId();
-    if (logStreamMap.contains(threadId))
+    QMutexLocker locker(&logStreamGuard);
+
+    std::ofstream *logStream = GetStream();
+    if (logStream)
     {
-        *logStreamMap[threadId] << message;
-        logStreamMap[threadId]->flush();
+        *logStream << message;
+        logStream->flush();
     }
 }
 
+inline void LogOutputPolicy::ForwardTo(Qt::HANDLE threadId)
+{
+    QMutexLocker locker(&logStreamGuard);
+    forwardedThreadMap.insert((long long)QThread::currentThreadId(), (long long)threadId);
+}
+
+inline void LogOutputPolicy::StopForwarding()
+{
+    QMutexLocker locker(&logStreamGuard);
+    forwardedThreadMap.remove((long long)QThread::currentThreadId());
+}
+
 //! Bind logging mechanism to file
 typedef Log<LogOutputPolicy> LogFile;
 
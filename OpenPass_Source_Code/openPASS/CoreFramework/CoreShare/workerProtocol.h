@@ -0,0 +1,32 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//-----------------------------------------------------------------------------
+//! @file  workerProtocol.h
+//! @brief This file contains the line protocol between the master and
+//!        persistent slaves started with --worker.
+//!
+//! The master writes one job per line to the standard input of the slave:
+//!     <jobId>\t<argument>\t<value>\t<argument>\t<value>...
+//! using the command line arguments of a regular slave. After the job, the
+//! slave writes to its standard output:
+//!     <jobFinished>\t<jobId>\t<exitCode>
+//! Closing the standard input terminates the slave.
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+namespace WorkerProtocol {
+
+constexpr char separator = '\t';
+constexpr char workerFlag[] = "--worker";
+constexpr char jobFinished[] = "OPENPASS_JOB_FINISHED";
+
+} // namespace WorkerProtocol
@@ -10,11 +10,143 @@
 *******************************************************************************/
 
 #include <sstream>
+#include <QXmlStreamReader>
 #include "xmlParser.h"
 
 namespace SimulationCommon
 {
 
+namespace
+{
+
+//! Copies the current element of the reader (attributes and content) into the given DOM element
+void ReadElement(QXmlStreamReader &reader, QDomDocument &document, QDomElement &element)
+{
+    for (const QXmlStreamAttribute &attribute : reader.attributes())
+    {
+        element.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+    }
+
+    while (!reader.atEnd())
+    {
+        switch (reader.readNext())
+        {
+        case QXmlStreamReader::StartElement:
+        {
+            QDomElement childElement = document.createElement(reader.qualifiedName().toString());
+            element.appendChild(childElement);
+            ReadElement(reader, document, childElement);
+            break;
+        }
+
+        case QXmlStreamReader::EndElement:
+            return;
+
+        case QXmlStreamReader::Characters:
+            // whitespace only text is dropped, as done by QDomDocument::setContent
+            if (reader.isCDATA())
+            {
+                element.appendChild(document.createCDATASection(reader.text().toString()));
+            }
+            else if (!reader.isWhitespace())
+            {
+                element.appendChild(document.createTextNode(reader.text().toString()));
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+} // namespace
+
+bool StreamChildElements(QIODevice &device,
+                         const std::vector<std::string> &parentPath,
+                         const StreamedElementHandler &handler,
+                         QString &errorMsg,
+                         int &errorLine)
+{
+    QXmlStreamReader reader(&device);
+
+    auto setError = [&](const QString &message) -> bool
+    {
+        errorMsg = reader.hasError() ? reader.errorString() : message;
+        errorLine = static_cast<int>(reader.lineNumber());
+        return false;
+    };
+
+    if (!reader.readNextStartElement())
+    {
+        return setError("Root element not found");
+    }
+
+    for (const auto &tag : parentPath)
+    {
+        const QString parentTag = QString::fromStdString(tag);
+        bool found = false;
+
+        while (reader.readNextStartElement())
+        {
+            if (reader.qualifiedName() == parentTag)
+            {
+                found = true;
+                break;
+            }
+
+            reader.skipCurrentElement();
+        }
+
+        if (!found)
+        {
+            return setError("Element " + parentTag + " not found");
+        }
+    }
+
+    const QString parentName = reader.qualifiedName().toString();
+    const QXmlStreamAttributes parentAttributes = reader.attributes();
+
+    while (reader.readNextStartElement())
+    {
+        QDomDocument document;
+        QDomElement parentElement = document.createElement(parentName);
+        for (const QXmlStreamAttribute &attribute : parentAttributes)
+        {
+            parentElement.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+        }
+        document.appendChild(parentElement);
+
+        const QString childName = reader.qualifiedName().toString();
+        QDomElement childElement = document.createElement(childName);
+        parentElement.appendChild(childElement);
+        ReadElement(reader, document, childElement);
+
+        if (reader.hasError())
+        {
+            return setError(reader.errorString());
+        }
+
+        if (!handler(parentElement))
+        {
+            return setError("Import of element " + childName + " failed");
+        }
+    }
+
+    // the remainder has to be well-formed, too
+    while (!reader.atEnd())
+    {
+        reader.readNext();
+    }
+
+    if (reader.hasError())
+    {
+        return setError(reader.errorString());
+    }
+
+    return true;
+}
+
 bool GetFirstChildElement(QDomElement rootElement, const std::string &tag, QDomElement &result)
 {
     QDomNode node = rootElement.firstChildElement(QString::fromStdString(tag));
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
+#include <vector>
 #include <QFile>
 #include <QDomDocument>
 #include <unordered_map>
@@ -27,6 +29,31 @@
 namespace SimulationCommon
 {
 
+//! Callback receiving a streamed element (see StreamChildElements)
+using StreamedElementHandler = std::function<bool(QDomElement &)>;
+
+/*!
+ *  \brief Streams the child elements below a given parent path of an XML file.
+ *
+ *  The file is read with a QXmlStreamReader. Only a single child element is materialized as
+ *  DOM subtree at a time. It is wrapped into a copy of its parent element (tag and attributes),
+ *  so that the existing DOM based parse functions can be applied unchanged. Peak memory is
+ *  bounded by the largest child element instead of the whole document.
+ *
+ *  \param[in]  device          Opened device to read from
+ *  \param[in]  parentPath      Tags leading from the document root to the parent element (empty for the root)
+ *  \param[in]  handler         Called with the wrapping parent element of each child; returning false aborts
+ *  \param[out] errorMsg        Description of the error on failure
+ *  \param[out] errorLine       Line of the error on failure
+ *
+ *  \return     True if the document is well-formed, the parent path exists and all handlers succeeded.
+ */
+extern bool StreamChildElements(QIODevice &device,
+                                const std::vector<std::string> &parentPath,
+                                const StreamedElementHandler &handler,
+                                QString &errorMsg,
+                                int &errorLine);
+
 extern bool GetFirstChildElement(QDomElement rootElement, const std::string &tag, QDomElement &result);
 
 extern bool GetFirstChild(QDomElement rootElement, QDomElement &result);
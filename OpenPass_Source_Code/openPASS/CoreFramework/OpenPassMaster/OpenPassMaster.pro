@@ -24,6 +24,7 @@ SRC_CORESHARE = ../CoreShare/xmlParser.cpp \
                 ../CoreShare/log.cpp
 
 INC_CORESHARE = ../CoreShare/xmlParser.h \
+                ../CoreShare/workerProtocol.h \
                 ../CoreShare/log.h
 
 INCLUDEPATH += \
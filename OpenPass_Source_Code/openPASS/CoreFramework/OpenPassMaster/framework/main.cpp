@@ -59,6 +59,13 @@ static QString ParseArguments(const QStringList& arguments);
 //-----------------------------------------------------------------------------
 static void CreateResultPathIfNecessary(const std::string& resultPath);
 
+//-----------------------------------------------------------------------------
+//! \brief Resolves a path relative to the application directory.
+//! \param[in] path The absolute or relative path.
+//! \returns The cleaned absolute path.
+//-----------------------------------------------------------------------------
+std::string GetAbsolutePath(const std::string& path);
+
 //-----------------------------------------------------------------------------
 //! \brief Initializes application logging.
 //! \param[in] logPath The path identifying where to write the logs.
@@ -120,6 +127,24 @@ extern "C" Q_DECL_EXPORT int run(int argc, char* argv[])
     LOG_INTERN(LogLevel::DebugCore) << "slave: " << slave;
     LOG_INTERN(LogLevel::DebugCore) << "libraries: " << masterConfig.libraries;
     LOG_INTERN(LogLevel::DebugCore) << "number of slaves: " << masterConfig.slaveConfigs.size();
+    LOG_INTERN(LogLevel::DebugCore) << "max parallel slaves: " << masterConfig.maxParallelSlaves;
+    LOG_INTERN(LogLevel::DebugCore) << "slave memory budget: " << masterConfig.slaveMemoryBudget;
+    LOG_INTERN(LogLevel::DebugCore) << "max retries: " << masterConfig.maxRetries;
+    LOG_INTERN(LogLevel::DebugCore) << "persistent slaves: " << masterConfig.persistentSlaves;
+
+    #ifndef USESLAVELIBRARY
+    auto& processManager = ProcessManager::getInstance();
+    processManager.SetLimits(masterConfig.maxParallelSlaves, masterConfig.slaveMemoryBudget, masterConfig.maxRetries);
+
+    if (masterConfig.persistentSlaves)
+    {
+        processManager.EnableWorkers(slave,
+        {
+            { "--logLevel", std::to_string(masterConfig.logLevel) },
+            { "--lib",      masterConfig.libraries }
+        });
+    }
+    #endif // USESLAVELIBRARY
 
     for (const auto& slaveConfig : masterConfig.slaveConfigs)
     {
@@ -136,22 +161,25 @@ extern "C" Q_DECL_EXPORT int run(int argc, char* argv[])
 
         #ifndef USESLAVELIBRARY
 
-        if (ProcessManager::getInstance().StartProcess(slave, arguments))
+        std::stringstream strStream;
+        for (const auto& [command, value] : arguments)
         {
-            std::stringstream strStream;
-            for (const auto& [command, value] : arguments)
-            {
-                strStream << command << " " << value << "\n";
-            }
-            LOG_INTERN(LogLevel::Info) << slave << " started with \n" << strStream.str() << std::endl;
-        }
-        else
-        {
-            LOG_INTERN(LogLevel::Error) << slave << " not started, check path.";
-            exit(EXIT_FAILURE);
+            strStream << command << " " << value << "\n";
         }
+        LOG_INTERN(LogLevel::Info) << slave << " queued with priority " << slaveConfig.priority << " and \n"
+                                   << strStream.str() << std::endl;
+
+        processManager.EnqueueJob(slave, arguments, slaveConfig.priority);
+    }
+
+    const bool allStarted = processManager.Run();
+    processManager.WriteSummary(GetAbsolutePath(masterConfig.jobSummary));
+
+    if (!allStarted)
+    {
+        LOG_INTERN(LogLevel::Error) << slave << " not started, check path.";
+        exit(EXIT_FAILURE);
     }
-    ProcessManager::getInstance().WaitAndClear();
 
         #else
         QtConcurrent::run([arguments, &argv, &slave]
@@ -177,15 +205,20 @@ extern "C" Q_DECL_EXPORT int run(int argc, char* argv[])
     return 0;
 }
 
-std::string InitLogging(const std::string& logPath, int logLevel)
+std::string GetAbsolutePath(const std::string& path)
 {
     QDir baseDir = QCoreApplication::applicationDirPath();
-    QString logFile = baseDir.absoluteFilePath(QString::fromStdString(logPath));
-    logFile = baseDir.cleanPath(logFile);
+    QString absolutePath = baseDir.absoluteFilePath(QString::fromStdString(path));
+    return baseDir.cleanPath(absolutePath).toStdString();
+}
+
+std::string InitLogging(const std::string& logPath, int logLevel)
+{
+    std::string logFile = GetAbsolutePath(logPath);
 
-    LogOutputPolicy::SetFile(logFile.toStdString());
+    LogOutputPolicy::SetFile(logFile);
     LogFile::ReportingLevel() = static_cast<LogLevel>(logLevel);
-    return logFile.toStdString();
+    return logFile;
 }
 
 QString ParseArguments(const QStringList& arguments)
@@ -38,11 +38,21 @@ public:
         std::optional<std::string> logFileMaster,
         std::optional<std::string> slave,
         std::optional<std::string> libraries,
+        std::optional<int> maxParallelSlaves,
+        std::optional<int> slaveMemoryBudget,
+        std::optional<int> maxRetries,
+        std::optional<std::string> jobSummary,
+        std::optional<bool> persistentSlaves,
         SlaveConfigs slaveConfigs) :
         logLevel{CheckOrDefault(logLevel.value_or(defaultLogLevel))},
         logFileMaster{logFileMaster.value_or(defaultLogFileMaster)},
         slave{slave.value_or(defaultSlave)},
         libraries{libraries.value_or(defaultLibraries)},
+        maxParallelSlaves{maxParallelSlaves.value_or(defaultMaxParallelSlaves)},
+        slaveMemoryBudget{slaveMemoryBudget.value_or(defaultSlaveMemoryBudget)},
+        maxRetries{maxRetries.value_or(defaultMaxRetries)},
+        jobSummary{jobSummary.value_or(defaultJobSummary)},
+        persistentSlaves{persistentSlaves.value_or(defaultPersistentSlaves)},
         slaveConfigs{slaveConfigs}
     {}
 
@@ -51,6 +61,11 @@ public:
         logFileMaster{defaultLogFileMaster},
         slave{defaultSlave},
         libraries{defaultLibraries},
+        maxParallelSlaves{defaultMaxParallelSlaves},
+        slaveMemoryBudget{defaultSlaveMemoryBudget},
+        maxRetries{defaultMaxRetries},
+        jobSummary{defaultJobSummary},
+        persistentSlaves{defaultPersistentSlaves},
         slaveConfigs{}
     {}
 
@@ -58,6 +73,11 @@ public:
     const std::string logFileMaster;
     const std::string slave;
     const std::string libraries;
+    const int maxParallelSlaves;        //!< Maximum number of simultaneously running slaves (0: ideal thread count)
+    const int slaveMemoryBudget;        //!< Maximum resident memory of a single slave in MB (0: unlimited)
+    const int maxRetries;               //!< Number of restarts of a crashed slave
+    const std::string jobSummary;       //!< File receiving wall time and exit status of each slave
+    const bool persistentSlaves;        //!< Stream the slave configs to long-lived slaves instead of one process each
     const SlaveConfigs slaveConfigs;
 
 private:
@@ -65,6 +85,11 @@ private:
     static constexpr char defaultLogFileMaster[] = "OpenPassMaster.log";
     static constexpr char defaultSlave[] = "OpenPassSlave";
     static constexpr char defaultLibraries[] = "lib";
+    static constexpr int defaultMaxParallelSlaves = 0;
+    static constexpr int defaultSlaveMemoryBudget = 0;
+    static constexpr int defaultMaxRetries = 0;
+    static constexpr char defaultJobSummary[] = "OpenPassMasterJobs.csv";
+    static constexpr bool defaultPersistentSlaves = false;
 
     //-------------------------------------------------------------------------
     //! \brief Checks if the passed value is in between the minimum and maximum
@@ -10,18 +10,27 @@
 *******************************************************************************/
 
 #include "processManager.h"
+#include "workerProtocol.h"
+#include <QEventLoop>
+#include <QFile>
 #include <algorithm>
+#include <fstream>
+
+namespace {
+constexpr int memoryPollInterval = 1000; // [ms]
+} // namespace
 
 ProcessManager::ProcessManager(QObject* parent):
     QObject(parent)
 {
     idealProcessCount = QThread::idealThreadCount();
+    connect(&memoryTimer, &QTimer::timeout, this, &ProcessManager::CheckMemoryBudget);
 }
 
 void ProcessManager::RemoveProcess(QProcess* process)
 {
     processMap.remove(process);
-    delete process;
+    process->deleteLater();
 }
 
 ProcessManager& ProcessManager::getInstance()
@@ -30,28 +39,64 @@ ProcessManager& ProcessManager::getInstance()
     return instance;
 }
 
-bool ProcessManager::StartProcess(const std::string& processPath,
-                                  const std::list<std::pair<std::string, std::string>>& arguments)
+void ProcessManager::SetLimits(int maxParallelProcesses, int memoryBudgetPerProcess, int maxRetries)
 {
-    auto qProcessPath = QString::fromStdString(processPath);
+    idealProcessCount = maxParallelProcesses > 0 ? maxParallelProcesses : QThread::idealThreadCount();
+    this->maxRetries = std::max(0, maxRetries);
+    this->memoryBudgetPerProcess = std::max(0, memoryBudgetPerProcess);
 
-    QStringList qArguments;
-    for (const std::pair<std::string, std::string>& argument : arguments)
+#ifndef Q_OS_LINUX
+    if (this->memoryBudgetPerProcess > 0)
     {
-        qArguments << QString::fromStdString(argument.first) << QString::fromStdString(argument.second);
+        LOG_INTERN(LogLevel::Warning) << "memory budget per slave is only supported on linux and will be ignored";
+        this->memoryBudgetPerProcess = 0;
     }
+#endif
+}
+
+void ProcessManager::EnableWorkers(const std::string& processPath, const Arguments& arguments)
+{
+    workerMode = true;
+    workerPath = processPath;
+    workerArguments = arguments;
+}
+
+void ProcessManager::EnqueueJob(const std::string& processPath, const Arguments& arguments, int priority)
+{
+    Job job;
+    job.id = static_cast<int>(jobs.size());
+    job.priority = priority;
+    job.processPath = processPath;
+    job.arguments = arguments;
+    jobs.push_back(job);
 
-    while (processMap.size() > idealProcessCount)
+    // stable insertion: behind all jobs with higher or equal priority
+    auto position = std::find_if(queue.begin(), queue.end(), [this, priority](std::size_t index)
     {
-        processMap.begin().key()->waitForFinished(1);
+        return jobs[index].priority < priority;
+    });
+    queue.insert(position, jobs.size() - 1);
+}
+
+bool ProcessManager::StartJob(Job& job)
+{
+    auto qProcessPath = QString::fromStdString(job.processPath);
+
+    QStringList qArguments;
+    for (const std::pair<std::string, std::string>& argument : job.arguments)
+    {
+        qArguments << QString::fromStdString(argument.first) << QString::fromStdString(argument.second);
     }
 
     QProcess* newProcess = new QProcess();
     newProcess->start(qProcessPath, qArguments);
+    ++job.attempts;
 
     if (newProcess->processId() == 0)
     {
-        LOG_INTERN(LogLevel::Error) << processPath << " not started, check path.";
+        LOG_INTERN(LogLevel::Error) << job.processPath << " not started, check path.";
+        job.state = JobState::NotStarted;
+        delete newProcess;
         return false;
     }
 
@@ -59,27 +104,356 @@ bool ProcessManager::StartProcess(const std::string& processPath,
                                     QString::number(newProcess->processId()).toStdString() << "###";
 
     connect(newProcess, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
-            [this, newProcess](int exitCode, QProcess::ExitStatus exitStatus)
+            this, [this, newProcess](int exitCode, QProcess::ExitStatus exitStatus)
     {
-        Q_UNUSED(exitCode);
-        Q_UNUSED(exitStatus);
-        RemoveProcess(newProcess);
+        OnProcessFinished(newProcess, exitCode, exitStatus);
     });
 
-    processMap.insert(newProcess, newProcess->processId());
+    job.state = JobState::Running;
+    job.timer.start();
+    processMap.insert(newProcess, job.id);
 
     return true;
 }
 
-void ProcessManager::WaitAndClear()
+bool ProcessManager::IsBusy() const
+{
+    return std::any_of(processMap.cbegin(), processMap.cend(), [](int jobIndex)
+    {
+        return jobIndex >= 0;
+    });
+}
+
+void ProcessManager::Dispatch()
+{
+    if (workerMode)
+    {
+        DispatchToWorkers();
+    }
+    else
+    {
+        while (processMap.size() < idealProcessCount && !queue.empty())
+        {
+            Job& job = jobs[queue.front()];
+            queue.pop_front();
+
+            if (!StartJob(job))
+            {
+                startFailed = true;
+            }
+        }
+    }
+
+    if (!IsBusy() && queue.empty())
+    {
+        emit AllJobsFinished();
+    }
+}
+
+void ProcessManager::OnProcessFinished(QProcess* process, int exitCode, QProcess::ExitStatus exitStatus)
+{
+    Job& job = jobs[processMap.value(process)];
+    job.wallTime += job.timer.elapsed();
+    RemoveProcess(process);
+
+    CompleteJob(job, exitCode, exitStatus == QProcess::CrashExit);
+    Dispatch();
+}
+
+void ProcessManager::CompleteJob(Job& job, int exitCode, bool crashed)
+{
+    job.exitCode = exitCode;
+
+    if (job.state == JobState::MemoryExceeded)
+    {
+        LOG_INTERN(LogLevel::Error) << "slave job " << job.id << " killed, memory budget of "
+                                    << memoryBudgetPerProcess << " MB exceeded";
+    }
+    else if (crashed)
+    {
+        if (job.attempts <= maxRetries)
+        {
+            LOG_INTERN(LogLevel::Warning) << "slave job " << job.id << " crashed, retry " << job.attempts
+                                          << " of " << maxRetries;
+            job.state = JobState::Queued;
+            queue.push_front(static_cast<std::size_t>(job.id));
+        }
+        else
+        {
+            LOG_INTERN(LogLevel::Error) << "slave job " << job.id << " crashed after " << job.attempts << " attempt(s)";
+            job.state = JobState::Crashed;
+        }
+    }
+    else
+    {
+        LOG_INTERN(LogLevel::Info) << "slave job " << job.id << " finished with exit code " << exitCode
+                                   << " after " << job.wallTime << " ms";
+        job.state = JobState::Finished;
+    }
+}
+
+QProcess* ProcessManager::StartWorker()
+{
+    QStringList qArguments {WorkerProtocol::workerFlag};
+    for (const std::pair<std::string, std::string>& argument : workerArguments)
+    {
+        qArguments << QString::fromStdString(argument.first) << QString::fromStdString(argument.second);
+    }
+
+    QProcess* worker = new QProcess();
+    worker->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+    worker->start(QString::fromStdString(workerPath), qArguments);
+
+    if (worker->processId() == 0)
+    {
+        LOG_INTERN(LogLevel::Error) << workerPath << " not started, check path.";
+        delete worker;
+        return nullptr;
+    }
+
+    LOG_INTERN(LogLevel::DebugCore) << std::endl << "### worker start pid: " <<
+                                    QString::number(worker->processId()).toStdString() << "###";
+
+    connect(worker, &QProcess::readyReadStandardOutput, this, [this, worker]()
+    {
+        OnWorkerOutput(worker);
+    });
+    connect(worker, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
+            this, [this, worker](int exitCode, QProcess::ExitStatus)
+    {
+        OnWorkerFinished(worker, exitCode);
+    });
+
+    processMap.insert(worker, -1);
+    return worker;
+}
+
+void ProcessManager::SendJob(QProcess* worker, Job& job)
+{
+    QByteArray line = QByteArray::number(job.id);
+    for (const std::pair<std::string, std::string>& argument : job.arguments)
+    {
+        line += WorkerProtocol::separator;
+        line += QByteArray::fromStdString(argument.first);
+        line += WorkerProtocol::separator;
+        line += QByteArray::fromStdString(argument.second);
+    }
+    line += '\n';
+
+    ++job.attempts;
+    job.state = JobState::Running;
+    job.timer.start();
+    processMap[worker] = job.id;
+
+    worker->write(line);
+}
+
+void ProcessManager::DispatchToWorkers()
+{
+    for (auto worker = processMap.begin(); worker != processMap.end() && !queue.empty(); ++worker)
+    {
+        if (worker.value() < 0)
+        {
+            SendJob(worker.key(), jobs[queue.front()]);
+            queue.pop_front();
+        }
+    }
+
+    while (!queue.empty() && processMap.size() < idealProcessCount)
+    {
+        QProcess* worker = StartWorker();
+        if (!worker)
+        {
+            startFailed = true;
+            for (std::size_t jobIndex : queue)
+            {
+                ++jobs[jobIndex].attempts;
+                jobs[jobIndex].state = JobState::NotStarted;
+            }
+            queue.clear();
+            break;
+        }
+
+        SendJob(worker, jobs[queue.front()]);
+        queue.pop_front();
+    }
+}
+
+void ProcessManager::OnWorkerOutput(QProcess* worker)
+{
+    bool jobFinished = false;
+
+    while (worker->canReadLine())
+    {
+        // other output of the slave is ignored
+        const QList<QByteArray> fields = worker->readLine().trimmed().split(WorkerProtocol::separator);
+        if (fields.size() != 3 || fields[0] != WorkerProtocol::jobFinished)
+        {
+            continue;
+        }
+
+        const int jobIndex = processMap.value(worker, -1);
+        if (jobIndex < 0 || fields[1].toInt() != jobIndex)
+        {
+            LOG_INTERN(LogLevel::Warning) << "unexpected job " << fields[1].toStdString() << " reported by worker";
+            continue;
+        }
+
+        Job& job = jobs[static_cast<std::size_t>(jobIndex)];
+        job.wallTime += job.timer.elapsed();
+        processMap[worker] = -1;
+
+        CompleteJob(job, fields[2].toInt(), false);
+        jobFinished = true;
+    }
+
+    if (jobFinished)
+    {
+        Dispatch();
+    }
+}
+
+void ProcessManager::OnWorkerFinished(QProcess* worker, int exitCode)
+{
+    const int jobIndex = processMap.value(worker, -1);
+    RemoveProcess(worker);
+
+    // a worker only terminates on its own, if it crashed during a job
+    if (jobIndex >= 0)
+    {
+        Job& job = jobs[static_cast<std::size_t>(jobIndex)];
+        job.wallTime += job.timer.elapsed();
+        CompleteJob(job, exitCode, true);
+    }
+
+    Dispatch();
+}
+
+void ProcessManager::StopWorkers()
 {
     QMapIterator<QProcess*, int> processMapIterator(processMap);
     while (processMapIterator.hasNext())
     {
         processMapIterator.next();
-        QProcess* process = processMapIterator.key();
-        process->waitForFinished(-1); //default timeout 30s, -1 :infinity
+        QProcess* worker = processMapIterator.key();
+        disconnect(worker, nullptr, this, nullptr);
+        worker->closeWriteChannel();
+        worker->waitForFinished(-1);
+        delete worker;
+    }
+    processMap.clear();
+}
+
+void ProcessManager::CheckMemoryBudget()
+{
+#ifdef Q_OS_LINUX
+    const qint64 budgetKb = static_cast<qint64>(memoryBudgetPerProcess) * 1024;
+
+    for (auto process = processMap.begin(); process != processMap.end(); ++process)
+    {
+        QFile status(QString("/proc/%1/status").arg(process.key()->processId()));
+        if (!status.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            continue;
+        }
+
+        for (const QString& line : QString(status.readAll()).split('\n'))
+        {
+            if (line.startsWith("VmRSS:"))
+            {
+                // format: "VmRSS:     1234 kB"
+                const qint64 residentKb = line.mid(6).trimmed().section(' ', 0, 0).toLongLong();
+
+                if (residentKb > budgetKb)
+                {
+                    // idle workers are simply restarted on demand
+                    if (process.value() >= 0)
+                    {
+                        Job& job = jobs[static_cast<std::size_t>(process.value())];
+                        if (job.state != JobState::Running)
+                        {
+                            break;
+                        }
+                        job.state = JobState::MemoryExceeded;
+                    }
+                    process.key()->kill();
+                }
+                break;
+            }
+        }
+    }
+#endif
+}
+
+bool ProcessManager::Run()
+{
+    QEventLoop eventLoop;
+    connect(this, &ProcessManager::AllJobsFinished, &eventLoop, &QEventLoop::quit);
+
+    if (memoryBudgetPerProcess > 0)
+    {
+        memoryTimer.start(memoryPollInterval);
+    }
+
+    Dispatch();
+
+    if (IsBusy() || !queue.empty())
+    {
+        eventLoop.exec();
+    }
+
+    memoryTimer.stop();
+    StopWorkers();
+    return !startFailed;
+}
+
+const char* ProcessManager::ToString(JobState state)
+{
+    switch (state)
+    {
+        case JobState::Queued:
+            return "Queued";
+        case JobState::Running:
+            return "Running";
+        case JobState::Finished:
+            return "Finished";
+        case JobState::Crashed:
+            return "Crashed";
+        case JobState::NotStarted:
+            return "NotStarted";
+        case JobState::MemoryExceeded:
+            return "MemoryExceeded";
     }
+    return "";
+}
+
+bool ProcessManager::WriteSummary(const std::string& summaryFile) const
+{
+    std::ofstream summary(summaryFile);
+    if (!summary.is_open())
+    {
+        LOG_INTERN(LogLevel::Error) << "could not write job summary " << summaryFile;
+        return false;
+    }
+
+    summary << "Job;Priority;State;ExitCode;Attempts;WallTime[ms];Arguments\n";
+    for (const auto& job : jobs)
+    {
+        summary << job.id << ';'
+                << job.priority << ';'
+                << ToString(job.state) << ';'
+                << job.exitCode << ';'
+                << job.attempts << ';'
+                << job.wallTime << ';';
+
+        for (const auto& [command, value] : job.arguments)
+        {
+            summary << command << ' ' << value << ' ';
+        }
+        summary << '\n';
+    }
+
+    return true;
 }
 
 void ProcessManager::KillAll()
@@ -89,7 +463,14 @@ void ProcessManager::KillAll()
     {
         processMapIterator.next();
         QProcess* process = processMapIterator.key();
+        disconnect(process, nullptr, this, nullptr);
         process->kill();
-        RemoveProcess(process);
+        process->waitForFinished();
+        if (processMapIterator.value() >= 0)
+        {
+            jobs[static_cast<std::size_t>(processMapIterator.value())].state = JobState::Crashed;
+        }
+        delete process;
     }
+    processMap.clear();
 }
@@ -9,20 +9,61 @@
 * SPDX-License-Identifier: EPL-2.0
 *******************************************************************************/
 
+//-----------------------------------------------------------------------------
+//! @file  processManager.h
+//! @brief This file contains the scheduler of the slave processes.
+//!
+//! Slave jobs are queued by priority and dispatched as soon as a running
+//! slave finishes, limited by the maximum number of parallel slaves.
+//! Jobs are either executed by one slave process each, or streamed to
+//! persistent slaves started in worker mode (see workerProtocol.h).
+//-----------------------------------------------------------------------------
+
 #pragma once
 
+#include <QElapsedTimer>
 #include <QObject>
-#include <QThread>
 #include <QProcess>
+#include <QThread>
+#include <QTimer>
 #include <QMap>
+#include <deque>
 #include <list>
 #include <string>
+#include <vector>
 #include "log.h"
 
 class ProcessManager : public QObject
 {
     Q_OBJECT
 public:
+    using Arguments = std::list<std::pair<std::string, std::string>>;
+
+    //! Final state of a slave job
+    enum class JobState
+    {
+        Queued,
+        Running,
+        Finished,
+        Crashed,
+        NotStarted,
+        MemoryExceeded
+    };
+
+    //! Bookkeeping of a single slave job
+    struct Job
+    {
+        int id;                         //!< Id of the job in order of enqueueing
+        int priority;                   //!< Jobs with higher priority are started first
+        std::string processPath;
+        Arguments arguments;
+        JobState state {JobState::Queued};
+        int attempts {0};               //!< Number of started attempts including retries
+        int exitCode {0};
+        qint64 wallTime {0};            //!< Accumulated wall time of all attempts [ms]
+        QElapsedTimer timer;
+    };
+
     static ProcessManager& getInstance();
 
     ProcessManager(const ProcessManager&) = delete;
@@ -31,18 +72,92 @@ public:
     ProcessManager& operator=(ProcessManager&&) = delete;
     virtual ~ProcessManager() { KillAll(); }
 
-    bool StartProcess(const std::string& processPath, const std::list<std::pair<std::string, std::string>>& arguments);
-    void WaitAndClear();
+    /*!
+    * \brief Sets the scheduling limits
+    *
+    * \param[in] maxParallelProcesses     Maximum number of simultaneously running slaves (<= 0: ideal thread count)
+    * \param[in] memoryBudgetPerProcess   Maximum resident memory of a slave in MB (<= 0: unlimited)
+    * \param[in] maxRetries               Number of restarts of a crashed slave
+    */
+    void SetLimits(int maxParallelProcesses, int memoryBudgetPerProcess, int maxRetries);
+
+    /*!
+    * \brief Executes the jobs in persistent slaves instead of one process per job
+    *
+    * \details The slaves are started on demand, up to the maximum number of parallel
+    *          processes, and reuse their loaded libraries between jobs.
+    *
+    * \param[in] processPath   Path of the slave executable
+    * \param[in] arguments     Command line arguments of the slaves, the job arguments are sent per job
+    */
+    void EnableWorkers(const std::string& processPath, const Arguments& arguments);
+
+    /*!
+    * \brief Adds a slave job to the queue
+    *
+    * \param[in] processPath   Path of the slave executable
+    * \param[in] arguments     Command line arguments of the slave
+    * \param[in] priority      Jobs with higher priority are started first, equal priorities keep their order
+    */
+    void EnqueueJob(const std::string& processPath, const Arguments& arguments, int priority = 0);
+
+    /*!
+    * \brief Runs all queued jobs and returns when the last slave finished
+    *
+    * \return false, if a slave could not be started
+    */
+    bool Run();
+
+    /*!
+    * \brief Writes wall time, attempts and exit status of each job as csv
+    *
+    * \param[in] summaryFile   Path of the summary file
+    * \return true on success
+    */
+    bool WriteSummary(const std::string& summaryFile) const;
+
     void KillAll();
 
 signals:
+    void AllJobsFinished();
 
-public slots:
+private slots:
+    void CheckMemoryBudget();
 
 private:
     ProcessManager(QObject* parent = nullptr);
+
+    //! Starts queued jobs until the parallel limit is reached
+    void Dispatch();
+    bool StartJob(Job& job);
+    void OnProcessFinished(QProcess* process, int exitCode, QProcess::ExitStatus exitStatus);
     void RemoveProcess(QProcess* process);
 
+    //! Updates the job state after its slave terminated or reported the job as finished
+    void CompleteJob(Job& job, int exitCode, bool crashed);
+
+    //! Assigns queued jobs to idle workers and starts new workers if necessary
+    void DispatchToWorkers();
+    QProcess* StartWorker();
+    void SendJob(QProcess* worker, Job& job);
+    void OnWorkerOutput(QProcess* worker);
+    void OnWorkerFinished(QProcess* worker, int exitCode);
+    void StopWorkers();
+    bool IsBusy() const;
+
+    static const char* ToString(JobState state);
+
     int idealProcessCount;
-    QMap<QProcess*, int> processMap;
+    int memoryBudgetPerProcess {0};
+    int maxRetries {0};
+    bool startFailed {false};
+
+    bool workerMode {false};
+    std::string workerPath;
+    Arguments workerArguments;
+
+    std::vector<Job> jobs;
+    std::deque<std::size_t> queue;      //!< Indices into jobs, sorted by priority
+    QMap<QProcess*, int> processMap;    //!< Running slaves and the index of their current job (-1: idle worker)
+    QTimer memoryTimer;
 };
@@ -28,20 +28,24 @@ class SlaveConfig
 public:
     SlaveConfig(std::optional<std::string> logFile,
                 std::optional<std::string> configs,
-                std::optional<std::string> results) :
+                std::optional<std::string> results,
+                std::optional<int> priority) :
         logFile{logFile.value_or(defaultLogFile)},
         configs{configs.value_or(defaultConfigs)},
-        results{results.value_or(defaultResults)}
+        results{results.value_or(defaultResults)},
+        priority{priority.value_or(defaultPriority)}
     {}
 
     const std::string logFile;
     const std::string configs;
     const std::string results;
+    const int priority;             //!< Slaves with higher priority are started first
 
 private:
     static constexpr char defaultLogFile[] = "OpenPassSlave.log";
     static constexpr char defaultConfigs[] = "configs";
     static constexpr char defaultResults[] = "results";
+    static constexpr int defaultPriority = 0;
 };
 
 } // namespace Configuration
@@ -82,6 +82,11 @@ MasterConfig MasterConfigImporter::Import(const QString& filename)
         GetValue<std::string>(document, "logFileMaster"),
         GetValue<std::string>(document, "slave"),
         GetValue<std::string>(document, "libraries"),
+        GetValue<int>(document, "maxParallelSlaves"),
+        GetValue<int>(document, "slaveMemoryBudget"),
+        GetValue<int>(document, "maxRetries"),
+        GetValue<std::string>(document, "jobSummary"),
+        GetValue<bool>(document, "persistentSlaves"),
         ParseSlaveConfigs(document)
     };
 }
@@ -109,7 +114,8 @@ SlaveConfig MasterConfigImporter::ParseSlaveConfig(const QDomElement& element)
     {
         GetValue<std::string>(element, "logFileSlave"),
         GetValue<std::string>(element, "configurations"),
-        GetValue<std::string>(element, "results")
+        GetValue<std::string>(element, "results"),
+        GetValue<int>(element, "priority")
     };
 }
 
@@ -120,12 +126,11 @@ QDomElement MasterConfigImporter::ReadDocument(QFile& xmlFile, const std::string
         throw std::runtime_error("Could not open file " + file);
     }
 
-    QByteArray xmlData(xmlFile.readAll());
     QDomDocument document;
     QString errorMsg;
     int errorLine;
 
-    if (!document.setContent(xmlData, &errorMsg, &errorLine))
+    if (!document.setContent(&xmlFile, &errorMsg, &errorLine))
     {
         throw std::runtime_error("Invalid xml file: " + file + "(" + std::to_string(errorLine) + ")");
     }
@@ -16,6 +16,7 @@
 #include "observationBinding.h"
 #include "eventDetector.h"
 #include "CoreFramework/CoreShare/log.h"
+#include "libraryCache.h"
 
 namespace SimulationSlave
 {
@@ -28,6 +29,8 @@ bool EventDetectorLibrary::Init()
         return false;
     }
 
+    LibraryCache::Prepare(library);
+
     if(!library->load())
     {
         LOG_INTERN(LogLevel::Error) << library->errorString().toStdString();
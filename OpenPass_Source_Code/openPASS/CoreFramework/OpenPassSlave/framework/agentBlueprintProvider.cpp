@@ -13,9 +13,12 @@
 #include "dynamicProfileSampler.h"
 #include "dynamicParametersSampler.h"
 
-AgentBlueprintProvider::AgentBlueprintProvider(ConfigurationContainerInterface *configurationContainer, const SamplerInterface& sampler) :
+AgentBlueprintProvider::AgentBlueprintProvider(ConfigurationContainerInterface *configurationContainer, const SamplerInterface& sampler,
+                                               StochasticsInterface& commonAgentStochastics, size_t presamplingBlockSize) :
     agentProfileSampler(configurationContainer, sampler),
     sampler(sampler),
+    commonAgentStochastics(commonAgentStochastics),
+    presamplingBlockSize(presamplingBlockSize),
     profiles(configurationContainer->GetProfiles()),
     agentProfiles(configurationContainer->GetProfiles()->GetAgentProfiles()),
     vehicleModels(configurationContainer->GetVehicleModels()),
@@ -26,60 +29,153 @@ AgentBlueprintProvider::AgentBlueprintProvider(ConfigurationContainerInterface *
 
 bool AgentBlueprintProvider::SampleAgent(AgentBlueprintInterface &agentBlueprint, LaneCategory laneCategory, unsigned int scenarioAgentIterator)
 {
-    agentProfileSampler.SampleAgentProfileName(agentBlueprint, laneCategory, scenarioAgentIterator);
-    auto agentProfile = agentProfiles.at(agentBlueprint.GetAgentProfileName());
-    if (agentProfile.type == AgentProfileType::Dynamic)
+    std::shared_ptr<const SampledAgent> sampledAgent;
+
+    const AgentCategory agentCategory = agentBlueprint.GetAgentCategory();
+    if (agentCategory == AgentCategory::Ego || agentCategory == AgentCategory::Scenario)
     {
-        SampledProfiles sampledProfiles = SampledProfiles::make(agentBlueprint.GetAgentProfileName(), sampler, profiles)
-                .SampleDriverProfile()
-                .SampleVehicleProfile()
-                .SampleVehicleComponentProfiles();
-        DynamicParameters dynamicParameters = DynamicParameters::make(sampler, sampledProfiles.vehicleProfileName, profiles->GetVehicleProfiles(), profiles->GetSensorProfiles())
-                .SampleSensorLatencies();
-        AgentBuildInformation agentBuildInformation = AgentBuildInformation::make(sampledProfiles, dynamicParameters, systemConfigBlueprint, profiles, vehicleModels)
-                .SetVehicleModelParameters()
-                .GatherBasicComponents()
-                .GatherDriverComponents()
-                .GatherVehicleComponents()
-                .GatherSensors();
-        return GenerateDynamicAgentBlueprint(agentBlueprint, agentBuildInformation, sampledProfiles.driverProfileName);
+        agentProfileSampler.SampleAgentProfileName(agentBlueprint, laneCategory, scenarioAgentIterator);
+        sampledAgent = SampleAgentOfProfile(agentBlueprint.GetAgentProfileName(), sampler);
     }
     else
     {
-        return GenerateStaticAgentBlueprint(agentBlueprint, agentProfile.systemConfigFile, agentProfile.systemId, agentProfile.vehicleModel);
+        auto& queue = presampledAgents[laneCategory];
+        if (queue.empty())
+        {
+            PresampleAgents(laneCategory);
+        }
+
+        sampledAgent = std::move(queue.front());
+        queue.pop_front();
+    }
+
+    if (!sampledAgent)
+    {
+        return false;
     }
+
+    ApplySampledAgent(*sampledAgent, agentBlueprint);
+    return true;
+}
+
+void AgentBlueprintProvider::Reset()
+{
+    presampledAgents.clear();
 }
 
-bool AgentBlueprintProvider::GenerateDynamicAgentBlueprint(AgentBlueprintInterface &agentBlueprint, AgentBuildInformation agentBuildInformation, std::string &driverProfileName)
+void AgentBlueprintProvider::PresampleAgents(LaneCategory laneCategory)
 {
-    agentBlueprint.SetVehicleModelName(agentBuildInformation.vehicleModelName);
-    agentBlueprint.SetVehicleModelParameters(agentBuildInformation.vehicleModelParameters);
-    agentBlueprint.SetDriverProfileName(driverProfileName);
-    agentBlueprint.SetAgentType(agentBuildInformation.agentType);
+    auto& queue = presampledAgents[laneCategory];
+    const SamplerInterface& commonAgentSampler = GetCommonAgentSampler(laneCategory);
 
-    for(const auto& sensor : agentBuildInformation.sensorParameters)
+    for (size_t i = 0; i < presamplingBlockSize; ++i)
     {
-        agentBlueprint.AddSensor(sensor);
+        // an agent profile which cannot be resolved is kept as nullptr and only reported when it is spawned
+        queue.push_back(SampleAgentOfProfile(agentProfileSampler.SampleCommonAgentProfileName(laneCategory, commonAgentSampler),
+                                             commonAgentSampler));
+    }
+}
+
+const SamplerInterface& AgentBlueprintProvider::GetCommonAgentSampler(LaneCategory laneCategory)
+{
+    auto& stream = commonAgentStreams[laneCategory];
+    if (!stream.sampler)
+    {
+        stream.stochastics = commonAgentStochastics.CreateStream(static_cast<std::uint64_t>(laneCategory));
+        if (!stream.stochastics)
+        {
+            LOG_INTERN(LogLevel::Warning) << "Stochastics do not support streams, the common agents of all lane categories share one stream";
+        }
+        stream.sampler = std::make_unique<Sampler>(stream.stochastics ? *stream.stochastics : commonAgentStochastics);
+    }
+
+    return *stream.sampler;
+}
+
+std::shared_ptr<const SampledAgent> AgentBlueprintProvider::SampleAgentOfProfile(const std::string& agentProfileName,
+                                                                                 const SamplerInterface& profileSampler)
+{
+    const auto& agentProfile = agentProfiles.at(agentProfileName);
+    if (agentProfile.type == AgentProfileType::Dynamic)
+    {
+        return SampleDynamicAgent(agentProfileName, profileSampler);
+    }
+    else
+    {
+        return ResolveStaticAgent(agentProfileName, agentProfile);
     }
-    return true;
 }
 
-bool AgentBlueprintProvider::GenerateStaticAgentBlueprint(AgentBlueprintInterface &agentBlueprint, std::string systemConfigName, int systemId, std::string vehicleModelName)
+std::shared_ptr<const SampledAgent> AgentBlueprintProvider::SampleDynamicAgent(const std::string& agentProfileName,
+                                                                               const SamplerInterface& profileSampler)
 {
+    SampledProfiles sampledProfiles = SampledProfiles::make(agentProfileName, profileSampler, profiles)
+            .SampleDriverProfile()
+            .SampleVehicleProfile()
+            .SampleVehicleComponentProfiles();
+    DynamicParameters dynamicParameters = DynamicParameters::make(profileSampler, sampledProfiles.vehicleProfileName, profiles->GetVehicleProfiles(), profiles->GetSensorProfiles())
+            .SampleSensorLatencies();
+    AgentBuildInformation agentBuildInformation = AgentBuildInformation::make(sampledProfiles, dynamicParameters, systemConfigBlueprint, profiles, vehicleModels)
+            .SetVehicleModelParameters()
+            .GatherBasicComponents()
+            .GatherDriverComponents()
+            .GatherVehicleComponents()
+            .GatherSensors();
+
+    auto sampledAgent = std::make_shared<SampledAgent>();
+    sampledAgent->agentProfileName = agentProfileName;
+    sampledAgent->vehicleModelName = std::move(agentBuildInformation.vehicleModelName);
+    sampledAgent->vehicleModelParameters = std::move(agentBuildInformation.vehicleModelParameters);
+    sampledAgent->driverProfileName = std::move(sampledProfiles.driverProfileName);
+    sampledAgent->agentType = std::move(agentBuildInformation.agentType);
+    sampledAgent->sensorParameters = std::move(agentBuildInformation.sensorParameters);
+
+    return sampledAgent;
+}
+
+std::shared_ptr<const SampledAgent> AgentBlueprintProvider::ResolveStaticAgent(const std::string& agentProfileName, const AgentProfile& agentProfile)
+{
+    const auto staticAgent = staticAgents.find(agentProfileName);
+    if (staticAgent != staticAgents.end())
+    {
+        return staticAgent->second;
+    }
+
+    auto sampledAgent = std::make_shared<SampledAgent>();
+    sampledAgent->agentProfileName = agentProfileName;
+
     try
     {
-        auto& systems = systemConfigs.at(systemConfigName)->GetSystems();
-        agentBlueprint.SetAgentType(systems.at(systemId));
+        auto& systems = systemConfigs.at(agentProfile.systemConfigFile)->GetSystems();
+        sampledAgent->agentType = systems.at(agentProfile.systemId);
     }
     catch (const std::out_of_range& e)
     {
         LOG_INTERN(LogLevel::Error) << "No system for specified id found in imported systemConfig: " << e.what();
-        return false;
+        return nullptr;
     }
 
-    agentBlueprint.SetVehicleModelName(vehicleModelName);
-    auto vehicleModelParameters = vehicleModels->GetVehicleModel(vehicleModelName);
-    agentBlueprint.SetVehicleModelParameters(vehicleModelParameters);
+    sampledAgent->vehicleModelName = agentProfile.vehicleModel;
+    sampledAgent->vehicleModelParameters = vehicleModels->GetVehicleModel(agentProfile.vehicleModel);
 
-    return true;
+    staticAgents.emplace(agentProfileName, sampledAgent);
+    return sampledAgent;
+}
+
+void AgentBlueprintProvider::ApplySampledAgent(const SampledAgent& sampledAgent, AgentBlueprintInterface& agentBlueprint)
+{
+    agentBlueprint.SetAgentProfileName(sampledAgent.agentProfileName);
+    agentBlueprint.SetVehicleModelName(sampledAgent.vehicleModelName);
+    agentBlueprint.SetVehicleModelParameters(sampledAgent.vehicleModelParameters);
+    agentBlueprint.SetAgentType(sampledAgent.agentType);
+
+    if (!sampledAgent.driverProfileName.empty())
+    {
+        agentBlueprint.SetDriverProfileName(sampledAgent.driverProfileName);
+    }
+
+    for (const auto& sensor : sampledAgent.sensorParameters)
+    {
+        agentBlueprint.AddSensor(sensor);
+    }
 }
@@ -16,22 +16,61 @@
 
 #pragma once
 
+#include <deque>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
 #include "dynamicAgentTypeGenerator.h"
 #include "Interfaces/agentBlueprintProviderInterface.h"
 #include "Interfaces/agentBlueprintInterface.h"
 #include "agentProfileSampler.h"
 #include "Interfaces/configurationContainerInterface.h"
+#include "Interfaces/stochasticsInterface.h"
+#include "sampler.h"
 
+//! Result of sampling an agent profile, which is copied into the AgentBlueprint
+struct SampledAgent
+{
+    std::string agentProfileName;
+    std::string vehicleModelName;
+    VehicleModelParameters vehicleModelParameters;
+    std::string driverProfileName;
+    std::shared_ptr<SimulationSlave::AgentTypeInterface> agentType;
+    std::vector<SensorParameter> sensorParameters;
+};
+
+/*!
+ * \brief Provides the sampled part of an AgentBlueprint
+ *
+ * Common agents are sampled in blocks ahead of time, one queue per LaneCategory, so that spawning
+ * only pops a ready agent. Each LaneCategory draws from its own stream of the common agent
+ * stochastics, so the n-th common agent of a LaneCategory neither depends on the block size nor on
+ * the other LaneCategory, and sampling ahead of time does not shift the main sampler.
+ * Ego and scenario agents are sampled on demand from the main sampler.
+ * Static agent profiles are resolved once and then shared by all agents of the profile.
+ */
 class AgentBlueprintProvider : public AgentBlueprintProviderInterface
 {
 public:
-    AgentBlueprintProvider(ConfigurationContainerInterface* configurationContainer, const SamplerInterface& sampler);
+    /*!
+    * \brief Constructor
+    *
+    * @param[in]        configurationContainer  Configurations of the simulation
+    * @param[in]        sampler                 Main sampler, used for ego and scenario agents
+    * @param[in]        commonAgentStochastics  Stochastics the streams of the common agents are created from
+    * @param[in]        presamplingBlockSize    Number of common agents sampled at once per lane category
+    */
+    AgentBlueprintProvider(ConfigurationContainerInterface* configurationContainer, const SamplerInterface& sampler,
+                           StochasticsInterface& commonAgentStochastics,
+                           size_t presamplingBlockSize = PRESAMPLING_BLOCK_SIZE);
 
     /*!
     * \brief Samples an entire agent
     *
     * \details First samples the agent profile and then depending on wether it is a static or dynamic profile samples the dynamic
-    * profiles and builds an AgentType from this or loads the AgentType from the specified SystemConfig
+    * profiles and builds an AgentType from this or loads the AgentType from the specified SystemConfig.
+    * Common agents are taken from the block sampled ahead of time for the lane category.
     *
     * @param[in/out]    agentBlueprint          All results get stored in the agent blueprint
     * @param[in]        laneCategory            Category of the lane the agent will be spawned in only relevant for common agents
@@ -42,36 +81,57 @@ public:
     virtual bool SampleAgent(AgentBlueprintInterface& agentBlueprint, LaneCategory laneCategory,
                              unsigned int scenarioAgentIterator) override;
 
-    /*!
-     * \brief Store sampled information in AgentBlueprint for dynamic AgentProfile
-     * \param agentBlueprint            All results get stored in the agent blueprint
-     * \param agentBuildInformation     AgentBuildInformation with information to store into the agentBlueprint
-     * \param driverProfileName         name of sampled DriverProfile
-     * \return
-     */
-    bool GenerateDynamicAgentBlueprint(AgentBlueprintInterface& agentBlueprint, AgentBuildInformation agentBuildInformation,
-                                       std::string& driverProfileName);
+    virtual void Reset() override;
 
+    //! Number of common agents sampled at once per lane category
+    static constexpr size_t PRESAMPLING_BLOCK_SIZE = 32;
+
+private:
     /*!
-    * \brief Store sampled information in AgentBlueprint for static AgentProfile
+    * \brief Samples an agent of the given agent profile
     *
-    * @param[in/out]    agentBlueprint          All results get stored in the agent blueprint
-    * @param[in]        systemConfigName        Name of systemConfiguration holding the system information
-    * @param[in]        systemId                Id of system to build (referes to given systemConfig
-    * @param[in]        vehicleModelName        Name of vehicle model for system
+    * @param[in]        agentProfileName        Name of the agent profile
+    * @param[in]        profileSampler          Sampler of the dynamic profiles
     *
-    * @return           true if Agent was succesfully sampled
+    * @return           sampled agent, nullptr if the agent profile could not be resolved
     */
-    bool GenerateStaticAgentBlueprint(AgentBlueprintInterface& agentBlueprint, std::string systemConfigName, int systemId,
-                                      std::string vehicleModelName);
+    std::shared_ptr<const SampledAgent> SampleAgentOfProfile(const std::string& agentProfileName,
+                                                             const SamplerInterface& profileSampler);
+
+    //! Builds the agent of a dynamic agent profile from the sampled profiles
+    std::shared_ptr<const SampledAgent> SampleDynamicAgent(const std::string& agentProfileName,
+                                                           const SamplerInterface& profileSampler);
+
+    //! Resolves the agent of a static agent profile from its SystemConfig, once per agent profile
+    std::shared_ptr<const SampledAgent> ResolveStaticAgent(const std::string& agentProfileName, const AgentProfile& agentProfile);
+
+    //! Samples the next block of common agents for the lane category
+    void PresampleAgents(LaneCategory laneCategory);
+
+    //! Returns the sampler of the common agents of the lane category, creating its stream on first use
+    const SamplerInterface& GetCommonAgentSampler(LaneCategory laneCategory);
+
+    //! Copies the sampled agent into the blueprint
+    static void ApplySampledAgent(const SampledAgent& sampledAgent, AgentBlueprintInterface& agentBlueprint);
 
-private:
     AgentProfileSampler agentProfileSampler;
     const SamplerInterface& sampler;
+    StochasticsInterface& commonAgentStochastics;
+    const size_t presamplingBlockSize;
     ProfilesInterface* profiles;
     std::unordered_map<std::string, AgentProfile>& agentProfiles;
     VehicleModelsInterface* vehicleModels {nullptr};
     std::shared_ptr<SystemConfigInterface> systemConfigBlueprint;
     std::map<std::string, std::shared_ptr<SystemConfigInterface>>& systemConfigs;
 
+    std::unordered_map<std::string, std::shared_ptr<const SampledAgent>> staticAgents;
+    std::map<LaneCategory, std::deque<std::shared_ptr<const SampledAgent>>> presampledAgents;
+
+    //! Stream of the common agents of a lane category, streams follow the reinitialization of commonAgentStochastics
+    struct CommonAgentStream
+    {
+        std::unique_ptr<StochasticsInterface> stochastics;
+        std::unique_ptr<Sampler> sampler;
+    };
+    std::map<LaneCategory, CommonAgentStream> commonAgentStreams;
 };
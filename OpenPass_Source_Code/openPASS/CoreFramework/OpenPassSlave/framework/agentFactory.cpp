@@ -13,6 +13,7 @@
 #include <list>
 #include <sstream>
 #include "agent.h"
+#include "agentBlueprint.h"
 #include "agentFactory.h"
 #include "agentType.h"
 #include "channel.h"
@@ -44,6 +45,7 @@ AgentFactory::AgentFactory(ModelBinding *modelBinding,
 
 AgentFactory::~AgentFactory()
 {
+    ReleaseRecycledAgents();
 }
 
 void AgentFactory::ResetIds()
@@ -53,39 +55,141 @@ void AgentFactory::ResetIds()
 
 void AgentFactory::Clear()
 {
+    ReleaseRecycledAgents();
+
     for(auto &item : agentList)
     {
-        delete item;
+        if(recycleAgents && item.agentType && item.agent->SupportsReset())
+        {
+            recycledAgents[item.agentType.get()].push_back(item);
+        }
+        else
+        {
+            delete item.agent;
+        }
     }
     agentList.clear();
+    agentBlueprints.clear();
+}
+
+void AgentFactory::SetRecycleAgents(bool recycleAgents)
+{
+    this->recycleAgents = recycleAgents;
+}
+
+void AgentFactory::SetComponentRandomStreams(bool componentRandomStreams)
+{
+    this->componentRandomStreams = componentRandomStreams;
+}
+
+void AgentFactory::ReleaseRecycledAgents()
+{
+    for(auto &item : recycledAgents)
+    {
+        for(auto &recycledAgent : item.second)
+        {
+            delete recycledAgent.agent;
+        }
+    }
+    recycledAgents.clear();
 }
 
 Agent* AgentFactory::AddAgent(AgentBlueprintInterface* agentBlueprint,
                               int spawnTime)
 {
-    Agent *agent = CreateAgent(lastAgentId,
-                               agentBlueprint,
-                               spawnTime);
+    Agent *agent = AddAgent(lastAgentId,
+                            agentBlueprint,
+                            spawnTime);
+    if(!agent)
+    {
+        return nullptr;
+    }
+
+    if(keepBlueprints)
+    {
+        if(const auto blueprint = dynamic_cast<AgentBlueprint*>(agentBlueprint))
+        {
+            agentBlueprints[lastAgentId] = std::make_shared<AgentBlueprint>(*blueprint);
+        }
+    }
+
+    lastAgentId++;
+
+    return agent;
+}
+
+Agent* AgentFactory::RestoreAgent(int id,
+                                  AgentBlueprintInterface* agentBlueprint,
+                                  int spawnTime)
+{
+    return AddAgent(id,
+                    agentBlueprint,
+                    spawnTime);
+}
+
+Agent* AgentFactory::AddAgent(int id,
+                              AgentBlueprintInterface* agentBlueprint,
+                              int spawnTime)
+{
+    Agent *agent = ReuseAgent(id,
+                              agentBlueprint,
+                              spawnTime);
+    if(!agent)
+    {
+        agent = CreateAgent(id,
+                            agentBlueprint,
+                            spawnTime);
+    }
     if(!agent)
     {
         LOG_INTERN(LogLevel::Error) << "could not create agent";
         return nullptr;
     }
 
-    if(!world->AddAgent(lastAgentId, agent->GetAgentAdapter()))
+    if(!world->AddAgent(id, agent->GetAgentAdapter()))
     {
         LOG_INTERN(LogLevel::Error) << "could not add agent to network";
         delete agent;
         return nullptr;
     }
 
-    lastAgentId++;
-
-    agentList.push_back(agent);
+    agentList.push_back({agent, agentBlueprint->GetSharedAgentType()});
 
     return agent;
 }
 
+void AgentFactory::SetKeepBlueprints(bool keepBlueprints)
+{
+    this->keepBlueprints = keepBlueprints;
+}
+
+Agent* AgentFactory::GetAgent(int id) const
+{
+    const auto item = std::find_if(agentList.begin(), agentList.end(),
+                                   [id](const AgentInstance& agentInstance)
+                                   {
+                                       return agentInstance.agent->GetId() == id;
+                                   });
+
+    return item == agentList.end() ? nullptr : item->agent;
+}
+
+std::shared_ptr<AgentBlueprintInterface> AgentFactory::GetAgentBlueprint(int id) const
+{
+    const auto item = agentBlueprints.find(id);
+    return item == agentBlueprints.end() ? nullptr : item->second;
+}
+
+int AgentFactory::GetNextAgentId() const
+{
+    return lastAgentId;
+}
+
+void AgentFactory::SetNextAgentId(int id)
+{
+    lastAgentId = id;
+}
+
 Agent *AgentFactory::CreateAgent(int id,
                                  AgentBlueprintInterface* agentBlueprint,
                                  int spawnTime)
@@ -105,7 +209,8 @@ Agent *AgentFactory::CreateAgent(int id,
                            modelBinding,
                            stochastics,
                            observationNetwork,
-                           eventNetwork))
+                           eventNetwork,
+                           componentRandomStreams))
     {
         LOG_INTERN(LogLevel::Error) << "agent could not be instantiated";
         delete agent;
@@ -123,6 +228,31 @@ Agent *AgentFactory::CreateAgent(int id,
     return agent;
 }
 
+Agent *AgentFactory::ReuseAgent(int id,
+                                AgentBlueprintInterface* agentBlueprint,
+                                int spawnTime)
+{
+    auto recycled = recycledAgents.find(&agentBlueprint->GetAgentType());
+    if(recycled == recycledAgents.end() || recycled->second.empty())
+    {
+        return nullptr;
+    }
+
+    Agent *agent = recycled->second.back().agent;
+    recycled->second.pop_back();
+
+    if(!agent->Reset(id,
+                     agentBlueprint,
+                     spawnTime))
+    {
+        LOG_INTERN(LogLevel::Warning) << "agent could not be reused";
+        delete agent;
+        return nullptr;
+    }
+
+    return agent;
+}
+
 bool AgentFactory::ConnectAgentLinks(Agent *agent)
 {
     for(const std::pair<const std::string, ComponentInterface*> &itemComponent : agent->GetComponents())
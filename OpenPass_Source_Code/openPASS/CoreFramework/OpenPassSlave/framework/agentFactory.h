@@ -22,6 +22,8 @@
 
 #include <map>
 #include <list>
+#include <memory>
+#include <vector>
 
 #include "Interfaces/agentFactoryInterface.h"
 #include "Interfaces/eventNetworkInterface.h"
@@ -56,10 +58,34 @@ public:
     void ResetIds();
 
     //-----------------------------------------------------------------------------
-    //! Unloads the model bindings.
+    //! Deletes all agents. If recycling is enabled, agents whose components all
+    //! support being reset are kept instead, to be reused by the next invocation
+    //! for agents of the same agent type. Kept agents which were not reused by
+    //! the current invocation are deleted.
     //-----------------------------------------------------------------------------
     void Clear();
 
+    //-----------------------------------------------------------------------------
+    //! Enables or disables reusing the agents of an invocation in the next one.
+    //!
+    //! @param[in]  recycleAgents       Flag if agents are reused
+    //-----------------------------------------------------------------------------
+    void SetRecycleAgents(bool recycleAgents);
+
+    //-----------------------------------------------------------------------------
+    //! Deletes all agents kept for reuse.
+    //-----------------------------------------------------------------------------
+    void ReleaseRecycledAgents();
+
+    //-----------------------------------------------------------------------------
+    //! Enables or disables an own random stream for each component of an agent,
+    //! keyed by the invocation, the agent id and the component name. The draws of
+    //! an agent then do not depend on the number or order of draws of other agents.
+    //!
+    //! @param[in]  componentRandomStreams  Flag if components draw from own streams
+    //-----------------------------------------------------------------------------
+    void SetComponentRandomStreams(bool componentRandomStreams);
+
     //-----------------------------------------------------------------------------
     //! Creates a new agent based on the provided parameters, then adds it to the
     //! agent network in the world representation. Also adds agents during runtime.
@@ -73,7 +99,78 @@ public:
     Agent *AddAgent(AgentBlueprintInterface* agentBlueprint,
                     int spawnTime);
 
+    //-----------------------------------------------------------------------------
+    //! Enables or disables keeping a copy of the blueprint of each added agent,
+    //! so that the agents can be recreated from a checkpoint. The copies are
+    //! deleted by Clear().
+    //!
+    //! @param[in]  keepBlueprints      Flag if blueprints are kept
+    //-----------------------------------------------------------------------------
+    void SetKeepBlueprints(bool keepBlueprints);
+
+    //-----------------------------------------------------------------------------
+    //! Returns the agent with the given id of the current invocation.
+    //!
+    //! @param[in]  id                  Agent ID
+    //!
+    //! @return                         The agent, nullptr if there is none
+    //-----------------------------------------------------------------------------
+    Agent *GetAgent(int id) const;
+
+    //-----------------------------------------------------------------------------
+    //! Returns the kept copy of the blueprint of the agent with the given id.
+    //!
+    //! @param[in]  id                  Agent ID
+    //!
+    //! @return                         The blueprint, nullptr if none was kept
+    //-----------------------------------------------------------------------------
+    std::shared_ptr<AgentBlueprintInterface> GetAgentBlueprint(int id) const;
+
+    //-----------------------------------------------------------------------------
+    //! Returns the id the next added agent gets.
+    //!
+    //! @return                         Agent ID
+    //-----------------------------------------------------------------------------
+    int GetNextAgentId() const;
+
+    //-----------------------------------------------------------------------------
+    //! Sets the id the next added agent gets.
+    //!
+    //! @param[in]  id                  Agent ID
+    //-----------------------------------------------------------------------------
+    void SetNextAgentId(int id);
+
+    //-----------------------------------------------------------------------------
+    //! Recreates an agent of an earlier invocation with its original id and adds
+    //! it to the agent network in the world representation. The id of the next
+    //! added agent is not changed.
+    //!
+    //! @param[in]  id                  Agent ID
+    //! @param[in]  agentBlueprint      Blueprint the agent was created from
+    //! @param[in]  spawnTime           Spawn time in ms
+    //!
+    //! @return                         The added agent
+    //-----------------------------------------------------------------------------
+    Agent *RestoreAgent(int id,
+                        AgentBlueprintInterface* agentBlueprint,
+                        int spawnTime);
+
 private:
+    //-----------------------------------------------------------------------------
+    //! @brief Creates or reuses an agent with the given id and adds it to the
+    //!         agent network in the world representation.
+    //!
+    //! @param[in]  id                  Agent ID
+    //! @param[in]  agentBlueprint      agentBlueprint contains all necessary
+    //!                                 informations to create an agent
+    //! @param[in]  spawnTime           Spawn time in ms
+    //!
+    //! @return                         The added agent
+    //-----------------------------------------------------------------------------
+    Agent* AddAgent(int id,
+                    AgentBlueprintInterface* agentBlueprint,
+                    int spawnTime);
+
     //-----------------------------------------------------------------------------
     //! @brief Links all channels of the agent components.
     //!
@@ -108,6 +205,30 @@ private:
                        AgentBlueprintInterface* agentBlueprint,
                        int spawnTime);
 
+    //-----------------------------------------------------------------------------
+    //! @brief Takes a kept agent of the agent type of the blueprint and resets it.
+    //!
+    //! The channels and components of the agent and their links are kept, only
+    //! the agent adapter is replaced and the components are reset.
+    //!
+    //! @param[in]  id                  Agent ID
+    //! @param[in]  agentBlueprint      agentBlueprint contains all necessary
+    //!                                 informations to create an agent
+    //! @param[in]  spawnTime           Spawn time in ms
+    //!
+    //! @return                         The reused agent, nullptr if there is none
+    //-----------------------------------------------------------------------------
+    Agent* ReuseAgent(int id,
+                      AgentBlueprintInterface* agentBlueprint,
+                      int spawnTime);
+
+    //! Agent and its agent type, which is kept alive as long as the agent may be reused
+    struct AgentInstance
+    {
+        Agent* agent;
+        std::shared_ptr<AgentTypeInterface> agentType;
+    };
+
     int lastAgentId = 0;
     ModelBinding *modelBinding;
     WorldInterface *world;
@@ -115,7 +236,13 @@ private:
     ObservationNetworkInterface *observationNetwork;
     EventNetworkInterface *eventNetwork;
 
-    std::list<const Agent*> agentList;
+    std::list<AgentInstance> agentList;
+
+    bool recycleAgents = false;
+    bool componentRandomStreams = false;
+    bool keepBlueprints = false;
+    std::map<int, std::shared_ptr<AgentBlueprintInterface>> agentBlueprints;
+    std::map<const AgentTypeInterface*, std::vector<AgentInstance>> recycledAgents;
 };
 
 } // namespace SimulationSlave
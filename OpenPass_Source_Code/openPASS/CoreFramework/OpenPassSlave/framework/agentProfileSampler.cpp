@@ -29,24 +29,21 @@ void AgentProfileSampler::SampleAgentProfileName(AgentBlueprintInterface &agentB
             break;
 
         default:
-            StringProbabilities possibleAgentProfiles;
-
-            switch(laneCategory)
-            {
-                case LaneCategory::RegularLane:
-                    possibleAgentProfiles = trafficConfig.regularLaneAgents;
-                    break;
-
-                case LaneCategory::RightMostLane:
-                    possibleAgentProfiles = trafficConfig.rightMostLaneAgents;
-                    break;
+            agentBlueprint.SetAgentProfileName(SampleCommonAgentProfileName(laneCategory, sampler));
+    }
+}
 
-                default:
-                    throw std::logic_error("Invalid LaneCategory could not sample AgentProfile");
-            }
+std::string AgentProfileSampler::SampleCommonAgentProfileName(LaneCategory laneCategory, const SamplerInterface& commonAgentSampler) const
+{
+    switch(laneCategory)
+    {
+        case LaneCategory::RegularLane:
+            return commonAgentSampler.SampleStringProbability(trafficConfig.regularLaneAgents);
 
-            std::string agentProfileName = sampler.SampleStringProbability(possibleAgentProfiles);
+        case LaneCategory::RightMostLane:
+            return commonAgentSampler.SampleStringProbability(trafficConfig.rightMostLaneAgents);
 
-            agentBlueprint.SetAgentProfileName(agentProfileName);
+        default:
+            throw std::logic_error("Invalid LaneCategory could not sample AgentProfile");
     }
 }
@@ -36,6 +36,16 @@ public:
     */
     void SampleAgentProfileName(AgentBlueprintInterface &agentBlueprint, LaneCategory laneCategory, unsigned int scenarioAgentIterator);
 
+    /*!
+    * \brief Samples the agent profile name of a common agent
+    *
+    * @param[in]        laneCategory                LaneCategory of the lane the agent will be spawned in
+    * @param[in]        commonAgentSampler          Sampler to draw the agent profile from
+    *
+    * @return           name of the sampled agent profile
+    */
+    std::string SampleCommonAgentProfileName(LaneCategory laneCategory, const SamplerInterface& commonAgentSampler) const;
+
 private:
     const std::vector<ScenarioEntity*>& scenarioEntities;
     const ScenarioEntity& egoEntity;
@@ -0,0 +1,217 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** \file  checkpoint.cpp */
+//-----------------------------------------------------------------------------
+
+#include <limits>
+#include <sstream>
+
+#include "agent.h"
+#include "checkpoint.h"
+#include "eventDetector.h"
+#include "CoreFramework/CoreShare/log.h"
+
+namespace SimulationSlave {
+
+namespace {
+//! Creates a stream which writes doubles without loss of precision
+std::ostringstream CreateStateStream()
+{
+    std::ostringstream state;
+    state.precision(std::numeric_limits<double>::max_digits10);
+    return state;
+}
+} // namespace
+
+Checkpoint::Checkpoint(int time,
+                       AgentFactoryInterface* agentFactory,
+                       WorldInterface* world,
+                       EventNetworkInterface* eventNetwork,
+                       EventDetectorNetworkInterface* eventDetectorNetwork) :
+    time(time),
+    agentFactory(agentFactory),
+    world(world),
+    eventNetwork(eventNetwork),
+    eventDetectorNetwork(eventDetectorNetwork)
+{
+}
+
+int Checkpoint::GetTime() const
+{
+    return time;
+}
+
+bool Checkpoint::IsSaved() const
+{
+    return saved;
+}
+
+bool Checkpoint::IsDue(int time) const
+{
+    return !saved && !skipped && time >= this->time;
+}
+
+bool Checkpoint::SupportsCheckpoint(const SpawnControl& spawnControl) const
+{
+    if (!spawnControl.SupportsCheckpoint())
+    {
+        LOG_INTERN(LogLevel::Warning) << "checkpoint skipped: spawn point does not support checkpoints";
+        return false;
+    }
+
+    for (const auto& eventDetector : eventDetectorNetwork->GetEventDetectors())
+    {
+        if (!eventDetector->GetImplementation()->SupportsCheckpoint())
+        {
+            LOG_INTERN(LogLevel::Warning) << "checkpoint skipped: event detector does not support checkpoints";
+            return false;
+        }
+    }
+
+    for (const auto& item : world->GetAgents())
+    {
+        const Agent* agent = agentFactory->GetAgent(item.first);
+        if (!agent || !agentFactory->GetAgentBlueprint(item.first) || !item.second->SupportsCheckpoint())
+        {
+            LOG_INTERN(LogLevel::Warning) << "checkpoint skipped: agent " << item.first << " does not support checkpoints";
+            return false;
+        }
+
+        for (const auto& component : agent->GetComponents())
+        {
+            if (!component.second->SupportsCheckpoint())
+            {
+                LOG_INTERN(LogLevel::Warning) << "checkpoint skipped: component " << component.first
+                                              << " of agent " << item.first << " does not support checkpoints";
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool Checkpoint::Save(int time,
+                      const SpawnControl& spawnControl,
+                      const RunResult& runResult)
+{
+    if (!SupportsCheckpoint(spawnControl))
+    {
+        skipped = true;
+        return false;
+    }
+
+    agents.clear();
+    for (const auto& item : world->GetAgents())
+    {
+        const Agent* agent = agentFactory->GetAgent(item.first);
+
+        AgentCheckpoint agentCheckpoint;
+        agentCheckpoint.id = item.first;
+        agentCheckpoint.spawnTime = item.second->GetSpawnTime();
+        agentCheckpoint.agentBlueprint = agentFactory->GetAgentBlueprint(item.first);
+
+        auto agentAdapterState = CreateStateStream();
+        item.second->SaveState(agentAdapterState);
+        agentCheckpoint.agentAdapterState = agentAdapterState.str();
+
+        for (const auto& component : agent->GetComponents())
+        {
+            agentCheckpoint.components.emplace(component.first, component.second->SaveState());
+        }
+
+        agents.push_back(std::move(agentCheckpoint));
+    }
+    nextAgentId = agentFactory->GetNextAgentId();
+
+    spawnPoints = spawnControl.SaveState();
+    eventNetworkState = eventNetwork->SaveState();
+
+    eventDetectorStates.clear();
+    for (const auto& eventDetector : eventDetectorNetwork->GetEventDetectors())
+    {
+        auto eventDetectorState = CreateStateStream();
+        eventDetector->GetImplementation()->SaveState(eventDetectorState);
+        eventDetectorStates.push_back(eventDetectorState.str());
+    }
+
+    collisionIds = *runResult.GetCollisionIds();
+
+    this->time = time;
+    saved = true;
+
+    LOG_INTERN(LogLevel::DebugCore) << "checkpoint saved at " << time << " ms with " << agents.size() << " agents";
+    return true;
+}
+
+bool Checkpoint::Restore(SpawnControl& spawnControl,
+                         RunResult& runResult,
+                         std::list<const Agent*>& agents)
+{
+    for (const auto& agentCheckpoint : this->agents)
+    {
+        Agent* agent = agentFactory->RestoreAgent(agentCheckpoint.id,
+                                                  agentCheckpoint.agentBlueprint.get(),
+                                                  agentCheckpoint.spawnTime);
+        if (!agent)
+        {
+            LOG_INTERN(LogLevel::Error) << "checkpoint: could not restore agent " << agentCheckpoint.id;
+            return false;
+        }
+
+        std::istringstream agentAdapterState(agentCheckpoint.agentAdapterState);
+        agent->GetAgentAdapter()->RestoreState(agentAdapterState);
+
+        for (const auto& component : agentCheckpoint.components)
+        {
+            ComponentInterface* restoredComponent = agent->GetComponent(component.first);
+            if (!restoredComponent)
+            {
+                LOG_INTERN(LogLevel::Error) << "checkpoint: agent " << agentCheckpoint.id << " misses component " << component.first;
+                return false;
+            }
+
+            restoredComponent->RestoreState(component.second);
+        }
+
+        agents.push_back(agent);
+    }
+    agentFactory->SetNextAgentId(nextAgentId);
+
+    // the state was saved right after the world was synchronized at the end of the previous timestep
+    world->SyncGlobalData();
+
+    spawnControl.RestoreState(spawnPoints);
+    eventNetwork->RestoreState(eventNetworkState);
+
+    auto eventDetectorState = eventDetectorStates.begin();
+    for (const auto& eventDetector : eventDetectorNetwork->GetEventDetectors())
+    {
+        if (eventDetectorState == eventDetectorStates.end())
+        {
+            break;
+        }
+
+        std::istringstream state(*eventDetectorState);
+        eventDetector->GetImplementation()->RestoreState(state);
+        ++eventDetectorState;
+    }
+
+    for (const auto collisionId : collisionIds)
+    {
+        runResult.AddCollisionId(collisionId);
+    }
+
+    return true;
+}
+
+} // namespace SimulationSlave
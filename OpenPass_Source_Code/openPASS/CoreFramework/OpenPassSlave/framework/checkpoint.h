@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** \file  checkpoint.h
+*	\brief This file contains the in-memory checkpoint of an invocation
+*/
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Interfaces/agentFactoryInterface.h"
+#include "Interfaces/componentInterface.h"
+#include "Interfaces/eventDetectorNetworkInterface.h"
+#include "Interfaces/eventNetworkInterface.h"
+#include "Interfaces/worldInterface.h"
+#include "runResult.h"
+#include "spawnControl.h"
+
+namespace SimulationSlave {
+
+class Agent;
+
+//-----------------------------------------------------------------------------
+/** \brief Snapshot of a running invocation
+*
+* 	\details The first invocation saves its state at the first timestep not
+*            before the checkpoint time. Later invocations restore this state
+*            and continue from there instead of simulating the timesteps before
+*            again. The state consists of the agents (blueprint, agent adapter and
+*            component states), the spawn points, the events, the event detectors
+*            and the collisions of the run result.
+*
+*            Not part of the state are
+*            - the random generators: each restored invocation continues with the
+*              draws of its own seed, so it is not bit-identical to an uninterrupted
+*              invocation with that seed,
+*            - the scheduler tasks: the recurring tasks of the restored agents are
+*              scheduled again from the checkpoint time on, their init tasks are
+*              not executed again.
+*
+*            The checkpoint is kept in memory and only shared by the invocations
+*            of one slave run, i.e. of the same scenario.
+*
+*            Saving is skipped if any of the modules does not support checkpoints.
+*
+* 	\ingroup OpenPassSlave
+*/
+//-----------------------------------------------------------------------------
+class Checkpoint
+{
+public:
+    Checkpoint(int time,
+               AgentFactoryInterface* agentFactory,
+               WorldInterface* world,
+               EventNetworkInterface* eventNetwork,
+               EventDetectorNetworkInterface* eventDetectorNetwork);
+    Checkpoint(const Checkpoint&) = delete;
+    Checkpoint(Checkpoint&&) = delete;
+    Checkpoint& operator=(const Checkpoint&) = delete;
+    Checkpoint& operator=(Checkpoint&&) = delete;
+    ~Checkpoint() = default;
+
+    /*!
+    * \brief Returns the time of the saved state
+    *
+    * @return    time of the saved state, the requested time if nothing is saved yet
+    */
+    int GetTime() const;
+
+    /*!
+    * \brief Checks if a state is saved, which can be restored
+    *
+    * @return    true if a state is saved
+    */
+    bool IsSaved() const;
+
+    /*!
+    * \brief Checks if the state has to be saved at the given time
+    *
+    * @param[in]     time       current time
+    * @return        true if nothing is saved yet, saving was not skipped and the checkpoint time is reached
+    */
+    bool IsDue(int time) const;
+
+    /*!
+    * \brief Saves the state of the current invocation
+    *
+    * \details Has to be called at the beginning of a timestep, before any task of the timestep is executed.
+    *
+    * @param[in]     time           current time
+    * @param[in]     spawnControl   spawn control of the invocation
+    * @param[in]     runResult      result of the invocation
+    * @return        false if saving is skipped, because a module does not support checkpoints
+    */
+    bool Save(int time,
+              const SpawnControl& spawnControl,
+              const RunResult& runResult);
+
+    /*!
+    * \brief Restores the saved state into a freshly cleared invocation
+    *
+    * @param[in,out] spawnControl   spawn control of the invocation
+    * @param[out]    runResult      result of the invocation
+    * @param[out]    agents         restored agents, their tasks have to be scheduled
+    * @return        false if an agent could not be restored
+    */
+    bool Restore(SpawnControl& spawnControl,
+                 RunResult& runResult,
+                 std::list<const Agent*>& agents);
+
+private:
+    //! State of an agent saved at a checkpoint
+    struct AgentCheckpoint
+    {
+        int id;
+        int spawnTime;
+        std::shared_ptr<AgentBlueprintInterface> agentBlueprint;
+        std::string agentAdapterState;
+        std::map<std::string, ComponentCheckpoint> components;
+    };
+
+    /*!
+    * \brief Checks if all agents, spawn points and event detectors support checkpoints
+    *
+    * @param[in]     spawnControl   spawn control of the invocation
+    * @return        true if the invocation can be saved
+    */
+    bool SupportsCheckpoint(const SpawnControl& spawnControl) const;
+
+    int time;
+    bool saved {false};
+    bool skipped {false};
+
+    AgentFactoryInterface* agentFactory {nullptr};
+    WorldInterface* world {nullptr};
+    EventNetworkInterface* eventNetwork {nullptr};
+    EventDetectorNetworkInterface* eventDetectorNetwork {nullptr};
+
+    std::vector<AgentCheckpoint> agents;
+    int nextAgentId {0};
+    std::vector<SpawnPointCheckpoint> spawnPoints;
+    EventNetworkState eventNetworkState;
+    std::vector<std::string> eventDetectorStates;
+    std::list<int> collisionIds;
+};
+
+} // namespace SimulationSlave
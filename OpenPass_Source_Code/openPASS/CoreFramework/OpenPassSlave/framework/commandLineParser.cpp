@@ -48,6 +48,7 @@ CommandLineArguments CommandLineParser::CompileCommandLineArguments(const QComma
     parsedArguments.libPath = commandLineParser.value("lib").toStdString();
     parsedArguments.configsPath = commandLineParser.value("configs").toStdString();
     parsedArguments.resultsPath = commandLineParser.value("results").toStdString();
+    parsedArguments.worker = commandLineParser.isSet("worker");
 
     return parsedArguments;
 }
@@ -57,7 +58,8 @@ void CommandLineParser::EvaluateDefaultedValues(const QCommandLineParser& comman
     parsingLog.clear();
     for (const auto& option : commandLineOptions)
     {
-        if (!commandLineParser.isSet(option.name))
+        // flags without value have no default to report
+        if (!option.valueName.isEmpty() && !commandLineParser.isSet(option.name))
         {
             parsingLog.push_back("No value supplied for " + option.name.toStdString()
                                  + ", falling back to default value " + option.defaultValue.toStdString());
@@ -75,7 +77,7 @@ std::list<std::string> CommandLineParser::parsingLog {};
  * Syntax:
  * 1) name used on the command line for this flag (e.g "-o", "--output")
  * 2) description - a description of what the flag does
- * 3) valueName - REQUIRED for options that take an input value;
+ * 3) valueName - REQUIRED for options that take an input value, empty for flags;
  * 4) defaultValue
  *
  * Don't forget to update test GivenNoValues_SetDefaultsAndLogsEntryForEachDefaultedValue too
@@ -111,5 +113,11 @@ const std::list<CommandLineOption> CommandLineParser::commandLineOptions
         "Path where to put result files",
         "resultPath",
         "results"
+    },
+    {
+        "worker",
+        "Stay alive and read jobs from the standard input",
+        "",
+        ""
     }
 };
@@ -21,6 +21,7 @@ struct CommandLineArguments
     std::string logFile;
     std::string configsPath;
     std::string resultsPath;
+    bool worker;
 };
 
 struct CommandLineOption
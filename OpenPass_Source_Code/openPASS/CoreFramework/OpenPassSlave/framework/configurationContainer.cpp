@@ -12,6 +12,9 @@
 /** \file  ConfigurationContainer.cpp */
 //-----------------------------------------------------------------------------
 
+#include <future>
+
+#include "CoreFramework/CoreShare/log.h"
 #include "directories.h"
 #include "configurationContainer.h"
 
@@ -19,74 +22,141 @@ using namespace Importer;
 
 bool ConfigurationContainer::ImportAllConfigurations()
 {
+    // Independent files are imported as concurrent tasks. Dependencies:
+    //   systemConfigBlueprint
+    //   slaveConfig -> profiles -> systemConfigs
+    //               -> scenario -> scenery, vehicleModels
+    // Results are evaluated in this fixed order, so error reporting does not depend on the task timing.
+    // The tasks log into the log file of this thread.
+    const Qt::HANDLE logThreadId = QThread::currentThreadId();
+
     //Import SystemConfigBlueprint
     systemConfigBlueprint = std::make_shared<SystemConfig>();
-    if (!SystemConfigImporter::Import(configurationFiles.systemConfigBlueprintFile, systemConfigBlueprint))
+    auto systemConfigBlueprintImport = std::async(std::launch::async, [this, logThreadId]
     {
-        LOG_INTERN(LogLevel::Error) << "could not import app configuration";
-        return false;
-    }
+        LogForwarding logForwarding(logThreadId);
+        return SystemConfigImporter::Import(configurationFiles.systemConfigBlueprintFile, systemConfigBlueprint);
+    });
 
     //Import SlaveConfig
     if (!SlaveConfigImporter::Import(configurationFiles.configurationDir,
                                      configurationFiles.slaveConfigFile,
                                      slaveConfig))
     {
+        systemConfigBlueprintImport.wait();
         LOG_INTERN(LogLevel::Error) << "could not import slave configuration '" << configurationFiles.slaveConfigFile << "'";
         return false;
     }
 
-    //Import ProfilesCatalog
-    if (!ProfilesImporter::Import(slaveConfig.GetProfilesCatalog(), profiles))
+    //Import ProfilesCatalog and the referenced SystemConfigs
+    std::future<bool> profilesImport = std::async(std::launch::async, [this, logThreadId]
+    {
+        LogForwarding logForwarding(logThreadId);
+        return ProfilesImporter::Import(slaveConfig.GetProfilesCatalog(), profiles);
+    });
+
+    //Import Scenario, followed by Scenery and VehicleModels
+    std::future<bool> sceneryImport;
+    std::future<bool> vehicleModelsImport;
+    std::future<bool> scenarioImport = std::async(std::launch::async, [this, logThreadId, &sceneryImport, &vehicleModelsImport]
+    {
+        LogForwarding logForwarding(logThreadId);
+        if (!ScenarioImporter::Import(slaveConfig.GetScenarioConfig().scenarioPath, &scenario))
+        {
+            return false;
+        }
+
+        sceneryImport = std::async(std::launch::async, [this, logThreadId]
+        {
+            LogForwarding logForwarding(logThreadId);
+            return SceneryImporter::Import(Directories::Concat(configurationFiles.configurationDir, scenario.GetSceneryPath()),
+                                           &scenery);
+        });
+
+        vehicleModelsImport = std::async(std::launch::async, [this, logThreadId]
+        {
+            LogForwarding logForwarding(logThreadId);
+            return VehicleModelsImporter::Import(
+                       Directories::Concat(configurationFiles.configurationDir, scenario.GetVehicleCatalogPath()),
+                       Directories::Concat(configurationFiles.configurationDir, scenario.GetPedestrianCatalogPath()),
+                       vehicleModels);
+        });
+
+        return true;
+    });
+
+    const bool profilesImported = profilesImport.get();
+    std::map<std::string, std::future<bool>> systemConfigImports;
+
+    if (profilesImported)
+    {
+        std::set<std::string> systemConfigFiles;
+        std::transform(profiles.GetAgentProfiles().begin(), profiles.GetAgentProfiles().end(), std::inserter(systemConfigFiles, systemConfigFiles.begin()),
+                       [](const auto& agentProfile){return agentProfile.second.systemConfigFile;});
+
+        //Import SystemConfigs
+        for (const auto& systemConfigFile : systemConfigFiles)
+        {
+            if (systemConfigFile == "")
+            {
+                continue;
+            }
+            auto systemConfig = std::make_shared<SystemConfig>();
+            systemConfigs.insert(std::make_pair(systemConfigFile, systemConfig));
+
+            systemConfigImports.emplace(systemConfigFile, std::async(std::launch::async, [this, logThreadId, systemConfigFile, systemConfig]
+            {
+                LogForwarding logForwarding(logThreadId);
+                return SystemConfigImporter::Import(Directories::Concat(configurationFiles.configurationDir, systemConfigFile), systemConfig);
+            }));
+        }
+    }
+
+    const bool systemConfigBlueprintImported = systemConfigBlueprintImport.get();
+    const bool scenarioImported = scenarioImport.get();
+    const bool sceneryImported = scenarioImported && sceneryImport.get();
+    const bool vehicleModelsImported = scenarioImported && vehicleModelsImport.get();
+
+    bool systemConfigsImported = true;
+    for (auto& systemConfigImport : systemConfigImports)
+    {
+        systemConfigsImported = systemConfigImport.second.get() && systemConfigsImported;
+    }
+
+    if (!systemConfigBlueprintImported)
+    {
+        LOG_INTERN(LogLevel::Error) << "could not import app configuration";
+        return false;
+    }
+
+    if (!profilesImported)
     {
         LOG_INTERN(LogLevel::Error) << "could not import profiles catalog";
         return false;
     }
 
-    //Import Scenario
-    if (!ScenarioImporter::Import(slaveConfig.GetScenarioConfig().scenarioPath, &scenario))
+    if (!scenarioImported)
     {
         LOG_INTERN(LogLevel::Error) << "could not import scenario";
         return false;
     }
 
-    //Import Scenery
-    if (!SceneryImporter::Import(Directories::Concat(configurationFiles.configurationDir, scenario.GetSceneryPath()),
-                                 &scenery))
+    if (!sceneryImported)
     {
         LOG_INTERN(LogLevel::Error) << "could not import scenery";
         return false;
     }
 
-    //Import VehicleModels
-    if (!VehicleModelsImporter::Import(
-                Directories::Concat(configurationFiles.configurationDir, scenario.GetVehicleCatalogPath()),
-                Directories::Concat(configurationFiles.configurationDir, scenario.GetPedestrianCatalogPath()),
-                vehicleModels))
+    if (!vehicleModelsImported)
     {
         LOG_INTERN(LogLevel::Error) << "could not import vehicle models";
         return false;
     }
 
-    std::set<std::string> systemConfigFiles;
-    std::transform(profiles.GetAgentProfiles().begin(), profiles.GetAgentProfiles().end(), std::inserter(systemConfigFiles, systemConfigFiles.begin()),
-                   [](const auto& agentProfile){return agentProfile.second.systemConfigFile;});
-
-    //Import SystemConfigs
-    for (const auto& systemConfigFile : systemConfigFiles)
+    if (!systemConfigsImported)
     {
-        if (systemConfigFile == "")
-        {
-            continue;
-        }
-        auto systemConfig = std::make_shared<SystemConfig>();
-
-        if(!SystemConfigImporter::Import(Directories::Concat(configurationFiles.configurationDir, systemConfigFile), systemConfig))
-        {
-            LOG_INTERN(LogLevel::Error) << "could not import vehicle models";
-            return false;
-        }
-        systemConfigs.insert(std::make_pair(systemConfigFile, systemConfig));
+        LOG_INTERN(LogLevel::Error) << "could not import system configurations";
+        return false;
     }
 
     return true;
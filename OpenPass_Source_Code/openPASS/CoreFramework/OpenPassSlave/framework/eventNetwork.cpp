@@ -12,7 +12,14 @@
 /** \file  EventNetwork.cpp */
 //-----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
 #include "eventNetwork.h"
+#include "Common/loggedEvent.h"
 
 using namespace EventDefinitions;
 
@@ -26,6 +33,7 @@ EventNetwork::~EventNetwork()
 {
     activeEvents.clear();
     archivedEvents.clear();
+    ResetEventLog();
 }
 
 Events* EventNetwork::GetActiveEvents()
@@ -51,17 +59,196 @@ std::list<std::shared_ptr<EventInterface> > *EventNetwork::GetActiveEventCategor
     }
 }
 
+const AgentEvents &EventNetwork::GetActiveEventsForAgent(EventCategory eventCategory, int agentId)
+{
+    static const AgentEvents noEvents;
+
+    auto categoryIterator = activeEventsByAgent.find(eventCategory);
+    if(categoryIterator == activeEventsByAgent.end())
+    {
+        return noEvents;
+    }
+
+    auto agentIterator = categoryIterator->second.find(agentId);
+    if(agentIterator == categoryIterator->second.end())
+    {
+        return noEvents;
+    }
+
+    return agentIterator->second;
+}
+
 void EventNetwork::RemoveOldEvents(int time)
 {
     for(Events::iterator iterator = archivedEvents.begin(); iterator != archivedEvents.end(); iterator++)
     {
-        while((*iterator).second.front()->GetEventTime() < time)
+        while(!(*iterator).second.empty() && (*iterator).second.front()->GetEventTime() < time)
         {
             (*iterator).second.pop_front();
         }
     }
 }
 
+void EventNetwork::SetArchiveRetention(int maxArchivedEvents, int archiveTimeWindow, const std::string &eventLogFile)
+{
+    ResetEventLog();
+
+    this->maxArchivedEvents = maxArchivedEvents;
+    this->archiveTimeWindow = archiveTimeWindow;
+    this->eventLogFile = eventLogFile;
+}
+
+void EventNetwork::ApplyArchiveRetention()
+{
+    // counted here, as the archived events may have been changed through GetArchivedEvents
+    size_t numberOfArchivedEvents = 0;
+    for(const auto &eventMapEntry : archivedEvents)
+    {
+        numberOfArchivedEvents += eventMapEntry.second.size();
+    }
+
+    while(numberOfArchivedEvents > 0)
+    {
+        // the oldest event is at the front of one of the category lists
+        std::list<std::shared_ptr<EventInterface>> *oldestEventList = nullptr;
+        EventCategory oldestEventCategory = EventCategory::Undefined;
+        for(auto &eventMapEntry : archivedEvents)
+        {
+            auto &eventList = eventMapEntry.second;
+            if(!eventList.empty() &&
+               (!oldestEventList || eventList.front()->GetId() < oldestEventList->front()->GetId()))
+            {
+                oldestEventList = &eventList;
+                oldestEventCategory = eventMapEntry.first;
+            }
+        }
+
+        const bool exceedsCount = maxArchivedEvents >= 0 &&
+                                  numberOfArchivedEvents > static_cast<size_t>(maxArchivedEvents);
+        const bool exceedsTimeWindow = archiveTimeWindow >= 0 &&
+                                       oldestEventList->front()->GetEventTime() < latestEventTime - archiveTimeWindow;
+
+        if(!exceedsCount && !exceedsTimeWindow)
+        {
+            return;
+        }
+
+        WriteToEventLog(oldestEventCategory, oldestEventList->front());
+        oldestEventList->pop_front();
+        numberOfArchivedEvents--;
+    }
+}
+
+std::string EventNetwork::GetEventLogFile(EventCategory eventCategory) const
+{
+    return eventLogFile + "." + std::to_string(static_cast<int>(eventCategory));
+}
+
+std::ofstream &EventNetwork::OpenEventLog(EventCategory eventCategory)
+{
+    std::ofstream &eventLog = eventLogs[eventCategory];
+    eventLog.open(GetEventLogFile(eventCategory), std::ios::out | std::ios::trunc);
+    if(!eventLog.is_open())
+    {
+        eventLogs.erase(eventCategory);
+        throw std::runtime_error("Could not open event log " + GetEventLogFile(eventCategory));
+    }
+    return eventLog;
+}
+
+void EventNetwork::WriteToEventLog(EventCategory eventCategory, const std::shared_ptr<EventInterface> &event)
+{
+    auto eventLogIterator = eventLogs.find(eventCategory);
+    std::ofstream &eventLog = (eventLogIterator != eventLogs.end()) ? eventLogIterator->second
+                                                                     : OpenEventLog(eventCategory);
+
+    // events are separated by newlines, strings are quoted to allow arbitrary content including newlines
+    eventLog << event->GetId() << ' '
+             << event->GetEventTime() << ' '
+             << event->GetTriggeringEventId() << ' '
+             << static_cast<int>(event->GetEventType()) << ' '
+             << std::quoted(event->GetSource()) << ' '
+             << std::quoted(event->GetSequenceName());
+
+    const auto eventParameters = event->GetEventParametersAsString();
+    eventLog << ' ' << eventParameters.size();
+    for(const auto &eventParameter : eventParameters)
+    {
+        eventLog << ' ' << std::quoted(eventParameter.first) << ' ' << std::quoted(eventParameter.second);
+    }
+
+    eventLog << '\n';
+}
+
+void EventNetwork::StreamLoggedEvents(EventCategory eventCategory,
+                                      const std::function<void(std::shared_ptr<EventInterface>)> &handler)
+{
+    auto eventLogIterator = eventLogs.find(eventCategory);
+    if(eventLogIterator == eventLogs.end())
+    {
+        return;
+    }
+
+    eventLogIterator->second.flush();
+
+    // each category has its own event log, so streaming all categories reads every logged event once
+    const std::string categoryEventLogFile = GetEventLogFile(eventCategory);
+    std::ifstream loggedEvents(categoryEventLogFile);
+
+    // read token by token, as a quoted string may span several lines
+    int id;
+    while(loggedEvents >> id)
+    {
+        int time;
+        int triggeringEventId;
+        int eventType;
+        std::string source;
+        std::string sequenceName;
+        size_t numberOfParameters;
+
+        loggedEvents >> time >> triggeringEventId >> eventType
+                     >> std::quoted(source) >> std::quoted(sequenceName)
+                     >> numberOfParameters;
+
+        std::list<std::pair<std::string, std::string>> eventParameters;
+        for(size_t parameterIndex = 0; loggedEvents && parameterIndex < numberOfParameters; ++parameterIndex)
+        {
+            std::string key;
+            std::string value;
+            loggedEvents >> std::quoted(key) >> std::quoted(value);
+            eventParameters.emplace_back(key, value);
+        }
+
+        if(!loggedEvents)
+        {
+            throw std::runtime_error("Corrupted event log " + categoryEventLogFile);
+        }
+
+        handler(std::make_shared<LoggedEvent>(id,
+                                              time,
+                                              triggeringEventId,
+                                              source,
+                                              sequenceName,
+                                              static_cast<EventType>(eventType),
+                                              eventParameters));
+    }
+
+    if(!loggedEvents.eof())
+    {
+        throw std::runtime_error("Corrupted event log " + categoryEventLogFile);
+    }
+}
+
+void EventNetwork::ResetEventLog()
+{
+    for(auto &eventLogEntry : eventLogs)
+    {
+        eventLogEntry.second.close();
+        std::remove(GetEventLogFile(eventLogEntry.first).c_str());
+    }
+    eventLogs.clear();
+}
+
 void EventNetwork::InsertEvent(std::shared_ptr<EventInterface> event)
 {
     EventCategory eventCategory = DefineEventCategory(event->GetEventType());
@@ -74,35 +261,42 @@ void EventNetwork::InsertEvent(std::shared_ptr<EventInterface> event)
         return;
     }
 
-    if(activeEvents.find(eventCategory) != activeEvents.end())
+    latestEventTime = std::max(latestEventTime, event->GetEventTime());
+
+    activeEvents[eventCategory].push_back(event);
+    IndexEventByAgent(eventCategory, event);
+}
+
+void EventNetwork::IndexEventByAgent(EventCategory eventCategory, const std::shared_ptr<EventInterface> &event)
+{
+    if(const auto agentBasedEvent = std::dynamic_pointer_cast<AgentBasedEvent>(event))
     {
-        activeEvents.at(eventCategory).push_back(event);
+        activeEventsByAgent[eventCategory][agentBasedEvent->agentId].push_back(event);
     }
-    else
+    else if(const auto collisionEvent = std::dynamic_pointer_cast<CollisionEvent>(event))
     {
-        std::list<std::shared_ptr<EventInterface>> eventsList;
-        eventsList.push_back(event);
+        activeEventsByAgent[eventCategory][collisionEvent->collisionAgentId].push_back(event);
 
-        activeEvents.insert(std::pair<const EventCategory, std::list<std::shared_ptr<EventInterface>>>(eventCategory, eventsList));
+        if(collisionEvent->collisionWithAgent)
+        {
+            activeEventsByAgent[eventCategory][collisionEvent->collisionOpponentId].push_back(event);
+        }
     }
 }
 
 void EventNetwork::ClearActiveEvents()
 {
-    for(std::pair<EventCategory, std::list<std::shared_ptr<EventInterface>>> eventMapEntry : activeEvents)
+    for(auto& eventMapEntry : activeEvents)
     {
-        if(archivedEvents.find(eventMapEntry.first) != archivedEvents.end())
-        {
-            std::list<std::shared_ptr<EventInterface>> *eventList = &(archivedEvents.at(eventMapEntry.first));
-            eventList->insert(eventList->end(), eventMapEntry.second.begin(), eventMapEntry.second.end());
-        }
-        else
-        {
-            archivedEvents.insert(eventMapEntry);
-        }
+        // splicing moves the list nodes, the events themselves are neither copied nor touched
+        auto& archivedEventList = archivedEvents[eventMapEntry.first];
+        archivedEventList.splice(archivedEventList.end(), eventMapEntry.second);
     }
 
     activeEvents.clear();
+    activeEventsByAgent.clear();
+
+    ApplyArchiveRetention();
 }
 
 void EventNetwork::Clear()
@@ -110,13 +304,60 @@ void EventNetwork::Clear()
     eventId = 0;
 
     activeEvents.clear();
+    activeEventsByAgent.clear();
     archivedEvents.clear();
+    latestEventTime = 0;
+    ResetEventLog();
 
     observer = nullptr;
     respawner = nullptr;
     runResult = nullptr;
 }
 
+EventNetworkState EventNetwork::SaveState()
+{
+    EventNetworkState state;
+    state.activeEvents = activeEvents;
+    state.archivedEvents = archivedEvents;
+    state.latestEventTime = latestEventTime;
+    state.eventId = eventId;
+
+    for(auto &eventLogEntry : eventLogs)
+    {
+        eventLogEntry.second.flush();
+
+        std::ifstream loggedEvents(GetEventLogFile(eventLogEntry.first), std::ios::binary);
+        std::ostringstream content;
+        content << loggedEvents.rdbuf();
+        state.eventLogs[eventLogEntry.first] = content.str();
+    }
+
+    return state;
+}
+
+void EventNetwork::RestoreState(const EventNetworkState &state)
+{
+    activeEvents = state.activeEvents;
+    archivedEvents = state.archivedEvents;
+    latestEventTime = state.latestEventTime;
+    eventId = state.eventId;
+
+    activeEventsByAgent.clear();
+    for(const auto& eventMapEntry : activeEvents)
+    {
+        for(const auto& event : eventMapEntry.second)
+        {
+            IndexEventByAgent(eventMapEntry.first, event);
+        }
+    }
+
+    ResetEventLog();
+    for(const auto &eventLogEntry : state.eventLogs)
+    {
+        OpenEventLog(eventLogEntry.first) << eventLogEntry.second;
+    }
+}
+
 void EventNetwork::Respawn(int time)
 {
     if(respawner != nullptr)
@@ -22,7 +22,9 @@
 
 #pragma once
 
+#include <fstream>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/agentBasedEvent.h"
@@ -67,7 +69,19 @@ public:
     *
     * @return	     List of active events.
     */
-    virtual std::list<std::shared_ptr<EventInterface>> *GetActiveEventCategory(EventCategory eventCategory);  
+    virtual std::list<std::shared_ptr<EventInterface>> *GetActiveEventCategory(EventCategory eventCategory);
+
+    /*!
+    * \brief Returns the active events of a specific category targeting a specific agent.
+    *
+    * \details The events are indexed by category and agent on insertion,
+    *          so no scan over all active events is required.
+    *
+    * @param[in]     eventCategory  Category of the events.
+    * @param[in]     agentId        Id of the targeted agent.
+    * @return	     Active events of the category targeting the agent (in order of insertion).
+    */
+    virtual const AgentEvents &GetActiveEventsForAgent(EventCategory eventCategory, int agentId);
 
     /*!
     * \brief Removes archived events which are older than a certain time stamp.
@@ -79,6 +93,32 @@ public:
     */
     virtual void RemoveOldEvents(int time);
 
+    /*!
+    * \brief Sets the retention policy of the archived events.
+    *
+    * \details Archived events exceeding the policy are moved from memory into an
+    *          append-only event log per category. A negative value disables the respective limit.
+    *
+    * @param[in]     maxArchivedEvents  Maximum number of archived events kept in memory.
+    * @param[in]     archiveTimeWindow  Time window in milliseconds (w.r.t. the latest event) kept in memory.
+    * @param[in]     eventLogFile       Path of the event log, suffixed with the category for each log.
+    */
+    virtual void SetArchiveRetention(int maxArchivedEvents, int archiveTimeWindow, const std::string &eventLogFile);
+
+    /*!
+    * \brief Reads back the events of one category of the event log one by one.
+    *
+    * \details The events are handed over in the order they were logged.
+    *          Only a single logged event is held in memory at a time and
+    *          only the event log of the category is read.
+    *          The logged events of a category are older than its archived events in memory.
+    *
+    * @param[in]     eventCategory  Category of the events.
+    * @param[in]     handler        Called for each logged event of the category.
+    */
+    virtual void StreamLoggedEvents(EventCategory eventCategory,
+                                    const std::function<void(std::shared_ptr<EventInterface>)> &handler);
+
     /*!
     * \brief Inserts an event into the activeEvents.
     *
@@ -92,7 +132,7 @@ public:
     /*!
     * \brief Empties the active events map and stores them as archived events.
     *
-    * \details Empties the current active events and inserts them into the archived events.
+    * \details Empties the current active events and moves them into the archived events.
     *          This method gets called once per cycle time.
     */
     virtual void ClearActiveEvents();
@@ -102,6 +142,25 @@ public:
     */
     virtual void Clear();
 
+    /*!
+    * \brief Saves the events and the content of the event log.
+    *
+    * \details The events are shared with the saved state, they are not modified after insertion.
+    *
+    * @return        Saved state.
+    */
+    virtual EventNetworkState SaveState();
+
+    /*!
+    * \brief Restores a state saved by SaveState().
+    *
+    * \details Replaces all events, rebuilds the agent index of the active events
+    *          and rewrites the event log.
+    *
+    * @param[in]     state      Saved state.
+    */
+    virtual void RestoreState(const EventNetworkState &state);
+
     /*!
     * \brief Triggers the respawner
     *
@@ -148,8 +207,61 @@ private:
     */
     EventCategory DefineEventCategory(EventType eventType);
 
+    /*!
+    * \brief Adds an event to the agent index of the active events
+    *
+    * \details Agent based events are indexed by their agent, collision events
+    *          by both collision partners (if the opponent is an agent).
+    *
+    * @param[in]     eventCategory  Category of the event.
+    * @param[in]     event          Shared pointer of the event.
+    */
+    void IndexEventByAgent(EventCategory eventCategory, const std::shared_ptr<EventInterface> &event);
+
+    /*!
+    * \brief Moves the oldest archived events into the event log until the retention policy is met.
+    */
+    void ApplyArchiveRetention();
+
+    /*!
+    * \brief Appends an event to the event log of its category.
+    *
+    * @param[in]     eventCategory  Category of the event.
+    * @param[in]     event          Shared pointer of the event.
+    */
+    void WriteToEventLog(EventCategory eventCategory, const std::shared_ptr<EventInterface> &event);
+
+    /*!
+    * \brief Creates the event log of a category, an existing log is overwritten.
+    *
+    * @param[in]     eventCategory  Category of the event log.
+    * @return        Opened event log.
+    */
+    std::ofstream &OpenEventLog(EventCategory eventCategory);
+
+    /*!
+    * \brief Returns the path of the event log of a category.
+    *
+    * @param[in]     eventCategory  Category of the event log.
+    * @return        Path of the event log.
+    */
+    std::string GetEventLogFile(EventCategory eventCategory) const;
+
+    /*!
+    * \brief Closes and removes the event logs of all categories.
+    */
+    void ResetEventLog();
+
     Events activeEvents;
+    std::map<EventCategory, std::unordered_map<int, AgentEvents>> activeEventsByAgent;
     Events archivedEvents;
+    int latestEventTime {0};
+
+    int maxArchivedEvents {-1};
+    int archiveTimeWindow {-1};
+    std::string eventLogFile;
+    std::map<EventCategory, std::ofstream> eventLogs;
+
     ObservationInterface *observer {nullptr};
     RespawnInterface *respawner {nullptr};
     RunResultInterface *runResult {nullptr};
@@ -32,7 +32,9 @@ FrameworkModuleContainer::FrameworkModuleContainer(
     modelBinding(frameworkModules.libraryDir, callbacks),
     agentFactory(&modelBinding, &world, &stochastics, &observationNetwork, &eventNetwork),
     sampler(stochastics),
-    agentBlueprintProvider(configurationContainer, sampler),
+    blueprintStochasticsBinding(callbacks),
+    blueprintStochastics(&blueprintStochasticsBinding),
+    agentBlueprintProvider(configurationContainer, sampler, blueprintStochastics),
     eventNetwork()
 {
 }
@@ -82,6 +84,11 @@ StochasticsInterface* FrameworkModuleContainer::GetStochastics()
     return &stochastics;
 }
 
+StochasticsInterface* FrameworkModuleContainer::GetBlueprintStochastics()
+{
+    return &blueprintStochastics;
+}
+
 WorldInterface* FrameworkModuleContainer::GetWorld()
 {
     return &world;
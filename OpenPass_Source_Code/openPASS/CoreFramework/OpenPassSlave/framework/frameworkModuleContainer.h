@@ -70,6 +70,8 @@ public:
 
     StochasticsInterface* GetStochastics() override;
 
+    StochasticsInterface* GetBlueprintStochastics() override;
+
     WorldInterface* GetWorld() override;
 
     AgentBlueprintProviderInterface* GetAgentBlueprintProvider() override;
@@ -99,6 +101,9 @@ private:
 
     const Sampler sampler;
 
+    StochasticsBinding blueprintStochasticsBinding;
+    Stochastics blueprintStochastics;
+
     AgentBlueprintProvider agentBlueprintProvider;
 
     EventNetwork eventNetwork;
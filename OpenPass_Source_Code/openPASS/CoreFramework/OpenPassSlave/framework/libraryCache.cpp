@@ -0,0 +1,28 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <QLibrary>
+
+#include "libraryCache.h"
+
+bool LibraryCache::enabled {false};
+
+void LibraryCache::SetEnabled(bool enabled)
+{
+    LibraryCache::enabled = enabled;
+}
+
+void LibraryCache::Prepare(QLibrary* library)
+{
+    if (enabled && library)
+    {
+        library->setLoadHints(library->loadHints() | QLibrary::PreventUnloadHint);
+    }
+}
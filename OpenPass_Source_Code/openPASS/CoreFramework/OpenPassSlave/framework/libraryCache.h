@@ -0,0 +1,33 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#pragma once
+
+class QLibrary;
+
+/// LibraryCache keeps loaded libraries resident between the jobs of a worker slave
+///
+/// If enabled, libraries prepared by the cache are never unmapped by QLibrary::unload.
+/// Loading the same library in a later job only increments the reference count
+/// instead of mapping and initializing the library again.
+class LibraryCache
+{
+public:
+    LibraryCache() = delete;
+
+    /// Enables or disables the cache for all libraries loaded afterwards
+    static void SetEnabled(bool enabled);
+
+    /// Applies the load hints of the cache to a library, must be called before loading it
+    static void Prepare(QLibrary* library);
+
+private:
+    static bool enabled;
+};
@@ -15,6 +15,7 @@
 #include <QDebug>
 #include <QThreadPool>
 #include <QElapsedTimer>
+#include <QTextStream>
 
 #include <algorithm>
 
@@ -26,6 +27,8 @@
 #include "directories.h"
 #include "frameworkModuleContainer.h"
 #include "CoreFramework/CoreShare/log.h"
+#include "CoreFramework/CoreShare/workerProtocol.h"
+#include "libraryCache.h"
 #include "runInstantiator.h"
 
 using namespace SimulationSlave;
@@ -62,6 +65,20 @@ static bool CheckWritableDir(const std::string& directory, const std::string& pr
 //-----------------------------------------------------------------------------
 static bool CheckDirectories(const Directories& directories);
 
+//-----------------------------------------------------------------------------
+//! \brief   RunJob Imports the configurations and executes the simulation
+//! \param   arguments   parsed command line arguments of the job
+//! \return  true, if the simulation finished successfully
+//-----------------------------------------------------------------------------
+static bool RunJob(const CommandLineArguments& arguments);
+
+//-----------------------------------------------------------------------------
+//! \brief   RunWorker Executes jobs read from the standard input until it is
+//!          closed, keeping loaded libraries resident between the jobs
+//!          (see workerProtocol.h)
+//-----------------------------------------------------------------------------
+static void RunWorker();
+
 //-----------------------------------------------------------------------------
 //! Entry point of program.
 //!
@@ -83,13 +100,35 @@ int main(int argc, char* argv[])
                  parsedArguments.logFile,
                  CommandLineParser::GetParsingLog());
 
+    if (parsedArguments.worker)
+    {
+        RunWorker();
+        LOG_INTERN(LogLevel::DebugCore) << "end slave";
+        return 0;
+    }
+
+    if (!RunJob(parsedArguments))
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    qDebug() << "Simulation time elapsed: " << timer.elapsed() << " ms";
+
+    LOG_INTERN(LogLevel::DebugCore) << "Simulation time elapsed: " << timer.elapsed() << " ms";
+    LOG_INTERN(LogLevel::DebugCore) << "end slave";
+
+    return 0;
+}
+
+bool RunJob(const CommandLineArguments& arguments)
+{
     Directories directories(QCoreApplication::applicationDirPath().toStdString(),
-                            parsedArguments.libPath,
-                            parsedArguments.configsPath,
-                            parsedArguments.resultsPath);
+                            arguments.libPath,
+                            arguments.configsPath,
+                            arguments.resultsPath);
     if (!CheckDirectories(directories))
     {
-        exit(EXIT_FAILURE);
+        return false;
     }
 
     ConfigurationFiles configurationFiles {directories.configurationDir, "systemConfigBlueprint.xml", "slaveConfig.xml"};
@@ -98,13 +137,13 @@ int main(int argc, char* argv[])
     if (!configurationContainer.ImportAllConfigurations())
     {
         LOG_INTERN(LogLevel::Error) << "Failed to import all configurations";
-        exit(EXIT_FAILURE);
+        return false;
     }
 
     const auto& libraries = configurationContainer.GetSlaveConfig()->GetExperimentConfig().libraries;
     FrameworkModules frameworkModules
     {
-        parsedArguments.logLevel,
+        arguments.logLevel,
         directories.libraryDir,
         libraries.at("EventDetectorLibrary"),
         libraries.at("ManipulatorLibrary"),
@@ -122,22 +161,50 @@ int main(int argc, char* argv[])
                                     frameworkModuleContainer,
                                     frameworkModules);
 
-    if (runInstantiator.ExecuteRun())
-    {
-        LOG_INTERN(LogLevel::DebugCore) << "simulation finished successfully";
-    }
-    else
+    if (!runInstantiator.ExecuteRun())
     {
         LOG_INTERN(LogLevel::Error) << "simulation failed";
-        exit(EXIT_FAILURE);
+        return false;
     }
 
-    qDebug() << "Simulation time elapsed: " << timer.elapsed() << " ms";
+    LOG_INTERN(LogLevel::DebugCore) << "simulation finished successfully";
+    return true;
+}
 
-    LOG_INTERN(LogLevel::DebugCore) << "Simulation time elapsed: " << timer.elapsed() << " ms";
-    LOG_INTERN(LogLevel::DebugCore) << "end slave";
+void RunWorker()
+{
+    LibraryCache::SetEnabled(true);
 
-    return 0;
+    QTextStream input(stdin);
+    QTextStream output(stdout);
+
+    for (QString line = input.readLine(); !line.isNull(); line = input.readLine())
+    {
+        if (line.isEmpty())
+        {
+            continue;
+        }
+
+        QStringList jobArguments = line.split(WorkerProtocol::separator);
+        const QString jobId = jobArguments.takeFirst();
+        jobArguments.prepend(QCoreApplication::applicationFilePath());
+
+        QElapsedTimer timer;
+        timer.start();
+
+        CommandLineArguments parsedArguments = CommandLineParser::Parse(jobArguments);
+        SetupLogging(static_cast<LogLevel>(parsedArguments.logLevel),
+                     parsedArguments.logFile,
+                     CommandLineParser::GetParsingLog());
+
+        const bool success = RunJob(parsedArguments);
+        LOG_INTERN(LogLevel::DebugCore) << "Simulation time elapsed: " << timer.elapsed() << " ms";
+
+        output << WorkerProtocol::jobFinished << WorkerProtocol::separator
+               << jobId << WorkerProtocol::separator
+               << (success ? EXIT_SUCCESS : EXIT_FAILURE) << "\n";
+        output.flush();
+    }
 }
 
 void SetupLogging(LogLevel logLevel, const std::string& logFile, const std::list<std::string>& bufferedMessages)
@@ -10,9 +10,11 @@
 *******************************************************************************/
 
 #include <functional>
+#include <memory>
 #include <sstream>
 
 #include "agentFactory.h"
+#include "checkpoint.h"
 #include "Interfaces/agentBlueprintProviderInterface.h"
 #include "agentType.h"
 #include "channel.h"
@@ -27,6 +29,7 @@
 #include "spawnPointNetwork.h"
 #include "stochastics.h"
 #include "invocationControl.h"
+#include "directories.h"
 #include "parameters.h"
 
 
@@ -46,12 +49,16 @@
 
 namespace SimulationSlave {
 
+//! Derives the seed of the blueprint stochastics from the random seed of the experiment
+constexpr std::uint32_t BLUEPRINT_SEED_OFFSET = 0x9E3779B9;
+
 void RunInstantiator::ClearRun()
 {
     world->Reset();
     agentFactory->Clear();
     spawnPointNetwork->Clear();
     eventNetwork->Clear();
+    agentBlueprintProvider->Reset();
 }
 
 bool RunInstantiator::InitializeFrameworkModules(ExperimentConfig& experimentConfig, ScenarioInterface* scenario)
@@ -59,6 +66,10 @@ bool RunInstantiator::InitializeFrameworkModules(ExperimentConfig& experimentCon
     CHECKFALSE(stochastics->Instantiate(frameworkModules.stochasticsLibrary));
     stochastics->InitGenerator(experimentConfig.randomSeed);
 
+    // common agents are sampled ahead of time from streams of a separate generator, so that they do not shift the main stream
+    CHECKFALSE(blueprintStochastics->Instantiate(frameworkModules.stochasticsLibrary));
+    blueprintStochastics->InitGenerator(experimentConfig.randomSeed ^ BLUEPRINT_SEED_OFFSET);
+
     CHECKFALSE(world->Instantiate());
 
     CHECKFALSE(eventDetectorNetwork->Instantiate(frameworkModules.eventDetectorLibrary,
@@ -107,6 +118,23 @@ bool RunInstantiator::ExecuteRun()
     }
     world->CreateScenery(scenery);
 
+    eventNetwork->SetArchiveRetention(experimentConfig.maxArchivedEvents,
+                                      experimentConfig.archivedEventsTimeWindow,
+                                      Directories::Concat(outputDir, "eventLog.tmp"));
+
+    agentFactory->SetRecycleAgents(experimentConfig.recycleAgents);
+    agentFactory->SetComponentRandomStreams(experimentConfig.componentRandomStreams);
+
+    std::unique_ptr<Checkpoint> checkpoint;
+    if (experimentConfig.checkpointTime >= 0)
+    {
+        checkpoint = std::unique_ptr<Checkpoint>(new Checkpoint(experimentConfig.checkpointTime,
+                                                                agentFactory,
+                                                                world,
+                                                                eventNetwork,
+                                                                eventDetectorNetwork));
+    }
+
     InvocationControl invocationControl(experimentConfig.numberOfInvocations);
     while (invocationControl.Progress())
     {
@@ -151,11 +179,15 @@ bool RunInstantiator::ExecuteRun()
                                  &runResult,
                                  observationModule.GetImplementation());
 
+        // blueprints are needed to recreate the agents, until the checkpoint is saved
+        agentFactory->SetKeepBlueprints(checkpoint && !checkpoint->IsSaved());
+
         auto schedulerReturnState = scheduler.Run(
                                         0,
                                         scenario->GetEndTime(),
                                         runResult,
-                                        eventNetwork);
+                                        eventNetwork,
+                                        checkpoint.get());
 
         if (schedulerReturnState == SchedulerReturnState::NoError)
         {
@@ -173,6 +205,7 @@ bool RunInstantiator::ExecuteRun()
         }
 
         stochastics->ReInit();
+        blueprintStochastics->ReInit();
 
         // Reset EventDetectors
         eventDetectorNetwork->ResetAll();
@@ -183,6 +216,7 @@ bool RunInstantiator::ExecuteRun()
     bool successfullyFinalized = observationNetwork->FinalizeAll();
 
     ClearRun();
+    agentFactory->ReleaseRecycledAgents();
     world->Clear();
 
     if (!successfullyFinalized || invocationControl.GetAbortFlag())
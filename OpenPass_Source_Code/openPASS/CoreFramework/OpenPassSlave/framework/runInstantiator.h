@@ -45,6 +45,7 @@ public:
         sampler(frameworkModuleContainer.GetSampler()),
         spawnPointNetwork(frameworkModuleContainer.GetSpawnPointNetwork()),
         stochastics(frameworkModuleContainer.GetStochastics()),
+        blueprintStochastics(frameworkModuleContainer.GetBlueprintStochastics()),
         eventDetectorNetwork(frameworkModuleContainer.GetEventDetectorNetwork()),
         manipulatorNetwork(frameworkModuleContainer.GetManipulatorNetwork()),
         frameworkModules{frameworkModules}
@@ -106,6 +107,7 @@ private:
     const SamplerInterface& sampler;
     SpawnPointNetworkInterface* spawnPointNetwork {nullptr};
     StochasticsInterface* stochastics {nullptr};
+    StochasticsInterface* blueprintStochastics {nullptr};
     EventDetectorNetworkInterface* eventDetectorNetwork {nullptr};
     ManipulatorNetworkInterface* manipulatorNetwork {nullptr};
     FrameworkModules& frameworkModules;
@@ -70,11 +70,10 @@ bool AgentSystemImporter::Import(const std::string &filename,
         return false;
     }
 
-    QByteArray xmlData(xmlFile.readAll());
     QDomDocument document;
     QString errorMsg;
     int errorLine;
-    if (!document.setContent(xmlData, &errorMsg, &errorLine))
+    if (!document.setContent(&xmlFile, &errorMsg, &errorLine))
     {
         LOG_INTERN(LogLevel::Warning) << "invalid xml file format of file " << filename;
         LOG_INTERN(LogLevel::Warning) << "in line " << errorLine << " : " << errorMsg.toStdString();
@@ -511,9 +511,8 @@ bool ProfilesImporter::Import(const std::string& filename, Profiles& profiles)
         return false;
     }
 
-    QByteArray xmlData(xmlFile.readAll());
     QDomDocument document;
-    if (!document.setContent(xmlData))
+    if (!document.setContent(&xmlFile))
     {
         LOG_INTERN(LogLevel::Warning) << "invalid xml file format of file " << filename;
         return false;
@@ -47,11 +47,10 @@ bool ScenarioImporter::Import(const std::string& filename, ScenarioInterface* sc
         throw std::runtime_error("Could not open scenario (" + filename + ")");
     }
 
-    QByteArray xmlData(xmlFile.readAll());
     QDomDocument document;
     QString errorMsg;
     int errorLine;
-    if (!document.setContent(xmlData, &errorMsg, &errorLine))
+    if (!document.setContent(&xmlFile, &errorMsg, &errorLine))
     {
         LOG_INTERN(LogLevel::Warning) << "invalid xml format: " << filename;
         LOG_INTERN(LogLevel::Warning) << "in line " << errorLine << ": " << errorMsg.toStdString();
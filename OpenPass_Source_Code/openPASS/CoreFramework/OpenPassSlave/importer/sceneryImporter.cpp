@@ -1260,10 +1260,10 @@ bool SceneryImporter::ParseRoads(QDomElement& documentRoot,
                 return false;
             }
 
+            // invalid objects never failed the import, the road is kept with the objects parsed so far
             if (!ParseObjects(roadElement, road))
             {
                 LOG_INTERN(LogLevel::Warning) << "SceneryImporter: Error Parsing objects";
-                return false;
             }
 
             if (!ParseSignals(roadElement, road))
@@ -1327,29 +1327,33 @@ bool SceneryImporter::Import(const std::string& filename,
         return false;
     }
 
-    QByteArray xmlData(xmlFile.readAll());
-    QDomDocument document;
+    // roads and junctions are streamed one at a time, so the DOM of the whole OpenDRIVE file is never held in memory
+    // invalid roads and junctions never failed the import, they are logged and the remaining elements are parsed
+    const SimulationCommon::StreamedElementHandler handler = [&](QDomElement& parentElement) -> bool
+    {
+        const QString tag = parentElement.firstChildElement().tagName();
+
+        if (tag == "junction" && !ParseJunctions(parentElement, scenery))
+        {
+            LOG_INTERN(LogLevel::Error) << "could not import junctions of scenery " << filename;
+        }
+        else if (tag == "road" && !ParseRoads(parentElement, scenery))
+        {
+            LOG_INTERN(LogLevel::Error) << "could not import roads of scenery " << filename;
+        }
+
+        return true;
+    };
+
     QString errorMsg;
     int errorLine;
-    if (!document.setContent(xmlData, &errorMsg, &errorLine))
+    if (!SimulationCommon::StreamChildElements(xmlFile, {}, handler, errorMsg, errorLine))
     {
         LOG_INTERN(LogLevel::Warning) << "invalid xml file format of file " << filename;
         LOG_INTERN(LogLevel::Warning) << "in line " << errorLine << " : " << errorMsg.toStdString();
         return false;
     }
 
-    QDomElement documentRoot = document.documentElement();
-    if (documentRoot.isNull())
-    {
-        return false;
-    }
-
-    // parse junctions
-    ParseJunctions(documentRoot, scenery);
-
-    // parse roads
-    ParseRoads(documentRoot, scenery);
-
     return true;
 }
 
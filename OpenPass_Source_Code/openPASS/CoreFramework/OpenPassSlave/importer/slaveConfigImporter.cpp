@@ -112,6 +112,35 @@ bool SlaveConfigImporter::ImportExperimentConfig(QDomElement experimentConfigEle
 
     experimentConfig.libraries = ImportLibraries(experimentConfigElement);
 
+    // Optional retention policy of archived events, older events are moved to the event log
+    if (!ParseInt(experimentConfigElement, "MaxArchivedEvents", experimentConfig.maxArchivedEvents))
+    {
+        experimentConfig.maxArchivedEvents = -1;
+    }
+
+    if (!ParseInt(experimentConfigElement, "ArchivedEventsTimeWindow", experimentConfig.archivedEventsTimeWindow))
+    {
+        experimentConfig.archivedEventsTimeWindow = -1;
+    }
+
+    // Optional reuse of agents across invocations, only applies to agents whose components all support being reset
+    if (!ParseBool(experimentConfigElement, "RecycleAgents", experimentConfig.recycleAgents))
+    {
+        experimentConfig.recycleAgents = false;
+    }
+
+    // Optional counter based random streams per component, draws of an agent are independent of the other agents
+    if (!ParseBool(experimentConfigElement, "ComponentRandomStreams", experimentConfig.componentRandomStreams))
+    {
+        experimentConfig.componentRandomStreams = false;
+    }
+
+    // Optional checkpoint, later invocations continue from the state of the first one at this time
+    if (!ParseInt(experimentConfigElement, "CheckpointTime", experimentConfig.checkpointTime))
+    {
+        experimentConfig.checkpointTime = -1;
+    }
+
     return true;
 }
 
@@ -267,9 +296,8 @@ bool SlaveConfigImporter::Import(const std::string& configurationDir,
         return false;
     }
 
-    QByteArray xmlData(xmlFile.readAll());
     QDomDocument document;
-    if (!document.setContent(xmlData))
+    if (!document.setContent(&xmlFile))
     {
         LOG_INTERN(LogLevel::Warning) << "invalid xml file format of file " << slaveConfigFile;
         return false;
@@ -173,10 +173,9 @@ bool SystemConfigImporter::ImportSystemConfigContent(const std::string& filename
         return false;
     }
 
-    QByteArray xmlData(xmlFile.readAll());
     QString errorMsg;
     int errorLine;
-    if (!document.setContent(xmlData, &errorMsg, &errorLine))
+    if (!document.setContent(&xmlFile, &errorMsg, &errorLine))
     {
         LOG_INTERN(LogLevel::Error) << "invalid xml file format of file " << filename;
         LOG_INTERN(LogLevel::Error) << "in line " << errorLine << " : " << errorMsg.toStdString();
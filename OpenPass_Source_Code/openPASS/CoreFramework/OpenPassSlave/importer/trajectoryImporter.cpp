@@ -26,9 +26,8 @@ bool TrajectoryImporter::Import(const std::string filename, TrajectoryInterface
         return false;
     }
 
-    QByteArray xmlData(xmlFile.readAll());
     QDomDocument document;
-    if(!document.setContent(xmlData))
+    if(!document.setContent(&xmlFile))
     {
         throw std::runtime_error("Invalid xml format of Trajectories");
     }
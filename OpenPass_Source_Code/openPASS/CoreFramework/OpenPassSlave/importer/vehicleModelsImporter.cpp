@@ -24,18 +24,20 @@ bool VehicleModelsImporter::Import(const std::string& vehicleCatalogPath,
 {
     try
     {
-        QDomElement catalogElement;
-
         if (!vehicleCatalogPath.empty())
         {
-            ImportCatalog(vehicleCatalogPath, catalogElement);
-            ImportVehicleCatalog(catalogElement, vehicleModels);
+            ImportCatalog(vehicleCatalogPath, [&](QDomElement& catalogElement)
+            {
+                ImportVehicleCatalog(catalogElement, vehicleModels);
+            });
         }
 
         if (!pedestrianCatalogPath.empty())
         {
-            ImportCatalog(pedestrianCatalogPath, catalogElement);
-            ImportPedestrianCatalog(catalogElement, vehicleModels);
+            ImportCatalog(pedestrianCatalogPath, [&](QDomElement& catalogElement)
+            {
+                ImportPedestrianCatalog(catalogElement, vehicleModels);
+            });
         }
 
         return true;
@@ -81,7 +83,8 @@ void VehicleModelsImporter::ImportPedestrianCatalog(QDomElement& catalogElement,
     }
 }
 
-void VehicleModelsImporter::ImportCatalog(const std::string& catalogPath, QDomElement& catalogElement)
+void VehicleModelsImporter::ImportCatalog(const std::string& catalogPath,
+                                          const std::function<void(QDomElement&)>& catalogImporter)
 {
     LOG_INTERN(LogLevel::Info) << "Importing catalog from " << catalogPath;
 
@@ -91,22 +94,19 @@ void VehicleModelsImporter::ImportCatalog(const std::string& catalogPath, QDomEl
         throw std::runtime_error("Could not open " + catalogPath);
     }
 
-    QByteArray xmlData(xmlFile.readAll());
-    QDomDocument document;
-
-    if (!document.setContent(xmlData))
+    QString errorMsg;
+    int errorLine;
+    const auto handler = [&catalogImporter](QDomElement& catalogElement) -> bool
     {
-        throw std::runtime_error("Invalid xml format of " + catalogPath);
-    }
-
-    const QDomElement documentRoot = document.documentElement();
+        catalogImporter(catalogElement);
+        return true;
+    };
 
-    if (documentRoot.isNull())
+    if (!SimulationCommon::StreamChildElements(xmlFile, {"Catalog"}, handler, errorMsg, errorLine))
     {
-        throw std::runtime_error("Root xml element not found in " + catalogPath);
+        throw std::runtime_error("Invalid xml format of " + catalogPath + " in line " + std::to_string(errorLine) +
+                                 ": " + errorMsg.toStdString());
     }
-
-    CHECKFALSE(SimulationCommon::GetFirstChildElement(documentRoot, "Catalog", catalogElement));
 }
 
 void VehicleModelsImporter::CheckModelParameters(const VehicleModelParameters& model)
@@ -13,6 +13,7 @@
 #include <QDomDocument>
 #include <QFile>
 #include <assert.h>
+#include <functional>
 #include <unordered_map>
 #include "xmlParser.h"
 #include "Common/globalDefinitions.h"
@@ -103,15 +104,17 @@ private:
     static void CheckModelParameters(const VehicleModelParameters& model);
 
     /*!
-     * \brief Imports a catalog from OpenSCENARIO DOM
+     * \brief Streams a catalog from an OpenSCENARIO file
      *
+     * The catalog entries are read one at a time. Each one is handed to the importer
+     * wrapped into its own catalog element, so the whole catalog DOM is never held in memory.
      *
      * \param[in]   catalogPath         Full path to the catalog XML file
-     * \param[out]  catalogElement      The imported catalog element
+     * \param[in]   catalogImporter     Importer called for each catalog entry
      *
      * \throw   std::runtime_error  On invalid XML or missing catalog tag
      */
-    static void ImportCatalog(const std::string& catalogPath, QDomElement& catalogElement);
+    static void ImportCatalog(const std::string& catalogPath, const std::function<void(QDomElement&)>& catalogImporter);
 
     /*!
      * \brief Imports all vehicles from a catalog (OpenSCENARIO DOM)
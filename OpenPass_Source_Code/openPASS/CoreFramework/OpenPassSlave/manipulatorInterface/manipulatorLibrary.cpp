@@ -14,6 +14,7 @@
 #include <sstream>
 
 #include "CoreFramework/CoreShare/log.h"
+#include "libraryCache.h"
 #include "manipulator.h"
 #include "manipulatorLibrary.h"
 #include "observationBinding.h"
@@ -29,6 +30,8 @@ bool ManipulatorLibrary::Init()
         return false;
     }
 
+    LibraryCache::Prepare(library);
+
     if(!library->load())
     {
         LOG_INTERN(LogLevel::Error) << library->errorString().toStdString();
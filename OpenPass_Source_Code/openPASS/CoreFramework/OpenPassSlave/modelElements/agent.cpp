@@ -71,7 +71,8 @@ bool Agent::Instantiate(AgentBlueprintInterface* agentBlueprint,
                         ModelBinding *modelBinding,
                         StochasticsInterface *stochastics,
                         ObservationNetworkInterface *observationNetwork,
-                        EventNetworkInterface *eventNetwork)
+                        EventNetworkInterface *eventNetwork,
+                        bool componentRandomStreams)
 {
     // setup
     if(!agentInterface->InitAgentParameter(id,
@@ -112,9 +113,24 @@ bool Agent::Instantiate(AgentBlueprintInterface* agentBlueprint,
 
         LOG_INTERN(LogLevel::DebugCore) << "- instantiate component " << componentName;
 
+        StochasticsInterface *componentStochastics = stochastics;
+        if(componentRandomStreams)
+        {
+            std::unique_ptr<StochasticsInterface> stream = stochastics->CreateStream(GetStreamId(id, componentName));
+            if(stream)
+            {
+                componentStochastics = stream.get();
+                randomStreams[componentName] = std::move(stream);
+            }
+            else
+            {
+                LOG_INTERN(LogLevel::Warning) << "stochastics module does not support random streams, component " << componentName << " uses the shared generator";
+            }
+        }
+
         ComponentInterface *component = modelBinding->Instantiate(componentType,
                                                          componentName,
-                                                         stochastics,
+                                                         componentStochastics,
                                                          world,
                                                          observationNetwork,
                                                          this,
@@ -188,6 +204,58 @@ bool Agent::Instantiate(AgentBlueprintInterface* agentBlueprint,
     return true;
 }
 
+bool Agent::SupportsReset() const
+{
+    return std::all_of(components.cbegin(), components.cend(),
+                       [](const std::pair<const std::string, ComponentInterface*>& item)
+                       {
+                           return item.second->SupportsReset();
+                       });
+}
+
+bool Agent::Reset(int id, AgentBlueprintInterface* agentBlueprint, int spawnTime)
+{
+    LOG_INTERN(LogLevel::DebugCore) << "reusing agent " << this->id << " as agent " << id;
+
+    this->id = id;
+    this->spawnTime = spawnTime;
+    this->agentBlueprint = agentBlueprint;
+    idsCollisionPartners.clear();
+
+    // the previous agent adapter was released by the world on reset
+    SetAgentAdapter(world->CreateAgentAdapterForAgent());
+    if (!agentInterface->InitAgentParameter(id,
+                                           spawnTime,
+                                           agentBlueprint))
+    {
+        return false;
+    }
+
+    for (std::pair<const std::string, std::unique_ptr<StochasticsInterface>>& item : randomStreams)
+    {
+        item.second->SetStreamId(GetStreamId(id, item.first));
+    }
+
+    for (std::pair<const std::string, ComponentInterface*>& item : components)
+    {
+        item.second->Reset(agentInterface);
+    }
+
+    return true;
+}
+
+std::uint64_t Agent::GetStreamId(int agentId, const std::string &componentName)
+{
+    // FNV-1a hash of the component name in the lower half, agent id in the upper half
+    std::uint32_t componentHash = 2166136261u;
+    for(unsigned char character : componentName)
+    {
+        componentHash = (componentHash ^ character) * 16777619u;
+    }
+
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(agentId)) << 32) | componentHash;
+}
+
 AgentInterface *Agent::GetAgentAdapter() const
 {
     return agentInterface;
@@ -24,6 +24,7 @@
 #include <utility>
 #include <map>
 #include <list>
+#include <memory>
 
 #include "Interfaces/stochasticsInterface.h"
 #include "Interfaces/agentInterface.h"
@@ -66,7 +67,26 @@ public:
                      ModelBinding *modelBinding,
                      StochasticsInterface *stochastics,
                      SimulationSlave::ObservationNetworkInterface *observationNetwork,
-                     EventNetworkInterface *eventNetwork);
+                     EventNetworkInterface *eventNetwork,
+                     bool componentRandomStreams = false);
+
+    //! Checks if all components of the agent support being reset
+    bool SupportsReset() const;
+
+    /*!
+     * \brief Reuses the channels and components of this agent for a new agent of the same agent type
+     *
+     * The agent gets a new agent adapter from the world, which is initialized from the blueprint,
+     * and all components are reset. Own random streams of the components are moved to
+     * the new agent id. Only valid if SupportsReset() returns true.
+     *
+     * @param[in]   id              Agent ID
+     * @param[in]   agentBlueprint  Blueprint of the new agent
+     * @param[in]   spawnTime       Spawn time in ms
+     *
+     * @return      true if the agent parameters could be initialized
+     */
+    bool Reset(int id, AgentBlueprintInterface* agentBlueprint, int spawnTime);
 
     bool IsValid() const
     {
@@ -78,6 +98,9 @@ public:
     void SetAgentAdapter(AgentInterface *agentAdapt);
 
 private:
+    //! Derives the id of the random stream of a component from the agent id and the component name
+    static std::uint64_t GetStreamId(int agentId, const std::string &componentName);
+
     // framework parameters
     std::vector<int> idsCollisionPartners;
     int spawnTime;
@@ -86,6 +109,7 @@ private:
     WorldInterface *world = nullptr;
     std::map<int, Channel*> channels;
     std::map<std::string, ComponentInterface*> components;
+    std::map<std::string, std::unique_ptr<StochasticsInterface>> randomStreams; //!< own random streams of the components, if enabled
 
     AgentInterface *agentInterface = nullptr;
 };
@@ -132,6 +132,11 @@ SimulationSlave::AgentTypeInterface& AgentBlueprint::GetAgentType()
     return *agentType.get();
 }
 
+std::shared_ptr<SimulationSlave::AgentTypeInterface> AgentBlueprint::GetSharedAgentType()
+{
+    return agentType;
+}
+
 SpawnParameter& AgentBlueprint::GetSpawnParameter()
 {
     return spawnParameter;
@@ -178,6 +178,13 @@ public:
     */
     virtual SimulationSlave::AgentTypeInterface& GetAgentType();
 
+    /*!
+    * \brief Returns the agent type as shared pointer, to keep it alive beyond the blueprint
+    *
+    * @return     agentType
+    */
+    virtual std::shared_ptr<SimulationSlave::AgentTypeInterface> GetSharedAgentType();
+
     /*!
     * \brief Returns the spawn parameter as reference
     *
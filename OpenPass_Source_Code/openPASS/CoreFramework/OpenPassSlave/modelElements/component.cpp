@@ -13,6 +13,8 @@
 #include <iostream>
 #include <cassert>
 #include <climits>
+#include <limits>
+#include <sstream>
 #include <stdexcept>
 
 #include "component.h"
@@ -435,6 +437,60 @@ bool Component::ReleaseFromLibrary()
     return modelLibrary->ReleaseComponent(this);
 }
 
+bool Component::SupportsReset() const
+{
+    return implementation && implementation->SupportsReset();
+}
+
+void Component::Reset(AgentInterface* agent)
+{
+    // input buffers are the output buffers of other components of the same agent
+    for (auto& item : outputChannelBuffers)
+    {
+        item.second->ReleaseData();
+    }
+
+    implementation->Reset(agent);
+}
+
+bool Component::SupportsCheckpoint() const
+{
+    return implementation && implementation->SupportsCheckpoint();
+}
+
+ComponentCheckpoint Component::SaveState() const
+{
+    ComponentCheckpoint checkpoint;
+
+    std::ostringstream modelState;
+    modelState.precision(std::numeric_limits<double>::max_digits10);
+    implementation->SaveState(modelState);
+    checkpoint.modelState = modelState.str();
+
+    // signals are immutable, so they can be shared with the restored component
+    for (const auto& item : outputChannelBuffers)
+    {
+        checkpoint.outputData.emplace(item.first, item.second->GetDataPtr());
+    }
+
+    return checkpoint;
+}
+
+void Component::RestoreState(const ComponentCheckpoint& checkpoint)
+{
+    std::istringstream modelState(checkpoint.modelState);
+    implementation->RestoreState(modelState);
+
+    for (const auto& item : checkpoint.outputData)
+    {
+        auto buffer = outputChannelBuffers.find(item.first);
+        if (buffer != outputChannelBuffers.end())
+        {
+            buffer->second->SetData(item.second);
+        }
+    }
+}
+
 ModelInterface* Component::GetImplementation() const
 {
     return implementation;
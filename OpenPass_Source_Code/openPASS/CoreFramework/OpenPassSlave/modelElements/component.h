@@ -235,6 +235,43 @@ public:
     //-----------------------------------------------------------------------------
     bool ReleaseFromLibrary();
 
+    //-----------------------------------------------------------------------------
+    //! Checks if the stored model interface implementation supports being reset.
+    //!
+    //! @return                             True if Reset() can be called
+    //-----------------------------------------------------------------------------
+    bool SupportsReset() const;
+
+    //-----------------------------------------------------------------------------
+    //! Releases the data of the output channel buffers and resets the stored model
+    //! interface implementation, so that it can be reused for another agent.
+    //!
+    //! @param[in]     agent                Agent adapter of the agent reusing this component
+    //-----------------------------------------------------------------------------
+    void Reset(AgentInterface* agent);
+
+    //-----------------------------------------------------------------------------
+    //! Checks if the stored model interface implementation supports checkpoints.
+    //!
+    //! @return                             True if SaveState() and RestoreState() can be called
+    //-----------------------------------------------------------------------------
+    bool SupportsCheckpoint() const;
+
+    //-----------------------------------------------------------------------------
+    //! Saves the state of the stored model interface implementation and the data
+    //! of the output channel buffers.
+    //!
+    //! @return                             Saved state
+    //-----------------------------------------------------------------------------
+    ComponentCheckpoint SaveState() const;
+
+    //-----------------------------------------------------------------------------
+    //! Restores a state saved by SaveState().
+    //!
+    //! @param[in]     checkpoint           Saved state
+    //-----------------------------------------------------------------------------
+    void RestoreState(const ComponentCheckpoint& checkpoint);
+
     //-----------------------------------------------------------------------------
     //! Returns the stored model interface instance.
     //!
@@ -19,6 +19,7 @@
 #include "component.h"
 #include "componentType.h"
 #include "CoreFramework/CoreShare/log.h"
+#include "libraryCache.h"
 #include "modelBinding.h"
 #include "modelLibrary.h"
 #include "Interfaces/observationNetworkInterface.h"
@@ -43,6 +44,8 @@ bool ModelLibrary::Init()
         return false;
     }
 
+    LibraryCache::Prepare(library);
+
     if(!library->load())
     {
         LOG_INTERN(LogLevel::Error) << library->errorString().toStdString();
@@ -15,6 +15,7 @@
 #include <sstream>
 
 #include "CoreFramework/CoreShare/log.h"
+#include "libraryCache.h"
 #include "observationBinding.h"
 #include "Interfaces/observationInterface.h"
 #include "observationLibrary.h"
@@ -39,6 +40,8 @@ bool ObservationLibrary::Init()
         return false;
     }
 
+    LibraryCache::Prepare(library);
+
     if(!library->load())
     {
         LOG_INTERN(LogLevel::Error) << library->errorString().toStdString();
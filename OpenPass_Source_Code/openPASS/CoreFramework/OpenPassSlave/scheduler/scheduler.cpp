@@ -11,6 +11,7 @@
 
 #include "agent.h"
 #include "agentParser.h"
+#include "checkpoint.h"
 #include "eventNetwork.h"
 #include "CoreFramework/CoreShare/log.h"
 #include "runResult.h"
@@ -39,7 +40,8 @@ SchedulerReturnState Scheduler::Run(
     int startTime,
     int endTime,
     RunResult& runResult,
-    EventNetworkInterface* eventNetwork)
+    EventNetworkInterface* eventNetwork,
+    Checkpoint* checkpoint)
 {
     if (startTime > endTime)
     {
@@ -70,13 +72,35 @@ SchedulerReturnState Scheduler::Run(
                    finalizeTasks,
                    frameworkUpdateRate));
 
-    if (ExecuteTasks(taskList->GetBootstrapTasks()) == false)
+    if (checkpoint && checkpoint->IsSaved())
+    {
+        // the bootstrap tasks were executed by the invocation which saved the checkpoint
+        currentTime = checkpoint->GetTime();
+
+        std::list<const Agent*> restoredAgents;
+        if (!checkpoint->Restore(spawnControl, runResult, restoredAgents))
+        {
+            LOG_INTERN(LogLevel::Error) << "Scheduler: could not restore checkpoint";
+            return SchedulerReturnState::AbortSimulation;
+        }
+
+        for (const auto& agent : restoredAgents)
+        {
+            ScheduleRestoredAgentTasks(*agent);
+        }
+    }
+    else if (ExecuteTasks(taskList->GetBootstrapTasks()) == false)
     {
         return ParseAbortReason(spawnControl, currentTime);
     }
 
     while (currentTime <= endTime)
     {
+        if (checkpoint && checkpoint->IsDue(currentTime))
+        {
+            checkpoint->Save(currentTime, spawnControl, runResult);
+        }
+
         if (!ExecuteTasks(taskList->GetCommonTasks(currentTime)))
         {
             return ParseAbortReason(spawnControl, currentTime);
@@ -182,4 +206,12 @@ void Scheduler::ScheduleAgentTasks(const Agent& agent)
     taskList->ScheduleNewNonRecurringTasks(agentParser.GetNonRecurringTasks());
 }
 
+void Scheduler::ScheduleRestoredAgentTasks(const Agent& agent)
+{
+    AgentParser agentParser(currentTime);
+    agentParser.Parse(agent);
+
+    taskList->ScheduleNewRecurringTasks(agentParser.GetRecurringTasks());
+}
+
 } // namespace SimulationSlave
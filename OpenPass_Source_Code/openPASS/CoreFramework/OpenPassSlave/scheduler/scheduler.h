@@ -27,6 +27,7 @@
 namespace SimulationSlave
 {
 
+class Checkpoint;
 class RunResult;
 class EventNetworkInterface;
 class SchedulePolicy;
@@ -78,12 +79,14 @@ public:
     * @param[in]     endTime                simulation end
     * @param[in]     EventNetworkInterface  EventNetwork
     * @param[out]    runResult              RunResult
+    * @param[in,out] checkpoint             Checkpoint to save or, if already saved, to continue from (optional)
     * @returns SchedulerReturnState for invocation control
     */
     SchedulerReturnState Run(int startTime,
              int endTime,
              RunResult &runResult,
-             EventNetworkInterface *eventNetwork);
+             EventNetworkInterface *eventNetwork,
+             Checkpoint *checkpoint = nullptr);
 
     /*!
     * \brief ScheduleAgentTasks
@@ -95,7 +98,17 @@ public:
     */
     void ScheduleAgentTasks(const Agent &agent);
 
-private:    
+private:
+    /*!
+    * \brief ScheduleRestoredAgentTasks
+    *
+    * \details schedule the recurring tasks of an agent restored from a checkpoint,
+    *           its init tasks were executed before the checkpoint
+    *
+    * @param[in]     Agent    restored agent
+    */
+    void ScheduleRestoredAgentTasks(const Agent &agent);
+    
     WorldInterface *world;
     SpawnPointNetworkInterface *spawnPointNetwork = nullptr;
     EventDetectorNetworkInterface *eventDetectorNetwork = nullptr;
@@ -12,6 +12,10 @@
 /** \file  SpawnControl.cpp */
 //-----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
 #include "commonTools.h"
 #include "spawnControl.h"
 #include "spawnPointNetwork.h"
@@ -57,6 +61,62 @@ SpawnControlError SpawnControl::GetError() const
     return spawnError;
 }
 
+bool SpawnControl::SupportsCheckpoint() const
+{
+    return std::all_of(spawnPoints.begin(), spawnPoints.end(),
+                       [](const SpawnAgentParameters& spawnAgentParams)
+                       {
+                           return spawnAgentParams.spawnPoint->GetImplementation()->SupportsCheckpoint();
+                       });
+}
+
+std::vector<SpawnPointCheckpoint> SpawnControl::SaveState() const
+{
+    std::vector<SpawnPointCheckpoint> checkpoints;
+
+    for (const auto& spawnAgentParams : spawnPoints)
+    {
+        std::ostringstream implementationState;
+        implementationState.precision(std::numeric_limits<double>::max_digits10);
+        spawnAgentParams.spawnPoint->GetImplementation()->SaveState(implementationState);
+
+        std::shared_ptr<AgentBlueprint> agentBlueprint;
+        if (const auto blueprint = dynamic_cast<const AgentBlueprint*>(spawnAgentParams.agentBlueprint))
+        {
+            agentBlueprint = std::make_shared<AgentBlueprint>(*blueprint);
+        }
+
+        checkpoints.push_back({agentBlueprint,
+                               spawnAgentParams.nextSpawnTime,
+                               spawnAgentParams.holdbackTime,
+                               implementationState.str()});
+    }
+
+    return checkpoints;
+}
+
+void SpawnControl::RestoreState(const std::vector<SpawnPointCheckpoint>& checkpoints)
+{
+    auto checkpoint = checkpoints.begin();
+    for (auto& spawnAgentParams : spawnPoints)
+    {
+        if (checkpoint == checkpoints.end())
+        {
+            break;
+        }
+
+        delete spawnAgentParams.agentBlueprint;
+        spawnAgentParams.agentBlueprint = checkpoint->agentBlueprint ? new AgentBlueprint(*checkpoint->agentBlueprint) : nullptr;
+        spawnAgentParams.nextSpawnTime = checkpoint->nextSpawnTime;
+        spawnAgentParams.holdbackTime = checkpoint->holdbackTime;
+
+        std::istringstream implementationState(checkpoint->implementationState);
+        spawnAgentParams.spawnPoint->GetImplementation()->RestoreState(implementationState);
+
+        ++checkpoint;
+    }
+}
+
 bool SpawnControl::Execute(int timestamp)
 {
     spawnError = SpawnControlError::NoError;
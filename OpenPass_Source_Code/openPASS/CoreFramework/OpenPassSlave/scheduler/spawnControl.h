@@ -24,6 +24,9 @@
 #include "spawnPoint.h"
 #include "Interfaces/spawnControlInterface.h"
 #include <list>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace SimulationSlave {
 
@@ -38,6 +41,15 @@ struct SpawnAgentParameters
     int holdbackTime;
 };
 
+//! State of the spawn points saved at a checkpoint
+struct SpawnPointCheckpoint
+{
+    std::shared_ptr<AgentBlueprint> agentBlueprint; //!< pending blueprint, nullptr if none
+    int nextSpawnTime;
+    int holdbackTime;
+    std::string implementationState;                //!< state written by the spawn point implementation
+};
+
 //-----------------------------------------------------------------------------
 /** \brief triggers spawning and generate new agent
 *
@@ -73,6 +85,31 @@ public:
 
     SpawnControlError GetError() const override;
 
+    /*!
+    * \brief SupportsCheckpoint
+    *
+    * @return    true if the implementations of all spawn points support checkpoints
+    */
+    bool SupportsCheckpoint() const;
+
+    /*!
+    * \brief SaveState
+    *
+    * \details copies the pending blueprints and saves the state of the spawn points
+    *
+    * @return    state of each spawn point
+    */
+    std::vector<SpawnPointCheckpoint> SaveState() const;
+
+    /*!
+    * \brief RestoreState
+    *
+    * \details restores a state saved by SaveState()
+    *
+    * @param[in]     checkpoints    state of each spawn point
+    */
+    void RestoreState(const std::vector<SpawnPointCheckpoint>& checkpoints);
+
 
     /*!
     * \brief ReviseVelocity
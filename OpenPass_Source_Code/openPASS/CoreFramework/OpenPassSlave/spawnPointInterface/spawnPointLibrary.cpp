@@ -16,6 +16,7 @@
 
 #include "agentFactory.h"
 #include "CoreFramework/CoreShare/log.h"
+#include "libraryCache.h"
 #include "observationBinding.h"
 #include "spawnPoint.h"
 #include "spawnPointLibrary.h"
@@ -40,6 +41,8 @@ bool SpawnPointLibrary::Init()
         return false;
     }
 
+    LibraryCache::Prepare(library);
+
     if(!library->load())
     {
         LOG_INTERN(LogLevel::Error) << library->errorString().toStdString();
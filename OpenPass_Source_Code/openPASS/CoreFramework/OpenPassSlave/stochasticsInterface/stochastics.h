@@ -88,6 +88,14 @@ public:
         return implementation->InitGenerator(seed);
     }
 
+    std::unique_ptr<StochasticsInterface> CreateStream(std::uint64_t streamId){
+        return implementation->CreateStream(streamId);
+    }
+
+    void SetStreamId(std::uint64_t streamId){
+        return implementation->SetStreamId(streamId);
+    }
+
     bool Instantiate(std::string libraryPath)
     {
         if(!stochasticsBinding){
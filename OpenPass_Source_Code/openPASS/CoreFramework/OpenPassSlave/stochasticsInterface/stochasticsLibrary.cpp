@@ -12,6 +12,7 @@
 #include <QLibrary>
 
 #include "CoreFramework/CoreShare/log.h"
+#include "libraryCache.h"
 #include "stochasticsLibrary.h"
 
 namespace SimulationSlave
@@ -36,6 +37,8 @@ bool StochasticsLibrary::Init()
         return false;
     }
 
+    LibraryCache::Prepare(library);
+
     if(!library->load())
     {
         LOG_INTERN(LogLevel::Error) << library->errorString().toStdString();
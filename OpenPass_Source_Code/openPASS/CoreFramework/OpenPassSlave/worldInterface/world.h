@@ -51,7 +51,7 @@ public:
         return implementation->GetAgentByName(scenarioName);
     }
 
-    std::list<AgentInterface*> GetAgentsByGroupType(AgentCategory& agentCategory) override
+    const std::list<AgentInterface*>& GetAgentsByGroupType(AgentCategory& agentCategory) override
     {
         return implementation->GetAgentsByGroupType(agentCategory);
     }
@@ -419,6 +419,12 @@ public:
     }
 
 
+    AgentSurroundings GetSurroundings(std::string roadId, int mainLaneId, int referenceLaneId,
+                                      double frontDistance, double referenceDistance, double searchDistance) const override
+    {
+        return implementation->GetSurroundings(roadId, mainLaneId, referenceLaneId, frontDistance, referenceDistance, searchDistance);
+    }
+
     virtual std::vector<CommonTrafficSign::Entity> GetTrafficSignsInRange(std::string roadId, int laneId,
             double startDistance, double searchRange) const override
     {
@@ -10,6 +10,7 @@
 *******************************************************************************/
 
 #include "CoreFramework/CoreShare/log.h"
+#include "libraryCache.h"
 #include "worldLibrary.h"
 
 namespace SimulationSlave
@@ -32,6 +33,8 @@ bool WorldLibrary::Init()
         return false;
     }
 
+    LibraryCache::Prepare(library);
+
     if(!library->load())
     {
         LOG_INTERN(LogLevel::Error) << library->errorString().toStdString();
@@ -8,6 +8,9 @@
 * SPDX-License-Identifier: EPL-2.0
 *******************************************************************************/
 
+#include <istream>
+#include <ostream>
+
 #include "ConditionalEventDetector.h"
 
 #include "SimulationTimeCondition.h"
@@ -66,6 +69,16 @@ void ConditionalEventDetector::Trigger(int time)
     }
 }
 
+void ConditionalEventDetector::SaveState(std::ostream &state) const
+{
+    state << triggered << ' ';
+}
+
+void ConditionalEventDetector::RestoreState(std::istream &state)
+{
+    state >> triggered;
+}
+
 std::list<std::shared_ptr<ConditionInterface>> ConditionalEventDetector::GetConditions() const
 {
     return conditions;
@@ -83,7 +96,7 @@ bool ConditionalEventDetector::AllConditionsMet(int time) const
 
 void ConditionalEventDetector::TriggerEventInsertion(int time)
 {
-    for(const auto agent : GetActingScenarioAgents())
+    ForEachActingScenarioAgent([this, time](AgentInterface *agent)
     {
         std::shared_ptr<AgentBasedEvent> event = std::make_shared<AgentBasedEvent>(time,
                                                                                    COMPONENTNAME,
@@ -92,6 +105,6 @@ void ConditionalEventDetector::TriggerEventInsertion(int time)
                                                                                    agent->GetId());
 
         eventNetwork->InsertEvent(event);
-    }
+    });
     triggered = true;
 }
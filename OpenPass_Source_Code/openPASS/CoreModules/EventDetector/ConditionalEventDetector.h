@@ -30,6 +30,9 @@ public:
 
     virtual void Trigger(int time) override;
 
+    virtual void SaveState(std::ostream &state) const override;
+    virtual void RestoreState(std::istream &state) override;
+
 private:
     using Conditions = std::list<std::shared_ptr<ConditionInterface>>;
 
@@ -74,6 +74,11 @@ void EventDetectorCommonBase::Reset()
     return;
 }
 
+bool EventDetectorCommonBase::SupportsCheckpoint() const
+{
+    return true;
+}
+
 void EventDetectorCommonBase::Log(CbkLogLevel logLevel,
          const char *file,
          int line,
@@ -87,49 +92,3 @@ void EventDetectorCommonBase::Log(CbkLogLevel logLevel,
                        message);
     }
 }
-
-std::list<AgentInterface *> EventDetectorCommonBase::GetTriggeringScenarioAgents()
-{
-    if(triggeringAgents.size() > 0 )
-    {
-        std::list<AgentInterface *> agents;
-
-        for(std::string agentName : triggeringAgents)
-        {
-            AgentInterface *agent = world->GetAgentByName(agentName);
-            if(agent != nullptr)
-            {
-                agents.push_back(agent);
-            }
-        }
-        return agents;
-    }
-    else
-    {
-       return world->GetAgentsByGroupType(agentCategory);
-    }
-}
-
-std::list<AgentInterface *> EventDetectorCommonBase::GetActingScenarioAgents()
-{
-
-    if(actingAgents.size() > 0 )
-    {
-        std::list<AgentInterface *> agents;
-
-        for(std::string agentName : actingAgents)
-        {
-            AgentInterface *agent = world->GetAgentByName(agentName);
-            if(agent != nullptr)
-            {
-                agents.push_back(agent);
-            }
-        }
-
-        return agents;
-    }
-    else
-    {
-       return world->GetAgentsByGroupType(agentCategory);
-    }
-}
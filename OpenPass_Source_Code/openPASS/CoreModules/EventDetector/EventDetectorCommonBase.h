@@ -88,6 +88,13 @@ public:
     */
     virtual void Reset();
 
+    /*!
+    * \brief Stateless event detectors support checkpoints without saving anything.
+    *
+    * @return     true
+    */
+    virtual bool SupportsCheckpoint() const;
+
 protected:
     /*!
      * \brief Log
@@ -104,14 +111,32 @@ protected:
              const std::string &message);
 
     /*!
-     * \brief Returns all agents that can trigger the EventDetector
+     * \brief Calls a function for all agents that can trigger the EventDetector
+     * \details     First looks wether specific agents names were set as triggering agents.
+     *              If not iterates the agent group which triggers the EventDetector.
+     *              The agents are visited in place, no list is copied.
+     *
+     * \param[in]   function    Called with each triggering agent
+     */
+    template <typename Function>
+    void ForEachTriggeringScenarioAgent(Function function)
+    {
+        ForEachScenarioAgent(triggeringAgents, function);
+    }
+
+    /*!
+     * \brief Calls a function for all agents that act on the events of the EventDetector
      * \details     First looks wether specific agents names were set as actors.
-     *              If not returns the agent group which trigger the EventDetector.
+     *              If not iterates the agent group of the EventDetector.
+     *              The agents are visited in place, no list is copied.
      *
-     * \return      Agents which trigger the EventDetector.
+     * \param[in]   function    Called with each acting agent
      */
-    std::list<AgentInterface*> GetTriggeringScenarioAgents();
-    std::list<AgentInterface*> GetActingScenarioAgents();
+    template <typename Function>
+    void ForEachActingScenarioAgent(Function function)
+    {
+        ForEachScenarioAgent(actingAgents, function);
+    }
 
 
     EventDefinitions::EventType eventType;
@@ -129,6 +154,30 @@ protected:
     AgentCategory agentCategory = AgentCategory::Any;
 
     const std::string COMPONENTNAME {"EventDetector"};
+
+private:
+    template <typename Function>
+    void ForEachScenarioAgent(std::vector<std::string> &agentNames, Function function)
+    {
+        if (!agentNames.empty())
+        {
+            for (std::string &agentName : agentNames)
+            {
+                AgentInterface *agent = world->GetAgentByName(agentName);
+                if (agent != nullptr)
+                {
+                    function(agent);
+                }
+            }
+        }
+        else
+        {
+            for (AgentInterface *agent : world->GetAgentsByGroupType(agentCategory))
+            {
+                function(agent);
+            }
+        }
+    }
 };
 
 
@@ -178,6 +178,13 @@ void ObservationFileHandler::AddEvents(std::shared_ptr<QXmlStreamWriter> fStream
 
     for (const auto& eventList : * (eventNetwork->GetArchivedEvents()))
     {
+        // events exceeding the retention policy of the event network were moved to its event log,
+        // they precede the archived events of their category kept in memory
+        eventNetwork->StreamLoggedEvents(eventList.first, [this, &fStream](std::shared_ptr<EventInterface> event)
+        {
+            AddEvent(fStream, event);
+        });
+
         for (const auto& event : eventList.second)
         {
             AddEvent(fStream, event);
@@ -9,14 +9,17 @@
 **********************************************************************/
 
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <numeric>
 #include <sstream>
 #include <iostream>
 #include <fstream>
+#include <limits>
 #include <QFile>
 #include <QTextStream>
 #include <QDir>
-#include <QDir>
 #include "observation_ttc_implementation.h"
 
 Observation_Ttc_Implementation::Observation_Ttc_Implementation(StochasticsInterface *stochastics,
@@ -28,9 +31,9 @@ Observation_Ttc_Implementation::Observation_Ttc_Implementation(StochasticsInterf
     // read parameters
     try
     {
-        Par_resultFolderName = GetParameters()->GetParametersString().at(0);
-        Par_tempFileName = GetParameters()->GetParametersString().at(1);
-        Par_finalFileName = GetParameters()->GetParametersString().at(2);
+        Par_resultFolderName = GetParameters()->GetParametersString().at("0");
+        Par_tempFileName = GetParameters()->GetParametersString().at("1");
+        Par_finalFileName = GetParameters()->GetParametersString().at("2");
     }
     catch(...)
     {
@@ -58,8 +61,13 @@ void Observation_Ttc_Implementation::SlavePreHook(const std::string &path)
 
 void Observation_Ttc_Implementation::SlavePreRunHook()
 {
-    agentsMinTtc.clear();
-    agentsTtc.clear();
+    for (auto &column : ttcColumns)
+    {
+        column.clear();
+    }
+    agentColumns.clear();
+    columnAgentIds.clear();
+    minTtc.clear();
     timeVector.clear();
 }
 
@@ -77,50 +85,154 @@ void Observation_Ttc_Implementation::SlaveUpdateHook(int time, RunResultInterfac
         timeVector.push_back(time);
     }
 
-    //calculate ttc for all agents
-    for(uint id = 0; id < GetWorld()->GetAgents().size(); id++)
+    SortAgentsByLane();
+
+    //calculate ttc for all agents, the agent in front is the neighbouring entry on the same lane in driving direction
+    for (size_t begin = 0; begin < laneOrder.size();)
     {
-        int frontID = findFrontAgentID(id);
-        if(frontID < 0){ //if nobody is in front, then continue
-            continue;
+        size_t end = begin + 1;
+        while (end < laneOrder.size() &&
+               laneOrder[end].laneId == laneOrder[begin].laneId &&
+               laneOrder[end].roadId == laneOrder[begin].roadId)
+        {
+            ++end;
         }
 
-        const AgentInterface *agent = GetWorld()->GetAgent(id);
-        const AgentInterface *frontAgent = GetWorld()->GetAgent(frontID);
+        // lanes with negative ids are driven in direction of increasing s, lanes with positive ids in opposite direction
+        const bool drivingInS = laneOrder[begin].laneId < 0;
+
+        for (size_t index = begin; index < end; ++index)
+        {
+            const LaneEntry &agent = laneOrder[index];
+            double gap;
+            double frontVelocity;
 
-        double deltaX = frontAgent->GetPositionX() - agent->GetPositionX();
-        double deltaV = frontAgent->GetVelocityX() - agent->GetVelocityX();
-        double ttc = - deltaX / deltaV;
+            if (drivingInS && index + 1 < end)
+            {
+                const LaneEntry &frontAgent = laneOrder[index + 1];
+                gap = frontAgent.rear - agent.front;
+                frontVelocity = frontAgent.velocity;
+            }
+            else if (!drivingInS && index > begin)
+            {
+                const LaneEntry &frontAgent = laneOrder[index - 1];
+                gap = agent.rear - frontAgent.front;
+                frontVelocity = frontAgent.velocity;
+            }
+            else if (!FindFrontAgentOnNextRoad(agent, gap, frontVelocity))
+            {
+                continue; //if nobody is in front, then continue
+            }
 
-        if(ttc < 0){// a negative ttc means that there will never be a collision
-            ttc = INFINITY;
+            StoreTtc(agent.agentId, CalculateTtc(agent, gap, frontVelocity));
         }
 
-        if(agent->GetCollisionPartners().size() > 0){
-            //collisin occured
-            ttc = 0;
+        begin = end;
+    }
+}
+
+void Observation_Ttc_Implementation::SortAgentsByLane()
+{
+    laneOrder.clear();
 
+    for (const auto &it : GetWorld()->GetAgents())
+    {
+        const AgentInterface *agent = it.second;
+        if (!agent->IsAgentInWorld())
+        {
+            continue;
         }
-        // save the minimal ttc
-        std::map<int, double>::iterator agentsMinIterator = agentsMinTtc.find(id);
-        if(agentsMinIterator == agentsMinTtc.end()){
-            agentsMinTtc.emplace(std::make_pair(id, ttc));
-        }else{
-            if(agentsMinIterator->second > ttc){
-                agentsMinIterator->second = ttc;
-            }
+
+        laneOrder.push_back({agent->GetRoadId(),
+                             agent->GetMainLaneId(),
+                             agent->GetDistanceToStartOfRoad(MeasurementPoint::Front),
+                             agent->GetDistanceToStartOfRoad(MeasurementPoint::Rear),
+                             agent->GetVelocityX(),
+                             agent->GetAgentId(),
+                             !agent->GetCollisionPartners().empty(),
+                             agent});
+    }
+
+    std::sort(laneOrder.begin(), laneOrder.end(), [](const LaneEntry &lhs, const LaneEntry &rhs)
+    {
+        if (lhs.laneId != rhs.laneId)
+        {
+            return lhs.laneId < rhs.laneId;
         }
+        const int roadOrder = lhs.roadId.compare(rhs.roadId);
+        if (roadOrder != 0)
+        {
+            return roadOrder < 0;
+        }
+        return std::tie(lhs.front, lhs.agentId) < std::tie(rhs.front, rhs.agentId);
+    });
+}
+
+bool Observation_Ttc_Implementation::FindFrontAgentOnNextRoad(const LaneEntry &agent, double &gap, double &frontVelocity) const
+{
+    // the lane stream of the world follows the lane in driving direction onto the succeeding roads
+    const auto frontAgent = dynamic_cast<const AgentInterface *>(agent.agent->GetObjectInFront(std::numeric_limits<double>::max()));
+    if (frontAgent == nullptr || !frontAgent->IsAgentInWorld() || frontAgent->GetRoadId() == agent.roadId)
+    {
+        return false;
+    }
 
-        //save all ttc
-        std::map<int, std::map<int, double>>::iterator agentIterator = agentsTtc.find(id);
-        if(agentIterator != agentsTtc.end()){
-            agentIterator->second.emplace(time, ttc);
-        }else{
-            std::map<int, double> agentTtc;
-            agentTtc.emplace(std::make_pair(time, ttc));
-            agentsTtc.emplace(std::make_pair(id, agentTtc));
+    // the s coordinates of different roads are not comparable, so the gap is measured between the reference points
+    const double distance = std::hypot(frontAgent->GetPositionX() - agent.agent->GetPositionX(),
+                                       frontAgent->GetPositionY() - agent.agent->GetPositionY());
+    gap = distance
+          - agent.agent->GetDistanceReferencePointToLeadingEdge()
+          - (frontAgent->GetLength() - frontAgent->GetDistanceReferencePointToLeadingEdge());
+    frontVelocity = frontAgent->GetVelocityX();
+    return true;
+}
+
+double Observation_Ttc_Implementation::CalculateTtc(const LaneEntry &agent, double gap, double frontVelocity)
+{
+    if (agent.collided)
+    {
+        //collision occured
+        return 0.0;
+    }
+
+    const double deltaX = std::max(gap, 0.0);
+    const double deltaV = frontVelocity - agent.velocity;
+    const double ttc = - deltaX / deltaV;
+
+    if (ttc < 0 || std::isnan(ttc))
+    {
+        // a negative ttc means that there will never be a collision
+        return INFINITY;
+    }
+
+    return ttc;
+}
+
+void Observation_Ttc_Implementation::StoreTtc(int agentId, double ttc)
+{
+    auto columnIterator = agentColumns.find(agentId);
+    if (columnIterator == agentColumns.end())
+    {
+        const size_t column = columnAgentIds.size();
+        columnIterator = agentColumns.emplace(agentId, column).first;
+        columnAgentIds.push_back(agentId);
+        minTtc.push_back(ttc);
+
+        if (ttcColumns.size() <= column)
+        {
+            ttcColumns.emplace_back();
         }
+        // the columns of the first run determine the capacity needed by the following runs
+        ttcColumns[column].reserve(timeVector.capacity());
     }
+
+    const size_t column = columnIterator->second;
+    auto &ttcColumn = ttcColumns[column];
+    ttcColumn.resize(timeVector.size(), NAN);
+    ttcColumn.back() = ttc;
+
+    // save the minimal ttc
+    minTtc[column] = std::min(minTtc[column], ttc);
 }
 
 void Observation_Ttc_Implementation::SlavePostRunHook(const RunResultInterface &runResult)
@@ -149,17 +261,26 @@ void Observation_Ttc_Implementation::SlavePostRunHook(const RunResultInterface &
     }
     resultFile << endLine;
 
+    // agents are written in order of their IDs
+    std::vector<size_t> columns(columnAgentIds.size());
+    std::iota(columns.begin(), columns.end(), 0);
+    std::sort(columns.begin(), columns.end(), [this](size_t lhs, size_t rhs)
+    {
+        return columnAgentIds[lhs] < columnAgentIds[rhs];
+    });
+
     resultFile << runID; // write runID in first column
     //data
-    for(auto const &agentID : agentsTtc){
+    for (size_t column : columns)
+    {
+        const auto &ttcColumn = ttcColumns[column];
+
         resultFile << sep; // leave first column always empty (reserved for runID)
-        resultFile << agentID.first << sep; //write ID of agent
-        resultFile << agentsMinTtc.find(agentID.first)->second << sep; //write minimal ttc of this agent
-        for(uint i = 0; i < timeVector.size(); ++i){ //write all ttc at every specific time step
-            std::map<int, double> agentTtcs = agentID.second;
-            std::map<int, double>::iterator it = agentTtcs.find(timeVector.at(i));
-            if(it != agentTtcs.end() ){// if ttc is found at specific time step, then write it
-                resultFile << it->second;
+        resultFile << columnAgentIds[column] << sep; //write ID of agent
+        resultFile << minTtc[column] << sep; //write minimal ttc of this agent
+        for(size_t i = 0; i < timeVector.size(); ++i){ //write all ttc at every specific time step
+            if(i < ttcColumn.size() && !std::isnan(ttcColumn[i])){// if ttc is found at specific time step, then write it
+                resultFile << ttcColumn[i];
             }// else leave blank
             resultFile << sep;
         }
@@ -176,26 +297,3 @@ void Observation_Ttc_Implementation::SlavePostHook()
 {
 
 }
-
-int Observation_Ttc_Implementation::findFrontAgentID(int ownID)
-{
-    const AgentInterface *agent = GetWorld()->GetAgent(ownID);
-    double posX = agent->GetPositionX();
-    double minDistance = INFINITY;
-    int frontID = -1;
-
-    for (const auto &it: GetWorld()->GetAgents()){
-        const AgentInterface *otherAgent = it.second;
-        double posXother = otherAgent->GetPositionX();
-        if ((otherAgent->GetAgentId() != ownID) && (posX < posXother))
-        {
-            double distance = posXother - posX;
-            if(minDistance > distance){
-                minDistance = distance;
-                frontID = otherAgent->GetAgentId();
-            }
-        }
-    }
-
-    return frontID;
-}
@@ -14,6 +14,8 @@
 
 #include <string>
 #include <tuple>
+#include <unordered_map>
+#include <vector>
 #include <QFile>
 #include <QTextStream>
 #include "agentInterface.h"
@@ -28,6 +30,10 @@
 *
 * This component logs the time to collision (ttc) of all agents.
 *
+* The front agent of each agent is the next agent on the same road and main lane.
+* It is found by sorting the agents of each lane by their distance along the road
+* once per time step, so the observation scales with n log n instead of n².
+*
 * The file format is csv to easily access ttc data.
 * Output data is the minimal ttc and the ttc at each time step of each agent.
 *
@@ -139,12 +145,71 @@ public:
     }
 
     //-----------------------------------------------------------------------------
-    //! Finds the ID of the agent that is exactly in front of the agent.
-    //!
-    //! @return                      ID of agent in front
-    int findFrontAgentID(int ownID);
+    //! The ttc is calculated from the world, pushed information is not observed.
+    //-----------------------------------------------------------------------------
+    virtual void Insert(int, int, LoggingGroup, const std::string &, const std::string &) override
+    {
+    } //dummy
+
+    virtual void InsertEvent(std::shared_ptr<EventInterface>) override
+    {
+    } //dummy
+
+    virtual void GatherFollowers() override
+    {
+    } //dummy
+
+    virtual void InformObserverOnSpawn(AgentInterface *) override
+    {
+    } //dummy
 
 private:
+    //! Position of an agent in the lane order of the current time step
+    struct LaneEntry
+    {
+        std::string roadId;
+        int laneId;
+        double front;       //!< distance of the front edge to the start of the road
+        double rear;        //!< distance of the rear edge to the start of the road
+        double velocity;
+        int agentId;
+        bool collided;
+        const AgentInterface *agent;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Sorts all agents located in the world by road, main lane and distance
+    //! along the road (ascending s, independent of the driving direction) into laneOrder.
+    //-----------------------------------------------------------------------------
+    void SortAgentsByLane();
+
+    //-----------------------------------------------------------------------------
+    //! Finds the agent in front of the leading agent of a lane on the succeeding roads.
+    //!
+    //! @param[in]     agent           Entry of the leading agent on its road and lane
+    //! @param[out]    gap             Distance between the agents
+    //! @param[out]    frontVelocity   Velocity of the agent in front
+    //! @return                        true if there is an agent in front on another road
+    //-----------------------------------------------------------------------------
+    bool FindFrontAgentOnNextRoad(const LaneEntry &agent, double &gap, double &frontVelocity) const;
+
+    //-----------------------------------------------------------------------------
+    //! Calculates the ttc of an agent to the agent in front.
+    //!
+    //! @param[in]     agent           Entry of the agent
+    //! @param[in]     gap             Distance between the agents
+    //! @param[in]     frontVelocity   Velocity of the agent in front
+    //! @return                        ttc, infinity if the gap does not close
+    //-----------------------------------------------------------------------------
+    static double CalculateTtc(const LaneEntry &agent, double gap, double frontVelocity);
+
+    //-----------------------------------------------------------------------------
+    //! Stores the ttc of an agent at the current time step.
+    //!
+    //! @param[in]     agentId     ID of the agent
+    //! @param[in]     ttc         ttc at the current time step
+    //-----------------------------------------------------------------------------
+    void StoreTtc(int agentId, double ttc);
 
     /**
     * \addtogroup Observation_Ttc
@@ -161,10 +226,17 @@ private:
 
     /** @} @} */
 
-    //! A map of all agents and their ttc at every time.
-    std::map<int, std::map<int, double>> agentsTtc;
-    //! A map to save the minimal Ttc of an agent.
-    std::map<int, double> agentsMinTtc;
+    //! Lane order of the agents at the current time step, reused between steps
+    std::vector<LaneEntry> laneOrder;
+    //! Column of each observed agent in the ttc buffers
+    std::unordered_map<int, size_t> agentColumns;
+    //! ID of the agent of each column
+    std::vector<int> columnAgentIds;
+    //! ttc of each column at every entry of the time vector (NaN: no agent in front)
+    //! The columns are kept between runs to reuse their memory.
+    std::vector<std::vector<double>> ttcColumns;
+    //! minimal ttc of each column
+    std::vector<double> minTtc;
     //! time vector
     std::vector<int> timeVector;
     //! full path name of result file
@@ -12,6 +12,9 @@
 /** @file  SpawnPoint.cpp */
 //-----------------------------------------------------------------------------
 
+#include <istream>
+#include <ostream>
+
 #include "SpawnPoint.h"
 
 //Constructor for testing only
@@ -766,6 +769,24 @@ double SpawnPoint::GetPreRunTimeTillSpawn()
     return spawnPointParameters.carsPerSecond == 0.0 ? static_cast<double>(INFINITY) : 0.0;
 }
 
+void SpawnPoint::SaveState(std::ostream &state) const
+{
+    state << static_cast<int>(spawnPointState) << ' ' << isFirstRespawning << ' '
+          << egoAndSceneryLanesIndex << ' ' << scenarioAgentIterator << ' '
+          << sceneryCarCurrentSPosition << ' ' << sceneryCarCurrentOffset << ' ';
+    sceneryParser.SaveState(state);
+}
+
+void SpawnPoint::RestoreState(std::istream &state)
+{
+    int spawnPointStateValue = 0;
+    state >> spawnPointStateValue >> isFirstRespawning
+          >> egoAndSceneryLanesIndex >> scenarioAgentIterator
+          >> sceneryCarCurrentSPosition >> sceneryCarCurrentOffset;
+    spawnPointState = static_cast<SpawnPointState>(spawnPointStateValue);
+    sceneryParser.RestoreState(state);
+}
+
 bool SpawnPoint::GenerateAgent(AgentBlueprintInterface* agentBlueprint)
 {
     //Sets predefined values
@@ -99,6 +99,25 @@ public:
      */
     bool GenerateAgent(AgentBlueprintInterface *agentBlueprint);
 
+    bool SupportsCheckpoint() const override
+    {
+        return true;
+    }
+
+    /*!
+     * \brief Writes the placement progress of the spawn point
+     *
+     * @param[out] state    stream receiving the state
+     */
+    void SaveState(std::ostream &state) const override;
+
+    /*!
+     * \brief Restores the placement progress written by SaveState()
+     *
+     * @param[in] state     stream providing the state
+     */
+    void RestoreState(std::istream &state) override;
+
     /*!
     * \brief Extracts SpawnPoint parameters.
     *
@@ -15,6 +15,8 @@
 #include "SpawnPointSceneryParser.h"
 #include <map>
 #include <list>
+#include <istream>
+#include <ostream>
 
 namespace SpawnPointHelper {
 
@@ -156,4 +158,43 @@ bool SceneryParser::RemoveLastCommonLaneParameter()
     return true;
 }
 
+namespace {
+void SaveLaneParameters(std::ostream& state, const std::vector<LaneParameters>& laneParameters)
+{
+    state << laneParameters.size();
+    for (const auto& item : laneParameters)
+    {
+        state << ' ' << item.streamId << ' ' << item.laneId << ' ' << static_cast<int>(item.laneCategory)
+              << ' ' << item.distanceToLaneStart << ' ' << item.offset;
+    }
+    state << ' ';
+}
+
+void RestoreLaneParameters(std::istream& state, std::vector<LaneParameters>& laneParameters)
+{
+    size_t size = 0;
+    state >> size;
+
+    laneParameters.resize(size);
+    for (auto& item : laneParameters)
+    {
+        int laneCategory = 0;
+        state >> item.streamId >> item.laneId >> laneCategory >> item.distanceToLaneStart >> item.offset;
+        item.laneCategory = static_cast<LaneCategory>(laneCategory);
+    }
+}
+} // namespace
+
+void SceneryParser::SaveState(std::ostream& state) const
+{
+    SaveLaneParameters(state, egoAndSceneryParameters);
+    SaveLaneParameters(state, commonLaneStreamParameters);
+}
+
+void SceneryParser::RestoreState(std::istream& state)
+{
+    RestoreLaneParameters(state, egoAndSceneryParameters);
+    RestoreLaneParameters(state, commonLaneStreamParameters);
+}
+
 } // namespace
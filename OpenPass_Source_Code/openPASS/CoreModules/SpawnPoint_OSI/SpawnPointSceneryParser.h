@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <iosfwd>
+
 #include "Common/spawnPointDefinitions.h"
 #include "Interfaces/worldInterface.h"
 
@@ -61,6 +63,20 @@ public:
     void PushEgoParameters(LaneParameters laneParameters);
     void PushSceneryParameters(LaneParameters laneParameters);
 
+    /*!
+    * \brief Writes the lanes which are changed during spawning.
+    *
+    * @param[out]    state         stream receiving the state
+    */
+    void SaveState(std::ostream& state) const;
+
+    /*!
+    * \brief Restores the lanes written by SaveState().
+    *
+    * @param[in]     state         stream providing the state
+    */
+    void RestoreState(std::istream& state);
+
 private:
 
     void ParseEntryLanes(std::string roadId);
@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//-----------------------------------------------------------------------------
+//! @file  philox.h
+//! @brief This file contains the counter based random number engine Philox4x32-10
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+/*!
+ * \brief Counter based random number engine Philox4x32-10
+ *
+ * Each block of four numbers is a bijection of a 128 bit counter under a 64 bit key
+ * (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC 2011).
+ * The upper half of the counter holds the stream id and the lower half counts the
+ * blocks drawn from the stream, so the n-th number of a stream only depends on the
+ * key, the stream id and n, but not on any other stream.
+ *
+ * Satisfies UniformRandomBitGenerator and can be used with the distributions of <random>.
+ */
+class PhiloxEngine
+{
+public:
+    using result_type = std::uint32_t;
+
+    PhiloxEngine() = default;
+
+    //! \param[in] seed         key of the engine
+    //! \param[in] streamId     id of the stream drawn from
+    PhiloxEngine(std::uint32_t seed, std::uint64_t streamId)
+    {
+        Seed(seed, streamId);
+    }
+
+    //! Selects the key and the stream and restarts the stream
+    void Seed(std::uint32_t seed, std::uint64_t streamId)
+    {
+        key = {seed, KEY_SALT};
+        this->streamId = streamId;
+        Restart();
+    }
+
+    //! Restarts the current stream from its first number
+    void Restart()
+    {
+        blockIndex = 0;
+        position = BLOCK_SIZE;
+    }
+
+    result_type operator()()
+    {
+        if (position == BLOCK_SIZE)
+        {
+            block = Generate({static_cast<std::uint32_t>(blockIndex),
+                              static_cast<std::uint32_t>(blockIndex >> 32),
+                              static_cast<std::uint32_t>(streamId),
+                              static_cast<std::uint32_t>(streamId >> 32)},
+                             key);
+            ++blockIndex;
+            position = 0;
+        }
+
+        return block[position++];
+    }
+
+    static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /*!
+     * \brief Applies the Philox4x32-10 bijection
+     *
+     * \param[in] counter   counter to encrypt
+     * \param[in] key       key of the bijection
+     * \return block of four random numbers
+     */
+    static std::array<std::uint32_t, 4> Generate(std::array<std::uint32_t, 4> counter,
+                                                 std::array<std::uint32_t, 2> key)
+    {
+        for (int round = 0; round < ROUNDS; ++round)
+        {
+            const std::uint64_t product0 = static_cast<std::uint64_t>(MULTIPLIER_0) * counter[0];
+            const std::uint64_t product1 = static_cast<std::uint64_t>(MULTIPLIER_1) * counter[2];
+
+            counter = {static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                       static_cast<std::uint32_t>(product1),
+                       static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                       static_cast<std::uint32_t>(product0)};
+
+            key[0] += WEYL_0;
+            key[1] += WEYL_1;
+        }
+
+        return counter;
+    }
+
+private:
+    static constexpr int ROUNDS = 10;
+    static constexpr std::size_t BLOCK_SIZE = 4;
+    static constexpr std::uint32_t MULTIPLIER_0 = 0xD2511F53;
+    static constexpr std::uint32_t MULTIPLIER_1 = 0xCD9E8D57;
+    static constexpr std::uint32_t WEYL_0 = 0x9E3779B9;
+    static constexpr std::uint32_t WEYL_1 = 0xBB67AE85;
+    static constexpr std::uint32_t KEY_SALT = 0x5354434B; // separates the streams from other uses of the seed
+
+    std::array<std::uint32_t, 2> key {{0, KEY_SALT}};
+    std::uint64_t streamId {0};
+    std::uint64_t blockIndex {0};
+    std::array<std::uint32_t, 4> block {};
+    std::size_t position {BLOCK_SIZE};
+};
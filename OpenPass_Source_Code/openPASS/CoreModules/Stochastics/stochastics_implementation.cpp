@@ -19,8 +19,9 @@
 #include <cmath>
 #include "stochastics_implementation.h"
 
-StochasticsImplementation::StochasticsImplementation(const CallbackInterface *callbacks) :
-    baseGenerator(0),
+template <typename Generator>
+BasicStochastics<Generator>::BasicStochastics(const CallbackInterface *callbacks) :
+    generator(),
     uniformDistribution(0, 1),
     binomialDistribution(1, 0.5),
     normalDistribution(0, 1),
@@ -29,42 +30,47 @@ StochasticsImplementation::StochasticsImplementation(const CallbackInterface *ca
 {
 }
 
-int StochasticsImplementation::GetBinomialDistributed(int upperRangeNum, double probSuccess)
+template <typename Generator>
+int BasicStochastics<Generator>::GetBinomialDistributed(int upperRangeNum, double probSuccess)
 {
     binomialDistribution.param(BinomialDist::param_type(upperRangeNum,probSuccess));
-    int draw = binomialDistribution(baseGenerator);
+    int draw = binomialDistribution(GetGenerator());
     LOG(CbkLogLevel::Debug, "GetBinomialDistributed " + std::to_string(draw));
     return draw;
 }
 
-double StochasticsImplementation::GetUniformDistributed(double a, double b)
+template <typename Generator>
+double BasicStochastics<Generator>::GetUniformDistributed(double a, double b)
 {
     uniformDistribution.param(std::uniform_real_distribution<double>::param_type(a, b));
-    double draw = uniformDistribution(baseGenerator);
+    double draw = uniformDistribution(GetGenerator());
     LOG(CbkLogLevel::Debug, "GetUniformDistributed " + std::to_string(draw));
     return  draw;
 }
 
-double StochasticsImplementation::GetNormalDistributed(double mean, double stdDeviation)
+template <typename Generator>
+double BasicStochastics<Generator>::GetNormalDistributed(double mean, double stdDeviation)
 {
     if(0 > stdDeviation)
     {
         LOG(CbkLogLevel::Warning, "GetNormalDistributed: stdDeviation negative");
         return mean;
     }
-    double draw = normalDistribution(baseGenerator);
+    double draw = normalDistribution(GetGenerator());
     LOG(CbkLogLevel::Debug, "GetNormalDistributed " + std::to_string(draw));
     return stdDeviation * draw + mean;
 }
 
-double StochasticsImplementation::GetExponentialDistributed(double lambda)
+template <typename Generator>
+double BasicStochastics<Generator>::GetExponentialDistributed(double lambda)
 {
-    double draw = exponentialDistribution(baseGenerator);
+    double draw = exponentialDistribution(GetGenerator());
     LOG(CbkLogLevel::Debug, "GetExponentialDistributed " + std::to_string(draw));
     return draw / lambda;
 }
 
-double StochasticsImplementation::GetGammaDistributed(double mean, double stdDeviation)
+template <typename Generator>
+double BasicStochastics<Generator>::GetGammaDistributed(double mean, double stdDeviation)
 {
     // b=1/beta; p=alpha;
     // E = alpha * beta; stdDev = sqrt(alpha) * beta;
@@ -76,33 +82,36 @@ double StochasticsImplementation::GetGammaDistributed(double mean, double stdDev
         return mean;
     }
     std::gamma_distribution<double> gammaDistribution(mean * mean / var, var / mean);
-    auto gammaGenerator = std::bind(gammaDistribution, baseGenerator);
+    auto gammaGenerator = std::bind(gammaDistribution, GetGenerator());
 
     double draw = gammaGenerator();
     LOG(CbkLogLevel::Debug, "GetGammaDistributed " + std::to_string(draw));
     return draw;
 }
 
-double StochasticsImplementation::GetLogNormalDistributed(double mean, double stdDeviation)
+template <typename Generator>
+double BasicStochastics<Generator>::GetLogNormalDistributed(double mean, double stdDeviation)
 {
     double s2 = log(pow(stdDeviation/mean, 2)+1);
 
     std::lognormal_distribution<double> lognormalDistribution(log(mean)-s2/2, sqrt(s2));
 
-    double draw = lognormalDistribution(baseGenerator);
+    double draw = lognormalDistribution(GetGenerator());
     LOG(CbkLogLevel::Debug, "GetLogNormalDistributed " + std::to_string(draw));
 
     return draw;
 }
 
-double StochasticsImplementation::GetSpecialDistributed(std::string distributionName, std::vector<double> args)
+template <typename Generator>
+double BasicStochastics<Generator>::GetSpecialDistributed(std::string distributionName, std::vector<double> args)
 {
     Q_UNUSED(distributionName);
     Q_UNUSED(args);
     return 0;
 }
 
-double StochasticsImplementation::GetPercentileLogNormalDistributed(double mean, double stdDeviation, double probability)
+template <typename Generator>
+double BasicStochastics<Generator>::GetPercentileLogNormalDistributed(double mean, double stdDeviation, double probability)
 {
     double s2 = log(pow(stdDeviation/mean, 2)+1);
 
@@ -116,7 +125,8 @@ double StochasticsImplementation::GetPercentileLogNormalDistributed(double mean,
     return draw;
 }
 
-double StochasticsImplementation::GetRandomCdfLogNormalDistributed(double mean, double stdDeviation)
+template <typename Generator>
+double BasicStochastics<Generator>::GetRandomCdfLogNormalDistributed(double mean, double stdDeviation)
 {
     double draw = GetLogNormalDistributed(mean, stdDeviation);
 
@@ -135,6 +145,24 @@ double StochasticsImplementation::GetRandomCdfLogNormalDistributed(double mean,
     return probabilityCdf;
 }
 
+template <typename Generator>
+void BasicStochastics<Generator>::ResetDistributions()
+{
+    uniformDistribution.reset();
+    binomialDistribution.reset();
+    normalDistribution.reset();
+    exponentialDistribution.reset();
+}
+
+template class BasicStochastics<std::mt19937>;
+template class BasicStochastics<PhiloxEngine>;
+
+StochasticsImplementation::StochasticsImplementation(const CallbackInterface *callbacks) :
+    BasicStochastics<std::mt19937>(callbacks)
+{
+    generator.seed(0);
+}
+
 std::uint32_t StochasticsImplementation::GetRandomSeed() const
 {
     return randomSeed;
@@ -142,17 +170,79 @@ std::uint32_t StochasticsImplementation::GetRandomSeed() const
 
 void StochasticsImplementation::ReInit()
 {
-    randomSeed = baseGenerator();
+    randomSeed = generator();
     InitGenerator(randomSeed);
 }
 
 void StochasticsImplementation::InitGenerator(std::uint32_t seed)
 {
     randomSeed = seed;
-    baseGenerator.seed(seed);
+    ++generation;
+    generator.seed(seed);
 
-    uniformDistribution.reset();
-    binomialDistribution.reset();
-    normalDistribution.reset();
-    exponentialDistribution.reset();
+    ResetDistributions();
+}
+
+std::unique_ptr<StochasticsInterface> StochasticsImplementation::CreateStream(std::uint64_t streamId)
+{
+    return std::unique_ptr<StochasticsInterface>(new (std::nothrow) StochasticsStream(callbacks, *this, streamId));
+}
+
+std::uint64_t StochasticsImplementation::GetGeneration() const
+{
+    return generation;
+}
+
+StochasticsStream::StochasticsStream(const CallbackInterface *callbacks,
+                                     const StochasticsImplementation &parent,
+                                     std::uint64_t streamId) :
+    BasicStochastics<PhiloxEngine>(callbacks),
+    parent(parent),
+    streamId(streamId)
+{
+    generation = parent.GetGeneration();
+    Seed(parent.GetRandomSeed());
+}
+
+std::uint32_t StochasticsStream::GetRandomSeed() const
+{
+    // the stream is rekeyed lazily on the next draw after the parent was reinitialized
+    return generation == parent.GetGeneration() ? seed : parent.GetRandomSeed();
+}
+
+void StochasticsStream::ReInit()
+{
+    generator.Restart();
+    ResetDistributions();
+}
+
+void StochasticsStream::InitGenerator(std::uint32_t seed)
+{
+    generation = parent.GetGeneration();
+    Seed(seed);
+}
+
+void StochasticsStream::SetStreamId(std::uint64_t streamId)
+{
+    this->streamId = streamId;
+    generation = parent.GetGeneration();
+    Seed(parent.GetRandomSeed());
+}
+
+PhiloxEngine& StochasticsStream::GetGenerator()
+{
+    if (generation != parent.GetGeneration())
+    {
+        generation = parent.GetGeneration();
+        Seed(parent.GetRandomSeed());
+    }
+
+    return generator;
+}
+
+void StochasticsStream::Seed(std::uint32_t seed)
+{
+    this->seed = seed;
+    generator.Seed(seed, streamId);
+    ResetDistributions();
 }
@@ -17,6 +17,10 @@
 * \details The Stochastics module implements a StochasticsInterface which is used
 * by all agents to create a random behavior.
 *
+* Besides the shared Mersenne Twister, it provides counter based streams (Philox4x32-10),
+* which are keyed by the seed of the invocation and a stream id, e.g. derived from an agent
+* and a component. The draws of a stream do not depend on the draws of any other stream.
+*
 * \section Stochastics_Inputs Inputs
 * name | meaning
 * -----|---------
@@ -43,29 +47,31 @@
 #include <random>
 #include <vector>
 #include <functional>
+#include <memory>
 #include "Interfaces/stochasticsInterface.h"
+#include "philox.h"
 #include "boost/math/distributions/lognormal.hpp"
 
 using namespace boost::math;
 using BinomialDist = std::binomial_distribution<>;
 
 /*!
- * \brief implementation of StochasticsInterface
+ * \brief Distributions of the StochasticsInterface on top of a random number engine
  *
- * The Stochastics module implements a StochasticsInterface which is used
- * by all agents to create a random behavior.
+ * \tparam Generator   engine satisfying UniformRandomBitGenerator
  *
  * \ingroup Stochastics
  */
-class StochasticsImplementation : public StochasticsInterface
+template <typename Generator>
+class BasicStochastics : public StochasticsInterface
 {
 public:
-    StochasticsImplementation(const CallbackInterface *callbacks);
-    StochasticsImplementation(const StochasticsImplementation&) = delete;
-    StochasticsImplementation(StochasticsImplementation&&) = delete;
-    StochasticsImplementation& operator=(const StochasticsImplementation&) = delete;
-    StochasticsImplementation& operator=(StochasticsImplementation&&) = delete;
-    virtual ~StochasticsImplementation() = default;
+    BasicStochastics(const CallbackInterface *callbacks);
+    BasicStochastics(const BasicStochastics&) = delete;
+    BasicStochastics(BasicStochastics&&) = delete;
+    BasicStochastics& operator=(const BasicStochastics&) = delete;
+    BasicStochastics& operator=(BasicStochastics&&) = delete;
+    virtual ~BasicStochastics() = default;
 
     /*!
     * \brief Generates an uniform distributed number.
@@ -173,6 +179,64 @@ public:
     */
     double GetPercentileLogNormalDistributed(double mean, double stdDeviation, double probability);
 
+protected:
+    //! Returns the engine to draw from
+    virtual Generator& GetGenerator()
+    {
+        return generator;
+    }
+
+    //! Discards the numbers cached by the distributions
+    void ResetDistributions();
+
+    /*! Provides callback to LOG() macro
+    *
+    * @param[in]     logLevel    Importance of log
+    * @param[in]     file        Name of file where log is called
+    * @param[in]     line        Line within file where log is called
+    * @param[in]     message     Message to log
+    */
+    void Log(CbkLogLevel logLevel,
+             const char *file,
+             int line,
+             const std::string &message)
+    {
+        if(callbacks)
+        {
+            callbacks->Log(logLevel,
+                           file,
+                           line,
+                           message);
+        }
+    }
+
+    Generator generator;
+    std::uniform_real_distribution<double> uniformDistribution;
+    BinomialDist binomialDistribution;
+    std::normal_distribution<double> normalDistribution;
+    std::exponential_distribution<double> exponentialDistribution;
+
+    const CallbackInterface *callbacks;
+};
+
+/*!
+ * \brief implementation of StochasticsInterface
+ *
+ * The Stochastics module implements a StochasticsInterface which is used
+ * by all agents to create a random behavior.
+ *
+ * \ingroup Stochastics
+ */
+class StochasticsImplementation : public BasicStochastics<std::mt19937>
+{
+public:
+    StochasticsImplementation(const CallbackInterface *callbacks);
+    StochasticsImplementation(const StochasticsImplementation&) = delete;
+    StochasticsImplementation(StochasticsImplementation&&) = delete;
+    StochasticsImplementation& operator=(const StochasticsImplementation&) = delete;
+    StochasticsImplementation& operator=(StochasticsImplementation&&) = delete;
+    virtual ~StochasticsImplementation() = default;
+
     /*!
     * \brief Returns the random seed.
     *
@@ -200,36 +264,67 @@ public:
     */
     void InitGenerator(std::uint32_t seed);
 
-protected:
-    /*! Provides callback to LOG() macro
+    /*!
+    * \brief Creates an independent counter based stream.
     *
-    * @param[in]     logLevel    Importance of log
-    * @param[in]     file        Name of file where log is called
-    * @param[in]     line        Line within file where log is called
-    * @param[in]     message     Message to log
+    * \details The stream is keyed by the random seed of this module and the stream id.
+    * It follows every reinitialization of this module, i.e. it restarts with the new seed.
+    *
+    * @param[in]    streamId    Id of the stream, unique within an invocation.
+    *
+    * @return       Stream, which must not outlive this module.
     */
-    void Log(CbkLogLevel logLevel,
-             const char *file,
-             int line,
-             const std::string &message)
-    {
-        if(callbacks)
-        {
-            callbacks->Log(logLevel,
-                           file,
-                           line,
-                           message);
-        }
-    }
+    std::unique_ptr<StochasticsInterface> CreateStream(std::uint64_t streamId);
+
+    //! Returns the number of (re)initializations, streams use it to detect a new seed
+    std::uint64_t GetGeneration() const;
 
 private:
     std::uint32_t randomSeed = 0;
+    std::uint64_t generation = 0;
+};
 
-    std::mt19937 baseGenerator;
-    std::uniform_real_distribution<double> uniformDistribution;
-    BinomialDist binomialDistribution;
-    std::normal_distribution<double> normalDistribution;
-    std::exponential_distribution<double> exponentialDistribution;
+/*!
+ * \brief Counter based stream of a StochasticsImplementation
+ *
+ * Draws from a Philox4x32-10 engine keyed by the seed of the parent and the stream id.
+ * Streams share no state but the seed of their parent, so draws of different streams
+ * may happen in any order and concurrently.
+ *
+ * \ingroup Stochastics
+ */
+class StochasticsStream : public BasicStochastics<PhiloxEngine>
+{
+public:
+    StochasticsStream(const CallbackInterface *callbacks,
+                      const StochasticsImplementation &parent,
+                      std::uint64_t streamId);
+    StochasticsStream(const StochasticsStream&) = delete;
+    StochasticsStream(StochasticsStream&&) = delete;
+    StochasticsStream& operator=(const StochasticsStream&) = delete;
+    StochasticsStream& operator=(StochasticsStream&&) = delete;
+    virtual ~StochasticsStream() = default;
 
-    const CallbackInterface *callbacks;
+    //! Returns the seed the stream is keyed with
+    std::uint32_t GetRandomSeed() const;
+
+    //! Restarts the stream from its first number
+    void ReInit();
+
+    //! Keys the stream with the given seed until the parent is reinitialized
+    void InitGenerator(std::uint32_t seed);
+
+    //! Restarts the stream under a new stream id
+    void SetStreamId(std::uint64_t streamId);
+
+protected:
+    PhiloxEngine& GetGenerator();
+
+private:
+    void Seed(std::uint32_t seed);
+
+    const StochasticsImplementation &parent;
+    std::uint64_t streamId;
+    std::uint32_t seed = 0;
+    std::uint64_t generation = 0;
 };
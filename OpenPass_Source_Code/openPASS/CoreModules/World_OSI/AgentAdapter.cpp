@@ -12,11 +12,27 @@
 
 #include <cassert>
 #include <algorithm>
+#include <istream>
+#include <ostream>
 #include "AgentAdapter.h"
 #include "Common/globalDefinitions.h"
 
 namespace loc = World::Localization;
 
+namespace {
+//! Returns the cached result for the key, the query is only evaluated on a cache miss
+template <typename Key, typename Value, typename Query>
+const Value& Memoize(std::map<Key, Value>& cache, const Key& key, Query query)
+{
+    auto entry = cache.find(key);
+    if (entry == cache.end())
+    {
+        entry = cache.emplace(key, query()).first;
+    }
+    return entry->second;
+}
+} // namespace
+
 AgentAdapter::AgentAdapter(WorldInterface* world,
                            const CallbackInterface* callbacks,
                            World::Localization::Cache& localizationCache) :
@@ -99,8 +115,65 @@ bool AgentAdapter::InitAgentParameter(int id,
     return true;
 }
 
+void AgentAdapter::SaveState(std::ostream &state) const
+{
+    state << distanceReferencePointToFrontAxle << ' ' << weight << ' ' << heightCOG << ' ' << wheelbase << ' '
+          << momentInertiaRoll << ' ' << momentInertiaPitch << ' ' << momentInertiaYaw << ' ' << steeringRatio << ' '
+          << maxAcceleration << ' ' << maxDeceleration << ' ' << maxVelocity << ' ' << maxCurvature << ' '
+          << frictionCoeff << ' ' << trackWidth << ' ' << currentGear << ' ' << accelPedal << ' ' << brakePedal << ' '
+          << steeringWheelAngle << ' ' << engineSpeed << ' ' << hornSwitch << ' ' << flasherSwitch << ' '
+          << distanceTraveled << ' ' << isValid << ' ' << completlyInWorld << ' ' << collisionPartners.size();
+
+    for (const auto& collisionPartner : collisionPartners)
+    {
+        state << ' ' << static_cast<int>(collisionPartner.first) << ' ' << collisionPartner.second;
+    }
+
+    // the OSI object is stored as binary, preceded by its size
+    const std::string movingObjectState = GetBaseTrafficObject().SaveState();
+    state << ' ' << movingObjectState.size() << ' ';
+    state.write(movingObjectState.data(), static_cast<std::streamsize>(movingObjectState.size()));
+}
+
+void AgentAdapter::RestoreState(std::istream &state)
+{
+    size_t numberOfCollisionPartners = 0;
+
+    state >> distanceReferencePointToFrontAxle >> weight >> heightCOG >> wheelbase
+          >> momentInertiaRoll >> momentInertiaPitch >> momentInertiaYaw >> steeringRatio
+          >> maxAcceleration >> maxDeceleration >> maxVelocity >> maxCurvature
+          >> frictionCoeff >> trackWidth >> currentGear >> accelPedal >> brakePedal
+          >> steeringWheelAngle >> engineSpeed >> hornSwitch >> flasherSwitch
+          >> distanceTraveled >> isValid >> completlyInWorld >> numberOfCollisionPartners;
+
+    collisionPartners.clear();
+    for (size_t index = 0; index < numberOfCollisionPartners; ++index)
+    {
+        int objectType = 0;
+        int objectId = 0;
+        state >> objectType >> objectId;
+        collisionPartners.emplace_back(static_cast<ObjectTypeOSI>(objectType), objectId);
+    }
+
+    size_t movingObjectStateSize = 0;
+    state >> movingObjectStateSize;
+    state.ignore(1);
+    std::string movingObjectState(movingObjectStateSize, '\0');
+    state.read(&movingObjectState[0], static_cast<std::streamsize>(movingObjectStateSize));
+    GetBaseTrafficObject().RestoreState(movingObjectState);
+
+    // the agent was located at its spawn position before
+    locator.Unlocate();
+    locator.ResetSearch();
+    boundingBoxNeedsUpdate = true;
+    Locate();
+}
+
 bool AgentAdapter::Update()
 {
+    // the world was synchronized, other agents may have moved even if this one did not
+    queryCache.Clear();
+
     if (GetVelocity() == 0.0)
     {
         return true;
@@ -125,6 +198,7 @@ bool AgentAdapter::Locate()
     // reset on-demand values
     remainders.clear();
     boundaryPoints.clear();
+    queryCache.Clear();
 
     locateResult = locator.Locate(GetBoundingBox2D(), GetLength() + GetWidth());
     if (!locateResult.isLocalizable)
@@ -289,7 +363,10 @@ double AgentAdapter::GetVelocity(VelocityScope velocityScope) const
 
 double AgentAdapter::GetLaneWidth(int relativeLane, double distance) const
 {
-    return world->GetLaneWidth(GetRoadId(), GetLaneIdFromRelative(relativeLane), GetRoadPosition().s + distance);
+    return Memoize(queryCache.laneWidth, {relativeLane, distance}, [&]
+    {
+        return world->GetLaneWidth(GetRoadId(), GetLaneIdFromRelative(relativeLane), GetRoadPosition().s + distance);
+    });
 }
 
 double AgentAdapter::GetLaneWidthRightDrivingAndStopLane()
@@ -303,7 +380,10 @@ double AgentAdapter::GetLaneWidthRightDrivingAndStopLane()
 
 double AgentAdapter::GetLaneCurvature(int relativeLane, double distance)
 {
-    return world->GetLaneCurvature(GetRoadId(), GetLaneIdFromRelative(relativeLane), GetRoadPosition().s + distance);
+    return Memoize(queryCache.laneCurvature, {relativeLane, distance}, [&]
+    {
+        return world->GetLaneCurvature(GetRoadId(), GetLaneIdFromRelative(relativeLane), GetRoadPosition().s + distance);
+    });
 }
 
 bool AgentAdapter::IsEgoAgent() const
@@ -313,12 +393,28 @@ bool AgentAdapter::IsEgoAgent() const
 
 WorldObjectInterface* AgentAdapter::GetObjectInFront(double previewDistance, int relativeLaneId) const
 {
-    return world->GetNextObjectInLane(GetRoadId(), GetLaneIdFromRelative(relativeLaneId), GetBaseTrafficObject().GetDistance(OWL::MeasurementPoint::RoadEnd), previewDistance);
+    return Memoize(queryCache.objectInFront, {previewDistance, relativeLaneId}, [&]
+    {
+        return world->GetNextObjectInLane(GetRoadId(), GetLaneIdFromRelative(relativeLaneId), GetBaseTrafficObject().GetDistance(OWL::MeasurementPoint::RoadEnd), previewDistance);
+    });
 }
 
 WorldObjectInterface *AgentAdapter::GetObjectBehind(double previewDistance, int relativeLaneId) const
 {
-    return world->GetClosestObjectInUpstream(GetRoadId(), GetLaneIdFromRelative(relativeLaneId), GetBaseTrafficObject().GetDistance(OWL::MeasurementPoint::RoadEnd),  previewDistance);
+    return Memoize(queryCache.objectBehind, {previewDistance, relativeLaneId}, [&]
+    {
+        return world->GetClosestObjectInUpstream(GetRoadId(), GetLaneIdFromRelative(relativeLaneId), GetBaseTrafficObject().GetDistance(OWL::MeasurementPoint::RoadEnd),  previewDistance);
+    });
+}
+
+AgentSurroundings AgentAdapter::GetSurroundings(double searchDistance) const
+{
+    return Memoize(queryCache.surroundings, searchDistance, [&]
+    {
+        return world->GetSurroundings(GetRoadId(), GetMainLaneId(), locateResult.globalRoadPosition.laneId,
+                                      GetBaseTrafficObject().GetDistance(OWL::MeasurementPoint::RoadEnd),
+                                      GetRoadPosition().s, searchDistance);
+    });
 }
 
 TrafficObjectInterface* AgentAdapter::GetTrafficObjectInFront(int laneId) const
@@ -591,9 +687,12 @@ bool AgentAdapter::IsLaneRamp(int laneId, double distance)
 
 double AgentAdapter::GetDistanceToEndOfLane(double sightDistance, int relativeLane) const
 {
-    return world->GetDistanceToEndOfLane(GetRoadId(), GetLaneIdFromRelative(relativeLane),
-                                         GetBaseTrafficObject().GetDistance(OWL::MeasurementPoint::RoadEnd),
-                                         sightDistance);
+    return Memoize(queryCache.distanceToEndOfLane, {sightDistance, relativeLane}, [&]
+    {
+        return world->GetDistanceToEndOfLane(GetRoadId(), GetLaneIdFromRelative(relativeLane),
+                                             GetBaseTrafficObject().GetDistance(OWL::MeasurementPoint::RoadEnd),
+                                             sightDistance);
+    });
 }
 
 std::vector<const WorldObjectInterface*> AgentAdapter::GetObjectsInRange(int relativeLane, double backwardsRange,
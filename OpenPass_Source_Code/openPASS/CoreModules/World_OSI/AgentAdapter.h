@@ -22,6 +22,8 @@
 
 #include <QtGlobal>
 #include <functional>
+#include <map>
+#include <utility>
 
 #include "Interfaces/worldInterface.h"
 #include "Interfaces/trafficObjectInterface.h"
@@ -720,6 +722,8 @@ public:
 
     WorldObjectInterface* GetObjectBehind(double previewDistance, int relativeLaneId = 0) const override;
 
+    AgentSurroundings GetSurroundings(double searchDistance) const override;
+
     const AgentInterface* GetAgentBehind(int laneId) const override;
 
     double GetDistanceToObject(const WorldObjectInterface* otherObject) const override;
@@ -777,6 +781,15 @@ public:
         this->sensorParameters = sensorParameters;
     }
 
+    bool SupportsCheckpoint() const override
+    {
+        return true;
+    }
+
+    void SaveState(std::ostream &state) const override;
+
+    void RestoreState(std::istream &state) override;
+
     virtual std::vector<const WorldObjectInterface*> GetObjectsInRange(int relativeLane, double backwardsRange,
             double forwardRange, MeasurementPoint mp) const override;
 
@@ -1237,6 +1250,29 @@ private:
     mutable std::vector<GlobalRoadPosition> boundaryPoints;
     mutable World::Localization::Remainders remainders;
 
+    //! Results of lane and object queries, which depend on the other agents as well.
+    //! Valid until the world is synchronized, see Update()
+    struct QueryCache
+    {
+        std::map<std::pair<int, double>, double> laneWidth;
+        std::map<std::pair<int, double>, double> laneCurvature;
+        std::map<std::pair<double, int>, double> distanceToEndOfLane;
+        std::map<std::pair<double, int>, WorldObjectInterface*> objectInFront;
+        std::map<std::pair<double, int>, WorldObjectInterface*> objectBehind;
+        std::map<double, AgentSurroundings> surroundings;
+
+        void Clear()
+        {
+            laneWidth.clear();
+            laneCurvature.clear();
+            distanceToEndOfLane.clear();
+            objectInFront.clear();
+            objectBehind.clear();
+            surroundings.clear();
+        }
+    };
+    mutable QueryCache queryCache;
+
     std::vector<std::pair<ObjectTypeOSI, int>> collisionPartners;
     bool isValid = true;
 
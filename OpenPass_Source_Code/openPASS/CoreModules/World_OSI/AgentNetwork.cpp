@@ -36,6 +36,9 @@ void AgentNetwork::Clear()
     }
 
     agents.clear();
+    agentsByName.clear();
+    agentsByCategory.clear();
+    occupancyGrid.Clear();
 
     for (const auto& removedAgent : removedAgents)
     {
@@ -53,9 +56,39 @@ bool AgentNetwork::AddAgent(int id, AgentInterface* agent)
         return false;
     }
 
+    AddToIndices(agent);
+
+    // agents are located on instantiation, so their bounding box is valid already
+    occupancyGrid.Insert(agent->GetBoundingBox2D());
+
     return true;
 }
 
+void AgentNetwork::AddToIndices(AgentInterface* agent)
+{
+    agentsByName[agent->GetScenarioName()].insert({agent->GetId(), agent});
+
+    // ids are assigned in ascending order, so appending keeps the lists ordered by id
+    agentsByCategory[agent->GetAgentCategory()].push_back(agent);
+    agentsByCategory[AgentCategory::Any].push_back(agent);
+}
+
+void AgentNetwork::RemoveFromIndices(const AgentInterface* agent)
+{
+    auto namedAgents = agentsByName.find(agent->GetScenarioName());
+    if (namedAgents != agentsByName.end())
+    {
+        namedAgents->second.erase(agent->GetId());
+        if (namedAgents->second.empty())
+        {
+            agentsByName.erase(namedAgents);
+        }
+    }
+
+    agentsByCategory[agent->GetAgentCategory()].remove(const_cast<AgentInterface*>(agent));
+    agentsByCategory[AgentCategory::Any].remove(const_cast<AgentInterface*>(agent));
+}
+
 AgentInterface* AgentNetwork::GetAgent(int id) const
 {
     if (agents.find(id) == agents.end())
@@ -76,6 +109,51 @@ const std::list<const AgentInterface*>& AgentNetwork::GetRemovedAgents() const
     return removedAgents;
 }
 
+AgentInterface* AgentNetwork::GetEgoAgent() const
+{
+    const auto& egoAgents = GetAgentsByCategory(AgentCategory::Ego);
+    return egoAgents.empty() ? nullptr : egoAgents.front();
+}
+
+AgentInterface* AgentNetwork::GetAgentByName(const std::string& scenarioName) const
+{
+    const auto namedAgents = agentsByName.find(scenarioName);
+    if (namedAgents == agentsByName.end())
+    {
+        return nullptr;
+    }
+
+    return namedAgents->second.begin()->second;
+}
+
+void AgentNetwork::RebuildOccupancyGrid()
+{
+    occupancyGrid.Clear();
+
+    for (const auto& item : agents)
+    {
+        occupancyGrid.Insert(item.second->GetBoundingBox2D());
+    }
+}
+
+bool AgentNetwork::IntersectsWithAgent(const polygon_t& footprint) const
+{
+    return occupancyGrid.Intersects(footprint);
+}
+
+const std::list<AgentInterface*>& AgentNetwork::GetAgentsByCategory(AgentCategory agentCategory) const
+{
+    static const std::list<AgentInterface*> noAgents;
+
+    const auto categoryAgents = agentsByCategory.find(agentCategory);
+    if (categoryAgents == agentsByCategory.end())
+    {
+        return noAgents;
+    }
+
+    return categoryAgents->second;
+}
+
 void AgentNetwork::QueueAgentUpdate(std::function<void()> func)
 {
     updateQueue.push_back(func);
@@ -107,6 +185,10 @@ void AgentNetwork::SyncGlobalData()
         {
             LOG(CbkLogLevel::Warning, "trying to remove non-existent agent");
         }
+        else
+        {
+            RemoveFromIndices(agent);
+        }
 
         removedAgents.push_back(agent);
 
@@ -130,4 +212,6 @@ void AgentNetwork::SyncGlobalData()
             continue;
         }
     }
+
+    RebuildOccupancyGrid();
 }
@@ -22,9 +22,13 @@
 #include <tuple>
 #include <algorithm>
 #include <utility>
+#include <list>
 #include <map>
+#include <string>
+#include <unordered_map>
 #include "Interfaces/agentInterface.h"
 #include "AgentAdapter.h"
+#include "AgentOccupancyGrid.h"
 #include "Interfaces/worldInterface.h"
 
 
@@ -110,6 +114,41 @@ public:
      */
     virtual const std::list<const AgentInterface*> &GetRemovedAgents() const;
 
+    /*!
+     * \brief GetEgoAgent
+     * Retrieves the ego agent with the lowest id (indexed, no search)
+     *
+     * \return              Ego agent, nullptr if there is none
+     */
+    AgentInterface *GetEgoAgent() const;
+
+    /*!
+     * \brief GetAgentByName
+     * Retrieves the agent with the given scenario name and the lowest id (indexed, no search)
+     *
+     * \param[in] scenarioName  Scenario name of the agent
+     * \return              Agent reference, nullptr if there is none
+     */
+    AgentInterface *GetAgentByName(const std::string &scenarioName) const;
+
+    /*!
+     * \brief GetAgentsByCategory
+     * Retrieves all agents of a category ordered by id (indexed, no search)
+     *
+     * \param[in] agentCategory Category of the agents, AgentCategory::Any for all agents
+     * \return              List of agent references
+     */
+    const std::list<AgentInterface*> &GetAgentsByCategory(AgentCategory agentCategory) const;
+
+    /*!
+     * \brief IntersectsWithAgent
+     * Checks if a footprint overlaps the bounding box of any agent (indexed, no search)
+     *
+     * \param[in] footprint  Polygon to test
+     * \return              true if the footprint intersects an agent
+     */
+    bool IntersectsWithAgent(const polygon_t &footprint) const;
+
 protected:
     //-----------------------------------------------------------------------------
     //! Provides callback to LOG() macro
@@ -133,9 +172,21 @@ protected:
         }
     }
 
-private:    
+private:
+    //! Adds the agent to the secondary indices (scenario name and category)
+    void AddToIndices(AgentInterface *agent);
+
+    //! Removes the agent from the secondary indices (scenario name and category)
+    void RemoveFromIndices(const AgentInterface *agent);
+
+    //! Rebuilds the occupancy grid from the current bounding boxes of all agents
+    void RebuildOccupancyGrid();
+
     WorldInterface *world;
     std::map<int, AgentInterface*> agents;
+    std::unordered_map<std::string, std::map<int, AgentInterface*>> agentsByName;
+    std::map<AgentCategory, std::list<AgentInterface*>> agentsByCategory;
+    AgentOccupancyGrid occupancyGrid;
     std::list<const AgentInterface*> removedAgents;
     std::list<std::function<void()>> updateQueue;
     std::list<const AgentInterface*> removeQueue;
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include "AgentOccupancyGrid.h"
+
+AgentOccupancyGrid::AgentOccupancyGrid(double cellSize) :
+    cellSize(cellSize)
+{}
+
+void AgentOccupancyGrid::Clear()
+{
+    entries.clear();
+    cells.clear();
+}
+
+void AgentOccupancyGrid::Insert(const polygon_t &boundingBox)
+{
+    const size_t index = entries.size();
+    entries.push_back({bg::return_envelope<box_t>(boundingBox), boundingBox});
+
+    const box_t &envelope = entries.back().envelope;
+    const int64_t lastColumn = CellIndex(envelope.max_corner().x());
+    const int64_t lastRow = CellIndex(envelope.max_corner().y());
+
+    for (int64_t column = CellIndex(envelope.min_corner().x()); column <= lastColumn; ++column)
+    {
+        for (int64_t row = CellIndex(envelope.min_corner().y()); row <= lastRow; ++row)
+        {
+            cells[CellKey(column, row)].push_back(index);
+        }
+    }
+}
+
+bool AgentOccupancyGrid::Intersects(const polygon_t &footprint) const
+{
+    if (entries.empty())
+    {
+        return false;
+    }
+
+    const box_t footprintEnvelope = bg::return_envelope<box_t>(footprint);
+    const int64_t firstColumn = CellIndex(footprintEnvelope.min_corner().x());
+    const int64_t lastColumn = CellIndex(footprintEnvelope.max_corner().x());
+    const int64_t firstRow = CellIndex(footprintEnvelope.min_corner().y());
+    const int64_t lastRow = CellIndex(footprintEnvelope.max_corner().y());
+
+    for (int64_t column = firstColumn; column <= lastColumn; ++column)
+    {
+        for (int64_t row = firstRow; row <= lastRow; ++row)
+        {
+            const auto cell = cells.find(CellKey(column, row));
+            if (cell == cells.end())
+            {
+                continue;
+            }
+
+            for (size_t index : cell->second)
+            {
+                const Entry &entry = entries[index];
+                if (!bg::intersects(footprintEnvelope, entry.envelope))
+                {
+                    continue;
+                }
+
+                // a pair of overlapping envelopes shares several cells, test it only in the
+                // cell containing the lower left corner of their overlap
+                if (CellIndex(std::max(footprintEnvelope.min_corner().x(), entry.envelope.min_corner().x())) != column ||
+                    CellIndex(std::max(footprintEnvelope.min_corner().y(), entry.envelope.min_corner().y())) != row)
+                {
+                    continue;
+                }
+
+                if (bg::intersects(footprint, entry.boundingBox))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+int64_t AgentOccupancyGrid::CellIndex(double coordinate) const
+{
+    return static_cast<int64_t>(std::floor(coordinate / cellSize));
+}
+
+uint64_t AgentOccupancyGrid::CellKey(int64_t column, int64_t row)
+{
+    return (static_cast<uint64_t>(column) << 32) ^ (static_cast<uint64_t>(row) & 0xFFFFFFFFu);
+}
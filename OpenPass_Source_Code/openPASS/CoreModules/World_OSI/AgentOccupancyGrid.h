@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+//-----------------------------------------------------------------------------
+//! @file  AgentOccupancyGrid.h
+//! @brief This file contains a uniform grid over the bounding boxes of the agents
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/boostGeometryCommon.h"
+
+/*!
+* \brief Uniform grid over the bounding boxes of all agents
+*
+* Each bounding box is registered in all cells overlapped by its axis aligned envelope.
+* A footprint is only tested against the boxes of the cells it overlaps, and the exact
+* polygon intersection is only calculated if the envelopes overlap.
+*/
+class AgentOccupancyGrid
+{
+public:
+    //! \param[in] cellSize     edge length of a square cell [m]
+    explicit AgentOccupancyGrid(double cellSize = 10.0);
+
+    //! Removes all bounding boxes
+    void Clear();
+
+    //! Adds the bounding box of an agent
+    void Insert(const polygon_t &boundingBox);
+
+    /*!
+     * \brief Checks if a footprint overlaps any of the bounding boxes
+     *
+     * \param[in] footprint     polygon to test
+     * \return true if the footprint intersects a bounding box
+     */
+    bool Intersects(const polygon_t &footprint) const;
+
+private:
+    struct Entry
+    {
+        box_t envelope;
+        polygon_t boundingBox;
+    };
+
+    int64_t CellIndex(double coordinate) const;
+    static uint64_t CellKey(int64_t column, int64_t row);
+
+    double cellSize;
+    std::vector<Entry> entries;
+    std::unordered_map<uint64_t, std::vector<size_t>> cells;
+};
@@ -10,6 +10,8 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <utility>
 #include <limits>
 #include <cassert>
@@ -223,7 +225,8 @@ bool GeometryConverter::CalculateLanes(double side,
                                        double sectionOffsetEnd,
                                        double roadOffset,
                                        double roadSectionStart,
-                                       int index)
+                                       int index,
+                                       LaneGeometrySamples& samples)
 {
     Q_UNUSED(sectionOffsetStart);
     Q_UNUSED(sectionOffsetEnd);
@@ -299,9 +302,7 @@ bool GeometryConverter::CalculateLanes(double side,
                                               laneOffset,
                                               laneWidth);
 
-        worldData.AddLaneGeometryPoint(*roadLane,
-                                       pointLeft, pointCenter, pointRight,
-                                       roadOffset, curvature, heading);
+        samples.push_back({roadLane, pointLeft, pointCenter, pointRight, roadOffset, curvature, heading});
 
         previousWidth += laneWidth;
     }
@@ -435,7 +436,8 @@ bool GeometryConverter::CalculatePoints(double geometryOffsetStart,
                                         double sectionOffsetStart,
                                         double sectionOffsetEnd,
                                         double roadGeometryStart,
-                                        double roadSectionStart)
+                                        double roadSectionStart,
+                                        LaneGeometrySamples& samples)
 {
     // calculate points
     double geometryOffset = geometryOffsetStart;
@@ -456,7 +458,8 @@ bool GeometryConverter::CalculatePoints(double geometryOffsetStart,
                            sectionOffsetEnd,
                            roadGeometryStart + geometryOffset,
                            roadSectionStart,
-                           index))
+                           index,
+                           samples))
         {
             return false;
         }
@@ -470,7 +473,8 @@ bool GeometryConverter::CalculatePoints(double geometryOffsetStart,
                            sectionOffsetEnd,
                            roadGeometryStart + geometryOffset,
                            roadSectionStart,
-                           index))
+                           index,
+                           samples))
         {
             return false;
         }
@@ -529,7 +533,8 @@ bool GeometryConverter::CalculatePointsOfAffectedGeometry(double roadSectionStar
                                                           double roadGeometryLength,
                                                           std::map<int, RoadLaneInterface *>& roadLanes,
                                                           RoadInterface* road,
-                                                          RoadGeometryInterface* roadGeometry)
+                                                          RoadGeometryInterface* roadGeometry,
+                                                          LaneGeometrySamples& samples)
 {
     double geometryOffsetStart;
     double sectionOffsetStart;
@@ -570,7 +575,8 @@ bool GeometryConverter::CalculatePointsOfAffectedGeometry(double roadSectionStar
                                   sectionOffsetStart,
                                   sectionOffsetEnd,
                                   roadGeometryStart,
-                                  roadSectionStart);
+                                  roadSectionStart,
+                                  samples);
 
     return status;
 }
@@ -578,7 +584,8 @@ bool GeometryConverter::CalculatePointsOfAffectedGeometry(double roadSectionStar
 bool GeometryConverter::CalculateGeometries(double roadSectionStart,
                                             double roadSectionNextStart,
                                             RoadInterface* road,
-                                            std::map<int, RoadLaneInterface*>& roadLanes)
+                                            std::map<int, RoadLaneInterface*>& roadLanes,
+                                            LaneGeometrySamples& samples)
 {
     bool status;
 
@@ -595,7 +602,8 @@ bool GeometryConverter::CalculateGeometries(double roadSectionStart,
                                    roadLanes,
                                    roadGeometry,
                                    roadGeometryStart,
-                                   roadGeometryEnd);
+                                   roadGeometryEnd,
+                                   samples);
 
         if(!status) return status;
     }
@@ -610,7 +618,8 @@ bool GeometryConverter::CalculateGeometry(double roadSectionStart,
                                           std::map<int, RoadLaneInterface*>& roadLanes,
                                           RoadGeometryInterface* roadGeometry,
                                           double& roadGeometryStart,
-                                          double& roadGeometryEnd)
+                                          double& roadGeometryEnd,
+                                          LaneGeometrySamples& samples)
 {
     double roadGeometryLength = roadGeometry->GetLength();
 
@@ -628,7 +637,8 @@ bool GeometryConverter::CalculateGeometry(double roadSectionStart,
                                                         roadGeometryLength,
                                                         roadLanes,
                                                         road,
-                                                        roadGeometry);
+                                                        roadGeometry,
+                                                        samples);
         if(status == false) return status;
     }
 
@@ -637,41 +647,90 @@ bool GeometryConverter::CalculateGeometry(double roadSectionStart,
 
 bool GeometryConverter::CalculateRoads()
 {
-    for(auto &roadItem : scenery->GetRoads())
+    std::vector<RoadInterface*> roads;
+    for (auto &roadItem : scenery->GetRoads())
     {
-        RoadInterface *road = roadItem.second;
+        roads.push_back(roadItem.second);
+    }
 
-        std::vector<RoadLaneSectionInterface*> roadLaneSections = road->GetLaneSections();
+    // sampling the road geometries only reads the scenery, so roads are processed concurrently
+    std::vector<LaneGeometrySamples> roadSamples(roads.size());
+    std::vector<char> roadStatus(roads.size(), false);
+    std::atomic<size_t> nextRoad {0};
 
-        //for(size_t i = 0; i < numberOfRoadLaneSections; i++)
-        //for (const auto roadSection : roadLaneSections)
-        for (auto roadLaneSectionIt = roadLaneSections.begin();
-             roadLaneSectionIt != roadLaneSections.end();
-             roadLaneSectionIt++)
+    auto worker = [&]()
+    {
+        for (size_t roadIndex = nextRoad++; roadIndex < roads.size(); roadIndex = nextRoad++)
         {
-            RoadLaneSectionInterface* roadSection = *roadLaneSectionIt;
-            std::map<int, RoadLaneInterface*>& roadLanes = roadSection->GetLanes();
+            roadStatus[roadIndex] = CalculateRoad(roads[roadIndex], roadSamples[roadIndex]);
+        }
+    };
 
-            if(!roadLanes.empty())
-            {
-                double roadSectionStart = roadSection->GetStart();
-                double roadSectionNextStart = std::numeric_limits<double>::max();
-
-                if (std::next(roadLaneSectionIt) != roadLaneSections.end()) // if not a single element in the list
-                {
-                    roadSectionNextStart = (*std::next(roadLaneSectionIt))->GetStart();
-                }
-
-                // collect geometry sections
-                bool status;
-                status = CalculateGeometries(roadSectionStart,
-                                             roadSectionNextStart,
-                                             road,
-                                             roadLanes);
-
-                if(status == false) return status;
-            } // if lanes are not empty
+    const size_t numberOfWorkers = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), roads.size());
+    std::vector<std::thread> workers;
+    for (size_t workerIndex = 1; workerIndex < numberOfWorkers; ++workerIndex)
+    {
+        workers.emplace_back(worker);
+    }
+    worker();
+
+    for (auto &thread : workers)
+    {
+        thread.join();
+    }
+
+    // the world data is filled sequentially in road order, so the result does not depend on the scheduling
+    for (size_t roadIndex = 0; roadIndex < roads.size(); ++roadIndex)
+    {
+        if (!roadStatus[roadIndex])
+        {
+            return false;
+        }
+
+        for (const auto &sample : roadSamples[roadIndex])
+        {
+            worldData.AddLaneGeometryPoint(*sample.roadLane,
+                                           sample.pointLeft, sample.pointCenter, sample.pointRight,
+                                           sample.roadOffset, sample.curvature, sample.heading);
         }
+
+        LaneGeometrySamples().swap(roadSamples[roadIndex]);
+    }
+
+    return true;
+}
+
+bool GeometryConverter::CalculateRoad(RoadInterface *road, LaneGeometrySamples &samples)
+{
+    std::vector<RoadLaneSectionInterface*> roadLaneSections = road->GetLaneSections();
+
+    for (auto roadLaneSectionIt = roadLaneSections.begin();
+         roadLaneSectionIt != roadLaneSections.end();
+         roadLaneSectionIt++)
+    {
+        RoadLaneSectionInterface* roadSection = *roadLaneSectionIt;
+        std::map<int, RoadLaneInterface*>& roadLanes = roadSection->GetLanes();
+
+        if(!roadLanes.empty())
+        {
+            double roadSectionStart = roadSection->GetStart();
+            double roadSectionNextStart = std::numeric_limits<double>::max();
+
+            if (std::next(roadLaneSectionIt) != roadLaneSections.end()) // if not a single element in the list
+            {
+                roadSectionNextStart = (*std::next(roadLaneSectionIt))->GetStart();
+            }
+
+            // collect geometry sections
+            bool status;
+            status = CalculateGeometries(roadSectionStart,
+                                         roadSectionNextStart,
+                                         road,
+                                         roadLanes,
+                                         samples);
+
+            if(status == false) return status;
+        } // if lanes are not empty
     }
 
     return true;
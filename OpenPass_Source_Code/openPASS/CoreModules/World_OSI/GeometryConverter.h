@@ -18,6 +18,7 @@
 
 #include <map>
 #include <list>
+#include <vector>
 #include "Interfaces/sceneryInterface.h"
 #include "WorldData.h"
 #include "Interfaces/worldInterface.h"
@@ -79,6 +80,20 @@ protected:
     }
 
 private:
+    //! Sampled lane geometry point, collected per road before it is added to the world data
+    struct LaneGeometrySample
+    {
+        RoadLaneInterface* roadLane;
+        Common::Vector2d pointLeft;
+        Common::Vector2d pointCenter;
+        Common::Vector2d pointRight;
+        double roadOffset;
+        double curvature;
+        double heading;
+    };
+
+    using LaneGeometrySamples = std::vector<LaneGeometrySample>;
+
     //-----------------------------------------------------------------------------
     //! Calculates height coordinate according to OpenDrive elevation profiles.
     //!
@@ -101,7 +116,8 @@ private:
     //! Iterates over all OpenDrive Roads to calculate Geometries.
     //!
     //! This function is a part of the Convert function.
-    //! Iterates over all roads to calculate Geometries
+    //! The roads are sampled concurrently (one task per road), afterwards the
+    //! samples are added to the world data in road order.
     //!
     //! Notes:
     //! - OpenDrive center lanes are skipped (width=0 by convention)
@@ -110,6 +126,17 @@ private:
     //-----------------------------------------------------------------------------
     bool CalculateRoads();
 
+    //-----------------------------------------------------------------------------
+    //! Samples the lane geometries of all lane sections of a single road.
+    //!
+    //! Only reads the scenery, hence it can be called concurrently for different roads.
+    //!
+    //! @param[in]  road           OpenDrive road data structure
+    //! @param[out] samples        Sampled lane geometry points of the road
+    //! @return                    False if an error occurred, true otherwise
+    //-----------------------------------------------------------------------------
+    bool CalculateRoad(RoadInterface *road, LaneGeometrySamples &samples);
+
     //-----------------------------------------------------------------------------
     //! Iterates over all geometries to calculate the geometry.
     //!
@@ -120,12 +147,14 @@ private:
     //! @param[in]  roadSectionNextStart   s coordinate of next roadSectionStart
     //! @param[in]  road                   Pointer containing the road
     //! @param[in]  roadLanes              Map of lanes per Road
+    //! @param[out] samples                Sampled lane geometry points
     //! @return                     False if an error occurred, true otherwise
     //-----------------------------------------------------------------------------
     bool CalculateGeometries(double roadSectionStart,
                              double roadSectionNextStart,
                              RoadInterface *road,
-                             std::map<int, RoadLaneInterface*> &roadLanes);
+                             std::map<int, RoadLaneInterface*> &roadLanes,
+                             LaneGeometrySamples &samples);
 
     //-----------------------------------------------------------------------------
     //! Calculates points if section is affected by geometry.
@@ -140,6 +169,7 @@ private:
     //! @param[in]  roadGeometry           Pointer containing the roadGeometry
     //! @param[out] roadGeometryStart      s coordinate of roadGeometryStart
     //! @param[out] roadGeometryEnd        s coordinate of roadGeometryEnd
+    //! @param[out] samples                Sampled lane geometry points
     //! @return                    False if an error occurred, true otherwise
     //-----------------------------------------------------------------------------
     bool CalculateGeometry(double roadSectionStart,
@@ -148,7 +178,8 @@ private:
                            std::map<int, RoadLaneInterface*> &roadLanes,
                            RoadGeometryInterface *roadGeometry,
                            double &roadGeometryStart,
-                           double &roadGeometryEnd);
+                           double &roadGeometryEnd,
+                           LaneGeometrySamples &samples);
 
     //-----------------------------------------------------------------------------
     //! Allocates lane geometry and calculates points.
@@ -165,6 +196,7 @@ private:
     //! @param[in]  roadLanes              Map of lanes per Road
     //! @param[in]  road                   Pointer containing the road
     //! @param[in]  roadGeometry           Pointer containing the roadGeometry
+    //! @param[out] samples                Sampled lane geometry points
     //! @return                    False if an error occurred, true otherwise
     //-----------------------------------------------------------------------------
     bool CalculatePointsOfAffectedGeometry(double roadSectionStart,
@@ -174,7 +206,8 @@ private:
                                            double roadGeometryLength,
                                            std::map<int, RoadLaneInterface *> &roadLanes,
                                            RoadInterface *road,
-                                           RoadGeometryInterface *roadGeometry);
+                                           RoadGeometryInterface *roadGeometry,
+                                           LaneGeometrySamples &samples);
 
     //-----------------------------------------------------------------------------
     //! Calculates geometryOffSetStart and SectionOffsetStart.
@@ -232,6 +265,7 @@ private:
     //! @param[out] sectionOffsetEnd       Offset to the end point of the section
     //! @param[in]  roadGeometryStart      s coordinate of roadGeometryStart
     //! @param[in]  roadSectionStart       s coordinate of current roadSectionStart
+    //! @param[out] samples                Sampled lane geometry points
     //-----------------------------------------------------------------------------
     bool CalculatePoints(double geometryOffsetStart,
                          double geometryOffsetEnd,
@@ -242,7 +276,8 @@ private:
                          double sectionOffsetStart,
                          double sectionOffsetEnd,
                          double roadGeometryStart,
-                         double roadSectionStart);
+                         double roadSectionStart,
+                         LaneGeometrySamples &samples);
 
 
     //-----------------------------------------------------------------------------
@@ -258,6 +293,7 @@ private:
     //! @param[in]  roadOffset           Absolute offset within lane
     //! @param[in]  roadSectionStart     Start offset of lane section within road
     //! @param[in]  index                Index within lane memory
+    //! @param[out] samples              Sampled lane geometry points
     //! @return                          True
     //-----------------------------------------------------------------------------
     bool CalculateLanes(double side,
@@ -269,7 +305,8 @@ private:
                         double sectionOffsetEnd,
                         double roadOffset,
                         double roadSectionStart,
-                        int index);
+                        int index,
+                        LaneGeometrySamples &samples);
 
 
     //-----------------------------------------------------------------------------
@@ -234,6 +234,11 @@ void BaseTrafficObjectLocator::Unlocate()
     baseTrafficObject.ClearLaneAssignments();
 }
 
+void BaseTrafficObjectLocator::ResetSearch()
+{
+    searchInitializer = SearchInitializer{};
+}
+
 std::vector<GlobalRoadPosition> LazyCoverageSolver::GetBoundaryPoints(const std::unique_ptr<PointAggregator>&
         pointAggregator)
 {
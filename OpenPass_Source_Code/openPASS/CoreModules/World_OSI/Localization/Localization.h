@@ -110,6 +110,9 @@ public:
     std::vector<GlobalRoadPosition> GetBoundaryPoints() const;
 
     void Unlocate();
+
+    //! Forgets the section found by the last localization, so that the next localization searches all roads
+    void ResetSearch();
 };
 
 }
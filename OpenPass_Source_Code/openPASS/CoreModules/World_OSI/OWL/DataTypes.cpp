@@ -808,6 +808,21 @@ void MovingObject::CopyToGroundTruth(osi3::GroundTruth& target) const
     newMovingObject->CopyFrom(*osiObject);
 }
 
+std::string MovingObject::SaveState() const
+{
+    return osiObject->SerializeAsString();
+}
+
+void MovingObject::RestoreState(const std::string& state)
+{
+    const auto id = osiObject->id().value();
+    osiObject->ParseFromString(state);
+    osiObject->mutable_id()->set_value(id);
+
+    frontDistance.Invalidate();
+    rearDistance.Invalidate();
+}
+
 Id MovingObject::GetId() const
 {
     return osiObject->id().value();
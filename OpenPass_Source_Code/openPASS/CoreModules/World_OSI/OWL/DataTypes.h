@@ -717,6 +717,23 @@ public:
     virtual bool GetHeadLight() const = 0;
     virtual void SetHighBeamLight(bool highbeamLight) = 0;
     virtual bool GetHighBeamLight() const = 0;
+
+    /*!
+     * \brief Serializes the underlying OSI object
+     *
+     * \return serialized state of the object
+     */
+    virtual std::string SaveState() const = 0;
+
+    /*!
+     * \brief Restores the underlying OSI object from a state returned by SaveState()
+     *
+     * The id of the object is kept. Road coordinate and lane assignments are not part of
+     * the state and have to be updated by localizing the object.
+     *
+     * \param[in] state    serialized state of an object
+     */
+    virtual void RestoreState(const std::string& state) = 0;
 };
 
 
@@ -1099,6 +1116,9 @@ public:
     virtual void SetHighBeamLight(bool highbeamLight) override;
     virtual bool GetHighBeamLight() const override;
 
+    std::string SaveState() const override;
+    void RestoreState(const std::string& state) override;
+
     void CopyToGroundTruth(osi3::GroundTruth& target) const override;
 private:
     osi3::MovingObject* osiObject;
@@ -119,6 +119,8 @@ public:
     MOCK_CONST_METHOD0(GetHeadLight, bool());
     MOCK_METHOD1(SetHighBeamLight, void(bool highbeamLight));
     MOCK_CONST_METHOD0(GetHighBeamLight, bool());
+    MOCK_CONST_METHOD0(SaveState, std::string());
+    MOCK_METHOD1(RestoreState, void(const std::string& state));
 
     MOCK_CONST_METHOD1(CopyToGroundTruth, void(osi3::GroundTruth&));
 };
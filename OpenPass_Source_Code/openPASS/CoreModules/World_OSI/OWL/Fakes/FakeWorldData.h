@@ -80,6 +80,7 @@ public:
     MOCK_CONST_METHOD0(GetTrafficSigns, const std::unordered_map<OWL::Id, OWL::Interfaces::TrafficSign*>& ());
 
     MOCK_METHOD2(GetSensorView, osi3::SensorView(osi3::SensorViewConfiguration&, int));
+    MOCK_METHOD2(GetSensorView, osi3::SensorView(const std::vector<osi3::SensorViewConfiguration>&, int));
 
     const OWL::Implementation::InvalidLane& GetInvalidLane() const override
     {
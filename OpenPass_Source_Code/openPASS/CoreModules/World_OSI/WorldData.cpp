@@ -16,6 +16,7 @@
 
 #include <exception>
 #include <string>
+#include <unordered_set>
 #include <qglobal.h>
 
 #include "Interfaces/roadInterface/roadInterface.h"
@@ -34,19 +35,28 @@
 namespace OWL {
 
 osi3::SensorView WorldData::GetSensorView(osi3::SensorViewConfiguration& conf, int agentId)
+{
+    return GetSensorView(std::vector<osi3::SensorViewConfiguration>{conf}, agentId);
+}
+
+osi3::SensorView WorldData::GetSensorView(const std::vector<osi3::SensorViewConfiguration>& confs, int agentId)
 {
     const auto host_id = GetOwlId(agentId);
+    const auto& hostVehicle = GetMovingObjectById(host_id);
     osi3::SensorView sv;
 
     auto currentInterfaceVersion = osi3::InterfaceVersion::descriptor()->file()->options().GetExtension(osi3::current_interface_version);
     sv.mutable_version()->CopyFrom(currentInterfaceVersion);
 
-    sv.mutable_sensor_id()->CopyFrom(conf.sensor_id());
-    sv.mutable_mounting_position()->CopyFrom(conf.mounting_position());
-    sv.mutable_mounting_position_rmse()->CopyFrom(conf.mounting_position());
+    // sensor specific information is only available for a single sensor
+    if (confs.size() == 1)
+    {
+        sv.mutable_sensor_id()->CopyFrom(confs.front().sensor_id());
+        sv.mutable_mounting_position()->CopyFrom(confs.front().mounting_position());
+        sv.mutable_mounting_position_rmse()->CopyFrom(confs.front().mounting_position());
+    }
 
-    auto filteredGroundTruth = GetFilteredGroundTruth(conf, GetMovingObjectById(host_id));
-    sv.mutable_global_ground_truth()->CopyFrom(filteredGroundTruth);
+    *sv.mutable_global_ground_truth() = GetFilteredGroundTruth(confs, hostVehicle);
     sv.mutable_host_vehicle_id()->set_value(host_id);
 
     auto zeroVector3d = osi3::Vector3d();
@@ -67,14 +77,18 @@ osi3::SensorView WorldData::GetSensorView(osi3::SensorViewConfiguration& conf, i
     zeroError.mutable_orientation_rate()->CopyFrom(zeroOrientation3d);
     zeroError.mutable_orientation_acceleration()->CopyFrom(zeroOrientation3d);
 
-    auto hostData = osi3::HostVehicleData();
-    auto& movingObject = GetMovingObjectById(host_id);
-    hostData.mutable_location_rmse()->CopyFrom(zeroError);
+    auto hostData = sv.mutable_host_vehicle_data();
+    hostData->mutable_location_rmse()->CopyFrom(zeroError);
 
-    osi3::GroundTruth tempGroundTruth;
-    movingObject.CopyToGroundTruth(tempGroundTruth);
-    hostData.mutable_location()->CopyFrom(tempGroundTruth.mutable_moving_object(0)->base());
-    sv.mutable_host_vehicle_data()->CopyFrom(hostData);
+    // the host vehicle is always part of the filtered GroundTruth, so it is not copied again
+    for (const auto& object : sv.global_ground_truth().moving_object())
+    {
+        if (object.id().value() == host_id)
+        {
+            hostData->mutable_location()->CopyFrom(object.base());
+            break;
+        }
+    }
 
     return sv;
 }
@@ -100,35 +114,54 @@ OWL::Id WorldData::GetOwlId(int agentId)
 
 osi3::GroundTruth WorldData::GetFilteredGroundTruth(const osi3::SensorViewConfiguration& conf, const OWL::Interfaces::MovingObject& reference)
 {
-    bool referenceObjectAdded = false;
-    osi3::GroundTruth filteredGroundTruth;
+    return GetFilteredGroundTruth(std::vector<osi3::SensorViewConfiguration>{conf}, reference);
+}
 
-    Primitive::AbsPosition relativeSensorPos
-        { conf.mounting_position().position().x(),
-          conf.mounting_position().position().y(),
-          conf.mounting_position().position().z() };
+osi3::GroundTruth WorldData::GetFilteredGroundTruth(const std::vector<osi3::SensorViewConfiguration>& confs, const OWL::Interfaces::MovingObject& reference)
+{
+    osi3::GroundTruth filteredGroundTruth;
 
     const auto& orientation = reference.GetAbsOrientation();
-    auto absoluteSensorPos = reference.GetReferencePointPosition() + relativeSensorPos;
-    absoluteSensorPos.RotateYaw(orientation.yaw);
+    std::unordered_set<const Interfaces::MovingObject*> filteredMovingObjects;
+    std::unordered_set<const Interfaces::StationaryObject*> filteredStationaryObjects;
 
-    const double yawMax = orientation.yaw + conf.mounting_position().orientation().yaw() + conf.field_of_view_horizontal() / 2.0;
-    const double yawMin = orientation.yaw + conf.mounting_position().orientation().yaw() - conf.field_of_view_horizontal() / 2.0;
+    for (const auto& conf : confs)
+    {
+        Primitive::AbsPosition relativeSensorPos
+            { conf.mounting_position().position().x(),
+              conf.mounting_position().position().y(),
+              conf.mounting_position().position().z() };
 
-    const double range = conf.range();
+        auto absoluteSensorPos = reference.GetReferencePointPosition() + relativeSensorPos;
+        absoluteSensorPos.RotateYaw(orientation.yaw);
 
-    const auto& filteredMovingObjects = GetMovingObjectsInSector(absoluteSensorPos, range, yawMin, yawMax);
-    const auto& filteredStationaryObjects = GetStationaryObjectsInSector(absoluteSensorPos, range, yawMin, yawMax);
-    const auto& filteredTrafficSigns = GetTrafficSigns();
-    const auto& filteredLanes = GetLanes();
+        const double yawMax = orientation.yaw + conf.mounting_position().orientation().yaw() + conf.field_of_view_horizontal() / 2.0;
+        const double yawMin = orientation.yaw + conf.mounting_position().orientation().yaw() - conf.field_of_view_horizontal() / 2.0;
 
-    for (const auto& object : filteredMovingObjects)
-    {
-        object->CopyToGroundTruth(filteredGroundTruth);
+        const double range = conf.range();
 
-        if (object->GetId() == reference.GetId())
+        for (const auto& object : GetMovingObjectsInSector(absoluteSensorPos, range, yawMin, yawMax))
         {
-            referenceObjectAdded = true;
+            filteredMovingObjects.insert(object);
+        }
+        for (const auto& object : GetStationaryObjectsInSector(absoluteSensorPos, range, yawMin, yawMax))
+        {
+            filteredStationaryObjects.insert(object);
+        }
+    }
+
+    // copy in the order of the world, so that the result does not depend on the order of the sensors
+    bool referenceObjectAdded = false;
+    for (const auto& mapItem : movingObjects)
+    {
+        if (filteredMovingObjects.count(mapItem.second) > 0)
+        {
+            mapItem.second->CopyToGroundTruth(filteredGroundTruth);
+
+            if (mapItem.second->GetId() == reference.GetId())
+            {
+                referenceObjectAdded = true;
+            }
         }
     }
 
@@ -137,17 +170,20 @@ osi3::GroundTruth WorldData::GetFilteredGroundTruth(const osi3::SensorViewConfig
         reference.CopyToGroundTruth(filteredGroundTruth);
     }
 
-    for (const auto& object : filteredStationaryObjects)
+    for (const auto& mapItem : stationaryObjects)
     {
-        object->CopyToGroundTruth(filteredGroundTruth);
+        if (filteredStationaryObjects.count(mapItem.second) > 0)
+        {
+            mapItem.second->CopyToGroundTruth(filteredGroundTruth);
+        }
     }
 
-    for (const auto& object : filteredTrafficSigns)
+    for (const auto& object : GetTrafficSigns())
     {
         object.second->CopyToGroundTruth(filteredGroundTruth);
     }
 
-    for (const auto& lane : filteredLanes)
+    for (const auto& lane : GetLanes())
     {
         lane.second->CopyToGroundTruth(filteredGroundTruth);
     }
@@ -402,7 +438,8 @@ Interfaces::MovingObject& WorldData::AddMovingObject(void* linkedObject)
 {
     Id id = CreateUid();
     osi3::MovingObject* osiMovingObject = osiGroundTruth.mutable_groundtruth()->add_moving_object();
-    auto movingObject = new MovingObject(osiMovingObject, linkedObject);
+    // only the wrapper lives in the arena, the OSI message is owned by the ground truth
+    auto movingObject = invocationArena.Create<MovingObject>(osiMovingObject, linkedObject);
 
     osiMovingObject->mutable_id()->set_value(id);
     movingObjects[id] = movingObject;
@@ -427,7 +464,7 @@ void WorldData::RemoveMovingObjectById(Id id)
     if (found)
     {
         osiMovingObjects.RemoveLast();
-        delete movingObjects.at(id);
+        Common::MemoryArena::Destroy(movingObjects.at(id));
         movingObjects.erase(id);
     }
 }
@@ -637,9 +674,12 @@ void WorldData::Reset()
 {
     for (auto movingObject : movingObjects)
     {
-        delete movingObject.second;
-}
+        Common::MemoryArena::Destroy(movingObject.second);
+    }
     movingObjects.clear();
+    osiGroundTruth.mutable_groundtruth()->clear_moving_object();
+
+    invocationArena.Release();
 }
 
 void WorldData::Clear()
@@ -651,7 +691,7 @@ void WorldData::Clear()
 
     for (auto movingObject : movingObjects)
     {
-        delete movingObject.second;
+        Common::MemoryArena::Destroy(movingObject.second);
     }
 
     for (auto stationaryObject : stationaryObjects)
@@ -693,6 +733,7 @@ void WorldData::Clear()
     roadIdMapping.clear();
 
     osiGroundTruth.Clear();
+    invocationArena.Release();
 }
 
 }
@@ -18,6 +18,7 @@
 
 #include <unordered_map>
 
+#include "Common/memoryArena.h"
 #include "OWL/DataTypes.h"
 #include "Interfaces/roadInterface/roadInterface.h"
 #include "Interfaces/roadInterface/junctionInterface.h"
@@ -81,6 +82,19 @@ public:
      */
     virtual osi3::SensorView GetSensorView(osi3::SensorViewConfiguration& conf, int agentId) = 0;
 
+    /*!
+     * \brief Creates one OSI SensorView for several sensors of an agent
+     *
+     * The GroundTruth is filtered once by the union of the fields of view of all configurations,
+     * so that the sensors of an agent can share it instead of requesting a SensorView each.
+     *
+     * \param[in]   confs     SensorViewConfigurations of all sensors
+     * \param[in]   agentId   The Id of the associated Agent
+     *
+     * \return      A OSI SensorView with filtered GroundTruth
+     */
+    virtual osi3::SensorView GetSensorView(const std::vector<osi3::SensorViewConfiguration>& confs, int agentId) = 0;
+
     //!Returns a map of all Roads with their OSI Id
     virtual const std::unordered_map<Id, Road*>& GetRoads() const = 0;
 
@@ -200,6 +214,7 @@ public:
     void Clear() override;
 
     osi3::SensorView GetSensorView(osi3::SensorViewConfiguration& conf, int agentId) override;
+    osi3::SensorView GetSensorView(const std::vector<osi3::SensorViewConfiguration>& confs, int agentId) override;
 
     /*!
      * \brief Retrieves a filtered OSI GroundTruth
@@ -211,6 +226,16 @@ public:
      */
     osi3::GroundTruth GetFilteredGroundTruth(const osi3::SensorViewConfiguration& conf, const Interfaces::MovingObject& reference);
 
+    /*!
+     * \brief Retrieves a OSI GroundTruth filtered by the union of several SensorViewConfigurations
+     *
+     * \param[in]   confs       The OSI SensorViewConfigurations to be used for filtering
+     * \param[in]   reference   Host of the sensors
+     *
+     * \return      A OSI GroundTruth containing each object inside at least one field of view once
+     */
+    osi3::GroundTruth GetFilteredGroundTruth(const std::vector<osi3::SensorViewConfiguration>& confs, const Interfaces::MovingObject& reference);
+
     /*!
      * \brief Retrieves the TrafficSigns located in the given sector (geometric shape)
      *
@@ -406,6 +431,12 @@ public:
 
     void Reset() override;
 
+    //! Returns the arena of the objects which are released on Reset()
+    const Common::MemoryArena& GetInvocationArena() const
+    {
+        return invocationArena;
+    }
+
 private:
 
     uint64_t next_free_uid{0};
@@ -427,6 +458,10 @@ private:
 
     osi3::world::WorldInterface osiGroundTruth;
 
+    //! Holds the wrappers of the moving objects, which all live until the end of the invocation.
+    //! The OSI messages and the per-timestep object lists of the lanes are not part of the arena.
+    Common::MemoryArena invocationArena;
+
     const Implementation::InvalidLane invalidLane;
 
     inline uint64_t CreateUid()
@@ -15,7 +15,13 @@ WorldDataQuery::WorldDataQuery(OWL::Interfaces::WorldData& worldData) : worldDat
 double WorldDataQuery::GetDistanceToEndOfLane(std::string roadId, OWL::OdId laneId, double initialSearchPosition, double maxSearchLength, std::list<OWL::LaneType> requestedLaneTypes) const
 {
     initialSearchPosition = std::max(0.0, initialSearchPosition); //supress negative search distances
-    const auto* lane = &GetLaneByOdId(roadId, laneId, initialSearchPosition);
+    return GetDistanceToEndOfLane(GetLaneByOdId(roadId, laneId, initialSearchPosition), initialSearchPosition, maxSearchLength, requestedLaneTypes);
+}
+
+double WorldDataQuery::GetDistanceToEndOfLane(OWL::CLane& initialLane, double initialSearchPosition, double maxSearchLength, const std::list<OWL::LaneType>& requestedLaneTypes) const
+{
+    initialSearchPosition = std::max(0.0, initialSearchPosition); //supress negative search distances
+    const auto* lane = &initialLane;
     if (lane->Exists() == false)
     {
         return 0.0;
@@ -190,7 +196,11 @@ bool WorldDataQuery::ExistsDrivingLaneOnSide(std::string roadId, OWL::OdId laneI
 
 OWL::CLane& WorldDataQuery::GetLaneByOdId(std::string roadId, OWL::OdId odLaneId, double distance) const
 {
-    auto section = GetSectionByDistance(roadId, distance);
+    return GetLaneByOdId(GetSectionByDistance(roadId, distance), odLaneId);
+}
+
+OWL::CLane& WorldDataQuery::GetLaneByOdId(OWL::CSection* section, OWL::OdId odLaneId) const
+{
     if (!section)
     {
         return worldData.GetInvalidLane();
@@ -323,28 +333,33 @@ OWL::OdId WorldDataQuery::GetLaneId(OWL::Id streamId, double endDistance) const
 
 std::vector<OWL::Interfaces::TrafficSign *> WorldDataQuery::GetTrafficSignsInRange(std::string roadId, OWL::OdId laneId, double startDistance, double searchRange) const
 {
-    std::vector<OWL::Interfaces::TrafficSign*> foundTrafficSigns{};    
+    return GetTrafficSignsInRange(roadId, std::vector<OWL::OdId>{laneId}, startDistance, searchRange).front();
+}
+
+std::vector<std::vector<OWL::Interfaces::TrafficSign*>> WorldDataQuery::GetTrafficSignsInRange(std::string roadId, const std::vector<OWL::OdId>& laneIds, double startDistance, double searchRange) const
+{
+    std::vector<std::vector<OWL::Interfaces::TrafficSign*>> foundTrafficSigns(laneIds.size());
+
+    const double minDistance = searchRange >= 0 ? startDistance : startDistance + searchRange;
+    const double maxDistance = searchRange >= 0 ? startDistance + searchRange : startDistance;
 
-    const std::unordered_map<OWL::Id, OWL::Interfaces::TrafficSign*> trafficSigns = worldData.GetTrafficSigns();
-    for (auto trafficSign : trafficSigns)
+    for (const auto& trafficSign : worldData.GetTrafficSigns())
     {
         double signDistance = trafficSign.second->GetS();
-        OWL::Id id = GetLaneByOdId(roadId, laneId, signDistance).GetId();
-        if(searchRange >= 0)
+        if (signDistance < minDistance || signDistance > maxDistance)
         {
-            if (signDistance >= startDistance && signDistance <= startDistance + searchRange && trafficSign.second->IsValidForLane(id))
-            {
-                foundTrafficSigns.push_back(trafficSign.second);
-            }
+            continue;
         }
-        else
+
+        // the lanes only have to be resolved for signs in range, once for all requested lanes
+        const auto section = GetSectionByDistance(roadId, signDistance);
+        for (size_t laneIndex = 0; laneIndex < laneIds.size(); ++laneIndex)
         {
-            if (signDistance <= startDistance && signDistance >= startDistance + searchRange && trafficSign.second->IsValidForLane(id))
+            if (trafficSign.second->IsValidForLane(GetLaneByOdId(section, laneIds[laneIndex]).GetId()))
             {
-                foundTrafficSigns.push_back(trafficSign.second);
+                foundTrafficSigns[laneIndex].push_back(trafficSign.second);
             }
         }
-
     }
 
     return foundTrafficSigns;
@@ -507,3 +522,64 @@ std::tuple<bool, double, const OWL::Lane * const> WorldDataQuery::GetWidthOfInte
 
     return {false, 0.0, nullptr};
 }
+
+AgentSurroundings WorldDataQuery::GetSurroundings(std::string roadId, int mainLaneId, int referenceLaneId,
+        double frontDistance, double referenceDistance, double searchDistance) const
+{
+    AgentSurroundings surroundings;
+    const std::vector<OWL::OdId> laneIds {mainLaneId, referenceLaneId + 1, referenceLaneId - 1};
+    const std::vector<LaneSurroundings*> lanes {&surroundings.laneEgo, &surroundings.laneLeft, &surroundings.laneRight};
+
+    // resolve the position once, the lanes are taken from these sections
+    const auto frontSection = GetSectionByDistance(roadId, frontDistance);
+    const auto referenceSection = (frontSection && frontSection->Covers(referenceDistance)) ?
+                                  frontSection : GetSectionByDistance(roadId, referenceDistance);
+
+    const auto trafficSigns = GetTrafficSignsInRange(roadId, laneIds, frontDistance, searchDistance);
+
+    for (size_t laneIndex = 0; laneIndex < laneIds.size(); ++laneIndex)
+    {
+        OWL::CLane& frontLane = GetLaneByOdId(frontSection, laneIds[laneIndex]);
+        OWL::CLane& referenceLane = GetLaneByOdId(referenceSection, laneIds[laneIndex]);
+        LaneSurroundings& lane = *lanes[laneIndex];
+
+        lane.curvature = referenceLane.GetCurvature(referenceDistance);
+        lane.width = referenceLane.GetWidth(referenceDistance);
+        lane.distanceToEndOfLane = GetDistanceToEndOfLane(frontLane, frontDistance, searchDistance,
+                                   {OWL::LaneType::Driving, OWL::LaneType::Exit, OWL::LaneType::OnRamp, OWL::LaneType::OffRamp, OWL::LaneType::Stop});
+        lane.trafficSigns = ConvertTrafficSigns(trafficSigns[laneIndex], frontDistance);
+
+        const auto objectInFront = GetNextObjectInLane<OWL::Interfaces::WorldObject>(frontLane, frontDistance, searchDistance);
+        lane.objectInFront = objectInFront ? objectInFront->GetLink<WorldObjectInterface>() : nullptr;
+
+        const auto objectBehind = GetClosestObjectInUpstream<OWL::Interfaces::WorldObject>(frontLane, frontDistance, searchDistance);
+        lane.objectBehind = objectBehind ? objectBehind->GetLink<WorldObjectInterface>() : nullptr;
+    }
+
+    // the adjacent lanes have to be driving lanes next to the main lane
+    OWL::CLane& mainLane = GetLaneByOdId(frontSection, mainLaneId);
+    surroundings.laneEgo.exists = mainLane.Exists();
+    surroundings.laneLeft.exists = mainLane.GetLeftLane().Exists() && (mainLane.GetLeftLane().GetLaneType() == OWL::LaneType::Driving);
+    surroundings.laneRight.exists = mainLane.GetRightLane().Exists() && (mainLane.GetRightLane().GetLaneType() == OWL::LaneType::Driving);
+
+    return surroundings;
+}
+
+std::vector<CommonTrafficSign::Entity> WorldDataQuery::ConvertTrafficSigns(
+        const std::vector<OWL::Interfaces::TrafficSign*>& signs, double startDistance) const
+{
+    std::vector<CommonTrafficSign::Entity> foundSigns {};
+
+    for (auto& sign : signs)
+    {
+        CommonTrafficSign::Entity foundSign {};
+        foundSign.type = sign->GetType();
+        foundSign.value = sign->GetValue();
+        foundSign.distanceToStartOfRoad = sign->GetS();
+        foundSign.relativeDistance = sign->GetS() - startDistance;
+
+        foundSigns.push_back(foundSign);
+    }
+
+    return foundSigns;
+}
@@ -47,7 +47,19 @@ public:
     OWL::Interfaces::WorldObject* GetNextObjectInLane(std::string roadId, OWL::OdId laneId, double initialSearchDistance,
             double maxSearchLength) const
     {
-        const auto& lane = GetLaneByOdId(roadId, laneId, initialSearchDistance);
+        return GetNextObjectInLane<T>(GetLaneByOdId(roadId, laneId, initialSearchDistance), initialSearchDistance, maxSearchLength);
+    }
+
+    //!Returns first object of type T in the ForwardLaneStream starting at the given lane, which has to be the lane at initialSearchDistance.
+    //! Return nullptr if there is no object in maxSearchLength
+    //!
+    //! @param lane lane to begin searching in
+    //! @param initialSearchDistance start s coordinates for search
+    //! @param maxSearchLength maximum look ahead distance
+    template <typename T>
+    OWL::Interfaces::WorldObject* GetNextObjectInLane(OWL::CLane& lane, double initialSearchDistance,
+            double maxSearchLength) const
+    {
         if (!lane.Exists())
         {
             return nullptr;
@@ -139,11 +151,24 @@ public:
     OWL::Interfaces::WorldObject* GetClosestObjectInUpstream(std::string roadId, OWL::OdId laneId,
             double initialSearchDistance,
             double maxSearchLength) const
+    {
+        return GetClosestObjectInUpstream<T>(GetLaneByOdId(roadId, laneId, initialSearchDistance), initialSearchDistance, maxSearchLength);
+    }
+
+    //!Returns first object of type T in the ReverseLaneStream starting at the given lane, which has to be the lane at initialSearchDistance.
+    //! Return nullptr if there is no object in maxSearchLength
+    //!
+    //! @param lane lane to begin searching in
+    //! @param initialSearchDistance start s coordinates for search
+    //! @param maxSearchLength maximum look ahead distance
+    template <typename T>
+    OWL::Interfaces::WorldObject* GetClosestObjectInUpstream(OWL::CLane& lane,
+            double initialSearchDistance,
+            double maxSearchLength) const
     {
         //supress negative search distances
         maxSearchLength = std::max(0.0, maxSearchLength);
 
-        const auto& lane = GetLaneByOdId(roadId, laneId, initialSearchDistance);
         if (!lane.Exists())
         {
             return nullptr;
@@ -352,6 +377,15 @@ public:
     double GetDistanceToEndOfLane(std::string roadId, OWL::OdId id, double initialSearchPosition, double maxSearchLength,
                                   std::list<OWL::LaneType> requestedLaneTypes) const;
 
+    //! Overload of GetDistanceToEndOfLane for a lane already resolved at initialSearchPosition
+    //!
+    //! @param lane lane at initialSearchPosition
+    //! @param initialSearchPosition start s-coordinate
+    //! @param maxSearchLength maxmium look ahead distance
+    //! @param requestedLaneTypes filter of LaneTypes
+    double GetDistanceToEndOfLane(OWL::CLane& lane, double initialSearchPosition, double maxSearchLength,
+                                  const std::list<OWL::LaneType>& requestedLaneTypes) const;
+
     //! Returns relative distance to start of last lane in ReverseLaneStream.
     //! Returns INFINITY if end of lane is outside maxSearchLength.
     //! Returns 0 if lane does not exist at initialSearchDistance.
@@ -380,6 +414,13 @@ public:
     //! @param distance s-coordinate
     OWL::CLane& GetLaneByOdId(std::string odRoadId, OWL::OdId odLaneId, double distance) const;
 
+    //! Returns lane of the section with given OpenDrive Id.
+    //! Returns InvalidLane if section is nullptr or has no such lane
+    //!
+    //! @param section section returned by GetSectionByDistance
+    //! @param odLaneId OpendDrive Id of Lane
+    OWL::CLane& GetLaneByOdId(OWL::CSection* section, OWL::OdId odLaneId) const;
+
     //! Returns section at specified distance.
     //! Returns nullptr if there is no section at given distance
     //!
@@ -440,6 +481,34 @@ public:
     std::vector<OWL::Interfaces::TrafficSign*> GetTrafficSignsInRange(std::string roadId, OWL::OdId laneId,
             double startDistance, double searchRange) const;
 
+    //! Returns all TrafficSigns valid for each of the given lanes, visiting every TrafficSign only once
+    //!
+    //! @param laneIds OpenDrive Ids of lanes
+    //! @param startDistance s-coordinate
+    //! @param searchRange search range, negative for searching upstream
+    //! @return found TrafficSigns in the order of laneIds
+    std::vector<std::vector<OWL::Interfaces::TrafficSign*>> GetTrafficSignsInRange(std::string roadId,
+            const std::vector<OWL::OdId>& laneIds, double startDistance, double searchRange) const;
+
+    //! Converts TrafficSigns into entities with their distance relative to startDistance
+    //!
+    //! @param signs TrafficSigns to convert
+    //! @param startDistance s-coordinate the relative distance refers to
+    std::vector<CommonTrafficSign::Entity> ConvertTrafficSigns(const std::vector<OWL::Interfaces::TrafficSign*>& signs,
+            double startDistance) const;
+
+    //! Returns the surroundings of an agent on its main lane and on the lanes left and right of its reference point.
+    //! The sections at frontDistance and referenceDistance are resolved only once for all lanes.
+    //!
+    //! @param roadId OpenDrive Id of the road
+    //! @param mainLaneId OpenDrive Id of the main lane of the agent
+    //! @param referenceLaneId OpenDrive Id of the lane of the reference point of the agent
+    //! @param frontDistance s-coordinate of the front of the agent
+    //! @param referenceDistance s-coordinate of the reference point of the agent
+    //! @param searchDistance search range for objects, TrafficSigns and the end of the lane
+    AgentSurroundings GetSurroundings(std::string roadId, int mainLaneId, int referenceLaneId,
+                                      double frontDistance, double referenceDistance, double searchDistance) const;
+
 
     LaneQueryResult QueryLane(std::string roadId, int laneId, double distance) const;
 
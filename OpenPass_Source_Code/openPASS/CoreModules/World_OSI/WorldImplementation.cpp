@@ -74,6 +74,11 @@ void WorldImplementation::ExtractParameter(ParameterInterface* parameters)
 
 void WorldImplementation::Reset()
 {
+    const auto& invocationArena = worldData.GetInvocationArena();
+    LOG(CbkLogLevel::Debug, "invocation arena: " + std::to_string(invocationArena.GetAllocationCount()) + " allocations, " +
+                            std::to_string(invocationArena.GetAllocatedBytes()) + " bytes (" +
+                            std::to_string(invocationArena.GetReservedBytes()) + " bytes reserved)");
+
     auto lanes = worldData.GetLanes();
     for (auto lane : lanes)
     {
@@ -171,75 +176,32 @@ double WorldImplementation::GetFriction() const
     return worldParameter.friction;
 }
 
+AgentSurroundings WorldImplementation::GetSurroundings(std::string roadId, int mainLaneId, int referenceLaneId,
+        double frontDistance, double referenceDistance, double searchDistance) const
+{
+    return worldDataQuery.GetSurroundings(roadId, mainLaneId, referenceLaneId, frontDistance, referenceDistance, searchDistance);
+}
+
 std::vector<CommonTrafficSign::Entity> WorldImplementation::GetTrafficSignsInRange(std::string roadId, int laneId,
         double startDistance, double searchRange) const
 {
-    std::vector<CommonTrafficSign::Entity> foundSigns {};
-    std::vector<OWL::Interfaces::TrafficSign*> signs = worldDataQuery.GetTrafficSignsInRange(roadId, laneId, startDistance,
-            searchRange);
-
-    for (auto& sign : signs)
-    {
-        CommonTrafficSign::Entity foundSign {};
-        foundSign.type = sign->GetType();
-        foundSign.value = sign->GetValue();
-        foundSign.distanceToStartOfRoad = sign->GetS();
-        foundSign.relativeDistance = sign->GetS() - startDistance;
-
-        foundSigns.push_back(foundSign);
-    }
-
-    return foundSigns;
+    return worldDataQuery.ConvertTrafficSigns(worldDataQuery.GetTrafficSignsInRange(roadId, laneId, startDistance, searchRange),
+            startDistance);
 }
 
 AgentInterface* WorldImplementation::GetEgoAgent()
 {
-    const std::map<int, AgentInterface*> agents = agentNetwork.GetAgents();
-
-    for (auto iterator = agents.begin(); iterator != agents.end(); iterator++)
-    {
-        AgentInterface* agent = iterator->second;
-        if (agent->IsEgoAgent())
-        {
-            return agent;
-        }
-    }
-
-    return nullptr;
+    return agentNetwork.GetEgoAgent();
 }
 
 AgentInterface* WorldImplementation::GetAgentByName(std::string& scenarioName)
-        {
-    const std::map<int, AgentInterface*> agents = agentNetwork.GetAgents();
-
-    for (auto iterator = agents.begin(); iterator != agents.end(); iterator++)
-    {
-        AgentInterface* agent = iterator->second;
-        if (agent->GetScenarioName() == (scenarioName))
-        {
-            return agent;
-        }
-    }
-
-    return nullptr;
-}
-
-std::list<AgentInterface*> WorldImplementation::GetAgentsByGroupType(AgentCategory& agentCategory)
 {
-    const std::map<int, AgentInterface*> agents = agentNetwork.GetAgents();
-
-    std::list<AgentInterface*> agentsWithGroupType;
-
-    for (auto iterator = agents.begin(); iterator != agents.end(); iterator++)
-    {
-        AgentInterface* agent = iterator->second;
-        if (agentCategory == AgentCategory::Any  || agent->GetAgentCategory() == agentCategory)
-        {
-            agentsWithGroupType.push_back(agent);
+    return agentNetwork.GetAgentByName(scenarioName);
 }
-    }
 
-    return agentsWithGroupType;
+const std::list<AgentInterface*>& WorldImplementation::GetAgentsByGroupType(AgentCategory& agentCategory)
+{
+    return agentNetwork.GetAgentsByCategory(agentCategory);
 }
 
 //// Agent functions
@@ -672,19 +634,7 @@ bool WorldImplementation::IntersectsWithAgent(double x, double y, double rotatio
 
     polygon_t polyNewAgent = World::Localization::GetBoundingBox(x, y, length, width, rotation, center);
 
-    for (std::pair<int, AgentInterface*> agent : GetAgents())
-    {
-        polygon_t polyAgent = agent.second->GetBoundingBox2D();
-
-
-        bool intersects = bg::intersects(polyNewAgent, polyAgent);
-        if (intersects)
-        {
-    return true;
-}
-    }
-
-    return false;
+    return agentNetwork.IntersectsWithAgent(polyNewAgent);
 }
 
 polygon_t WorldImplementation::GetBoundingBoxAroundAgent(AgentInterface* agent, double width, double length)
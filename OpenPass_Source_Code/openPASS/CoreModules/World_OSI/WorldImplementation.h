@@ -130,7 +130,7 @@ public:
 
     AgentInterface* GetAgentByName(std::string& scenarioName);
 
-    std::list<AgentInterface*> GetAgentsByGroupType(AgentCategory& agentCategory);
+    const std::list<AgentInterface*>& GetAgentsByGroupType(AgentCategory& agentCategory);
 
     // Agent functions
     AgentInterface* GetNextAgentInLane(std::string roadId, int laneId, double currentDistance) const override;
@@ -213,6 +213,9 @@ public:
 
     std::pair<bool, double> GetLateralDistance(GlobalRoadPosition src, GlobalRoadPosition dst) const override;
 
+    AgentSurroundings GetSurroundings(std::string roadId, int mainLaneId, int referenceLaneId,
+                                      double frontDistance, double referenceDistance, double searchDistance) const override;
+
     std::vector<CommonTrafficSign::Entity> GetTrafficSignsInRange(std::string roadId, int laneId, double startDistance,
             double searchRange) const override;
 
@@ -10,8 +10,10 @@
 *******************************************************************************/
 
 #include <cassert>
+#include <algorithm>
 #include <limits>
 #include <array>
+#include <sstream>
 
 #include "collisionDetection_Impact_implementation.h"
 
@@ -26,6 +28,9 @@ typedef enum {
     NumberCorners
 } CornerType;
 
+//! Tolerance of the unit normals of two edges to be treated as parallel
+constexpr double parallelTolerance = 1E-9;
+
 } // namespace
 
 CollisionDetection_Impact_Implementation::~CollisionDetection_Impact_Implementation()
@@ -117,11 +122,11 @@ CollisionDetection_Impact_Implementation::CalculateAllIntersectionPoints(
             n2.Norm();
             double d2 = n2.Dot( corners2[i2_1] );
 
-            // check if edges are parallel
-            bool areParallel     = fabs( n1.x - n2.x ) < std::numeric_limits<double>::epsilon()
-                                   && fabs( n1.y - n2.y ) < std::numeric_limits<double>::epsilon();
-            bool areAntiParallel = fabs( n1.x + n2.x ) < std::numeric_limits<double>::epsilon()
-                                   && fabs( n1.y + n2.y ) < std::numeric_limits<double>::epsilon();
+            // check if edges are parallel, the normals are unit vectors rounded from rotated corners
+            bool areParallel     = fabs( n1.x - n2.x ) < parallelTolerance
+                                   && fabs( n1.y - n2.y ) < parallelTolerance;
+            bool areAntiParallel = fabs( n1.x + n2.x ) < parallelTolerance
+                                   && fabs( n1.y + n2.y ) < parallelTolerance;
             if ( areParallel ||  areAntiParallel) {
                 if ( n1.Dot( corners2[i2_1]) <= d1 ) {
                     // first point of the edge of polygon2 is inside the edge of polygon1
@@ -404,58 +409,22 @@ bool CollisionDetection_Impact_Implementation::GetIntersectionPoint(Common::Vect
     return true;
 }
 
-bool CollisionDetection_Impact_Implementation::GetTimeOfFirstContact(const AgentInterface *agent1,
-                                                                     const AgentInterface *agent2,
-                                                                     int &timeFirstContact)
+bool CollisionDetection_Impact_Implementation::GetFirstContact(const AgentInterface *agent1,
+                                                               const AgentInterface *agent2,
+                                                               Contact &contact)
 {
-    std::vector<Common::Vector2d> agent1Corners = GetAgentCorners(agent1);
-    std::vector<Common::Vector2d> agent2Corners = GetAgentCorners(agent2);
-
-    Polygon agent1Polygon(agent1Corners);
-
-    Polygon agent2Polygon(agent2Corners);
-
     Common::Vector2d agent1VelocityVector = GetAgentVelocityVector(agent1);
     Common::Vector2d agent2VelocityVector = GetAgentVelocityVector(agent2);
 
-    int cycleTime = 100;       // assumption
-
-    timeFirstContact = 0;      //start of range
-    int lastTimeNoContact = 0; //end of range
-
     // Check if velocities are nearly same. If true, time of first contact will be very high
     // (infinity if velocities are exactly the same)
     if ((agent1VelocityVector - agent2VelocityVector).Length() < 1E-5) {
         return false;
     }
 
-    //get last time with no contact --> calculate end of range
-    bool intersected = true;
-    while (intersected) {
-        timeFirstContact = lastTimeNoContact;
-        lastTimeNoContact -= cycleTime; // one cycleTime to the past --> negative
-        intersected = ShiftPolygonsAndCheckIntersection(agent1Polygon, agent2Polygon,
-                                                        agent1VelocityVector * (static_cast<double>(lastTimeNoContact) / 1000),
-                                                        agent2VelocityVector * (static_cast<double>(lastTimeNoContact) / 1000));
-    }
-
-    //calculate first time of contact with range getting smaller
-    while (std::abs(timeFirstContact - lastTimeNoContact) > 1) {
-        int nextTime = lastTimeNoContact - (lastTimeNoContact - timeFirstContact) / 2;
-
-        intersected = ShiftPolygonsAndCheckIntersection(agent1Polygon, agent2Polygon,
-                                                        agent1VelocityVector * (static_cast<double>(nextTime) / 1000),
-                                                        agent2VelocityVector * (static_cast<double>(nextTime) / 1000));
-
-        if (intersected) {
-            timeFirstContact = nextTime;
-
-        } else {
-            lastTimeNoContact = nextTime;
-        }
-    }
-
-    return true;
+    return CalculateFirstContact(GetAgentCorners(agent1), agent1VelocityVector,
+                                 GetAgentCorners(agent2), agent2VelocityVector,
+                                 contact);
 }
 
 std::vector<int> CollisionDetection_Impact_Implementation::GetVertexTypes(
@@ -537,24 +506,9 @@ void CollisionDetection_Impact_Implementation::LogPostCrashDynamic(PostCrashDyna
     LOG(CbkLogLevel::Info, msg.str());
 }
 
-bool CollisionDetection_Impact_Implementation::ShiftPolygonsAndCheckIntersection(Polygon polygon1,
-                                                                                 Polygon polygon2, Common::Vector2d shiftVector1, Common::Vector2d shiftVector2)
-{
-    polygon1.Translate(shiftVector1);
-    polygon2.Translate(shiftVector2);
-
-    std::vector<Common::Vector2d> intersectionPoints = CalculateAllIntersectionPoints(
-                                                           polygon1.GetVertices(), polygon2.GetVertices());
-
-    if (intersectionPoints.size() > 0) {
-        return true;
-    } else {
-        return false;
-    }
-}
-
 bool CollisionDetection_Impact_Implementation::GetCollisionPosition(const AgentInterface *agent1,
-                                                                    const AgentInterface *agent2, Common::Vector2d &cog1, Common::Vector2d &cog2,
+                                                                    const AgentInterface *agent2, const Contact &firstContact,
+                                                                    Common::Vector2d &cog1, Common::Vector2d &cog2,
                                                                     Common::Vector2d &pointOfImpact, double &phi)
 {
     std::vector<Common::Vector2d> agent1Corners;
@@ -578,7 +532,10 @@ bool CollisionDetection_Impact_Implementation::GetCollisionPosition(const AgentI
                                                   agent2Polygon.GetVertices(),
                                                   intersectionPoints);
 
-    CalculatePlaneOfContact(intersectionPolygon, vertexTypes, pointOfImpact, phi);
+    if (!CalculatePlaneOfContact(intersectionPolygon, vertexTypes, pointOfImpact, phi)) {
+        CalculatePlaneOfFirstContact(firstContact, GetAgentVelocityVector(agent1), pointOfImpact, phi);
+        LOG(CbkLogLevel::Debug, "Contact plane taken from the first contact.");
+    }
 
     return true;
 }
@@ -593,18 +550,25 @@ bool CollisionDetection_Impact_Implementation::CreateResult(const AgentInterface
     double resultAgent1DistOnBorder = -1;
     double resultAgent2DistOnBorder = -1;
 
-    int timeOfFirstContact = 0;
-    if (!GetTimeOfFirstContact(agent1, agent2, timeOfFirstContact)) {
+    Contact firstContact;
+    if (!GetFirstContact(agent1, agent2, firstContact)) {
         LOG(CbkLogLevel::Error, "Could not calculate time of first contact.");
         return false;
     }
 
+    std::stringstream msg;
+    msg << "First contact of agents " << agent1->GetAgentId() << " and " << agent2->GetAgentId()
+        << ": time = " << firstContact.time
+        << " x = " << firstContact.point.x << " y = " << firstContact.point.y
+        << " normalX = " << firstContact.normal.x << " normalY = " << firstContact.normal.y;
+    LOG(CbkLogLevel::Debug, msg.str());
+
     Common::Vector2d resultAgent1COG = Common::Vector2d(-1, -1);
     Common::Vector2d resultAgent2COG = Common::Vector2d(-1, -1);
     Common::Vector2d pointOfImpact;
     double phi;
 
-    if (!GetCollisionPosition(agent1, agent2, resultAgent1COG, resultAgent2COG, pointOfImpact, phi)) {
+    if (!GetCollisionPosition(agent1, agent2, firstContact, resultAgent1COG, resultAgent2COG, pointOfImpact, phi)) {
         LOG(CbkLogLevel::Error, "Could not get collision position parameters.");
         return false;
     }
@@ -21,6 +21,7 @@
 #include "collisionDetectionInterface.h"
 #include "callbackInterface.h"
 #include "polygon.h"
+#include "firstContact.h"
 #include "postCrashDynamic.h"
 
 /**
@@ -232,11 +233,11 @@ private:
      *
      * \param[in] agent1                 first agent to consider
      * \param[in] agent2                 other agent to consider
-     * \param[out] firstTimeContact      time of first contact --> negative since in the past
+     * \param[out] contact               time, point and normal of first contact
      * \return                           flag indicating if calculation could be done correctly
      */
-    bool GetTimeOfFirstContact(const AgentInterface *agent1, const AgentInterface *agent2,
-                               int &timeFirstContact);
+    bool GetFirstContact(const AgentInterface *agent1, const AgentInterface *agent2,
+                         Contact &contact);
 
     /*!
      * \brief Calculates vertex types of intersection polygon
@@ -281,19 +282,6 @@ private:
      */
     void LogPostCrashDynamic(PostCrashDynamic *postCrashDynamic, int id);
 
-    /*!
-     * \brief shifts 2 polygons and checks if the shifted polygons are intersecting
-     * Shift two polygons along their shift vectors and check if they are intersecting each other.
-     *
-     * \param[in] polygon1                  first polygon
-     * \param[in] polygon2                  second polygon
-     * \param[in] shiftVector1              shift vector of first polygon
-     * \param[in] shiftVector2              shift vector of seond polygon
-     * \return                              true if they are intersecting each other after shifting, false otherwise
-     */
-    bool ShiftPolygonsAndCheckIntersection(Polygon polygon1, Polygon polygon2,
-                                           Common::Vector2d shiftVector1, Common::Vector2d shiftVector2);
-
     /*!
      * \brief Get geometry data at collision time
      * Calculate the geometry parameters of the collision of two agents at a time
@@ -302,8 +290,12 @@ private:
      * - center of gravity of both agents
      * - paramters describing the contact plane (point of impact and angle)
      *
+     * If the intersection of the agents does not define a contact plane (e.g. the agents
+     * only touch), the plane of the first contact is used instead.
+     *
      * \param[in]  agent1                   first agent
      * \param[in]  agent2                   second agent
+     * \param[in]  firstContact             first contact of the agents
      * \param[out] cog1                     center of gravity of first agent
      * \param[out] cog2                     center of gravity of second agent
      * \param[out] pointOfImpact            vector of the point of impact
@@ -311,6 +303,7 @@ private:
      * \return                              true if calculation was successful
      */
     bool GetCollisionPosition(const AgentInterface *agent1, const AgentInterface *agent2,
+                              const Contact &firstContact,
                               Common::Vector2d &cog1, Common::Vector2d &cog2, Common::Vector2d &pointOfImpact,
                               double &phi);
 
@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "firstContact.h"
+
+bool CalculateFirstContact(const std::vector<Common::Vector2d> &corners1, const Common::Vector2d &velocity1,
+                           const std::vector<Common::Vector2d> &corners2, const Common::Vector2d &velocity2,
+                           Contact &contact)
+{
+    // the second rectangle moves relative to the first one, which stays at its current position
+    const Common::Vector2d relativeVelocity = velocity2 - velocity1;
+    const double featureTolerance = 1E-6;
+
+    double enterTime = -std::numeric_limits<double>::infinity();
+    double exitTime = std::numeric_limits<double>::infinity();
+    Common::Vector2d enterAxis;
+    bool enterAxisOfFirst = true;
+
+    // separating axes are the normals of two adjacent edges of each rectangle
+    for (int rectangle = 0; rectangle < 2; ++rectangle) {
+        const std::vector<Common::Vector2d> &corners = (rectangle == 0) ? corners1 : corners2;
+
+        for (int edge = 0; edge < 2; ++edge) {
+            Common::Vector2d axis(corners[edge + 1].y - corners[edge].y,
+                                  -(corners[edge + 1].x - corners[edge].x));
+            if (!axis.Norm()) {
+                return false;
+            }
+
+            double min1 = std::numeric_limits<double>::infinity();
+            double max1 = -std::numeric_limits<double>::infinity();
+            for (const Common::Vector2d &corner : corners1) {
+                min1 = std::min(min1, axis.Dot(corner));
+                max1 = std::max(max1, axis.Dot(corner));
+            }
+            double min2 = std::numeric_limits<double>::infinity();
+            double max2 = -std::numeric_limits<double>::infinity();
+            for (const Common::Vector2d &corner : corners2) {
+                min2 = std::min(min2, axis.Dot(corner));
+                max2 = std::max(max2, axis.Dot(corner));
+            }
+
+            const double speed = axis.Dot(relativeVelocity);
+            if (std::fabs(speed) < std::numeric_limits<double>::epsilon()) {
+                // no relative movement along this axis: overlapping always or never
+                if ((min2 > max1) || (max2 < min1)) {
+                    return false;
+                }
+                continue;
+            }
+
+            // the projections overlap while min2 + speed * t <= max1 and max2 + speed * t >= min1
+            const double time1 = (max1 - min2) / speed;
+            const double time2 = (min1 - max2) / speed;
+            const double axisEnterTime = std::min(time1, time2);
+
+            if (axisEnterTime > enterTime) {
+                enterTime = axisEnterTime;
+                enterAxisOfFirst = (rectangle == 0);
+                // orient the normal from the first to the second rectangle
+                enterAxis = (speed < 0) ? axis : axis * -1;
+            }
+            exitTime = std::min(exitTime, std::max(time1, time2));
+        }
+    }
+
+    // not overlapping at the current time or overlapping forever,
+    // agents which only touch may enter or exit by rounding noise after or before the current time
+    if (std::isinf(enterTime) || (enterTime > featureTolerance) || (exitTime < -featureTolerance)
+            || (enterTime > exitTime + featureTolerance)) {
+        return false;
+    }
+    enterTime = std::min(enterTime, 0.0);
+
+    // positions at the time of first contact relative to the first rectangle
+    std::vector<Common::Vector2d> movedCorners2;
+    for (const Common::Vector2d &corner : corners2) {
+        movedCorners2.push_back(corner + relativeVelocity * enterTime);
+    }
+
+    // the reference face lies on the contact axis, the incident feature touches it
+    const Common::Vector2d tangent(-enterAxis.y, enterAxis.x);
+    const std::vector<Common::Vector2d> &referenceCorners = enterAxisOfFirst ? corners1 : movedCorners2;
+    const std::vector<Common::Vector2d> &incidentCorners = enterAxisOfFirst ? movedCorners2 : corners1;
+    const double referenceSign = enterAxisOfFirst ? 1.0 : -1.0;
+
+    double referenceExtreme = -std::numeric_limits<double>::infinity();
+    for (const Common::Vector2d &corner : referenceCorners) {
+        referenceExtreme = std::max(referenceExtreme, referenceSign * enterAxis.Dot(corner));
+    }
+    double incidentExtreme = std::numeric_limits<double>::infinity();
+    for (const Common::Vector2d &corner : incidentCorners) {
+        incidentExtreme = std::min(incidentExtreme, referenceSign * enterAxis.Dot(corner));
+    }
+
+    double referenceMin = std::numeric_limits<double>::infinity();
+    double referenceMax = -std::numeric_limits<double>::infinity();
+    for (const Common::Vector2d &corner : referenceCorners) {
+        if (referenceSign * enterAxis.Dot(corner) >= referenceExtreme - featureTolerance) {
+            referenceMin = std::min(referenceMin, tangent.Dot(corner));
+            referenceMax = std::max(referenceMax, tangent.Dot(corner));
+        }
+    }
+    double incidentMin = std::numeric_limits<double>::infinity();
+    double incidentMax = -std::numeric_limits<double>::infinity();
+    for (const Common::Vector2d &corner : incidentCorners) {
+        if (referenceSign * enterAxis.Dot(corner) <= incidentExtreme + featureTolerance) {
+            incidentMin = std::min(incidentMin, tangent.Dot(corner));
+            incidentMax = std::max(incidentMax, tangent.Dot(corner));
+        }
+    }
+
+    // touching vertex or middle of the overlap of touching edges
+    const double tangentPosition = (std::max(referenceMin, incidentMin) + std::min(referenceMax, incidentMax)) / 2;
+    const double normalPosition = referenceSign * incidentExtreme;
+
+    contact.time = enterTime;
+    contact.normal = enterAxis;
+    contact.point = enterAxis * normalPosition + tangent * tangentPosition + velocity1 * enterTime;
+
+    return true;
+}
+
+void CalculatePlaneOfFirstContact(const Contact &contact, const Common::Vector2d &velocity1,
+                                  Common::Vector2d &pointOfImpact, double &phi)
+{
+    // the contact point moves with the first agent from the time of first contact to now
+    pointOfImpact = contact.point - velocity1 * contact.time;
+
+    // the contact plane is perpendicular to the contact normal
+    phi = std::atan2(contact.normal.x, -contact.normal.y);
+    if (phi < 0) {
+        phi = phi + M_PI;
+    }
+    if (phi >= M_PI) {
+        phi = phi - M_PI;
+    }
+}
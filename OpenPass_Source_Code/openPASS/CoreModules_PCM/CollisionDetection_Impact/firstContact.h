@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#ifndef FIRSTCONTACT_H
+#define FIRSTCONTACT_H
+
+#include <vector>
+#include "vector2d.h"
+
+//! First contact of two agents
+struct Contact
+{
+    double time = 0.0;          //!< time of first contact relative to the current time [s], negative in the past
+    Common::Vector2d point;     //!< point of first contact
+    Common::Vector2d normal;    //!< contact normal, pointing from the first to the second agent
+};
+
+/*!
+ * \brief calculates the first contact of two translating rectangles
+ *
+ * Since both rectangles only translate, their projections on each of the four
+ * separating axes (edge normals) overlap during one time interval, which is
+ * calculated analytically. The rectangles overlap during the intersection of
+ * these intervals, so the first contact is the latest entering time. The axis of
+ * this time is the contact normal, the contact point is the touching vertex or
+ * the middle of the touching edges.
+ *
+ * \param[in] corners1               corners of the first rectangle at the current time
+ * \param[in] velocity1              velocity of the first rectangle
+ * \param[in] corners2               corners of the second rectangle at the current time
+ * \param[in] velocity2              velocity of the second rectangle
+ * \param[out] contact               time, point and normal of first contact
+ * \return                           false, if the rectangles do not overlap at the current time
+ *                                   or have been overlapping forever; rectangles which only touch
+ *                                   have their first contact at the current time
+ */
+bool CalculateFirstContact(const std::vector<Common::Vector2d> &corners1, const Common::Vector2d &velocity1,
+                           const std::vector<Common::Vector2d> &corners2, const Common::Vector2d &velocity2,
+                           Contact &contact);
+
+/*!
+ * \brief calculates the plane of contact at the current time from the first contact
+ *
+ * Used if the intersection of the agents has no plane of contact, e.g. if they only touch.
+ *
+ * \param[in] contact                first contact of the agents
+ * \param[in] velocity1              velocity of the first agent
+ * \param[out] pointOfImpact         contact point moved with the first agent to the current time
+ * \param[out] phi                   angle of the contact plane, perpendicular to the contact normal [0, pi)
+ */
+void CalculatePlaneOfFirstContact(const Contact &contact, const Common::Vector2d &velocity1,
+                                  Common::Vector2d &pointOfImpact, double &phi);
+
+#endif // FIRSTCONTACT_H
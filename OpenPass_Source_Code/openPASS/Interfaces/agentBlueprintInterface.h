@@ -71,6 +71,7 @@ public:
     virtual std::list<SensorParameter>          GetSensorParameters()  = 0;
     virtual VehicleComponentProfileNames        GetVehicleComponentProfileNames() = 0;
     virtual SimulationSlave::AgentTypeInterface& GetAgentType() = 0;
+    virtual std::shared_ptr<SimulationSlave::AgentTypeInterface> GetSharedAgentType() = 0;
     virtual SpawnParameter&                      GetSpawnParameter() = 0;
     virtual double                              GetSpeedGoalMin() = 0;
 
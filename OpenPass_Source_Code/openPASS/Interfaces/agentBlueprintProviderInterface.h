@@ -39,5 +39,12 @@ public:
                              LaneCategory laneCategory,
                              unsigned int scenarioAgentIterator) = 0;
 
+    /*!
+    * \brief Discards all agents sampled ahead of time
+    *
+    * \details Called before each invocation, so that the agents of an invocation only depend on its random seed
+    */
+    virtual void Reset() = 0;
+
 };
 
@@ -19,6 +19,7 @@
 
 #include <map>
 #include <list>
+#include <memory>
 
 #include "Interfaces/agentBlueprintInterface.h"
 
@@ -47,6 +48,21 @@ public:
     //-----------------------------------------------------------------------------
     virtual void Clear() = 0;
 
+    //-----------------------------------------------------------------------------
+    //! Enables or disables reusing the agents of an invocation in the next one.
+    //-----------------------------------------------------------------------------
+    virtual void SetRecycleAgents(bool recycleAgents) = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Deletes all agents kept for reuse.
+    //-----------------------------------------------------------------------------
+    virtual void ReleaseRecycledAgents() = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Enables or disables an own random stream for each component of an agent.
+    //-----------------------------------------------------------------------------
+    virtual void SetComponentRandomStreams(bool componentRandomStreams) = 0;
+
     //-----------------------------------------------------------------------------
     //! Creates a new agent based on the provided parameters, then adds it to the
     //! agent network in the world representation. Also adds agents during runtime.
@@ -58,6 +74,48 @@ public:
     //-----------------------------------------------------------------------------
     virtual Agent *AddAgent(AgentBlueprintInterface* agentBlueprint,
                             int spawnTime) = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Enables or disables keeping a copy of the blueprint of each added agent.
+    //-----------------------------------------------------------------------------
+    virtual void SetKeepBlueprints(bool keepBlueprints) = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Returns the agent with the given id of the current invocation.
+    //!
+    //! @return                         The agent, nullptr if there is none
+    //-----------------------------------------------------------------------------
+    virtual Agent *GetAgent(int id) const = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Returns the kept copy of the blueprint of the agent with the given id.
+    //!
+    //! @return                         The blueprint, nullptr if none was kept
+    //-----------------------------------------------------------------------------
+    virtual std::shared_ptr<AgentBlueprintInterface> GetAgentBlueprint(int id) const = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Returns the id the next added agent gets.
+    //-----------------------------------------------------------------------------
+    virtual int GetNextAgentId() const = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Sets the id the next added agent gets.
+    //-----------------------------------------------------------------------------
+    virtual void SetNextAgentId(int id) = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Recreates an agent of an earlier invocation with its original id.
+    //!
+    //! @param[in]  id                  Agent ID
+    //! @param[in]  agentBlueprint      Blueprint the agent was created from
+    //! @param[in]  spawnTime           Spawn time in ms
+    //!
+    //! @return                         The added agent
+    //-----------------------------------------------------------------------------
+    virtual Agent *RestoreAgent(int id,
+                                AgentBlueprintInterface* agentBlueprint,
+                                int spawnTime) = 0;
 };
 
 } //namespace SimulationSlave
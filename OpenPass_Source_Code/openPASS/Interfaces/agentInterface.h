@@ -21,6 +21,7 @@
 
 #include <map>
 #include <list>
+#include <iosfwd>
 #include <vector>
 
 #include "Common/globalDefinitions.h"
@@ -63,6 +64,28 @@ private:
     Obstruction() = default;
 };
 
+//! @brief Objects and attributes of a single lane around an agent
+///
+struct LaneSurroundings
+{
+    bool exists {false};                ///!< @brief True, if the lane exists (neighbouring lanes only count if they are driving lanes)
+    double curvature {0.0};             ///!< @brief Curvature of the lane at the reference point of the agent
+    double width {0.0};                 ///!< @brief Width of the lane at the reference point of the agent
+    double distanceToEndOfLane {0.0};   ///!< @brief Distance from the front of the agent to the end of the lane
+    std::vector<CommonTrafficSign::Entity> trafficSigns;   ///!< @brief Traffic signs valid for the lane within the search distance
+    WorldObjectInterface* objectInFront {nullptr};         ///!< @brief Next object in front, nullptr if none within the search distance
+    WorldObjectInterface* objectBehind {nullptr};          ///!< @brief Closest object behind, nullptr if none within the search distance
+};
+
+//! @brief Surroundings of an agent on its own lane and the adjacent lanes
+///
+struct AgentSurroundings
+{
+    LaneSurroundings laneEgo;
+    LaneSurroundings laneLeft;
+    LaneSurroundings laneRight;
+};
+
 /**
 * \brief Agent Interface within the openPASS framework.
 * \details This interface provides access to agent parameters, properties, attributes and dynamic states.
@@ -1436,6 +1459,18 @@ public:
     //-----------------------------------------------------------------------------
     virtual std::vector<CommonTrafficSign::Entity> GetTrafficSignsInRange(double searchDistance, int relativeLane = 0) const = 0;
 
+    //-----------------------------------------------------------------------------
+    //! Returns the objects in front and behind, the geometry and the traffic signs of the
+    //! own lane and the adjacent lanes in one query. The values equal the ones of
+    //! GetObjectInFront, GetObjectBehind, ExistsLaneLeft/Right, GetLaneCurvature,
+    //! GetLaneWidth, GetDistanceToEndOfLane and GetTrafficSignsInRange for the relative
+    //! lanes 0, 1 and -1, but the position of the agent is resolved only once.
+    //!
+    //! @param[in]    searchDistance     look ahead and look behind distance
+    //! @return       surroundings of the agent
+    //-----------------------------------------------------------------------------
+    virtual AgentSurroundings GetSurroundings(double searchDistance) const = 0;
+
     //-----------------------------------------------------------------------------
     //! Retrieves the minimum speed goal of agent
     //!
@@ -1453,6 +1488,38 @@ public:
     virtual const std::list<SensorParameter>& GetSensorParameters() const = 0;
 
     virtual void SetSensorParameters(std::list<SensorParameter> sensorParameters) = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Checks if the dynamic state of the agent can be saved by SaveState() and
+    //! restored by RestoreState() in order to resume an invocation from a checkpoint
+    //!
+    //! @return               True if SaveState() and RestoreState() are supported
+    //-----------------------------------------------------------------------------
+    virtual bool SupportsCheckpoint() const
+    {
+        return false;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Writes the state of the agent which changes during an invocation
+    //!
+    //! @param[out] state     Stream receiving the state
+    //-----------------------------------------------------------------------------
+    virtual void SaveState(std::ostream &state) const
+    {
+        (void)state;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Restores a state written by SaveState() to an agent initialized from the same
+    //! blueprint and relocates the agent
+    //!
+    //! @param[in] state      Stream providing the state
+    //-----------------------------------------------------------------------------
+    virtual void RestoreState(std::istream &state)
+    {
+        (void)state;
+    }
 };
 
 #endif // AGENTINTERFACE_H
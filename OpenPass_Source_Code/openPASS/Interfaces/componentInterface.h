@@ -28,6 +28,13 @@ class Agent;
 class ChannelBuffer;
 class ObservationModule;
 
+//! State of a component saved at a checkpoint
+struct ComponentCheckpoint
+{
+    std::string modelState;                                             //!< state written by the model interface implementation
+    std::map<int, std::shared_ptr<SignalInterface const>> outputData;   //!< signals of the output channel buffers by link id
+};
+
 class ComponentInterface
 {
 public:
@@ -222,6 +229,43 @@ public:
     //-----------------------------------------------------------------------------
     virtual bool ReleaseFromLibrary() = 0;
 
+    //-----------------------------------------------------------------------------
+    //! Checks if the stored model interface implementation supports being reset.
+    //!
+    //! @return                             True if Reset() can be called
+    //-----------------------------------------------------------------------------
+    virtual bool SupportsReset() const = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Releases the data of the output channel buffers and resets the stored model
+    //! interface implementation, so that it can be reused for another agent.
+    //!
+    //! @param[in]     agent                Agent adapter of the agent reusing this component
+    //-----------------------------------------------------------------------------
+    virtual void Reset(AgentInterface* agent) = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Checks if the stored model interface implementation supports checkpoints.
+    //!
+    //! @return                             True if SaveState() and RestoreState() can be called
+    //-----------------------------------------------------------------------------
+    virtual bool SupportsCheckpoint() const = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Saves the state of the stored model interface implementation and the data
+    //! of the output channel buffers.
+    //!
+    //! @return                             Saved state
+    //-----------------------------------------------------------------------------
+    virtual ComponentCheckpoint SaveState() const = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Restores a state saved by SaveState().
+    //!
+    //! @param[in]     checkpoint           Saved state
+    //-----------------------------------------------------------------------------
+    virtual void RestoreState(const ComponentCheckpoint& checkpoint) = 0;
+
     //-----------------------------------------------------------------------------
     //! Returns the stored model interface instance.
     //!
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <vector>
 #include "Interfaces/eventNetworkInterface.h"
 
@@ -36,6 +37,24 @@ public:
     virtual void Trigger(int time) = 0;
     virtual int GetCycleTime() = 0;
     virtual void Reset() = 0;
+
+    //! Returns true if the detector supports SaveState() and RestoreState()
+    virtual bool SupportsCheckpoint() const
+    {
+        return false;
+    }
+
+    //! Writes the state of the detector which changes during an invocation
+    virtual void SaveState(std::ostream &state) const
+    {
+        (void)state;
+    }
+
+    //! Restores a state written by SaveState()
+    virtual void RestoreState(std::istream &state)
+    {
+        (void)state;
+    }
   };
 
 
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <functional>
+#include <string>
+#include <vector>
+
 #include "Interfaces/agentInterface.h"
 #include "Interfaces/eventInterface.h"
 #include "Interfaces/observationInterface.h"
@@ -23,10 +27,21 @@
 #include "Interfaces/runResultInterface.h"
 
 using Events = std::map<EventDefinitions::EventCategory, std::list<std::shared_ptr<EventInterface>>>;
+using AgentEvents = std::vector<std::shared_ptr<EventInterface>>;
 
 namespace SimulationSlave
 {
 
+//! State of the EventNetwork saved at a checkpoint
+struct EventNetworkState
+{
+    Events activeEvents;
+    Events archivedEvents;
+    int latestEventTime {0};
+    int eventId {0};
+    std::map<EventDefinitions::EventCategory, std::string> eventLogs;   //!< content of the event log of each category
+};
+
 //-----------------------------------------------------------------------------
 /** \brief This class provides the interface for the EventNetwork
 *
@@ -48,14 +63,25 @@ public:
 
     virtual std::list<std::shared_ptr<EventInterface>> *GetActiveEventCategory(EventDefinitions::EventCategory eventCategory) = 0;
 
+    virtual const AgentEvents &GetActiveEventsForAgent(EventDefinitions::EventCategory eventCategory, int agentId) = 0;
+
     virtual void RemoveOldEvents(int time) = 0;
 
+    virtual void SetArchiveRetention(int maxArchivedEvents, int archiveTimeWindow, const std::string &eventLogFile) = 0;
+
+    virtual void StreamLoggedEvents(EventDefinitions::EventCategory eventCategory,
+                                    const std::function<void(std::shared_ptr<EventInterface>)> &handler) = 0;
+
     virtual void InsertEvent(std::shared_ptr<EventInterface> event) = 0;
 
     virtual void ClearActiveEvents() = 0;
 
     virtual void Clear() = 0;
 
+    virtual EventNetworkState SaveState() = 0;
+
+    virtual void RestoreState(const EventNetworkState &state) = 0;
+
     virtual void Respawn(int time) = 0;
 
     virtual void AddCollision(const int agentId) = 0;
@@ -85,6 +85,13 @@ public:
     */
     virtual StochasticsInterface* GetStochastics() = 0;
 
+    /*!
+    * \brief Returns a pointer to the Stochastics used for sampling the common agents ahead of time
+    *
+    * @return        Stochastics pointer
+    */
+    virtual StochasticsInterface* GetBlueprintStochastics() = 0;
+
     /*!
     * \brief Returns a pointer to the World
     *
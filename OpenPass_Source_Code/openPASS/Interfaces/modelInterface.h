@@ -112,6 +112,62 @@ public:
     //-----------------------------------------------------------------------------
     virtual void Trigger(int time) = 0;
 
+    //-----------------------------------------------------------------------------
+    //! Checks if this component can be reset by Reset() and reused by the framework
+    //! for another agent of the same agent type in a later invocation
+    //!
+    //! @return                       True if Reset() is supported
+    //-----------------------------------------------------------------------------
+    virtual bool SupportsReset() const
+    {
+        return false;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Function is called by the framework before this component is reused for
+    //! another agent. The component has to restore the state it had after
+    //! construction. Only called if SupportsReset() returns true.
+    //!
+    //! @param[in]     agent          Agent embedding this component from now on
+    //-----------------------------------------------------------------------------
+    virtual void Reset(AgentInterface *agent)
+    {
+        (void)agent;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Checks if the state of this component can be saved by SaveState() and
+    //! restored by RestoreState() in order to resume an invocation from a checkpoint
+    //!
+    //! @return                       True if SaveState() and RestoreState() are supported
+    //-----------------------------------------------------------------------------
+    virtual bool SupportsCheckpoint() const
+    {
+        return false;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Writes all state of this component which changes during an invocation.
+    //! Only called if SupportsCheckpoint() returns true.
+    //!
+    //! @param[out]    state          Stream receiving the state
+    //-----------------------------------------------------------------------------
+    virtual void SaveState(std::ostream &state) const
+    {
+        (void)state;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Restores the state written by SaveState() of a component of the same agent
+    //! in an earlier invocation. Only called if SupportsCheckpoint() returns true.
+    //!
+    //! @param[in]     state          Stream providing the state
+    //-----------------------------------------------------------------------------
+    virtual void RestoreState(std::istream &state)
+    {
+        (void)state;
+    }
+
     //-----------------------------------------------------------------------------
     //! Checks if this component is configured as init module
     //!
@@ -366,6 +422,16 @@ protected:
         agent->RemoveAgent();
     }
 
+    //-----------------------------------------------------------------------------
+    //! Sets the agent which contains this component, used on Reset()
+    //!
+    //! @param[in]     agent          Agent embedding this component
+    //-----------------------------------------------------------------------------
+    void SetAgent(AgentInterface *agent)
+    {
+        this->agent = agent;
+    }
+
 private:
     AgentInterface *agent;                //!< Reference to agent containing this component
 public: //RP: BAD HACK! just for testing FMI
@@ -430,6 +496,16 @@ protected:
         return agent;
     }
 
+    //-----------------------------------------------------------------------------
+    //! Sets the agent which contains this component, used on Reset()
+    //!
+    //! @param[in]     agent          Agent embedding this component
+    //-----------------------------------------------------------------------------
+    void SetAgent(AgentInterface *agent)
+    {
+        this->agent = agent;
+    }
+
 private:
     AgentInterface *agent;                //!< Agent id
 };
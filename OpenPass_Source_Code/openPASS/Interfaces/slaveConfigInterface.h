@@ -34,6 +34,11 @@ struct ExperimentConfig
     std::uint32_t randomSeed;
     std::vector<std::string> loggingGroups;         //!< Holds the names of enabled logging groups
     Libraries libraries;
+    int maxArchivedEvents {-1};                     //!< Maximum number of archived events kept in memory (negative: unlimited)
+    int archivedEventsTimeWindow {-1};              //!< Time window in ms of archived events kept in memory (negative: unlimited)
+    bool recycleAgents {false};                     //!< Reuse agents of an invocation for agents of the same agent type in the next one
+    bool componentRandomStreams {false};            //!< Draw the random numbers of each component from an own stream, keyed by invocation, agent and component
+    int checkpointTime {-1};                        //!< Time in ms at which the first invocation is saved and the later ones continue from (negative: disabled)
 };
 
 struct ScenarioConfig
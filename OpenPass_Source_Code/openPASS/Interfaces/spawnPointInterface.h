@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <string>
 
 #include "Interfaces/parameterInterface.h"
@@ -142,6 +143,37 @@ public:
     //-----------------------------------------------------------------------------
     virtual bool GenerateAgent(AgentBlueprintInterface* agentBlueprint) = 0;
 
+    //-----------------------------------------------------------------------------
+    //! Checks if the state of the spawn point can be saved by SaveState() and
+    //! restored by RestoreState() in order to resume an invocation from a checkpoint
+    //!
+    //! @return     true if SaveState() and RestoreState() are supported
+    //-----------------------------------------------------------------------------
+    virtual bool SupportsCheckpoint() const
+    {
+        return false;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Writes the state of the spawn point which changes during an invocation
+    //!
+    //! @param[out] state   Stream receiving the state
+    //-----------------------------------------------------------------------------
+    virtual void SaveState(std::ostream &state) const
+    {
+        (void)state;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Restores a state written by SaveState()
+    //!
+    //! @param[in]  state   Stream providing the state
+    //-----------------------------------------------------------------------------
+    virtual void RestoreState(std::istream &state)
+    {
+        (void)state;
+    }
+
     //virtual void SetSpawnItem(SpawnItemParameterInterface &spawnItem, int maxIndex) = 0;
 
 protected:
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 #include "Interfaces/callbackInterface.h"
@@ -141,6 +143,32 @@ public:
     //-----------------------------------------------------------------------------
     virtual void InitGenerator(std::uint32_t seed) = 0;
 
+    //-----------------------------------------------------------------------------
+    //! Creates an independent counter based stream, keyed by the seed of the
+    //! current invocation and the stream id. The draws of a stream do not depend
+    //! on the draws of any other stream. The stream restarts with the new seed on
+    //! every reinitialization of the generator it was created from.
+    //!
+    //! @param[in]     streamId     id of the stream, unique within an invocation
+    //!
+    //! @return                     stream, nullptr if streams are not supported
+    //-----------------------------------------------------------------------------
+    virtual std::unique_ptr<StochasticsInterface> CreateStream(std::uint64_t streamId)
+    {
+        (void)streamId;
+        return nullptr;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Restarts a stream created by CreateStream() under a new stream id
+    //!
+    //! @param[in]     streamId     id of the stream, unique within an invocation
+    //-----------------------------------------------------------------------------
+    virtual void SetStreamId(std::uint64_t streamId)
+    {
+        (void)streamId;
+    }
+
     virtual bool Instantiate(std::string) {return false;}
 };
 
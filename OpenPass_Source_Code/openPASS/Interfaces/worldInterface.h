@@ -725,6 +725,21 @@ public:
 
     virtual std::pair<bool, double> GetLateralDistance(GlobalRoadPosition src, GlobalRoadPosition dst) const = 0;
 
+    //-----------------------------------------------------------------------------
+    //! Retrieves the objects in front and behind, the geometry and the traffic signs of a
+    //! lane and its adjacent lanes, resolving the sections of the road only once
+    //!
+    //! @param[in] roadId               OpenDrive id of the road
+    //! @param[in] mainLaneId           OpenDrive id of the lane at frontDistance
+    //! @param[in] referenceLaneId      OpenDrive id of the lane at referenceDistance, the adjacent lanes are determined from it
+    //! @param[in] frontDistance        s coordinate for objects, end of lane and traffic signs
+    //! @param[in] referenceDistance    s coordinate for curvature and width
+    //! @param[in] searchDistance       look ahead and look behind distance
+    //! @return                         surroundings, see AgentInterface::GetSurroundings()
+    //-----------------------------------------------------------------------------
+    virtual AgentSurroundings GetSurroundings(std::string roadId, int mainLaneId, int referenceLaneId,
+                                              double frontDistance, double referenceDistance, double searchDistance) const = 0;
+
     //-----------------------------------------------------------------------------
     //! Retrieves all traffic signs in front
     //!
@@ -787,7 +802,7 @@ public:
     //!
     //! @return
     //-----------------------------------------------------------------------------
-    virtual std::list<AgentInterface*> GetAgentsByGroupType(AgentCategory& agentCategory) = 0;
+    virtual const std::list<AgentInterface*>& GetAgentsByGroupType(AgentCategory& agentCategory) = 0;
 };
 
 #endif // WORLDINTERFACE_H
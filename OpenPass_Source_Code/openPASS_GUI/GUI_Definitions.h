@@ -31,10 +31,14 @@
 #define FILENAME_OPENPASSSLAVE_LOG  "OpenPassSlave.log"
 #define FILENAME_OPENPASSMASTER_LOG  "OpenPassMaster.log"
 
+#define FILENAME_PCM_SNAPSHOT       "pcmData.pcmdata"
+#define SUFFIX_PCM_SNAPSHOT         "pcmdata"
+
 #define REGEX_CASE_NUMBER           "\\d*"
 #define REGEX_CASE_SYSTEM           "\\d\\-\\d\\-\\d"
 
 #define DIR_NO_VARIATION            "Default"
+#define DIRNAME_BATCH               "Batch"
 #define VARIATION_COUNT_DEFAULT     2
 #define INIT_RANDOM_SEED            -1
 #define SHIFT_RADIUS_CAR1           1.0
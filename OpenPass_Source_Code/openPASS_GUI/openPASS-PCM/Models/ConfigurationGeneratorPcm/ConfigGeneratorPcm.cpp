@@ -55,7 +55,7 @@ bool ConfigGenerator::GenerateConfigFromDB(DatabaseReader &dbReader,
     PCM_IntendedCourses intendedCourses;
     PCM_GlobalData globalData;
 
-    if (!dbReader.IsDataBaseOpen())
+    if (!dbReader.IsCached(pcmCase) && !dbReader.IsDataBaseOpen())
     {
         bool success = dbReader.OpenDataBase();
         if (!success)
@@ -255,6 +255,18 @@ void ConfigGenerator::AddConfigSet(QString resultFolderName, QString systemConfi
     configSetList.append(configSet);
 }
 
+void ConfigGenerator::AddConfigSets(const QList<QMap<QString, QString>> &configSets)
+{
+    configSetList.append(configSets);
+}
+
+QList<QMap<QString, QString>> ConfigGenerator::TakeConfigSets()
+{
+    QList<QMap<QString, QString>> configSets;
+    configSets.swap(configSetList);
+    return configSets;
+}
+
 void ConfigGenerator::Clear()
 {
     configSetList.clear();
@@ -50,6 +50,12 @@ public:
                       QString sceneryConfig,
                       QString scenarioConfig);
 
+    //! Appends configuration sets generated by another generator
+    void AddConfigSets(const QList<QMap<QString, QString>> &configSets);
+
+    //! Returns the configuration sets generated so far and removes them from the generator
+    QList<QMap<QString, QString>> TakeConfigSets();
+
     void Clear();
 
 private:
@@ -0,0 +1,125 @@
+/*********************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+**********************************************************************/
+
+#include "DataCachePcm.h"
+
+#include <QDataStream>
+#include <QFile>
+#include <algorithm>
+
+namespace {
+constexpr quint32 snapshotMagic = 0x50434D44; // "PCMD"
+constexpr quint32 snapshotVersion = 1;
+}
+
+bool PCM_DataCache::ContainsCase(int pcmCase) const
+{
+    return std::binary_search(cases.cbegin(), cases.cend(), pcmCase);
+}
+
+QStringList PCM_DataCache::GetCaseList() const
+{
+    QStringList caseList;
+    for (int pcmCase : cases)
+    {
+        caseList.append(QString("%1").arg(pcmCase));
+    }
+    return caseList;
+}
+
+const PCM_Rows &PCM_DataCache::GetRows(const QString &table, int pcmCase) const
+{
+    static const PCM_Rows noRows;
+
+    auto tableIter = tables.constFind(table);
+    if (tableIter == tables.cend())
+    {
+        return noRows;
+    }
+
+    auto caseIter = tableIter->constFind(pcmCase);
+    if (caseIter == tableIter->cend())
+    {
+        return noRows;
+    }
+
+    return *caseIter;
+}
+
+bool PCM_DataCache::Save(const QString &snapshotFile) const
+{
+    QFile file(snapshotFile);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream << snapshotMagic << snapshotVersion << cases << tables;
+
+    return stream.status() == QDataStream::Ok;
+}
+
+std::shared_ptr<const PCM_DataCache> PCM_DataCache::Load(const QString &snapshotFile)
+{
+    QFile file(snapshotFile);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return nullptr;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_6);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (magic != snapshotMagic || version != snapshotVersion)
+    {
+        return nullptr;
+    }
+
+    auto data = std::make_shared<PCM_DataCache>();
+    stream >> data->cases >> data->tables;
+    if (stream.status() != QDataStream::Ok)
+    {
+        return nullptr;
+    }
+
+    std::sort(data->cases.begin(), data->cases.end());
+    return data;
+}
+
+void PCM_DataCache::AddCase(int pcmCase)
+{
+    auto position = std::lower_bound(cases.begin(), cases.end(), pcmCase);
+    if (position == cases.end() || *position != pcmCase)
+    {
+        cases.insert(position, pcmCase);
+    }
+}
+
+void PCM_DataCache::AddRow(const QString &table, int pcmCase, QVariantList row)
+{
+    tables[table][pcmCase].append(std::move(row));
+}
+
+void PCM_DataCache::AddRows(PCM_DataCache other)
+{
+    for (auto table = other.tables.begin(); table != other.tables.end(); ++table)
+    {
+        QHash<int, PCM_Rows> &rows = tables[table.key()];
+        for (auto pcmCase = table->begin(); pcmCase != table->end(); ++pcmCase)
+        {
+            rows[pcmCase.key()].append(*pcmCase);
+        }
+    }
+}
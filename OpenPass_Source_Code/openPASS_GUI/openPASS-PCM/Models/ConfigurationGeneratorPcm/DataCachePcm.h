@@ -0,0 +1,80 @@
+/*********************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+**********************************************************************/
+
+#ifndef DATACACHEPCM_H
+#define DATACACHEPCM_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVariantList>
+#include <QVector>
+#include <memory>
+
+//! Rows of one table and case, each row holds the selected columns in query order
+using PCM_Rows = QVector<QVariantList>;
+
+//-----------------------------------------------------------------------------
+//! Immutable copy of the PCM database rows of a set of cases.
+//!
+//! The cache is filled once by DatabaseReader::Prefetch and is shared by all
+//! readers generating configurations, which build their PCM objects from the
+//! cached rows instead of querying the database per case. It can be stored as
+//! a binary snapshot, which replaces the database for offline reruns.
+//-----------------------------------------------------------------------------
+class PCM_DataCache
+{
+public:
+    PCM_DataCache() = default;
+
+    /*!
+     * \brief Checks whether the case was prefetched, even if it has no rows
+     */
+    bool ContainsCase(int pcmCase) const;
+
+    /*!
+     * \brief Returns the prefetched cases in ascending order
+     */
+    QStringList GetCaseList() const;
+
+    /*!
+     * \brief Returns the rows of a table for a case
+     *
+     * \param[in] table     name of the table query (see DatabaseReader)
+     * \param[in] pcmCase   case number
+     * \return rows in the order of the query, empty if there are none
+     */
+    const PCM_Rows &GetRows(const QString &table, int pcmCase) const;
+
+    /*!
+     * \brief Writes the cache to a binary snapshot file
+     */
+    bool Save(const QString &snapshotFile) const;
+
+    /*!
+     * \brief Reads a snapshot written by Save
+     *
+     * \return the cache or nullptr, if the file is missing or no valid snapshot
+     */
+    static std::shared_ptr<const PCM_DataCache> Load(const QString &snapshotFile);
+
+private:
+    friend class DatabaseReader;
+
+    void AddCase(int pcmCase);
+    void AddRow(const QString &table, int pcmCase, QVariantList row);
+    //! Adds the rows of another cache, its cases are not added
+    void AddRows(PCM_DataCache other);
+
+    QVector<int> cases;
+    QHash<QString, QHash<int, PCM_Rows>> tables;
+};
+
+#endif // DATACACHEPCM_H
@@ -10,6 +10,94 @@
 
 #include "DatabaseReaderPcm.h"
 
+namespace {
+
+//! Query of the rows of one table, restricted to the requested cases by the reader
+struct TableQuery
+{
+    QString name;       //!< key of the rows in the cache
+    QString columns;
+    QString table;
+    QString condition;  //!< additional condition, may be empty
+    QString order;      //!< order of the rows within a case, may be empty
+};
+
+const QString participantsQuery = "participants";
+const QString initialsQuery = "initials";
+const QString trajectoriesQuery = "trajectories";
+
+//! Number of cases per prefetch statement, keeps the IN lists of the statements short
+constexpr int prefetchChunkSize = 500;
+
+const QList<TableQuery> &GetTableQueries()
+{
+    static const QList<TableQuery> tableQueries = []()
+    {
+        QList<TableQuery> queries;
+        queries.append(TableQuery{participantsQuery,
+                        "TYPEPCM,WIDTH,LENGTH,DISTCGFA,WEIGHT,HEIGHTCG,WHEELBASE,IXX,IYY,IZZ,MUE,TRACKWIDTH,HEIGHT,CGFRONT",
+                        "participant_data", "", ""});
+        queries.append(TableQuery{initialsQuery, "XPOS,YPOS,VX,VY,AX,AY,PSI", "dynamics", "STEP = 0", ""});
+        queries.append(TableQuery{trajectoriesQuery, "BETNR,STEP,XPOS,YPOS,VX,VY,PSI", "dynamics", "", "BETNR, STEP"});
+
+        for (int i = 1; i < static_cast<int>(MarkType::NumberOfMarkTypes); i++)
+        {
+            QString marksTypeName = QString::fromStdString(PCM_Helper::ConvertMarkTypeToDBString(
+                                                               static_cast<MarkType>(i)));
+            queries.append(TableQuery{marksTypeName, "LINENO,POINTNO,X,Y,Z", marksTypeName, "", "LINENO, POINTNO"});
+        }
+
+        QString objectsName = QString::fromStdString(PCM_Helper::ConvertObjectTypeToDBString(
+                                                         ObjectType::OBJECT));
+        queries.append(TableQuery{objectsName, "LINENO,POINTNO,X,Y,Z,OBJTYPE", objectsName, "", "LINENO, POINTNO"});
+
+        QString viewObjectsName = QString::fromStdString(PCM_Helper::ConvertObjectTypeToDBString(
+                                                             ObjectType::VIEWOBJECT));
+        queries.append(TableQuery{viewObjectsName, "LINENO,POINTNO,X,Y,Z", viewObjectsName, "", "LINENO, POINTNO"});
+
+        QString intendedCourseName = QString::fromStdString(PCM_Helper::GetIntendedCourseDBString());
+        queries.append(TableQuery{intendedCourseName, "BETNR,POINTNO,X,Y,Z", intendedCourseName, "", "BETNR, POINTNO"});
+
+        QString globalDataName = QString::fromStdString(PCM_Helper::GetGlobalDataDBString());
+        queries.append(TableQuery{globalDataName, "OFFSETX,OFFSETY,PARTICIP,SIMUVERS", globalDataName, "", ""});
+
+        return queries;
+    }();
+
+    return tableQueries;
+}
+
+const TableQuery *FindTableQuery(const QString &name)
+{
+    for (const TableQuery &tableQuery : GetTableQueries())
+    {
+        if (tableQuery.name == name)
+        {
+            return &tableQuery;
+        }
+    }
+    return nullptr;
+}
+
+//! Builds the statement of a table query, optionally selecting the case as first column
+QString BuildStatement(const TableQuery &tableQuery, const QString &caseCondition, bool selectCase)
+{
+    QString statement = "SELECT " + (selectCase ? QString("FALL,") : QString()) + tableQuery.columns
+                        + " FROM " + tableQuery.table + " WHERE ";
+    if (!tableQuery.condition.isEmpty())
+    {
+        statement += tableQuery.condition + " AND ";
+    }
+    statement += caseCondition;
+    if (!tableQuery.order.isEmpty())
+    {
+        statement += " ORDER BY " + (selectCase ? QString("FALL, ") : QString()) + tableQuery.order;
+    }
+    return statement;
+}
+
+} // namespace
+
 DatabaseReader::DatabaseReader()
 {
 }
@@ -43,6 +131,14 @@ bool DatabaseReader::OpenDataBase()
         return false;
     }
 
+    QString dbString = "Driver={Microsoft Access Driver (*.mdb, *.accdb)};FIL={Access};DBQ="
+                       + databaseName;
+
+    return OpenDataBase("QODBC", dbString);
+}
+
+bool DatabaseReader::OpenDataBase(const QString &driver, const QString &databaseString)
+{
     bool success = true;
 
     if (IsDataBaseOpen())
@@ -50,10 +146,9 @@ bool DatabaseReader::OpenDataBase()
         CloseDataBase();
     }
 
-    db = QSqlDatabase::addDatabase("QODBC");
-    QString dbString = "Driver={Microsoft Access Driver (*.mdb, *.accdb)};FIL={Access};DBQ="
-                       + databaseName;
-    db.setDatabaseName(dbString);
+    // each reader uses its own connection, so readers can be used in parallel threads
+    db = QSqlDatabase::addDatabase(driver, QString("DatabaseReader_%1").arg(reinterpret_cast<quintptr>(this)));
+    db.setDatabaseName(databaseString);
     connection = db.connectionName();
 
     success =  db.open();
@@ -70,6 +165,11 @@ bool DatabaseReader::CloseDataBase()
     if (IsDataBaseOpen())
     {
         db.close();
+    }
+
+    // the connection is also added, if the database could not be opened
+    if (!connection.isEmpty())
+    {
         db = QSqlDatabase();
         QSqlDatabase::removeDatabase(connection);
         connection = "";
@@ -91,7 +191,7 @@ bool DatabaseReader::ReadCaseList(QStringList &caseList)
     }
 
     // Read the Cases from the table "participant_data"
-    QSqlQuery query;
+    QSqlQuery query(db);
 
     query.exec("SELECT DISTINCT FALL FROM participant_data ORDER BY FALL ASC");
     while (query.next())
@@ -105,6 +205,130 @@ bool DatabaseReader::ReadCaseList(QStringList &caseList)
 
 }
 
+std::shared_ptr<const PCM_DataCache> DatabaseReader::Prefetch(const QStringList &caseList)
+{
+    if (!IsDataBaseOpen())
+    {
+        return nullptr;
+    }
+
+    auto data = std::make_shared<PCM_DataCache>();
+
+    for (int first = 0; first < caseList.size(); first += prefetchChunkSize)
+    {
+        QVector<int> chunk;
+        QStringList chunkCases;
+        for (const QString &pcmCase : caseList.mid(first, prefetchChunkSize))
+        {
+            bool isNumber = false;
+            int caseNumber = pcmCase.toInt(&isNumber);
+            if (!isNumber)
+            {
+                continue;
+            }
+
+            chunk.append(caseNumber);
+            chunkCases.append(QString("%1").arg(caseNumber));
+        }
+
+        if (chunk.isEmpty())
+        {
+            continue;
+        }
+
+        // the rows of a chunk are only added, if all of its statements succeed
+        PCM_DataCache chunkData;
+        bool success = true;
+
+        QString caseCondition = "FALL IN (" + chunkCases.join(",") + ")";
+        for (const TableQuery &tableQuery : GetTableQueries())
+        {
+            QSqlQuery query(db);
+            query.setForwardOnly(true);
+            if (!query.exec(BuildStatement(tableQuery, caseCondition, true)))
+            {
+                std::cout << "Warning (ConfigGenerator): could not prefetch " << tableQuery.name.toStdString()
+                          << ", the cases " << chunkCases.first().toStdString() << " to " << chunkCases.last().toStdString()
+                          << " are read one by one: " << query.lastError().text().toStdString() << std::endl;
+                success = false;
+                break;
+            }
+
+            const int columnCount = query.record().count();
+            while (query.next())
+            {
+                QVariantList row;
+                row.reserve(columnCount - 1);
+                for (int column = 1; column < columnCount; column++)
+                {
+                    row.append(query.value(column));
+                }
+                chunkData.AddRow(tableQuery.name, query.value(0).toInt(), std::move(row));
+            }
+
+            query.clear();
+        }
+
+        if (!success)
+        {
+            continue;
+        }
+
+        for (int caseNumber : chunk)
+        {
+            data->AddCase(caseNumber);
+        }
+        data->AddRows(std::move(chunkData));
+    }
+
+    return data;
+}
+
+void DatabaseReader::SetCache(std::shared_ptr<const PCM_DataCache> data)
+{
+    cache = std::move(data);
+}
+
+bool DatabaseReader::IsCached(const QString &pcmCase) const
+{
+    return cache && cache->ContainsCase(pcmCase.toInt());
+}
+
+bool DatabaseReader::SelectRows(const QString &table, const QString &pcmCase, PCM_Rows &rows)
+{
+    if (IsCached(pcmCase))
+    {
+        rows = cache->GetRows(table, pcmCase.toInt());
+        return true;
+    }
+
+    const TableQuery *tableQuery = FindTableQuery(table);
+    if (tableQuery == nullptr || !IsDataBaseOpen())
+    {
+        return false;
+    }
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    query.exec(BuildStatement(*tableQuery, "FALL = " + pcmCase, false));
+
+    const int columnCount = query.record().count();
+    while (query.next())
+    {
+        QVariantList row;
+        row.reserve(columnCount);
+        for (int column = 0; column < columnCount; column++)
+        {
+            row.append(query.value(column));
+        }
+        rows.append(std::move(row));
+    }
+
+    query.clear();
+
+    return true;
+}
+
 bool DatabaseReader::ReadAllData(const QString &pcmCase,
                                  std::vector<PCM_ParticipantData> &participants,
                                  std::vector<PCM_InitialValues> &initials,
@@ -177,86 +401,70 @@ bool DatabaseReader::ReadAllData(const QString &pcmCase,
 bool DatabaseReader::ReadParticipantData(const QString &pcmCase,
                                          std::vector<PCM_ParticipantData> &participants)
 {
-    if (!IsDataBaseOpen())
+    PCM_Rows rows;
+    if (!SelectRows(participantsQuery, pcmCase, rows))
     {
         return false;
     }
 
-    QSqlQuery query;
-    query.exec("SELECT TYPEPCM,WIDTH,LENGTH,DISTCGFA,WEIGHT,HEIGHTCG,WHEELBASE,IXX,IYY,IZZ,MUE,TRACKWIDTH,HEIGHT,CGFRONT FROM participant_data WHERE FALL = "
-               + pcmCase);
-    while (query.next())
+    for (const QVariantList &row : rows)
     {
-        participants.push_back(PCM_ParticipantData(query.value(0).toString(),
-                                                   query.value(1).toString(),
-                                                   query.value(2).toString(),
-                                                   query.value(3).toString(),
-                                                   query.value(4).toString(),
-                                                   query.value(5).toString(),
-                                                   query.value(6).toString(),
-                                                   query.value(7).toString(),
-                                                   query.value(8).toString(),
-                                                   query.value(9).toString(),
-                                                   query.value(10).toString(),
-                                                   query.value(11).toString(),
-                                                   query.value(12).toString(),
-                                                   query.value(13).toString()));
+        participants.push_back(PCM_ParticipantData(row.at(0).toString(),
+                                                   row.at(1).toString(),
+                                                   row.at(2).toString(),
+                                                   row.at(3).toString(),
+                                                   row.at(4).toString(),
+                                                   row.at(5).toString(),
+                                                   row.at(6).toString(),
+                                                   row.at(7).toString(),
+                                                   row.at(8).toString(),
+                                                   row.at(9).toString(),
+                                                   row.at(10).toString(),
+                                                   row.at(11).toString(),
+                                                   row.at(12).toString(),
+                                                   row.at(13).toString()));
     }
 
-    query.clear();
-
     return !(participants.empty());
 }
 
 bool DatabaseReader::ReadDynamicsData(const QString &pcmCase,
                                       std::vector<PCM_InitialValues> &initials)
 {
-    if (!IsDataBaseOpen())
+    PCM_Rows rows;
+    if (!SelectRows(initialsQuery, pcmCase, rows))
     {
         return false;
     }
 
-    QSqlQuery query;
-    query.exec("SELECT XPOS,YPOS,VX,VY,AX,AY,PSI FROM dynamics WHERE STEP = 0 AND FALL = " + pcmCase);
-    while (query.next())
+    for (const QVariantList &row : rows)
     {
-        initials.push_back(PCM_InitialValues(query.value(0).toString(),
-                                             query.value(1).toString(),
-                                             query.value(2).toString(),
-                                             query.value(3).toString(),
-                                             query.value(4).toString(),
-                                             query.value(5).toString(),
-                                             query.value(6).toString()));
+        initials.push_back(PCM_InitialValues(row.at(0).toString(),
+                                             row.at(1).toString(),
+                                             row.at(2).toString(),
+                                             row.at(3).toString(),
+                                             row.at(4).toString(),
+                                             row.at(5).toString(),
+                                             row.at(6).toString()));
     }
 
-    query.clear();
-
     return !(initials.empty());
 }
 
 bool DatabaseReader::ReadTrajectoryData(const QString &pcmCase,
                                         std::vector<PCM_Trajectory *> &trajectories)
 {
-    if (!IsDataBaseOpen())
+    // rows of all participants ordered by BETNR and STEP, one trajectory per BETNR
+    PCM_Rows rows;
+    if (!SelectRows(trajectoriesQuery, pcmCase, rows))
     {
         return false;
     }
 
-    QSqlQuery query;
-    query.exec("SELECT BETNR FROM dynamics WHERE FALL = " + pcmCase + " GROUP BY BETNR");
-    std::vector<QString>betNr;
-    while (query.next())
+    int rowIndex = 0;
+    while (rowIndex < rows.size())
     {
-        betNr.push_back(query.value(0).toString());
-    }
-
-    query.clear();
-
-    for (size_t i = 0; i < betNr.size(); i++)
-    {
-        query.exec( "SELECT STEP,XPOS,YPOS,VX,VY,PSI FROM dynamics WHERE BETNR = "
-                    + betNr.at(i) + "AND FALL = " + pcmCase + " ORDER BY STEP ASC" );
-
+        const QVariant betNr = rows.at(rowIndex).at(0);
 
         std::vector<int> *timeVec = new std::vector<int>;
         std::vector<double> *xPosVec = new std::vector<double>;
@@ -265,14 +473,15 @@ bool DatabaseReader::ReadTrajectoryData(const QString &pcmCase,
         std::vector<double> *vVelVec = new std::vector<double>;
         std::vector<double> *psiVec = new std::vector<double>;
 
-        while (query.next())
+        for (; rowIndex < rows.size() && rows.at(rowIndex).at(0) == betNr; rowIndex++)
         {
-            timeVec->push_back((qRound(query.value(0).toDouble() * 1000)));
-            xPosVec->push_back(query.value(1).toDouble());
-            yPosVec->push_back(query.value(2).toDouble());
-            uVelVec->push_back(query.value(3).toDouble());
-            vVelVec->push_back(query.value(4).toDouble());
-            psiVec->push_back(query.value(5).toDouble());
+            const QVariantList &row = rows.at(rowIndex);
+            timeVec->push_back((qRound(row.at(1).toDouble() * 1000)));
+            xPosVec->push_back(row.at(2).toDouble());
+            yPosVec->push_back(row.at(3).toDouble());
+            uVelVec->push_back(row.at(4).toDouble());
+            vVelVec->push_back(row.at(5).toDouble());
+            psiVec->push_back(row.at(6).toDouble());
         }
 
         trajectories.push_back(new PCM_Trajectory(timeVec,
@@ -283,14 +492,12 @@ bool DatabaseReader::ReadTrajectoryData(const QString &pcmCase,
                                                   psiVec));
     }
 
-    query.clear();
-
     return !(trajectories.empty());
 }
 
 bool DatabaseReader::ReadMarksData(const QString &pcmCase, std::vector<PCM_Marks *> &marksVec)
 {
-    if (!IsDataBaseOpen())
+    if (!IsCached(pcmCase) && !IsDataBaseOpen())
     {
         return false;
     }
@@ -302,22 +509,20 @@ bool DatabaseReader::ReadMarksData(const QString &pcmCase, std::vector<PCM_Marks
         QString marksTypeName = QString::fromStdString(PCM_Helper::ConvertMarkTypeToDBString(
                                                            marks->GetMarkType()));
 
-        QSqlQuery query;
-        query.exec( "SELECT LINENO,POINTNO,X,Y,Z FROM " + marksTypeName + " WHERE FALL = " + pcmCase +
-                    " ORDER BY LINENO, POINTNO");
+        PCM_Rows rows;
+        SelectRows(marksTypeName, pcmCase, rows);
 
-        while (query.next())
+        for (const QVariantList &row : rows)
         {
-            int lineNo = query.value(0).toInt();
-            int pointNo = query.value(1).toInt();
-            double x = query.value(2).toDouble();
-            double y = query.value(3).toDouble();
-            double z = query.value(4).toDouble();
+            int lineNo = row.at(0).toInt();
+            int pointNo = row.at(1).toInt();
+            double x = row.at(2).toDouble();
+            double y = row.at(3).toDouble();
+            double z = row.at(4).toDouble();
 
             AddLineData(marks, lineNo, pointNo, x, y, z);
         }
         marksVec.push_back(marks);
-        query.clear();
     }
 
     return true;
@@ -325,88 +530,75 @@ bool DatabaseReader::ReadMarksData(const QString &pcmCase, std::vector<PCM_Marks
 
 bool DatabaseReader::ReadObjectsData(const QString &pcmCase, PCM_Object &objects)
 {
-    if (!IsDataBaseOpen())
-    {
-        return false;
-    }
-
     QString objectsName = QString::fromStdString(PCM_Helper::ConvertObjectTypeToDBString(
                                                      ObjectType::OBJECT));
 
-    QSqlQuery query;
-    query.exec( "SELECT LINENO,POINTNO,X,Y,Z,OBJTYPE FROM " + objectsName + " WHERE FALL = " + pcmCase +
-                " ORDER BY LINENO, POINTNO");
+    PCM_Rows rows;
+    if (!SelectRows(objectsName, pcmCase, rows))
+    {
+        return false;
+    }
 
-    while (query.next())
+    for (const QVariantList &row : rows)
     {
-        int lineNo = query.value(0).toInt();
-        int pointNo = query.value(1).toInt();
-        double x = query.value(2).toDouble();
-        double y = query.value(3).toDouble();
-        double z = query.value(4).toDouble();
-        int objectType = query.value(5).toInt();
+        int lineNo = row.at(0).toInt();
+        int pointNo = row.at(1).toInt();
+        double x = row.at(2).toDouble();
+        double y = row.at(3).toDouble();
+        double z = row.at(4).toDouble();
+        int objectType = row.at(5).toInt();
 
         AddLineData(&objects, lineNo, pointNo, x, y, z);
         objects.SetObjectType(objectType);
     }
 
-    query.clear();
-
     return true;
 }
 
 bool DatabaseReader::ReadViewObjectsData(const QString &pcmCase, PCM_ViewObject &viewObject)
 {
-    if (!IsDataBaseOpen())
-    {
-        return false;
-    }
-
     QString viewObjectsName = QString::fromStdString(PCM_Helper::ConvertObjectTypeToDBString(
                                                          ObjectType::VIEWOBJECT));
 
-    QSqlQuery query;
-    query.exec( "SELECT LINENO,POINTNO,X,Y,Z FROM " + viewObjectsName + " WHERE FALL = " + pcmCase +
-                " ORDER BY LINENO, POINTNO");
+    PCM_Rows rows;
+    if (!SelectRows(viewObjectsName, pcmCase, rows))
+    {
+        return false;
+    }
 
-    while (query.next())
+    for (const QVariantList &row : rows)
     {
-        int lineNo = query.value(0).toInt();
-        int pointNo = query.value(1).toInt();
-        double x = query.value(2).toDouble();
-        double y = query.value(3).toDouble();
-        double z = query.value(4).toDouble();
+        int lineNo = row.at(0).toInt();
+        int pointNo = row.at(1).toInt();
+        double x = row.at(2).toDouble();
+        double y = row.at(3).toDouble();
+        double z = row.at(4).toDouble();
 
         AddLineData(&viewObject, lineNo, pointNo, x, y, z);
     }
 
-    query.clear();
-
     return true;
 }
 
 bool DatabaseReader::ReadIntendedCourseData(const QString &pcmCase,
                                             PCM_IntendedCourses &intendedCources)
 {
-    if (!IsDataBaseOpen())
-    {
-        return false;
-    }
-
     QString intendedCourseName = QString::fromStdString(
                                      PCM_Helper::GetIntendedCourseDBString());
 
-    QSqlQuery query;
-    query.exec( "SELECT BETNR,POINTNO,X,Y,Z FROM " + intendedCourseName + " WHERE FALL = " + pcmCase +
-                " ORDER BY BETNR, POINTNO");
+    PCM_Rows rows;
+    if (!SelectRows(intendedCourseName, pcmCase, rows))
+    {
+        return false;
+    }
 
-    while (query.next())
+    for (const QVariantList &row : rows)
     {
-        int betNr = query.value(0).toInt();
-        int pointNo = query.value(1).toInt();
-        double x = query.value(2).toDouble();
-        double y = query.value(3).toDouble();
-        double z = query.value(4).toDouble();
+        int betNr = row.at(0).toInt();
+        int pointNo = row.at(1).toInt();
+        double x = row.at(2).toDouble();
+        double y = row.at(3).toDouble();
+        double z = row.at(4).toDouble();
 
         if (!intendedCources.IsCoursePresent(betNr))
         {
@@ -429,37 +621,31 @@ bool DatabaseReader::ReadIntendedCourseData(const QString &pcmCase,
 
     }
 
-    query.clear();
-
     return true;
 }
 
 bool DatabaseReader::ReadGlobalData(const QString &pcmCase, PCM_GlobalData &globalData)
 {
-    if (!IsDataBaseOpen())
+    QString globalDataName = QString::fromStdString(PCM_Helper::GetGlobalDataDBString());
+
+    PCM_Rows rows;
+    if (!SelectRows(globalDataName, pcmCase, rows))
     {
         return false;
     }
 
-    QString globalDataName = QString::fromStdString(PCM_Helper::GetGlobalDataDBString());
-
-    QSqlQuery query;
-    query.exec( "SELECT OFFSETX,OFFSETY,PARTICIP,SIMUVERS FROM " + globalDataName + " WHERE FALL = " +
-                pcmCase);
-
-    while (query.next())
+    for (const QVariantList &row : rows)
     {
-        double offsetX = query.value(0).toDouble();
-        double offsetY = query.value(1).toDouble();
-        int participants = query.value(2).toInt();
-        int simulationVersion = query.value(3).toInt();
+        double offsetX = row.at(0).toDouble();
+        double offsetY = row.at(1).toDouble();
+        int participants = row.at(2).toInt();
+        int simulationVersion = row.at(3).toInt();
 
         globalData.SetOffsetX(offsetX);
         globalData.SetOffsetY(offsetY);
         globalData.SetParticipants(participants);
         globalData.SetSimulationVersion(simulationVersion);
     }
-    query.clear();
 
     return true;
 }
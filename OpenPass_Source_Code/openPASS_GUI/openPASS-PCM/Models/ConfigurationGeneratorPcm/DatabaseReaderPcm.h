@@ -14,7 +14,9 @@
 #include <QStringList>
 #include <QtSql>
 #include <iostream>
+#include <memory>
 
+#include "DataCachePcm.h"
 #include "pcm_participantData.h"
 #include "pcm_initialValues.h"
 #include "pcm_trajectory.h"
@@ -35,11 +37,43 @@ public:
     bool SetDatabase(QString &dbName);
 
     bool OpenDataBase();
+
+    /*!
+     * \brief Opens the database with the given Qt SQL driver
+     *
+     * OpenDataBase() uses the ODBC driver for the Access database. Other
+     * drivers can read a copy of the PCM tables, e.g. "QSQLITE".
+     *
+     * \param[in] driver           name of the Qt SQL driver
+     * \param[in] databaseString   database name or connection string of the driver
+     * \return true, if the database could be opened
+     */
+    bool OpenDataBase(const QString &driver, const QString &databaseString);
     bool CloseDataBase();
     bool IsDataBaseOpen();
 
     bool ReadCaseList(QStringList &caseList);
 
+    /*!
+     * \brief Reads all rows of the given cases with a few set-based queries
+     *
+     * Cases of a chunk whose statements fail are not added to the cache, so
+     * they are still read from the database one by one.
+     *
+     * \param[in] caseList   cases to read
+     * \return the rows of the cases or nullptr, if the database is not open
+     */
+    std::shared_ptr<const PCM_DataCache> Prefetch(const QStringList &caseList);
+
+    /*!
+     * \brief Lets the Read functions use the prefetched rows of the cached cases
+     *
+     * Cases which are not cached are still read from the database.
+     */
+    void SetCache(std::shared_ptr<const PCM_DataCache> data);
+
+    bool IsCached(const QString &pcmCase) const;
+
     bool ReadAllData(const QString &pcmCase,
                      std::vector<PCM_ParticipantData> &participants,
                      std::vector<PCM_InitialValues> &initials,
@@ -68,6 +102,11 @@ public:
                         PCM_GlobalData &globalData);
 
 private:
+    //! Rows of a table query for a case, either from the cache or from the database
+    bool SelectRows(const QString &table,
+                    const QString &pcmCase,
+                    PCM_Rows &rows);
+
     bool AddLineData(PCM_LineContainer *lineContainer,
                      int lineNo,
                      int pointNo,
@@ -78,6 +117,7 @@ private:
     QString databaseName = "";
     QSqlDatabase db;
     QString connection;
+    std::shared_ptr<const PCM_DataCache> cache;
 };
 
 #endif // DATABASEREADER_H
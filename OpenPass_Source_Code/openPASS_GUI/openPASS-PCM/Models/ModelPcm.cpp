@@ -9,6 +9,9 @@
 **********************************************************************/
 
 #include "GUI_Definitions.h"
+#include "ModelPcm.h"
+
+#include <algorithm>
 
 ModelPcm::ModelPcm(QObject *parent)
     : QObject(parent)
@@ -52,7 +55,9 @@ void ModelPcm::SimulationStop()
 {
     simulationStop = true;
 
-    //todo: terminate running simulation threads if existing
+    // wake up the simulation waiting for generated configurations, a running master is killed by RunMaster
+    QMutexLocker locker(&batchMutex);
+    batchCondition.wakeAll();
 }
 
 bool ModelPcm::ClearCaseList()
@@ -69,6 +74,22 @@ bool ModelPcm::LoadCasesFromPcmFile(const QString &pcmFilePath)
 
     dbReader.CloseDataBase();
     currentPcmFilePath = pcmFilePath;
+    pcmData.reset();
+
+    // a snapshot of a previous simulation replaces the database
+    if (QFileInfo(pcmFilePath).suffix() == SUFFIX_PCM_SNAPSHOT)
+    {
+        pcmData = PCM_DataCache::Load(pcmFilePath);
+        if (!pcmData)
+        {
+            return false;
+        }
+
+        pcmCaseList = pcmData->GetCaseList();
+        listModelPcm->setStringList(pcmCaseList);
+        return true;
+    }
+
     dbReader.SetDatabase(currentPcmFilePath);
     bool success = dbReader.OpenDataBase();
 
@@ -123,6 +144,11 @@ void ModelPcm::SetLogLevel(const int level)
     this->logLevel = level;
 }
 
+void ModelPcm::SetSaveSnapshot(const bool saveSnapshot)
+{
+    this->saveSnapshot = saveSnapshot;
+}
+
 void ModelPcm::SetOtherSystemFile(const QString &otherSystemFile)
 {
     this->otherSystemFile = otherSystemFile;
@@ -187,37 +213,103 @@ void ModelPcm::StartSimulation()
 //        return;
 //    }
 
-    QString baseFolder = QCoreApplication::applicationDirPath();
+    const QList<SimulationTask> tasks = CreateSimulationTasks();
 
-    QModelIndexList pcmCaseIndexList = selectionModelPcm->selectedIndexes();
-    QStringList otherSytemList = otherSystemFile.split(";");
-    QStringList car1SystemList = car1SystemFile.split(";");
-    QStringList car2SystemList = car2SystemFile.split(";");
+    if (inputFromPCMDB && !PrefetchPcmData(tasks))
+    {
+        Q_EMIT ShowMessage("ERROR", "Failed to read the cases from the PCM file [" + currentPcmFilePath + "]");
+        Q_EMIT SimulationFinished();
+        return;
+    }
 
-    Q_EMIT SimulationProgressMaximum(pcmCaseIndexList.count()
-                                     * otherSytemList.count()
-                                     * car1SystemList.count()
-                                     * car2SystemList.count()
-                                     * 2);
+    // the progress counts simulated configurations
+    Q_EMIT SimulationProgressMaximum(tasks.count());
 
     int progress = 0;
-    Q_EMIT SimulationProgressChanged(progress++);
-
-    configGenerator->Clear();
+    Q_EMIT SimulationProgressChanged(progress);
+
+    readyConfigSets.clear();
+    generationError = "";
+    generationAbort = false;
+    nextTask = 0;
+
+    // the configurations are generated in parallel and simulated in batches as soon as they are ready,
+    // so the generation of later cases overlaps with the simulation of earlier ones
+    QThreadPool generatorPool;
+    const int generatorCount = std::max(1, std::min(QThread::idealThreadCount(), tasks.count()));
+    runningGenerators = generatorCount;
+    for (int generatorIndex = 0; generatorIndex < generatorCount; ++generatorIndex)
+    {
+        QtConcurrent::run(&generatorPool, [this, &tasks]()
+        {
+            GenerateConfigs(tasks);
+        });
+    }
 
-    for (QModelIndex &pcmCaseIndex : pcmCaseIndexList)
+    bool masterSuccess = true;
+    int batchIndex = 0;
+    while (true)
     {
-        if (simulationStop)
+        QList<QMap<QString, QString>> configSets;
         {
-            Q_EMIT ShowMessage("Information", "Simulation aborted.");
-            Q_EMIT SimulationFinished();
-            return;
+            QMutexLocker locker(&batchMutex);
+            while (readyConfigSets.isEmpty() && runningGenerators > 0 && !simulationStop && !generationAbort)
+            {
+                batchCondition.wait(&batchMutex);
+            }
+            configSets.swap(readyConfigSets);
         }
 
+        if (simulationStop || generationAbort || configSets.isEmpty())
+        {
+            break;
+        }
+
+        QString batchFolder = resultFolder + "/" + DIRNAME_BATCH + QString("_%1").arg(batchIndex++, 3, 10, QChar('0'));
+        masterSuccess = RunMaster(batchFolder, configSets);
+        if (!masterSuccess)
+        {
+            break;
+        }
+
+        progress += configSets.count();
+        Q_EMIT SimulationProgressChanged(progress);
+    }
+
+    // stop the remaining generators, if the simulation ended early
+    generationAbort = true;
+    generatorPool.waitForDone();
+
+    if (simulationStop)
+    {
+        Q_EMIT ShowMessage("Information", "Simulation aborted.");
+    }
+    else if (!generationError.isEmpty())
+    {
+        Q_EMIT ShowMessage("ERROR", generationError);
+    }
+    else if (masterSuccess)
+    {
+        Q_EMIT ShowMessage("Information", "Simulation successfully finished.");
+    }
+
+    Q_EMIT SimulationFinished();
+}
+
+QList<ModelPcm::SimulationTask> ModelPcm::CreateSimulationTasks()
+{
+    QList<SimulationTask> tasks;
+
+    QModelIndexList pcmCaseIndexList = selectionModelPcm->selectedIndexes();
+    QStringList otherSytemList = otherSystemFile.split(";");
+    QStringList car1SystemList = car1SystemFile.split(";");
+    QStringList car2SystemList = car2SystemFile.split(";");
+
+    for (QModelIndex &pcmCaseIndex : pcmCaseIndexList)
+    {
         int otherSystemCount = 0;
         for (QString otherSystem : otherSytemList)
         {
-
             if (otherSystem.isEmpty())
             {
                 continue;
@@ -246,92 +338,16 @@ void ModelPcm::StartSimulation()
                     {
                         QString varName = (varIndex == 0) ? DIR_NO_VARIATION :
                                                 QString("Var_%1").arg(varIndex, 5, 10, QChar('0')); // zero padding if var index less than 5 digits
-                        QString caseSystemVarFolder = caseSystemFolder + "/" + varName;
-
-                        QDir caseSystemVarDir(caseSystemVarFolder);
-                        if (caseSystemVarDir.exists())
-                        {
-                            if(!caseSystemVarDir.removeRecursively())
-                            {
-                                Q_EMIT ShowMessage("ERROR", "Failed to delete directory " + caseSystemVarFolder + " due to access control from another program");
-                                Q_EMIT SimulationFinished();
-                            return;
-                        }
-                    }
-                        if(!caseSystemVarDir.mkpath(caseSystemVarDir.absolutePath()))
-                    {
-                            Q_EMIT ShowMessage("ERROR", "Failed to create directory " + caseSystemVarFolder);
-                            Q_EMIT SimulationFinished();
-                        return;
-                    }
 
                         // the random seed uses PCM case number if the inital seed is negative. Otherwise it uses the inital seed.
                         int randomSeed = (initRandomSeed < 0) ? (pcmCaseIndex.data().toInt() + varIndex)
                                                               : (initRandomSeed + varIndex);
 
-//                        qDebug("StartSimulation: var %s with random seed: %d", qPrintable(varName), randomSeed);
-
-                        if(inputFromPCMDB)
-                        {
-                            if (!configGenerator->GenerateConfigFromDB(dbReader,
-                                                          pcmCase,
-                                      caseSystemVarFolder,
-                                      otherSystem, car1System, car2System,
-                                      randomSeed,
-                                      (varIndex == 0)?std::vector<double>{-1, -1}: std::vector<double>{shiftRadius1, shiftRadius2},
-                                      (varIndex == 0)?std::vector<double>{INFINITY, INFINITY}: std::vector<double>{velocityMaxScale1, velocityMaxScale2}))
-                    {
-                                Q_EMIT ShowMessage("ERROR", "Failed to generate configuration file for case: " + pcmCase);
-                        Q_EMIT SimulationFinished();
-                        return;
-                    }
-                        }
-                        else
-                        {
-                            // Generate Configs from previous result folder
-                            QString prevCaseFolder = prevResultFolder + "/" + pcmCase;
-                            QString prevCaseSystemVarFolder, prevSystemName;
-
-                            QDirIterator it(prevCaseFolder, QDir::Dirs | QDir::NoSymLinks | QDir::NoDotAndDotDot);
-                            while (it.hasNext())
-                            {
-                                prevSystemName = QFileInfo(it.next()).baseName(); // get the base name of the subfolder without path prefix
-                                if(QRegExp(REGEX_CASE_SYSTEM).exactMatch(prevSystemName)) // check if the subfolder name matches the pattern like "0-0-0"
-                                {
-                                    prevCaseSystemVarFolder = prevCaseFolder + "/" + prevSystemName + "/" + DIR_NO_VARIATION;
-                                    QDir prevCaseSystemVarDir(prevCaseSystemVarFolder);
-                                    if (prevCaseSystemVarDir.exists())
-                                    {
-                                        break; // found a valid previous result folder
-                                    }
-
-                                }
-                            }
-
-                            if(prevCaseSystemVarFolder.isEmpty())
-                            {
-                                Q_EMIT ShowMessage("ERROR", "No valid case result folder in previous results for case " + pcmCase);
-                                Q_EMIT SimulationFinished();
-                                return;
-                            }
-
-                            if (!configGenerator->GenerateConfigFromPrevResult(prevCaseSystemVarFolder,
-                                      caseSystemVarFolder,
-                                      otherSystem, car1System, car2System,
-                                      randomSeed,
-                                      (varIndex == 0)?std::vector<double>{-1, -1}: std::vector<double>{shiftRadius1, shiftRadius2},
-                                      (varIndex == 0)?std::vector<double>{INFINITY, INFINITY}: std::vector<double>{velocityMaxScale1, velocityMaxScale2}))
-                            {
-                                Q_EMIT ShowMessage("ERROR", "Failed to generate configuration files for case: " + pcmCase);
-                                Q_EMIT SimulationFinished();
-                                return;
-                            }
-                        }
+                        tasks.append({pcmCase, otherSystem, car1System, car2System,
+                                      caseSystemFolder + "/" + varName, varIndex, randomSeed});
                     }
 
                     car2SystemCount++;
-
-                    Q_EMIT SimulationProgressChanged(progress++);
                 }
                 car1SystemCount++;
             }
@@ -339,33 +355,226 @@ void ModelPcm::StartSimulation()
         }
     }
 
-    const QString frameworkConfigFile = configGenerator->GenerateFrameworkConfig(resultFolder, logLevel);
+    return tasks;
+}
+
+bool ModelPcm::PrefetchPcmData(const QList<SimulationTask> &tasks)
+{
+    QStringList cases;
+    for (const SimulationTask &task : tasks)
+    {
+        if (!cases.contains(task.pcmCase))
+        {
+            cases.append(task.pcmCase);
+        }
+    }
+
+    bool cached = (pcmData != nullptr);
+    for (int caseIndex = 0; cached && caseIndex < cases.count(); ++caseIndex)
+    {
+        cached = pcmData->ContainsCase(cases.at(caseIndex).toInt());
+    }
+
+    if (!cached)
+    {
+        // all cases are read at once with a few set-based queries instead of several queries per case
+        DatabaseReader reader;
+        if (!reader.SetDatabase(currentPcmFilePath) || !reader.OpenDataBase())
+        {
+            return false;
+        }
+
+        pcmData = reader.Prefetch(cases);
+        reader.CloseDataBase();
+
+        if (!pcmData)
+        {
+            return false;
+        }
+    }
+
+    // the optional snapshot allows to rerun the cases without the database
+    if (saveSnapshot)
+    {
+        QDir(resultFolder).mkpath(".");
+        if (!pcmData->Save(resultFolder + "/" + FILENAME_PCM_SNAPSHOT))
+        {
+            Q_EMIT ShowMessage("Warning", "Could not write the PCM snapshot to [" + resultFolder + "]");
+        }
+    }
+
+    return true;
+}
+
+void ModelPcm::GenerateConfigs(const QList<SimulationTask> &tasks)
+{
+    // the cases are read from the prefetched rows, so the generators do not need a database connection
+    DatabaseReader reader;
+    reader.SetCache(pcmData);
+    ConfigGenerator generator(baseFolder);
+
+    for (int taskIndex = nextTask++; taskIndex < tasks.count(); taskIndex = nextTask++)
+    {
+        if (simulationStop || generationAbort)
+        {
+            break;
+        }
+
+        QString errorMessage;
+        bool success = GenerateConfig(tasks.at(taskIndex), reader, generator, errorMessage);
+
+        QMutexLocker locker(&batchMutex);
+        if (!success)
+        {
+            if (generationError.isEmpty())
+            {
+                generationError = errorMessage;
+            }
+            generationAbort = true;
+            batchCondition.wakeAll();
+            break;
+        }
+
+        readyConfigSets.append(generator.TakeConfigSets());
+        batchCondition.wakeAll();
+    }
+
+    QMutexLocker locker(&batchMutex);
+    runningGenerators--;
+    batchCondition.wakeAll();
+}
+
+bool ModelPcm::GenerateConfig(const SimulationTask &task,
+                              DatabaseReader &reader,
+                              ConfigGenerator &generator,
+                              QString &errorMessage)
+{
+    QDir caseSystemVarDir(task.caseSystemVarFolder);
+    if (caseSystemVarDir.exists())
+    {
+        if(!caseSystemVarDir.removeRecursively())
+        {
+            errorMessage = "Failed to delete directory " + task.caseSystemVarFolder + " due to access control from another program";
+            return false;
+        }
+    }
+    if(!caseSystemVarDir.mkpath(caseSystemVarDir.absolutePath()))
+    {
+        errorMessage = "Failed to create directory " + task.caseSystemVarFolder;
+        return false;
+    }
+
+    const std::vector<double> shiftRadiusVec = (task.varIndex == 0) ? std::vector<double>{-1, -1}
+                                                                    : std::vector<double>{shiftRadius1, shiftRadius2};
+    const std::vector<double> velMaxScaleVec = (task.varIndex == 0) ? std::vector<double>{INFINITY, INFINITY}
+                                                                    : std::vector<double>{velocityMaxScale1, velocityMaxScale2};
+
+    if(inputFromPCMDB)
+    {
+        if (!generator.GenerateConfigFromDB(reader,
+                                            task.pcmCase,
+                                            task.caseSystemVarFolder,
+                                            task.otherSystem, task.car1System, task.car2System,
+                                            task.randomSeed,
+                                            shiftRadiusVec,
+                                            velMaxScaleVec))
+        {
+            errorMessage = "Failed to generate configuration file for case: " + task.pcmCase;
+            return false;
+        }
+    }
+    else
+    {
+        // Generate Configs from previous result folder
+        QString prevCaseFolder = prevResultFolder + "/" + task.pcmCase;
+        QString prevCaseSystemVarFolder, prevSystemName;
+
+        QDirIterator it(prevCaseFolder, QDir::Dirs | QDir::NoSymLinks | QDir::NoDotAndDotDot);
+        while (it.hasNext())
+        {
+            prevSystemName = QFileInfo(it.next()).baseName(); // get the base name of the subfolder without path prefix
+            if(QRegExp(REGEX_CASE_SYSTEM).exactMatch(prevSystemName)) // check if the subfolder name matches the pattern like "0-0-0"
+            {
+                prevCaseSystemVarFolder = prevCaseFolder + "/" + prevSystemName + "/" + DIR_NO_VARIATION;
+                QDir prevCaseSystemVarDir(prevCaseSystemVarFolder);
+                if (prevCaseSystemVarDir.exists())
+                {
+                    break; // found a valid previous result folder
+                }
+
+            }
+        }
+
+        if(prevCaseSystemVarFolder.isEmpty())
+        {
+            errorMessage = "No valid case result folder in previous results for case " + task.pcmCase;
+            return false;
+        }
+
+        if (!generator.GenerateConfigFromPrevResult(prevCaseSystemVarFolder,
+                                                    task.caseSystemVarFolder,
+                                                    task.otherSystem, task.car1System, task.car2System,
+                                                    task.randomSeed,
+                                                    shiftRadiusVec,
+                                                    velMaxScaleVec))
+        {
+            errorMessage = "Failed to generate configuration files for case: " + task.pcmCase;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ModelPcm::RunMaster(const QString &batchFolder,
+                         const QList<QMap<QString, QString>> &configSets)
+{
+    if (!QDir().mkpath(batchFolder))
+    {
+        Q_EMIT ShowMessage("ERROR", "Failed to create directory " + batchFolder);
+        return false;
+    }
+
+    configGenerator->Clear();
+    configGenerator->AddConfigSets(configSets);
+
+    const QString frameworkConfigFile = configGenerator->GenerateFrameworkConfig(batchFolder, logLevel);
     if (frameworkConfigFile == "")
     {
         Q_EMIT ShowMessage("ERROR", "Failed to generate framework configuration file");
-        Q_EMIT SimulationFinished();
-        return;
+        return false;
     }
 
     // execute the master process
     QString masterPath = baseFolder + "/" + FILENAME_OPENPASSMASTER_EXE;
-    QProcess *masterProcess = new QProcess();
+    QProcess masterProcess;
     QStringList arguments;
     arguments << "--frameworkConfigFile" << frameworkConfigFile;
 
-    masterProcess->start(masterPath, arguments);
-    masterProcess->waitForFinished(-1);
-    if (masterProcess->exitCode() != 0)
+    masterProcess.start(masterPath, arguments);
+
+    // poll instead of blocking, so a stop request terminates the running master
+    while (!masterProcess.waitForFinished(100) && masterProcess.state() != QProcess::NotRunning)
     {
-        Q_EMIT ShowMessage("ERROR", "Simulation aborted. Master returned with -1");
-        Q_EMIT SimulationFinished();
-        delete masterProcess;
-        return;
+        if (simulationStop)
+        {
+            masterProcess.kill();
+            masterProcess.waitForFinished(-1);
+            return false;
+        }
     }
-    delete masterProcess;
 
-    Q_EMIT SimulationProgressChanged(progress++);
+    if (masterProcess.error() == QProcess::FailedToStart)
+    {
+        Q_EMIT ShowMessage("ERROR", "Simulation aborted. Failed to start " + masterPath);
+        return false;
+    }
 
-    Q_EMIT ShowMessage("Information", "Simulation successfully finished.");
-    Q_EMIT SimulationFinished();
+    if (masterProcess.exitStatus() != QProcess::NormalExit || masterProcess.exitCode() != 0)
+    {
+        Q_EMIT ShowMessage("ERROR", "Simulation aborted. Master returned with -1");
+        return false;
+    }
+
+    return true;
 }
@@ -11,9 +11,12 @@
 #ifndef MODELPCM_H
 #define MODELPCM_H
 
+#include <QMutex>
 #include <QObject>
 #include <QStringListModel>
+#include <QWaitCondition>
 #include <QtConcurrent>
+#include <atomic>
 #include "ConfigurationGeneratorPcm/ConfigGeneratorPcm.h"
 #include "FileHelper.h"
 #include "GUI_Definitions.h"
@@ -36,6 +39,7 @@ public Q_SLOTS:
     bool LoadCasesFromPrevResult(const QString &resDirPath);
     void SetResultFolder(const QString &resultFolder);
     void SetLogLevel(const int level);
+    void SetSaveSnapshot(const bool saveSnapshot);
     void SetOtherSystemFile(const QString &otherSystemFile);
     void SetCar1SystemFile(const QString &car1SystemFile);
     void SetCar2SystemFile(const QString &car2SystemFile);
@@ -62,8 +66,39 @@ Q_SIGNALS:
     void ShowMessage(QString title, QString message);
 
 private:
+    //! A single simulation of the batch: one case with one system combination and variation
+    struct SimulationTask
+    {
+        QString pcmCase;
+        QString otherSystem;
+        QString car1System;
+        QString car2System;
+        QString caseSystemVarFolder;
+        int varIndex;
+        int randomSeed;
+    };
+
     void StartSimulation();
 
+    QList<SimulationTask> CreateSimulationTasks();
+
+    //! Reads the rows of all cases of the tasks into pcmData, unless they are already cached.
+    //! If saveSnapshot is set, pcmData is also written as snapshot into the result folder.
+    bool PrefetchPcmData(const QList<SimulationTask> &tasks);
+
+    //! Generates the configurations of the tasks in parallel to other generators,
+    //! finished configuration sets are handed over to the simulation via readyConfigSets
+    void GenerateConfigs(const QList<SimulationTask> &tasks);
+
+    bool GenerateConfig(const SimulationTask &task,
+                        DatabaseReader &reader,
+                        ConfigGenerator &generator,
+                        QString &errorMessage);
+
+    //! Simulates a batch of configuration sets with a master, killed if the simulation is stopped
+    bool RunMaster(const QString &batchFolder,
+                   const QList<QMap<QString, QString>> &configSets);
+
     QStringListModel *listModelPcm = nullptr;
     QItemSelectionModel *selectionModelPcm = nullptr;
     QStringList pcmCaseList;
@@ -95,9 +130,19 @@ private:
 
     ConfigGenerator *configGenerator;
     DatabaseReader dbReader;
+    std::shared_ptr<const PCM_DataCache> pcmData;    //!< prefetched rows of the cases, shared by all generators
 
-    bool simulationStop = false;
+    std::atomic<bool> simulationStop {false};
     bool inputFromPCMDB = true;
+    bool saveSnapshot = false;
+
+    QMutex batchMutex;
+    QWaitCondition batchCondition;
+    QList<QMap<QString, QString>> readyConfigSets;   //!< generated but not yet simulated configuration sets
+    int runningGenerators = 0;
+    QString generationError = "";
+    std::atomic<bool> generationAbort {false};
+    std::atomic<int> nextTask {0};
 };
 
 #endif // MODELPCM_H
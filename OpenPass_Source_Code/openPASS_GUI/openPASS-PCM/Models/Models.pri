@@ -11,6 +11,7 @@
 HEADERS += \
     $$PWD/ModelPcm.h \
     $$PWD/ConfigurationGeneratorPcm/ConfigGeneratorPcm.h \
+    $$PWD/ConfigurationGeneratorPcm/DataCachePcm.h \
     $$PWD/ConfigurationGeneratorPcm/DatabaseReaderPcm.h \
     $$PWD/ConfigurationGeneratorPcm/ConfigWriter.h \
     $$PWD/ConfigurationGeneratorPcm/stochasticsPCM.h \
@@ -38,6 +39,7 @@ HEADERS += \
 SOURCES += \
     $$PWD/ModelPcm.cpp \
     $$PWD/ConfigurationGeneratorPcm/ConfigGeneratorPcm.cpp \
+    $$PWD/ConfigurationGeneratorPcm/DataCachePcm.cpp \
     $$PWD/ConfigurationGeneratorPcm/DatabaseReaderPcm.cpp \
     $$PWD/ConfigurationGeneratorPcm/ConfigWriter.cpp \
     $$PWD/ConfigurationGeneratorPcm/stochasticsPCM.cpp \
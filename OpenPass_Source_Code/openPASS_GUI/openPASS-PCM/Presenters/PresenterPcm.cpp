@@ -33,6 +33,9 @@ PresenterPcm::PresenterPcm(ModelPcm *modelPcm, ViewPcm *viewPcm,
     connect(viewPcm, &ViewPcm::LogLevelChanged,
             modelPcm, &ModelPcm::SetLogLevel);
 
+    connect(viewPcm, &ViewPcm::SaveSnapshotChanged,
+            modelPcm, &ModelPcm::SetSaveSnapshot);
+
     connect(viewPcm, &ViewPcm::OtherFileChanged,
             modelPcm, &ModelPcm::SetOtherSystemFile);
 
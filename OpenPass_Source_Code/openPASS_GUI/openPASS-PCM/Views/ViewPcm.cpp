@@ -111,6 +111,7 @@ void ViewPcm::enableIOGUI(bool enabled)
     ui->lineEditPrevResultFolder->setEnabled(enabled);
     ui->lineEditResultFolder->setEnabled(enabled);
     ui->comboBox_LogLevel->setEnabled(enabled);
+    ui->checkBoxSaveSnapshot->setEnabled(enabled);
 
     ui->lineEditCar1->setEnabled(enabled);
     ui->lineEditCar2->setEnabled(enabled);
@@ -216,6 +217,7 @@ void ViewPcm::ActionSaveExperiment()
     }
 
     settings.setValue(configStringEnvResultFolder, ui->lineEditResultFolder->text());
+    settings.setValue(configStringEnvSaveSnapshot, ui->checkBoxSaveSnapshot->isChecked());
     settings.setValue(configStringSysCar1, ui->lineEditCar1->text());
     settings.setValue(configStringSysCar2, ui->lineEditCar2->text());
     settings.setValue(configStringSysOther, ui->lineEditOther->text());
@@ -293,6 +295,7 @@ void ViewPcm::ActionLoadExperiment()
     }
 
     ui->lineEditResultFolder->setText(settings.value(configStringEnvResultFolder).toString());
+    ui->checkBoxSaveSnapshot->setChecked(settings.value(configStringEnvSaveSnapshot, false).toBool());
     ui->lineEditCar1->setText(settings.value(configStringSysCar1).toString());
     ui->lineEditCar2->setText(settings.value(configStringSysCar2).toString());
     ui->lineEditOther->setText(settings.value(configStringSysOther).toString());
@@ -363,7 +366,7 @@ void ViewPcm::on_buttonBrowsePcmFile_clicked()
     QDir const root = QDir(QCoreApplication::applicationDirPath());
     QString const filepath = QFileDialog::getOpenFileName(
                                  this, tr("openPASS / Read input data from a PCM file"), pcmFileParentFolder,
-                                 QStringLiteral("PCM File (*.mdb);;All files (*)"));
+                                 QStringLiteral("PCM File (*.mdb);;PCM Snapshot (*.pcmdata);;All files (*)"));
 
     if (!filepath.isNull())
     {
@@ -558,6 +561,11 @@ void ViewPcm::on_radioButton_RSValue_toggled(bool checked)
     }
 }
 
+void ViewPcm::on_checkBoxSaveSnapshot_toggled(bool checked)
+{
+    Q_EMIT SaveSnapshotChanged(checked);
+}
+
 void ViewPcm::on_spinBox_VarCount_valueChanged(int value)
 {
     Q_EMIT VariationCountChanged(value);
@@ -51,6 +51,7 @@ Q_SIGNALS:
     void PrevResultFolderChanged(const QString &prevResultFolder) const;
     void ResultFolderChanged(const QString &newResultFolder) const;
     void LogLevelChanged(const int level) const;
+    void SaveSnapshotChanged(const bool saveSnapshot) const;
     void OtherFileChanged(const QString &newResultFolder) const;
     void Car1FileChanged(const QString &newResultFolder) const;
     void Car2FileChanged(const QString &newResultFolder) const;
@@ -76,6 +77,7 @@ private:
     const QString configStringEnvPcmFile = "Environment/PCMFile";
     const QString configStringEnvInputFolder = "Environment/InputFolder";
     const QString configStringEnvResultFolder = "Environment/ResultFolder";
+    const QString configStringEnvSaveSnapshot = "Environment/SaveSnapshot";
     const QString configStringSysCar1 = "System/Car1";
     const QString configStringSysCar2 = "System/Car2";
     const QString configStringSysOther = "System/Other";
@@ -124,6 +126,7 @@ private Q_SLOTS:
     void on_buttonBrowsePrevResultFolder_clicked();
     void on_lineEditPrevResultFolder_textChanged(const QString &arg1);
     void on_comboBox_LogLevel_currentIndexChanged(int index);
+    void on_checkBoxSaveSnapshot_toggled(bool checked);
     void on_radioButton_RSCase_toggled(bool checked);
     void on_radioButton_RSValue_toggled(bool checked);
     void on_spinBox_VarCount_valueChanged(int value);
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/agentFactoryInterface.h"
+
+namespace SimulationSlave {
+
+class FakeAgentFactory : public AgentFactoryInterface
+{
+ public:
+  MOCK_METHOD0(ResetIds,
+      void());
+  MOCK_METHOD0(Clear,
+      void());
+  MOCK_METHOD1(SetRecycleAgents,
+      void(bool recycleAgents));
+  MOCK_METHOD0(ReleaseRecycledAgents,
+      void());
+  MOCK_METHOD1(SetComponentRandomStreams,
+      void(bool componentRandomStreams));
+  MOCK_METHOD2(AddAgent,
+      Agent *(AgentBlueprintInterface* agentBlueprint, int spawnTime));
+  MOCK_METHOD1(SetKeepBlueprints,
+      void(bool keepBlueprints));
+  MOCK_CONST_METHOD1(GetAgent,
+      Agent *(int id));
+  MOCK_CONST_METHOD1(GetAgentBlueprint,
+      std::shared_ptr<AgentBlueprintInterface>(int id));
+  MOCK_CONST_METHOD0(GetNextAgentId,
+      int());
+  MOCK_METHOD1(SetNextAgentId,
+      void(int id));
+  MOCK_METHOD3(RestoreAgent,
+      Agent *(int id, AgentBlueprintInterface* agentBlueprint, int spawnTime));
+};
+
+} // namespace SimulationSlave
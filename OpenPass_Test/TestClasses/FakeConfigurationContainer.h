@@ -0,0 +1,25 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/configurationContainerInterface.h"
+
+class FakeConfigurationContainer : public ConfigurationContainerInterface
+{
+ public:
+  MOCK_METHOD0(ImportAllConfigurations,
+      bool());
+  MOCK_METHOD0(GetSystemConfigBlueprint,
+      std::shared_ptr<SystemConfigInterface>());
+  MOCK_METHOD0(GetSlaveConfig,
+      SlaveConfigInterface*());
+  MOCK_METHOD0(GetProfiles,
+      ProfilesInterface*());
+  MOCK_METHOD0(GetScenery,
+      SceneryInterface*());
+  MOCK_METHOD0(GetScenario,
+      ScenarioInterface*());
+  MOCK_METHOD0(GetSystemConfigs,
+      std::map<std::string, std::shared_ptr<SystemConfigInterface>>&());
+  MOCK_METHOD0(GetVehicleModels,
+      VehicleModelsInterface*());
+};
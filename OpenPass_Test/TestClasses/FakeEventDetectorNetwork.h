@@ -0,0 +1,21 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/eventDetectorNetworkInterface.h"
+
+namespace SimulationSlave {
+
+class FakeEventDetectorNetwork : public EventDetectorNetworkInterface
+{
+ public:
+  MOCK_METHOD4(Instantiate,
+      bool(const std::string libraryPath, ScenarioInterface *scenario, EventNetworkInterface* eventNetwork, StochasticsInterface *stochastics));
+  MOCK_METHOD0(Clear,
+      void());
+  MOCK_METHOD0(GetEventDetectors,
+      std::vector<const EventDetector*>());
+  MOCK_METHOD0(ResetAll,
+      void());
+};
+
+} // namespace SimulationSlave
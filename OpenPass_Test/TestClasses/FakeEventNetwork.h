@@ -0,0 +1,43 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/eventNetworkInterface.h"
+
+namespace SimulationSlave {
+
+class FakeEventNetwork : public EventNetworkInterface
+{
+ public:
+  MOCK_METHOD0(GetActiveEvents,
+      Events *());
+  MOCK_METHOD0(GetArchivedEvents,
+      Events *());
+  MOCK_METHOD1(GetActiveEventCategory,
+      std::list<std::shared_ptr<EventInterface>> *(EventDefinitions::EventCategory eventCategory));
+  MOCK_METHOD2(GetActiveEventsForAgent,
+      const AgentEvents &(EventDefinitions::EventCategory eventCategory, int agentId));
+  MOCK_METHOD1(RemoveOldEvents,
+      void(int time));
+  MOCK_METHOD3(SetArchiveRetention,
+      void(int maxArchivedEvents, int archiveTimeWindow, const std::string &eventLogFile));
+  MOCK_METHOD2(StreamLoggedEvents,
+      void(EventDefinitions::EventCategory eventCategory, const std::function<void(std::shared_ptr<EventInterface>)> &handler));
+  MOCK_METHOD1(InsertEvent,
+      void(std::shared_ptr<EventInterface> event));
+  MOCK_METHOD0(ClearActiveEvents,
+      void());
+  MOCK_METHOD0(Clear,
+      void());
+  MOCK_METHOD0(SaveState,
+      EventNetworkState());
+  MOCK_METHOD1(RestoreState,
+      void(const EventNetworkState &state));
+  MOCK_METHOD1(Respawn,
+      void(int time));
+  MOCK_METHOD1(AddCollision,
+      void(const int agentId));
+  MOCK_METHOD3(Initialize,
+      void(RespawnInterface *respawner, RunResultInterface *runResult, ObservationInterface *observer));
+};
+
+} // namespace SimulationSlave
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/observationInterface.h"
+
+class FakeObservation : public ObservationInterface
+{
+ public:
+  MOCK_METHOD0(MasterPreHook,
+      void());
+  MOCK_METHOD1(MasterPostHook,
+      void(const std::string& filename));
+  MOCK_METHOD1(SlavePreHook,
+      void(const std::string& path));
+  MOCK_METHOD0(SlavePreRunHook,
+      void());
+  MOCK_METHOD2(SlaveUpdateHook,
+      void(int time, RunResultInterface& runResult));
+  MOCK_METHOD1(SlavePostRunHook,
+      void(const RunResultInterface& runResult));
+  MOCK_METHOD0(SlavePostHook,
+      void());
+  MOCK_METHOD0(SlaveResultFile,
+      const std::string());
+  MOCK_METHOD5(Insert,
+      void(int time, int agentId, LoggingGroup group, const std::string& key, const std::string& value));
+  MOCK_METHOD1(InsertEvent,
+      void(std::shared_ptr<EventInterface> event));
+  MOCK_METHOD0(GatherFollowers,
+      void());
+  MOCK_METHOD1(InformObserverOnSpawn,
+      void(AgentInterface* agent));
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/parameterInterface.h"
+
+class FakeParameter : public ParameterInterface
+{
+ public:
+  MOCK_METHOD2(AddParameterDouble,
+      bool(std::string name, double value));
+  MOCK_METHOD2(AddParameterInt,
+      bool(std::string name, int value));
+  MOCK_METHOD2(AddParameterBool,
+      bool(std::string name, bool value));
+  MOCK_METHOD2(AddParameterString,
+      bool(std::string name, const std::string& value));
+  MOCK_METHOD2(AddParameterStringVector,
+      bool(std::string name, const std::vector<std::string> value));
+  MOCK_METHOD2(AddParameterDoubleVector,
+      bool(std::string name, const std::vector<double> value));
+  MOCK_METHOD2(AddParameterIntVector,
+      bool(std::string name, const std::vector<int> value));
+  MOCK_METHOD2(AddParameterBoolVector,
+      bool(std::string name, const std::vector<bool> value));
+  MOCK_METHOD2(AddParameterNormalDistribution,
+      bool(std::string name, const StochasticDefintions::NormalDistributionParameter value));
+  MOCK_METHOD1(InitializeListItem,
+      ParameterInterface&(std::string key));
+  MOCK_CONST_METHOD0(GetParametersDouble,
+      const std::map<std::string, double>&());
+  MOCK_CONST_METHOD0(GetParametersInt,
+      const std::map<std::string, int>&());
+  MOCK_CONST_METHOD0(GetParametersBool,
+      const std::map<std::string, bool>&());
+  MOCK_CONST_METHOD0(GetParametersString,
+      const std::map<std::string, const std::string>&());
+  MOCK_CONST_METHOD0(GetParametersDoubleVector,
+      const std::map<std::string, const std::vector<double>>&());
+  MOCK_CONST_METHOD0(GetParametersIntVector,
+      const std::map<std::string, const std::vector<int>>&());
+  MOCK_CONST_METHOD0(GetParametersBoolVector,
+      const std::map<std::string, const std::vector<bool>>&());
+  MOCK_CONST_METHOD0(GetParametersStringVector,
+      const std::map<std::string, const std::vector<std::string>>&());
+  MOCK_CONST_METHOD0(GetParametersNormalDistribution,
+      const std::map<std::string, const StochasticDefintions::NormalDistributionParameter>&());
+  MOCK_CONST_METHOD0(GetParameterLists,
+      const std::map<std::string, ParameterLists>&());
+};
@@ -21,13 +21,15 @@ class FakeRoad : public RoadInterface {
   MOCK_METHOD1(AddRoadLaneSection,
       RoadLaneSectionInterface*(double start));
   MOCK_METHOD1(AddRoadSignal,
-      RoadSignalInterface*(const RoadSignalSpecification &signal));
+      void(const RoadSignalSpecification &signal));
   MOCK_METHOD1(AddRoadObject,
-      RoadObjectInterface*(const RoadObjectSpecification &object));
+      void(const RoadObjectSpecification &object));
   MOCK_CONST_METHOD0(GetId,
-      const std::string&());
+      const std::string());
   MOCK_METHOD0(GetElevations,
       std::list<RoadElevation*>&());
+  MOCK_CONST_METHOD0(GetLaneOffsets,
+      const std::list<RoadLaneOffset*>&());
   MOCK_METHOD0(GetLaneOffsets,
       std::list<RoadLaneOffset*>&());
   MOCK_METHOD0(GetGeometries,
@@ -35,7 +37,7 @@ class FakeRoad : public RoadInterface {
   MOCK_METHOD0(GetRoadLinks,
       std::list<RoadLinkInterface*>&());
   MOCK_METHOD0(GetLaneSections,
-      std::list<RoadLaneSectionInterface*>&());
+      std::vector<RoadLaneSectionInterface*>&());
   MOCK_METHOD0(GetRoadSignals,
       std::vector<RoadSignalInterface*>&());
   MOCK_METHOD0(GetRoadObjects,
@@ -46,8 +48,12 @@ class FakeRoad : public RoadInterface {
       bool());
   MOCK_METHOD1(AddRoadType,
        void(const RoadTypeSpecification &));
-  MOCK_METHOD1(GetRoadType,
+  MOCK_CONST_METHOD1(GetRoadType,
        RoadTypeInformation(double start));
+  MOCK_METHOD1(SetJunctionId,
+       void(const std::string& junctionId));
+  MOCK_METHOD0(GetJunctionId,
+       std::string());
 };
 
 
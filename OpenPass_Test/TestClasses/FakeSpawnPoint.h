@@ -0,0 +1,18 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/spawnPointInterface.h"
+
+class FakeSpawnPoint : public SpawnPointInterface
+{
+ public:
+  FakeSpawnPoint() : SpawnPointInterface(nullptr, nullptr, nullptr) {}
+  MOCK_METHOD1(GenerateAgent,
+      bool(AgentBlueprintInterface* agentBlueprint));
+  MOCK_CONST_METHOD0(SupportsCheckpoint,
+      bool());
+  MOCK_CONST_METHOD1(SaveState,
+      void(std::ostream &state));
+  MOCK_METHOD1(RestoreState,
+      void(std::istream &state));
+};
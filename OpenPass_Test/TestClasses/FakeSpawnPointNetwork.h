@@ -0,0 +1,19 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/spawnPointNetworkInterface.h"
+
+namespace SimulationSlave {
+
+class FakeSpawnPointNetwork : public SpawnPointNetworkInterface
+{
+ public:
+  MOCK_METHOD6(Instantiate,
+      bool(std::string libraryPath, AgentFactoryInterface *agentFactory, AgentBlueprintProviderInterface *agentBlueprintProvider, ParameterInterface *parameters, const SamplerInterface &sampler, ScenarioInterface *scenario));
+  MOCK_METHOD0(Clear,
+      void());
+  MOCK_METHOD0(GetSpawnPoint,
+      SpawnPoint*());
+};
+
+} // namespace SimulationSlave
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/stochasticsInterface.h"
+
+class FakeStochastics : public StochasticsInterface
+{
+ public:
+  MOCK_METHOD2(GetUniformDistributed,
+      double(double a, double b));
+  MOCK_METHOD2(GetBinomialDistributed,
+      int(int upperRangeNum, double probSuccess));
+  MOCK_METHOD2(GetNormalDistributed,
+      double(double mean, double stdDeviation));
+  MOCK_METHOD1(GetExponentialDistributed,
+      double(double lambda));
+  MOCK_METHOD2(GetGammaDistributed,
+      double(double mean, double stdDeviation));
+  MOCK_METHOD2(GetLogNormalDistributed,
+      double(double mean, double stdDeviation));
+  MOCK_METHOD2(GetSpecialDistributed,
+      double(std::string distributionName, std::vector<double> args));
+  MOCK_METHOD2(GetRandomCdfLogNormalDistributed,
+      double(double mean, double stdDeviation));
+  MOCK_METHOD3(GetPercentileLogNormalDistributed,
+      double(double mean, double stdDeviation, double probability));
+  MOCK_CONST_METHOD0(GetRandomSeed,
+      std::uint32_t());
+  MOCK_METHOD1(InitGenerator,
+      void(std::uint32_t seed));
+  MOCK_METHOD0(ReInit,
+      void());
+};
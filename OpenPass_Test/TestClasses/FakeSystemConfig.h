@@ -0,0 +1,17 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/systemConfigInterface.h"
+
+class FakeSystemConfig : public SystemConfigInterface
+{
+ public:
+  MOCK_METHOD0(GetSystems,
+      std::map<int, std::shared_ptr<SimulationSlave::AgentTypeInterface>>&());
+  MOCK_METHOD1(SetSystems,
+      void(std::map<int, std::shared_ptr<SimulationSlave::AgentTypeInterface>> systems));
+  MOCK_METHOD0(AddModelParameters,
+      ParameterInterface*());
+  MOCK_METHOD1(AddModelParameters,
+      void(std::shared_ptr<ParameterInterface> modelParameters));
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/vehicleModelsInterface.h"
+
+class FakeVehicleModels : public VehicleModelsInterface
+{
+ public:
+  MOCK_METHOD0(GetVehicleModelMap,
+      VehicleModelMap&());
+  MOCK_METHOD1(GetVehicleModel,
+      VehicleModelParameters(std::string vehicleModelType));
+};
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "Interfaces/worldInterface.h"
+
+class FakeWorld : public WorldInterface
+{
+ public:
+  MOCK_METHOD0(GetOsiGroundTruth,
+      void*());
+  MOCK_METHOD0(GetGlobalDrivingView,
+      void *());
+  MOCK_METHOD0(GetGlobalObjects,
+      void *());
+  MOCK_METHOD1(SetTimeOfDay,
+      void(int timeOfDay));
+  MOCK_METHOD1(SetWeekday,
+      void(Weekday weekday));
+  MOCK_METHOD0(GetWorldData,
+      void*());
+  MOCK_CONST_METHOD0(GetTimeOfDay,
+      std::string());
+  MOCK_CONST_METHOD0(GetWeekday,
+      Weekday());
+  MOCK_CONST_METHOD0(GetVisibilityDistance,
+      double());
+  MOCK_METHOD1(SetParameter,
+      void(WorldParameter *worldParameter));
+  MOCK_METHOD1(ExtractParameter,
+      void(ParameterInterface* parameters));
+  MOCK_METHOD0(Reset,
+      void());
+  MOCK_METHOD0(Clear,
+      void());
+  MOCK_METHOD0(CreateGlobalDrivingView,
+      bool());
+  MOCK_CONST_METHOD1(GetAgent,
+      AgentInterface *(int id));
+  MOCK_CONST_METHOD0(GetAgents,
+      const std::map<int, AgentInterface *> &());
+  MOCK_CONST_METHOD0(GetWorldObjects,
+      const std::vector<const WorldObjectInterface*>&());
+  MOCK_METHOD2(AddAgent,
+      bool(int id, AgentInterface *agent));
+  MOCK_METHOD2(QueueAgentUpdate,
+      void(std::function<void(double)> func, double val));
+  MOCK_METHOD1(QueueAgentUpdate,
+      void(std::function<void()> func));
+  MOCK_METHOD1(QueueAgentRemove,
+      void(const AgentInterface *agent));
+  MOCK_METHOD0(SyncGlobalData,
+      void());
+  MOCK_METHOD1(CreateScenery,
+      bool(SceneryInterface *scenery));
+  MOCK_METHOD0(CreateAgentAdapterForAgent,
+      AgentInterface *());
+  MOCK_METHOD0(GetSpecialAgent,
+      const AgentInterface *());
+  MOCK_METHOD1(GetLastCarInlane,
+      const AgentInterface *(int laneNumber));
+  MOCK_CONST_METHOD0(GetBicycle,
+      const AgentInterface *());
+  MOCK_CONST_METHOD4(GetPositionByDistanceAndLane,
+      Position(double distanceOnLane, double offset, std::string roadId, int laneId));
+  MOCK_METHOD1(CreateWorldScenery,
+      bool(const std::string &sceneryFilename));
+  MOCK_METHOD1(CreateWorldScenario,
+      bool(const std::string &scenarioFilename));
+  MOCK_CONST_METHOD3(GetNextAgentInLane,
+      AgentInterface*(std::string roadId, int laneId, double currentDistance));
+  MOCK_CONST_METHOD3(GetLastAgentInLane,
+      AgentInterface*(std::string roadId, int laneId, double currentDistance));
+  MOCK_CONST_METHOD3(GetClosestAgentInUpstream,
+      AgentInterface*(std::string roadId, int laneId, double initialSearchDistance));
+  MOCK_CONST_METHOD3(GetFarthestAgentInUpstream,
+      AgentInterface*(std::string roadId, int laneId, double initialSearchDistance));
+  MOCK_CONST_METHOD3(GetNextTrafficObjectInLane,
+      TrafficObjectInterface*(std::string roadId, int laneId, double currentDistance));
+  MOCK_CONST_METHOD3(GetLastTrafficObjectInLane,
+      TrafficObjectInterface*(std::string roadId, int laneId, double currentDistance));
+  MOCK_CONST_METHOD3(GetClosestTrafficObjectInUpstream,
+      TrafficObjectInterface*(std::string roadId, int laneId, double currentDistance));
+  MOCK_CONST_METHOD3(GetFarthestTrafficObjectInUpstream,
+      TrafficObjectInterface*(std::string roadId, int laneId, double currentDistance));
+  MOCK_CONST_METHOD3(GetNextObjectInLane,
+      WorldObjectInterface*(std::string roadId, int laneId, double currentDistance));
+  MOCK_CONST_METHOD4(GetNextObjectInLane,
+      WorldObjectInterface*(std::string roadId, int laneId, double currentDistance, double searchDistance));
+  MOCK_CONST_METHOD3(GetLastObjectInLane,
+      WorldObjectInterface*(std::string roadId, int laneId, double currentDistance));
+  MOCK_CONST_METHOD4(GetLastObjectInLane,
+      WorldObjectInterface*(std::string roadId, int laneId, double currentDistance, double searchDistance));
+  MOCK_CONST_METHOD3(GetClosestObjectInUpstream,
+      WorldObjectInterface*(std::string roadId, int laneId, double currentDistance));
+  MOCK_CONST_METHOD4(GetClosestObjectInUpstream,
+      WorldObjectInterface*(std::string roadId, int laneId, double currentDistance, double searchDistance));
+  MOCK_CONST_METHOD3(GetFarthestObjectInUpstream,
+      WorldObjectInterface*(std::string roadId, int laneId, double currentDistance));
+  MOCK_CONST_METHOD1(GetFirstObjectDownstream,
+      WorldObjectInterface*(uint64_t streamId));
+  MOCK_CONST_METHOD4(GetAgentsInRange,
+      std::vector<const AgentInterface*>(std::string roadId, int laneId, double startDistance, double endDistance));
+  MOCK_CONST_METHOD4(GetObjectsInRange,
+      std::vector<const WorldObjectInterface*>(std::string roadId, int laneId, double startDistance, double endDistance));
+  MOCK_METHOD2(GetDrivingLanesAtDistance,
+      std::vector<int>(std::string roadId, double distance));
+  MOCK_METHOD2(GetStopLanesAtDistance,
+      std::vector<int>(std::string roadId, double distance));
+  MOCK_METHOD2(GetExitLanesAtDistance,
+      std::vector<int>(std::string roadId, double distance));
+  MOCK_METHOD2(GetRampsAtDistance,
+      std::vector<int>(std::string roadId, double distance));
+  MOCK_METHOD4(GetNextValidSOnLane,
+      bool(std::string roadId, int laneId, double distance, double& next));
+  MOCK_METHOD4(GetLastValidSOnLane,
+      bool(std::string roadId, int laneId, double distance, double& last));
+  MOCK_METHOD3(IsSValidOnLane,
+      bool(std::string roadId, int laneId, double distance));
+  MOCK_METHOD3(ExistsLaneLeft,
+      bool(std::string roadId, int laneId, double distance));
+  MOCK_METHOD3(ExistsLaneRight,
+      bool(std::string roadId, int laneId, double distance));
+  MOCK_METHOD2(GetNumberOfLanes,
+      int(std::string roadId, double distance));
+  MOCK_CONST_METHOD3(GetLaneCurvature,
+      double(std::string roadId, int laneId, double distance));
+  MOCK_CONST_METHOD3(GetLaneWidth,
+      double(std::string roadId, int laneId, double distance));
+  MOCK_CONST_METHOD3(GetLaneDirection,
+      double(std::string roadId, int laneId, double distance));
+  MOCK_METHOD4(GetDistanceToEndOfLane,
+      double(std::string roadId, int laneNumber, double initialSearchDistance, double maxSearchLength));
+  MOCK_METHOD4(GetDistanceToEndOfDrivingLane,
+      double(std::string roadId, int laneNumber, double initialSearchDistance, double maxSearchLength));
+  MOCK_METHOD4(GetDistanceToEndOfDrivingOrStopLane,
+      double(std::string roadId, int laneNumber, double initialSearchDistance, double maxSearchLength));
+  MOCK_METHOD4(GetDistanceToEndOfRamp,
+      double(std::string roadId, int laneId, double initialSearchDistance, double maxSearchLength));
+  MOCK_METHOD4(GetDistanceToEndOfExit,
+      double(std::string roadId, int laneId, double initialSearchDistance, double maxSearchLength));
+  MOCK_METHOD6(IntersectsWithAgent,
+      bool(double x, double y, double rotation, double length, double width, double center));
+  MOCK_METHOD3(GetBoundingBoxAroundAgent,
+      polygon_t(AgentInterface* agent, double width, double length));
+  MOCK_CONST_METHOD2(RoadCoord2WorldCoord,
+      Position(RoadPosition roadCoord, std::string roadID));
+  MOCK_CONST_METHOD2(GetLateralDistance,
+      std::pair<bool, double>(GlobalRoadPosition src, GlobalRoadPosition dst));
+  MOCK_CONST_METHOD6(GetSurroundings,
+      AgentSurroundings(std::string roadId, int mainLaneId, int referenceLaneId, double frontDistance, double referenceDistance, double searchDistance));
+  MOCK_CONST_METHOD4(GetTrafficSignsInRange,
+      std::vector<CommonTrafficSign::Entity>(std::string roadId, int laneId, double startDistance, double searchRange));
+  MOCK_CONST_METHOD0(GetFriction,
+      double());
+  MOCK_CONST_METHOD3(QueryLane,
+      LaneQueryResult(std::string roadId, int laneId, double distance));
+  MOCK_CONST_METHOD3(QueryLanes,
+      std::list<LaneQueryResult>(std::string roadId, double startDistance, double endDistance));
+  MOCK_CONST_METHOD2(GetLaneId,
+      int(uint64_t streamId, double endDistance));
+  MOCK_METHOD0(GetEgoAgent,
+      AgentInterface*());
+  MOCK_CONST_METHOD0(GetRemovedAgents,
+      const std::list<const AgentInterface*>&());
+  MOCK_CONST_METHOD0(GetTrafficObjects,
+      const std::vector<const TrafficObjectInterface*>&());
+  MOCK_METHOD1(GetAgentByName,
+      AgentInterface*(std::string& scenarioName));
+  MOCK_METHOD1(GetAgentsByGroupType,
+      const std::list<AgentInterface*>&(AgentCategory& agentCategory));
+};
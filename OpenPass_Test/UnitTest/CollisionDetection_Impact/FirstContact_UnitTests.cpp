@@ -0,0 +1,293 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include "firstContact.h"
+#include "polygon.h"
+
+using Common::Vector2d;
+
+namespace {
+
+std::vector<Vector2d> CreateBox(double x, double y, double length, double width, double yaw = 0.0)
+{
+    const double cosYaw = std::cos(yaw);
+    const double sinYaw = std::sin(yaw);
+    const double halfLength = 0.5 * length;
+    const double halfWidth = 0.5 * width;
+
+    std::vector<Vector2d> corners;
+    for (const auto &corner : {Vector2d(-halfLength, halfWidth), Vector2d(-halfLength, -halfWidth),
+                               Vector2d(halfLength, -halfWidth), Vector2d(halfLength, halfWidth)})
+    {
+        corners.emplace_back(x + cosYaw * corner.x - sinYaw * corner.y,
+                             y + sinYaw * corner.x + cosYaw * corner.y);
+    }
+    return corners;
+}
+
+//! Overlap test of two rectangles by separating axes
+bool Overlap(const std::vector<Vector2d> &corners1, const std::vector<Vector2d> &corners2)
+{
+    for (const std::vector<Vector2d> *corners : {&corners1, &corners2})
+    {
+        for (size_t edge = 0; edge < 2; ++edge)
+        {
+            const Vector2d axis((*corners)[edge + 1].y - (*corners)[edge].y,
+                                -((*corners)[edge + 1].x - (*corners)[edge].x));
+            double min1 = std::numeric_limits<double>::infinity();
+            double max1 = -std::numeric_limits<double>::infinity();
+            for (const Vector2d &corner : corners1)
+            {
+                min1 = std::min(min1, axis.Dot(corner));
+                max1 = std::max(max1, axis.Dot(corner));
+            }
+            double min2 = std::numeric_limits<double>::infinity();
+            double max2 = -std::numeric_limits<double>::infinity();
+            for (const Vector2d &corner : corners2)
+            {
+                min2 = std::min(min2, axis.Dot(corner));
+                max2 = std::max(max2, axis.Dot(corner));
+            }
+            if (min2 >= max1 || max2 <= min1)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/*!
+ * Reference search of the former GetFirstContact: step back in 100 ms steps until the
+ * shifted rectangles do not overlap any more, then bisect to whole milliseconds.
+ *
+ * \return                              time of first contact [ms]
+ */
+int FindFirstContactByStepBackAndBisect(const std::vector<Vector2d> &corners1, const Vector2d &velocity1,
+                                        const std::vector<Vector2d> &corners2, const Vector2d &velocity2)
+{
+    auto intersected = [&](int time)
+    {
+        Polygon polygon1(corners1);
+        Polygon polygon2(corners2);
+        polygon1.Translate(velocity1 * (time / 1000.0));
+        polygon2.Translate(velocity2 * (time / 1000.0));
+        return Overlap(polygon1.GetVertices(), polygon2.GetVertices());
+    };
+
+    const int cycleTime = 100;
+    int timeFirstContact = 0;
+    int lastTimeNoContact = 0;
+
+    do
+    {
+        timeFirstContact = lastTimeNoContact;
+        lastTimeNoContact -= cycleTime;
+    } while (intersected(lastTimeNoContact));
+
+    while (std::abs(timeFirstContact - lastTimeNoContact) > 1)
+    {
+        const int nextTime = lastTimeNoContact - (lastTimeNoContact - timeFirstContact) / 2;
+        if (intersected(nextTime))
+        {
+            timeFirstContact = nextTime;
+        }
+        else
+        {
+            lastTimeNoContact = nextTime;
+        }
+    }
+
+    return timeFirstContact;
+}
+
+struct CollisionScenario
+{
+    std::vector<Vector2d> corners1;
+    Vector2d velocity1;
+    std::vector<Vector2d> corners2;
+    Vector2d velocity2;
+};
+
+} // namespace
+
+TEST(FirstContact, HeadOn_TouchesAtFrontFaces)
+{
+    const auto corners1 = CreateBox(0.0, 0.0, 4.0, 2.0);
+    const auto corners2 = CreateBox(3.5, 0.0, 4.0, 2.0);
+    Contact contact;
+
+    ASSERT_TRUE(CalculateFirstContact(corners1, {10.0, 0.0}, corners2, {-10.0, 0.0}, contact));
+
+    EXPECT_NEAR(contact.time, -0.025, 1e-9);
+    EXPECT_NEAR(contact.point.x, 1.75, 1e-9);
+    EXPECT_NEAR(contact.point.y, 0.0, 1e-9);
+    EXPECT_NEAR(contact.normal.x, 1.0, 1e-9);
+    EXPECT_NEAR(contact.normal.y, 0.0, 1e-9);
+}
+
+TEST(FirstContact, ObliqueVertex_TouchesAtVertex)
+{
+    // diamond with its left vertex at (1.8, 0.3) in the front face of the first box
+    const auto corners1 = CreateBox(0.0, 0.0, 4.0, 2.0);
+    const auto corners2 = CreateBox(2.8, 0.3, std::sqrt(2.0), std::sqrt(2.0), M_PI_4);
+    Contact contact;
+
+    ASSERT_TRUE(CalculateFirstContact(corners1, {0.0, 0.0}, corners2, {-10.0, -5.0}, contact));
+
+    EXPECT_NEAR(contact.time, -0.02, 1e-9);
+    EXPECT_NEAR(contact.point.x, 2.0, 1e-9);
+    EXPECT_NEAR(contact.point.y, 0.4, 1e-9);
+    EXPECT_NEAR(contact.normal.x, 1.0, 1e-9);
+    EXPECT_NEAR(contact.normal.y, 0.0, 1e-9);
+}
+
+TEST(FirstContact, ObliqueEdges_TouchesAtMiddleOfEdgeOverlap)
+{
+    const auto corners1 = CreateBox(0.0, 0.0, 4.0, 2.0);
+    const auto corners2 = CreateBox(3.5, 1.8, 4.0, 2.0);
+    Contact contact;
+
+    ASSERT_TRUE(CalculateFirstContact(corners1, {0.0, 0.0}, corners2, {-5.0, -10.0}, contact));
+
+    EXPECT_NEAR(contact.time, -0.02, 1e-9);
+    EXPECT_NEAR(contact.point.x, 1.8, 1e-9);
+    EXPECT_NEAR(contact.point.y, 1.0, 1e-9);
+    EXPECT_NEAR(contact.normal.x, 0.0, 1e-9);
+    EXPECT_NEAR(contact.normal.y, 1.0, 1e-9);
+}
+
+TEST(FirstContact, NormalPointsFromFirstToSecondAgent)
+{
+    const auto corners1 = CreateBox(3.5, 0.0, 4.0, 2.0);
+    const auto corners2 = CreateBox(0.0, 0.0, 4.0, 2.0);
+    Contact contact;
+
+    ASSERT_TRUE(CalculateFirstContact(corners1, {-10.0, 0.0}, corners2, {10.0, 0.0}, contact));
+
+    EXPECT_NEAR(contact.normal.x, -1.0, 1e-9);
+    EXPECT_NEAR(contact.normal.y, 0.0, 1e-9);
+}
+
+TEST(FirstContact, SeparatedBoxes_HaveNoContact)
+{
+    const auto corners1 = CreateBox(0.0, 0.0, 4.0, 2.0);
+    const auto corners2 = CreateBox(10.0, 0.0, 4.0, 2.0);
+    Contact contact;
+
+    EXPECT_FALSE(CalculateFirstContact(corners1, {10.0, 0.0}, corners2, {-10.0, 0.0}, contact));
+}
+
+TEST(FirstContact, BoxesPassingEachOther_HaveNoContact)
+{
+    const auto corners1 = CreateBox(0.0, 0.0, 4.0, 2.0);
+    const auto corners2 = CreateBox(0.0, 3.0, 4.0, 2.0, 0.3);
+    Contact contact;
+
+    EXPECT_FALSE(CalculateFirstContact(corners1, {10.0, 0.0}, corners2, {-10.0, 0.0}, contact));
+}
+
+TEST(FirstContact, OverlappingWithSameVelocity_HaveNoContact)
+{
+    const auto corners1 = CreateBox(0.0, 0.0, 4.0, 2.0);
+    const auto corners2 = CreateBox(3.5, 0.0, 4.0, 2.0);
+    Contact contact;
+
+    EXPECT_FALSE(CalculateFirstContact(corners1, {10.0, 0.0}, corners2, {10.0, 0.0}, contact));
+}
+
+TEST(FirstContact, PlaneOfHeadOnContact_IsFrontFaceOfFirstAgent)
+{
+    // overlapping by 0.1 m, closing with 20 m/s, so the first contact was 5 ms ago at x = 1.95 m
+    const auto corners1 = CreateBox(0.0, 0.0, 4.0, 2.0);
+    const auto corners2 = CreateBox(3.9, 0.0, 4.0, 2.0);
+    const Vector2d velocity1(10.0, 0.0);
+    Contact contact;
+    ASSERT_TRUE(CalculateFirstContact(corners1, velocity1, corners2, {-10.0, 0.0}, contact));
+
+    Vector2d pointOfImpact;
+    double phi;
+    CalculatePlaneOfFirstContact(contact, velocity1, pointOfImpact, phi);
+
+    // the contact point moved with the first agent onto its current front face
+    EXPECT_NEAR(pointOfImpact.x, 2.0, 1e-9);
+    EXPECT_NEAR(pointOfImpact.y, 0.0, 1e-9);
+    EXPECT_NEAR(phi, M_PI_2, 1e-9);
+}
+
+TEST(FirstContact, PlaneOfSideContact_IsParallelToDrivingDirection)
+{
+    // the second agent hits the left side of the standing first agent
+    const auto corners1 = CreateBox(0.0, 0.0, 4.0, 2.0);
+    const auto corners2 = CreateBox(0.5, 1.9, 1.0, 2.0);
+    Contact contact;
+    ASSERT_TRUE(CalculateFirstContact(corners1, {0.0, 0.0}, corners2, {0.0, -5.0}, contact));
+
+    Vector2d pointOfImpact;
+    double phi;
+    CalculatePlaneOfFirstContact(contact, {0.0, 0.0}, pointOfImpact, phi);
+
+    EXPECT_NEAR(pointOfImpact.x, 0.5, 1e-9);
+    EXPECT_NEAR(pointOfImpact.y, 1.0, 1e-9);
+    EXPECT_NEAR(phi, 0.0, 1e-9);
+}
+
+TEST(FirstContact, BoxesApartByRoundingNoise_HaveContactAtCurrentTime)
+{
+    // the world reports the collision, but the front faces are still apart by rounding noise
+    const auto corners1 = CreateBox(0.0, 0.0, 4.0, 2.0);
+    const auto corners2 = CreateBox(4.0 + 1e-12, 0.5, 4.0, 2.0);
+    Contact contact;
+
+    ASSERT_TRUE(CalculateFirstContact(corners1, {10.0, 0.0}, corners2, {0.0, 0.0}, contact));
+
+    EXPECT_DOUBLE_EQ(contact.time, 0.0);
+    EXPECT_NEAR(contact.point.x, 2.0, 1e-9);
+    EXPECT_NEAR(contact.point.y, 0.25, 1e-9);
+    EXPECT_NEAR(contact.normal.x, 1.0, 1e-9);
+    EXPECT_NEAR(contact.normal.y, 0.0, 1e-9);
+}
+
+TEST(FirstContact, AgreesWithStepBackAndBisectSearch)
+{
+    const std::vector<CollisionScenario> scenarios
+    {
+        // head-on
+        {CreateBox(0.0, 0.0, 4.5, 1.8), {15.0, 0.0}, CreateBox(4.2, 0.1, 4.8, 2.0, M_PI), {-12.0, 0.0}},
+        // oblique
+        {CreateBox(0.0, 0.0, 4.5, 1.8, 0.1), {15.0, 1.5}, CreateBox(3.2, 1.9, 4.8, 2.0, 1.2), {-2.0, -12.0}},
+        // slow rear-end
+        {CreateBox(0.0, 0.0, 4.5, 1.8), {8.0, 0.0}, CreateBox(4.4, 0.3, 4.5, 1.8), {7.0, 0.0}},
+    };
+
+    for (const CollisionScenario &scenario : scenarios)
+    {
+        Contact contact;
+        ASSERT_TRUE(CalculateFirstContact(scenario.corners1, scenario.velocity1,
+                                          scenario.corners2, scenario.velocity2, contact));
+
+        const int timeFirstContact = FindFirstContactByStepBackAndBisect(scenario.corners1, scenario.velocity1,
+                                                                         scenario.corners2, scenario.velocity2);
+
+        // the search only resolves whole milliseconds, its result is the first millisecond in contact
+        EXPECT_LE(contact.time * 1000.0, timeFirstContact);
+        EXPECT_GT(contact.time * 1000.0, timeFirstContact - 1);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,27 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  FirstContact_UnitTests.pro
+# \brief This file contains tests for the first contact of the CollisionDetection_Impact
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS/Common \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules_PCM/CollisionDetection_Impact
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/Common/vector2d.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules_PCM/CollisionDetection_Impact/firstContact.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules_PCM/CollisionDetection_Impact/polygon.cpp \
+    FirstContact_UnitTests.cpp
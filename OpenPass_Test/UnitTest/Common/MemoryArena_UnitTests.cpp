@@ -0,0 +1,169 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "memoryArena.h"
+
+using Common::MemoryArena;
+
+namespace {
+
+bool IsAligned(const void *memory, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(memory) % alignment == 0;
+}
+
+//! Counts its living instances
+struct Counted
+{
+    explicit Counted(int value) :
+        value(value)
+    {
+        ++instances;
+    }
+
+    ~Counted()
+    {
+        --instances;
+    }
+
+    int value;
+    static int instances;
+};
+
+int Counted::instances = 0;
+
+} // namespace
+
+TEST(MemoryArena, AllocationsWithAlignment_AreAligned)
+{
+    MemoryArena arena(256);
+
+    for (std::size_t alignment : {1, 2, 4, 8, 16, 32, 64})
+    {
+        // an odd allocation in between shifts the offset in the block
+        arena.Allocate(1, 1);
+        void *memory = arena.Allocate(3, alignment);
+
+        EXPECT_TRUE(IsAligned(memory, alignment)) << "alignment " << alignment;
+    }
+}
+
+TEST(MemoryArena, AllocationWithoutAlignment_IsAlignedForAllTypes)
+{
+    MemoryArena arena(256);
+
+    arena.Allocate(1);
+    void *memory = arena.Allocate(1);
+
+    EXPECT_TRUE(IsAligned(memory, alignof(std::max_align_t)));
+}
+
+TEST(MemoryArena, CreatedObject_IsAlignedForItsType)
+{
+    struct alignas(64) Aligned
+    {
+        char data[3];
+    };
+    MemoryArena arena(256);
+
+    arena.Allocate(1, 1);
+    Aligned *object = arena.Create<Aligned>();
+
+    EXPECT_TRUE(IsAligned(object, 64));
+}
+
+TEST(MemoryArena, FullBlock_RollsOverToNewBlock)
+{
+    MemoryArena arena(256);
+
+    char *first = static_cast<char *>(arena.Allocate(100, 1));
+    char *second = static_cast<char *>(arena.Allocate(100, 1));
+    EXPECT_EQ(second, first + 100);
+    EXPECT_EQ(arena.GetReservedBytes(), 256u);
+
+    char *third = static_cast<char *>(arena.Allocate(100, 1));
+
+    EXPECT_EQ(arena.GetReservedBytes(), 512u);
+    EXPECT_TRUE(third < first || third >= first + 256);
+    EXPECT_EQ(arena.GetAllocationCount(), 3u);
+    EXPECT_EQ(arena.GetAllocatedBytes(), 300u);
+}
+
+TEST(MemoryArena, OversizedAllocation_GetsOwnBlock)
+{
+    MemoryArena arena(256);
+
+    arena.Allocate(10, 1);
+    void *large = arena.Allocate(1000, 16);
+
+    EXPECT_TRUE(IsAligned(large, 16));
+    EXPECT_GE(arena.GetReservedBytes(), 256u + 1000u);
+    std::memset(large, 0xAB, 1000);
+
+    // the arena continues with blocks of the regular size
+    const std::size_t reservedBytes = arena.GetReservedBytes();
+    char *small = static_cast<char *>(arena.Allocate(10, 1));
+    EXPECT_TRUE(small < static_cast<char *>(large) || small >= static_cast<char *>(large) + 1000);
+    EXPECT_LE(arena.GetReservedBytes(), reservedBytes + 256u);
+}
+
+TEST(MemoryArena, Release_ReusesBlocksWithoutNewReservation)
+{
+    MemoryArena arena(256);
+    const std::vector<std::size_t> sizes {100, 100, 100, 1000, 50};
+
+    std::vector<void *> firstInvocation;
+    for (std::size_t size : sizes)
+    {
+        firstInvocation.push_back(arena.Allocate(size, 8));
+    }
+    const std::size_t reservedBytes = arena.GetReservedBytes();
+
+    arena.Release();
+
+    EXPECT_EQ(arena.GetAllocationCount(), 0u);
+    EXPECT_EQ(arena.GetAllocatedBytes(), 0u);
+
+    std::vector<void *> secondInvocation;
+    for (std::size_t size : sizes)
+    {
+        secondInvocation.push_back(arena.Allocate(size, 8));
+    }
+
+    EXPECT_EQ(secondInvocation, firstInvocation);
+    EXPECT_EQ(arena.GetReservedBytes(), reservedBytes);
+    EXPECT_EQ(arena.GetAllocationCount(), sizes.size());
+}
+
+TEST(MemoryArena, CreateAndDestroy_CallConstructorAndDestructor)
+{
+    MemoryArena arena;
+
+    Counted *object = arena.Create<Counted>(42);
+
+    EXPECT_EQ(object->value, 42);
+    EXPECT_EQ(Counted::instances, 1);
+
+    MemoryArena::Destroy(object);
+    MemoryArena::Destroy<Counted>(nullptr);
+
+    EXPECT_EQ(Counted::instances, 0);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,23 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  MemoryArena_UnitTests.pro
+# \brief This file contains tests for the memory arena of the Common library
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS/Common
+
+SOURCES += \
+    MemoryArena_UnitTests.cpp
@@ -0,0 +1,294 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include "trajectoryPath.h"
+
+using Common::TrajectoryPath;
+using Common::Vector2d;
+
+namespace {
+
+//! L-shaped trajectory: 3 m along x in 1 s, then 8 m along y in 3 s
+TrajectoryPath CreateLShape()
+{
+    return TrajectoryPath({{0.0, 0.0}, {3.0, 0.0}, {3.0, 4.0}, {3.0, 8.0}},
+                          {0.0, 1.0, 3.0, 4.0});
+}
+
+//! Straight trajectory along x with a halt of 2 s at x = 5 m
+TrajectoryPath CreateWithHalt()
+{
+    return TrajectoryPath({{0.0, 0.0}, {5.0, 0.0}, {5.0, 0.0}, {10.0, 0.0}},
+                          {0.0, 1.0, 3.0, 4.0});
+}
+
+size_t FindIndexLinear(const TrajectoryPath &path, double distance, size_t fromIndex)
+{
+    size_t index = fromIndex;
+    while (index + 1 < path.Size() && path.GetDistance(index) < distance)
+    {
+        ++index;
+    }
+    return index;
+}
+
+} // namespace
+
+TEST(TrajectoryPath, DifferentNumberOfPointsAndTimes_Throws)
+{
+    EXPECT_THROW(TrajectoryPath({{0.0, 0.0}, {1.0, 0.0}}, {0.0}), std::invalid_argument);
+}
+
+TEST(TrajectoryPath, Construction_PrecomputesGeometry)
+{
+    const TrajectoryPath path = CreateLShape();
+
+    ASSERT_EQ(path.Size(), 4u);
+    EXPECT_DOUBLE_EQ(path.GetLength(), 11.0);
+    EXPECT_DOUBLE_EQ(path.GetDistance(1), 3.0);
+    EXPECT_DOUBLE_EQ(path.GetDistance(2), 7.0);
+
+    EXPECT_DOUBLE_EQ(path.GetHeading(0), 0.0);
+    EXPECT_DOUBLE_EQ(path.GetHeading(1), M_PI_2);
+    EXPECT_DOUBLE_EQ(path.GetHeading(3), M_PI_2);
+
+    EXPECT_DOUBLE_EQ(path.GetCurvature(0), 0.0);
+    EXPECT_DOUBLE_EQ(path.GetCurvature(1), M_PI_2 / 3.5);
+    EXPECT_DOUBLE_EQ(path.GetCurvature(2), 0.0);
+    EXPECT_DOUBLE_EQ(path.GetCurvature(3), 0.0);
+}
+
+TEST(TrajectoryPath, FindIndexAtDistance_ReturnsFirstPointAtOrAfterDistance)
+{
+    const TrajectoryPath path = CreateLShape();
+
+    EXPECT_EQ(path.FindIndexAtDistance(0.0, 0), 0u);
+    EXPECT_EQ(path.FindIndexAtDistance(3.0, 0), 1u);
+    EXPECT_EQ(path.FindIndexAtDistance(3.5, 0), 2u);
+    EXPECT_EQ(path.FindIndexAtDistance(7.0, 1), 2u);
+    EXPECT_EQ(path.FindIndexAtDistance(10.0, 0), 3u);
+}
+
+TEST(TrajectoryPath, FindIndexAtDistance_DistanceBehindStartIndex_ReturnsStartIndex)
+{
+    const TrajectoryPath path = CreateLShape();
+
+    EXPECT_EQ(path.FindIndexAtDistance(1.0, 2), 2u);
+}
+
+TEST(TrajectoryPath, FindIndexAtDistance_DistanceBeyondEnd_ReturnsLastIndex)
+{
+    const TrajectoryPath path = CreateLShape();
+
+    EXPECT_EQ(path.FindIndexAtDistance(100.0, 0), 3u);
+    EXPECT_EQ(path.FindIndexAtDistance(100.0, 3), 3u);
+    EXPECT_EQ(TrajectoryPath().FindIndexAtDistance(1.0, 0), 0u);
+}
+
+TEST(TrajectoryPath, FindIndexAtDistance_MatchesLinearSearch)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> segmentLength(0.0, 2.0);
+
+    std::vector<Vector2d> points;
+    std::vector<double> times;
+    double x = 0.0;
+    for (int index = 0; index < 1000; ++index)
+    {
+        points.emplace_back(x, 0.0);
+        times.push_back(index);
+        x += segmentLength(generator);
+    }
+    const TrajectoryPath path(points, times);
+
+    std::uniform_real_distribution<double> distance(-1.0, path.GetLength() + 1.0);
+    std::uniform_int_distribution<size_t> fromIndex(0, path.Size() - 1);
+    for (int sample = 0; sample < 1000; ++sample)
+    {
+        const double s = distance(generator);
+        const size_t from = fromIndex(generator);
+        EXPECT_EQ(path.FindIndexAtDistance(s, from), FindIndexLinear(path, s, from)) << "s = " << s << ", from = " << from;
+    }
+}
+
+TEST(TrajectoryPath, AdvanceByDistance_InterpolatesWithinSegments)
+{
+    const TrajectoryPath path = CreateLShape();
+    TrajectoryPath::Cursor cursor(path);
+
+    cursor.AdvanceByDistance(1.5);
+    EXPECT_EQ(cursor.GetSegment(), 0u);
+    EXPECT_DOUBLE_EQ(cursor.GetFraction(), 0.5);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().x, 1.5);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().y, 0.0);
+    EXPECT_DOUBLE_EQ(cursor.GetTime(), 0.5);
+    EXPECT_DOUBLE_EQ(cursor.GetHeading(), 0.0);
+
+    cursor.AdvanceByDistance(3.0);
+    EXPECT_EQ(cursor.GetSegment(), 1u);
+    EXPECT_DOUBLE_EQ(cursor.GetDistance(), 4.5);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().x, 3.0);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().y, 1.5);
+    EXPECT_DOUBLE_EQ(cursor.GetTime(), 1.75);
+    EXPECT_DOUBLE_EQ(cursor.GetHeading(), M_PI_2);
+    EXPECT_FALSE(cursor.IsAtEnd());
+}
+
+TEST(TrajectoryPath, AdvanceByDistance_NonPositiveDistance_DoesNotMove)
+{
+    const TrajectoryPath path = CreateLShape();
+    TrajectoryPath::Cursor cursor(path);
+    cursor.AdvanceByDistance(2.0);
+
+    cursor.AdvanceByDistance(0.0);
+    cursor.AdvanceByDistance(-1.0);
+
+    EXPECT_DOUBLE_EQ(cursor.GetDistance(), 2.0);
+}
+
+TEST(TrajectoryPath, AdvanceByDistance_PastEnd_StopsAtLastPoint)
+{
+    const TrajectoryPath path = CreateLShape();
+    TrajectoryPath::Cursor cursor(path);
+
+    cursor.AdvanceByDistance(20.0);
+
+    EXPECT_TRUE(cursor.IsAtEnd());
+    EXPECT_EQ(cursor.GetSegment(), 2u);
+    EXPECT_DOUBLE_EQ(cursor.GetFraction(), 1.0);
+    EXPECT_DOUBLE_EQ(cursor.GetDistance(), 11.0);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().x, 3.0);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().y, 8.0);
+    EXPECT_DOUBLE_EQ(cursor.GetTime(), 4.0);
+
+    cursor.AdvanceByDistance(1.0);
+    EXPECT_TRUE(cursor.IsAtEnd());
+    EXPECT_DOUBLE_EQ(cursor.GetDistance(), 11.0);
+}
+
+TEST(TrajectoryPath, AdvanceByTime_InterpolatesWithinSegments)
+{
+    const TrajectoryPath path = CreateLShape();
+    TrajectoryPath::Cursor cursor(path);
+
+    cursor.AdvanceByTime(2.0);
+    EXPECT_EQ(cursor.GetSegment(), 1u);
+    EXPECT_DOUBLE_EQ(cursor.GetFraction(), 0.5);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().x, 3.0);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().y, 2.0);
+    EXPECT_DOUBLE_EQ(cursor.GetDistance(), 5.0);
+
+    cursor.AdvanceByTime(1.5);
+    EXPECT_EQ(cursor.GetSegment(), 2u);
+    EXPECT_DOUBLE_EQ(cursor.GetTime(), 3.5);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().y, 6.0);
+    EXPECT_FALSE(cursor.IsAtEnd());
+}
+
+TEST(TrajectoryPath, AdvanceByTime_PastEnd_StopsAtLastPoint)
+{
+    const TrajectoryPath path = CreateLShape();
+    TrajectoryPath::Cursor cursor(path);
+
+    cursor.AdvanceByTime(10.0);
+
+    EXPECT_TRUE(cursor.IsAtEnd());
+    EXPECT_DOUBLE_EQ(cursor.GetTime(), 4.0);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().y, 8.0);
+
+    cursor.AdvanceByTime(1.0);
+    EXPECT_TRUE(cursor.IsAtEnd());
+    EXPECT_DOUBLE_EQ(cursor.GetTime(), 4.0);
+}
+
+TEST(TrajectoryPath, AdvanceByTime_DuringHalt_KeepsPositionAndHeading)
+{
+    const TrajectoryPath path = CreateWithHalt();
+    TrajectoryPath::Cursor cursor(path);
+
+    cursor.AdvanceByTime(2.0);
+
+    EXPECT_EQ(cursor.GetSegment(), 1u);
+    EXPECT_DOUBLE_EQ(cursor.GetTime(), 2.0);
+    EXPECT_DOUBLE_EQ(cursor.GetDistance(), 5.0);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().x, 5.0);
+    EXPECT_DOUBLE_EQ(cursor.GetHeading(), 0.0);
+    EXPECT_FALSE(cursor.IsAtEnd());
+
+    cursor.AdvanceByTime(1.5);
+
+    EXPECT_EQ(cursor.GetSegment(), 2u);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().x, 7.5);
+}
+
+TEST(TrajectoryPath, AdvanceByDistance_OverHalt_SkipsTheHalt)
+{
+    const TrajectoryPath path = CreateWithHalt();
+    TrajectoryPath::Cursor cursor(path);
+
+    cursor.AdvanceByDistance(5.0);
+
+    EXPECT_EQ(cursor.GetSegment(), 2u);
+    EXPECT_DOUBLE_EQ(cursor.GetFraction(), 0.0);
+    EXPECT_DOUBLE_EQ(cursor.GetTime(), 3.0);
+
+    cursor.AdvanceByDistance(2.5);
+
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().x, 7.5);
+    EXPECT_DOUBLE_EQ(cursor.GetTime(), 3.5);
+}
+
+TEST(TrajectoryPath, Cursor_OnSinglePoint_IsAtEnd)
+{
+    const TrajectoryPath path({{1.0, 2.0}}, {0.5});
+    TrajectoryPath::Cursor cursor(path);
+
+    cursor.AdvanceByDistance(1.0);
+    cursor.AdvanceByTime(1.0);
+
+    EXPECT_TRUE(cursor.IsAtEnd());
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().x, 1.0);
+    EXPECT_DOUBLE_EQ(cursor.GetPosition().y, 2.0);
+    EXPECT_DOUBLE_EQ(cursor.GetTime(), 0.5);
+}
+
+TEST(TrajectoryPath, Cursor_RestoredFromSegmentAndFraction_ContinuesLikeTheOriginal)
+{
+    const TrajectoryPath path = CreateWithHalt();
+    TrajectoryPath::Cursor cursor(path);
+    cursor.AdvanceByTime(0.3);
+    cursor.AdvanceByTime(1.5);
+
+    TrajectoryPath::Cursor restoredCursor(path, cursor.GetSegment(), cursor.GetFraction());
+
+    EXPECT_EQ(restoredCursor.GetSegment(), cursor.GetSegment());
+    EXPECT_DOUBLE_EQ(restoredCursor.GetTime(), cursor.GetTime());
+    EXPECT_DOUBLE_EQ(restoredCursor.GetDistance(), cursor.GetDistance());
+
+    cursor.AdvanceByTime(1.5);
+    restoredCursor.AdvanceByTime(1.5);
+    cursor.AdvanceByDistance(1.0);
+    restoredCursor.AdvanceByDistance(1.0);
+
+    EXPECT_EQ(restoredCursor.GetSegment(), cursor.GetSegment());
+    EXPECT_EQ(restoredCursor.GetFraction(), cursor.GetFraction());
+    EXPECT_EQ(restoredCursor.GetPosition().x, cursor.GetPosition().x);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,25 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  TrajectoryPath_UnitTests.pro
+# \brief This file contains tests for the polyline trajectory of the Common library
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS/Common
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/Common/trajectoryPath.cpp \
+    ../../../OpenPass_Source_Code/openPASS/Common/vector2d.cpp \
+    TrajectoryPath_UnitTests.cpp
@@ -0,0 +1,292 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Common/accelerationSignal.h"
+#include "Common/compCtrlToAgentCompSignal.h"
+#include "Common/dynamicsSignal.h"
+#include "Common/lateralSignal.h"
+#include "Common/parametersVehicleSignal.h"
+#include "Common/steeringSignal.h"
+#include "Components/Algorithm_Lateral/algorithm_lateralImplementation.h"
+#include "Components/Dynamics_TrajectoryFollower/absoluteWorldCoordinateTrajectoryFollower.h"
+#include "Components/Sensor_Driver/Signals/sensorDriverSignal.h"
+
+#include "FakeAgent.h"
+#include "FakeObservation.h"
+#include "FakeParameter.h"
+#include "FakeTrajectory.h"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace {
+
+constexpr int cycleTime = 100;
+
+//! Saves the model with full precision, as the simulation does for checkpoints
+std::string SaveModel(const ModelInterface &model)
+{
+    std::ostringstream state;
+    state.precision(std::numeric_limits<double>::max_digits10);
+    model.SaveState(state);
+    return state.str();
+}
+
+void RestoreModel(ModelInterface &model, const std::string &savedState)
+{
+    std::istringstream state(savedState);
+    model.RestoreState(state);
+}
+
+std::shared_ptr<SignalInterface const> CreateSensorDriverSignal(double velocity, double steeringWheelAngle)
+{
+    OwnVehicleInformation ownVehicleInformation;
+    ownVehicleInformation.velocity = velocity;
+    ownVehicleInformation.steeringWheelAngle = steeringWheelAngle;
+
+    return std::make_shared<SensorDriverSignal const>(ownVehicleInformation,
+                                                      TrafficRuleInformation{},
+                                                      GeometryInformation{},
+                                                      SurroundingObjects{});
+}
+
+std::shared_ptr<SignalInterface const> CreateParametersVehicleSignal()
+{
+    VehicleModelParameters vehicleParameters;
+    vehicleParameters.steeringRatio = 15.0;
+    vehicleParameters.maximumSteeringWheelAngleAmplitude = 500.0;
+    vehicleParameters.wheelbase = 2.7;
+
+    return std::make_shared<ParametersVehicleSignal const>(vehicleParameters);
+}
+
+std::unique_ptr<AlgorithmLateralImplementation> CreateAlgorithmLateral()
+{
+    return std::make_unique<AlgorithmLateralImplementation>("AlgorithmLateral", false, 0, 0, 0, cycleTime,
+                                                            nullptr, nullptr, nullptr, nullptr, nullptr);
+}
+
+//! Runs one cycle in the order of the scheduler and returns the desired steering wheel angle
+double RunCycle(AlgorithmLateralImplementation &algorithm, int time, double velocity, double steeringWheelAngle)
+{
+    algorithm.UpdateInput(100, CreateParametersVehicleSignal(), time);
+    algorithm.UpdateInput(101, CreateSensorDriverSignal(velocity, steeringWheelAngle), time);
+    algorithm.Trigger(time);
+
+    std::shared_ptr<SignalInterface const> output;
+    algorithm.UpdateOutput(0, output, time);
+    return std::dynamic_pointer_cast<SteeringSignal const>(output)->steeringWheelAngle;
+}
+
+class TrajectoryFollowerCheckpointTest : public ::testing::Test
+{
+public:
+    TrajectoryFollowerCheckpointTest()
+    {
+        worldCoordinates = {{0, {0.0, 0.0, 0.0, 0.0}},
+                            {400, {4.0, 0.0, 0.0, 0.0}},
+                            {800, {10.0, 3.0, 0.5, 0.0}},
+                            {1200, {14.0, 8.0, 1.0, 0.0}}};
+        boolParameters = {{"EnforceTrajectory", false}, {"AutomaticDeactivation", true}};
+        observations = {{0, &fakeObservation}};
+
+        ON_CALL(fakeTrajectory, GetWorldCoordinates()).WillByDefault(Return(&worldCoordinates));
+        ON_CALL(fakeParameters, GetParametersBool()).WillByDefault(ReturnRef(boolParameters));
+        ON_CALL(fakeAgent, GetId()).WillByDefault(Return(0));
+    }
+
+    std::unique_ptr<AbsoluteWorldCoordinateTrajectoryFollower> CreateTrajectoryFollower()
+    {
+        return std::make_unique<AbsoluteWorldCoordinateTrajectoryFollower>("TrajectoryFollower", false, 0, 0, 0, cycleTime,
+                                                                           nullptr, nullptr, &fakeParameters, &observations,
+                                                                           nullptr, &fakeAgent, &fakeTrajectory);
+    }
+
+    std::map<int, Position> worldCoordinates;
+    std::map<std::string, bool> boolParameters;
+    std::map<int, ObservationInterface*> observations;
+
+    NiceMock<FakeTrajectory> fakeTrajectory;
+    NiceMock<FakeParameter> fakeParameters;
+    NiceMock<FakeObservation> fakeObservation;
+    NiceMock<FakeAgent> fakeAgent;
+};
+
+//! Activates and triggers the follower like the ComponentController does every cycle and returns its dynamics output
+std::shared_ptr<DynamicsSignal const> RunCycle(AbsoluteWorldCoordinateTrajectoryFollower &follower, int time)
+{
+    const std::map<std::string, std::pair<ComponentType, ComponentState>> vehicleComponentStates;
+    follower.UpdateInput(83, std::make_shared<CompCtrlToAgentCompSignal const>(ComponentState::Acting, vehicleComponentStates), time);
+    follower.Trigger(time);
+
+    std::shared_ptr<SignalInterface const> output;
+    follower.UpdateOutput(0, output, time);
+    return std::dynamic_pointer_cast<DynamicsSignal const>(output);
+}
+
+void ExpectSameDynamics(const DynamicsSignal &restored, const DynamicsSignal &original)
+{
+    EXPECT_EQ(restored.componentState, original.componentState);
+    EXPECT_EQ(restored.positionX, original.positionX);
+    EXPECT_EQ(restored.positionY, original.positionY);
+    EXPECT_EQ(restored.yaw, original.yaw);
+    EXPECT_EQ(restored.yawRate, original.yawRate);
+    EXPECT_EQ(restored.velocity, original.velocity);
+    EXPECT_EQ(restored.acceleration, original.acceleration);
+    EXPECT_EQ(restored.travelDistance, original.travelDistance);
+}
+
+} // namespace
+
+TEST(AlgorithmLateral, RestoreState_ContinuesWithSameSteeringWheelAngles)
+{
+    auto algorithm = CreateAlgorithmLateral();
+
+    // The lateral signal is only sent once, so the controller has to hold it across the checkpoint
+    algorithm->UpdateInput(0, std::make_shared<LateralSignal const>(3.5, 0.4, 0.5, 0.02, 7.5, 0.001, ComponentState::Acting), 0);
+
+    int time = 0;
+    double steeringWheelAngle = 0.0;
+    for (; time < 300; time += cycleTime)
+    {
+        steeringWheelAngle = RunCycle(*algorithm, time, 20.0, steeringWheelAngle);
+    }
+
+    const std::string savedState = SaveModel(*algorithm);
+    auto restoredAlgorithm = CreateAlgorithmLateral();
+    RestoreModel(*restoredAlgorithm, savedState);
+
+    for (; time < 1000; time += cycleTime)
+    {
+        const double originalAngle = RunCycle(*algorithm, time, 20.0, steeringWheelAngle);
+        const double restoredAngle = RunCycle(*restoredAlgorithm, time, 20.0, steeringWheelAngle);
+
+        EXPECT_EQ(restoredAngle, originalAngle);
+        steeringWheelAngle = originalAngle;
+    }
+}
+
+TEST_F(TrajectoryFollowerCheckpointTest, RestoreState_ContinuesAlongSameTrajectory)
+{
+    auto follower = CreateTrajectoryFollower();
+
+    int time = 0;
+    for (; time < 500; time += cycleTime)
+    {
+        RunCycle(*follower, time);
+    }
+
+    const std::string savedState = SaveModel(*follower);
+    auto restoredFollower = CreateTrajectoryFollower();
+    RestoreModel(*restoredFollower, savedState);
+
+    // runs past the end of the trajectory, so the follower has to stay deactivated although it is still requested to act
+    std::shared_ptr<DynamicsSignal const> original;
+    for (; time < 1600; time += cycleTime)
+    {
+        original = RunCycle(*follower, time);
+        const auto restored = RunCycle(*restoredFollower, time);
+
+        ExpectSameDynamics(*restored, *original);
+    }
+
+    EXPECT_EQ(original->componentState, ComponentState::Disabled);
+}
+
+TEST_F(TrajectoryFollowerCheckpointTest, RestoreState_ContinuesWithAccelerationInput)
+{
+    auto follower = CreateTrajectoryFollower();
+    const auto braking = std::make_shared<AccelerationSignal const>(ComponentState::Acting, -2.0);
+
+    int time = 0;
+    for (; time < 500; time += cycleTime)
+    {
+        follower->UpdateInput(1, braking, time);
+        RunCycle(*follower, time);
+    }
+
+    const std::string savedState = SaveModel(*follower);
+    auto restoredFollower = CreateTrajectoryFollower();
+    RestoreModel(*restoredFollower, savedState);
+
+    for (; time < 1600; time += cycleTime)
+    {
+        follower->UpdateInput(1, braking, time);
+        restoredFollower->UpdateInput(1, braking, time);
+
+        const auto original = RunCycle(*follower, time);
+        const auto restored = RunCycle(*restoredFollower, time);
+
+        ExpectSameDynamics(*restored, *original);
+    }
+}
+
+TEST(AlgorithmLateral, Reset_ContinuesLikeNewComponent)
+{
+    auto algorithm = CreateAlgorithmLateral();
+    algorithm->UpdateInput(0, std::make_shared<LateralSignal const>(3.5, 0.4, 0.5, 0.02, 7.5, 0.001, ComponentState::Acting), 0);
+
+    double steeringWheelAngle = 0.0;
+    for (int time = 0; time < 300; time += cycleTime)
+    {
+        steeringWheelAngle = RunCycle(*algorithm, time, 20.0, steeringWheelAngle);
+    }
+
+    algorithm->Reset(nullptr);
+    auto newAlgorithm = CreateAlgorithmLateral();
+
+    for (int time = 0; time < 1000; time += cycleTime)
+    {
+        const double newAngle = RunCycle(*newAlgorithm, time, 20.0, steeringWheelAngle);
+        const double resetAngle = RunCycle(*algorithm, time, 20.0, steeringWheelAngle);
+
+        EXPECT_EQ(resetAngle, newAngle);
+        steeringWheelAngle = newAngle;
+    }
+}
+
+TEST_F(TrajectoryFollowerCheckpointTest, Reset_FollowsTrajectoryFromStartLikeNewComponent)
+{
+    auto follower = CreateTrajectoryFollower();
+
+    // runs past the end of the trajectory, so the follower is deactivated before the reset
+    for (int time = 0; time < 1600; time += cycleTime)
+    {
+        RunCycle(*follower, time);
+    }
+
+    follower->Reset(&fakeAgent);
+    auto newFollower = CreateTrajectoryFollower();
+
+    for (int time = 0; time < 1600; time += cycleTime)
+    {
+        const auto expected = RunCycle(*newFollower, time);
+        const auto reset = RunCycle(*follower, time);
+
+        ExpectSameDynamics(*reset, *expected);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
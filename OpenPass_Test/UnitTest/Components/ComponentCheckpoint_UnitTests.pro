@@ -0,0 +1,33 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  ComponentCheckpoint_UnitTests.pro
+# \brief This file contains tests that restored components continue like the saved ones and reset components like new ones
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+COMPONENTS_DIR = ../../../OpenPass_Source_Code/openPASS/Components
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS \
+            ../../../OpenPass_Source_Code/openPASS/Common \
+            ../../../OpenPass_Source_Code/openPASS/Interfaces \
+            ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/Common/trajectoryPath.cpp \
+    ../../../OpenPass_Source_Code/openPASS/Common/vector2d.cpp \
+    $$COMPONENTS_DIR/Algorithm_Lateral/algorithm_lateralImplementation.cpp \
+    $$COMPONENTS_DIR/Dynamics_TrajectoryFollower/trajectoryFollowerCommonBase.cpp \
+    $$COMPONENTS_DIR/Dynamics_TrajectoryFollower/absoluteWorldCoordinateTrajectoryFollower.cpp \
+    ComponentCheckpoint_UnitTests.cpp
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <fstream>
+#include <list>
+#include <map>
+#include <memory>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "eventNetwork.h"
+#include "observationCyclics.h"
+#include "observationFileHandler.h"
+#include "runResult.h"
+#include "runStatistic.h"
+
+#include "FakeWorld.h"
+
+using ::testing::NiceMock;
+using ::testing::ReturnRef;
+
+using namespace EventDefinitions;
+using SimulationSlave::EventNetwork;
+
+namespace {
+
+//! Inserts agent based and collision events in alternating order and archives all but the last one
+void InsertEvents(EventNetwork &eventNetwork)
+{
+    eventNetwork.InsertEvent(std::make_shared<AgentBasedEvent>(100, "Test", "", EventType::AEBActive, 1));
+    eventNetwork.InsertEvent(std::make_shared<CollisionEvent>(100, "Test", "", EventType::Collision, true, 1, 2));
+    eventNetwork.InsertEvent(std::make_shared<AgentBasedEvent>(200, "Test", "", EventType::AEBInactive, 1));
+    eventNetwork.InsertEvent(std::make_shared<CollisionEvent>(200, "Test", "", EventType::Collision, true, 1, 3));
+    eventNetwork.ClearActiveEvents();
+
+    eventNetwork.InsertEvent(std::make_shared<AgentBasedEvent>(300, "Test", "", EventType::AEBActive, 2));
+}
+
+//! Writes a single run with the events of the event network and returns the ids of the events in the output file
+std::vector<int> WriteEventIds(EventNetwork &eventNetwork)
+{
+    const std::string outputDir = ::testing::TempDir();
+    const std::map<int, AgentInterface *> agents;
+    const std::list<const AgentInterface *> removedAgents;
+    NiceMock<FakeWorld> world;
+    ON_CALL(world, GetAgents()).WillByDefault(ReturnRef(agents));
+    ON_CALL(world, GetRemovedAgents()).WillByDefault(ReturnRef(removedAgents));
+
+    SimulationSlave::RunResult runResult;
+    ObservationCyclics cyclics;
+    ObservationFileHandler fileHandler;
+    fileHandler.SetOutputDir(outputDir);
+    fileHandler.WriteStartOfFile();
+    fileHandler.WriteRun(runResult, RunStatistic(0), cyclics, &world, &eventNetwork);
+    fileHandler.WriteEndOfFile();
+
+    std::vector<int> ids;
+    std::ifstream outputFile(outputDir + "/simulationOutput.xml");
+    const std::regex eventId("<Event Id=\"(\\d+)\"");
+    std::smatch match;
+    for (std::string line; std::getline(outputFile, line);)
+    {
+        if (std::regex_search(line, match, eventId))
+        {
+            ids.push_back(std::stoi(match[1]));
+        }
+    }
+    return ids;
+}
+
+} // namespace
+
+TEST(ObservationLog, WithoutArchiveRetention_WritesArchivedEventsPerCategoryBeforeActiveEvents)
+{
+    EventNetwork eventNetwork;
+    InsertEvents(eventNetwork);
+
+    EXPECT_EQ(WriteEventIds(eventNetwork), (std::vector<int>{0, 2, 1, 3, 4}));
+}
+
+TEST(ObservationLog, EventsMovedToEventLog_AreWrittenInOrderOfEventsKeptInMemory)
+{
+    EventNetwork eventNetwork;
+    // the events 0, 1 and 2 exceed the retention policy, event 3 stays in memory
+    eventNetwork.SetArchiveRetention(1, -1, ::testing::TempDir() + "ObservationLog_UnitTests_events.log");
+    InsertEvents(eventNetwork);
+
+    EXPECT_EQ(WriteEventIds(eventNetwork), (std::vector<int>{0, 2, 1, 3, 4}));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,34 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  ObservationLog_UnitTests.pro
+# \brief This file contains tests for the output file of the Observation_Log
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS \
+            ../../../OpenPass_Source_Code/openPASS/Common \
+            ../../../OpenPass_Source_Code/openPASS/Interfaces \
+            ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare \
+            ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/framework \
+            ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/scheduler \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules/Observation_Log
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/framework/eventNetwork.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/scheduler/runResult.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/Observation_Log/observationCyclics.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/Observation_Log/observationFileHandler.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/Observation_Log/runStatistic.cpp \
+    ObservationLog_UnitTests.cpp
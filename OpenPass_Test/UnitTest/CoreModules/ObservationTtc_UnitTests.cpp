@@ -0,0 +1,200 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "observation_ttc_implementation.h"
+#include "runResult.h"
+
+#include "FakeAgent.h"
+#include "FakeParameter.h"
+#include "FakeWorld.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace {
+
+//! Agent of length 5 m with the reference point at the rear edge
+struct TtcAgent
+{
+    int id;
+    std::string roadId;
+    int laneId;
+    double rear;            //!< distance of the rear edge to the start of the road
+    double velocity;
+    double positionX;       //!< global position of the reference point
+};
+
+//! World with the agents of the test, the observer reads its result file from the temp directory
+class ObservationTtcFixture
+{
+public:
+    ObservationTtcFixture() :
+        resultFolder(::testing::TempDir()),
+        stringParameters{{"0", resultFolder}, {"1", "simulationTtc.tmp"}, {"2", "simulationTtc.csv"}}
+    {
+        std::remove((resultFolder + "/simulationTtc.csv").c_str());
+
+        ON_CALL(parameters, GetParametersString()).WillByDefault(ReturnRef(stringParameters));
+        ON_CALL(world, GetAgents()).WillByDefault(ReturnRef(agentMap));
+    }
+
+    ~ObservationTtcFixture()
+    {
+        std::remove((resultFolder + "/simulationTtc.csv").c_str());
+    }
+
+    NiceMock<FakeAgent> &AddAgent(const TtcAgent &ttcAgent)
+    {
+        agents.emplace_back();
+        NiceMock<FakeAgent> &agent = agents.back();
+
+        ON_CALL(agent, GetAgentId()).WillByDefault(Return(ttcAgent.id));
+        ON_CALL(agent, IsAgentInWorld()).WillByDefault(Return(true));
+        ON_CALL(agent, GetRoadId(_)).WillByDefault(Return(ttcAgent.roadId));
+        ON_CALL(agent, GetMainLaneId(_)).WillByDefault(Return(ttcAgent.laneId));
+        ON_CALL(agent, GetDistanceToStartOfRoad(MeasurementPoint::Rear)).WillByDefault(Return(ttcAgent.rear));
+        ON_CALL(agent, GetDistanceToStartOfRoad(MeasurementPoint::Front)).WillByDefault(Return(ttcAgent.rear + 5.0));
+        ON_CALL(agent, GetVelocityX()).WillByDefault(Return(ttcAgent.velocity));
+        ON_CALL(agent, GetCollisionPartners()).WillByDefault(Return(std::vector<std::pair<ObjectTypeOSI, int>>{}));
+        ON_CALL(agent, GetPositionX()).WillByDefault(Return(ttcAgent.positionX));
+        ON_CALL(agent, GetPositionY()).WillByDefault(Return(0.0));
+        ON_CALL(agent, GetLength()).WillByDefault(Return(5.0));
+        ON_CALL(agent, GetDistanceReferencePointToLeadingEdge()).WillByDefault(Return(5.0));
+        ON_CALL(agent, GetObjectInFront(_, _)).WillByDefault(Return(nullptr));
+
+        agentMap[ttcAgent.id] = &agent;
+        return agent;
+    }
+
+    //! Runs the observer over the given time steps and returns the lines of the result file
+    std::vector<std::string> Observe(const std::vector<int> &times, const std::function<void(int)> &beforeTimeStep)
+    {
+        Observation_Ttc_Implementation observation(nullptr, &world, &parameters, nullptr);
+        SimulationSlave::RunResult runResult;
+
+        observation.SlavePreHook(resultFolder);
+        observation.SlavePreRunHook();
+        for (int time : times)
+        {
+            beforeTimeStep(time);
+            observation.SlaveUpdateHook(time, runResult);
+        }
+        observation.SlavePostRunHook(runResult);
+
+        std::vector<std::string> lines;
+        std::ifstream resultFile(resultFolder + "/simulationTtc.csv");
+        for (std::string line; std::getline(resultFile, line);)
+        {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    std::string resultFolder;
+    std::map<std::string, const std::string> stringParameters;
+    NiceMock<FakeParameter> parameters;
+    NiceMock<FakeWorld> world;
+    std::list<NiceMock<FakeAgent>> agents;
+    std::map<int, AgentInterface *> agentMap;
+};
+
+} // namespace
+
+TEST(ObservationTtc, AgentsOnTwoLanesAndNextRoad_WritesTtcToAgentInFront)
+{
+    ObservationTtcFixture fixture;
+
+    // road A (0 m to 100 m) with the lanes -1 and -2, road B succeeds road A
+    // lane -1: agent 1 behind agent 2, agent 3 on road B in front of agent 2
+    fixture.AddAgent({1, "A", -1, 5.0, 20.0, 5.0});
+    auto &agent2 = fixture.AddAgent({2, "A", -1, 25.0, 10.0, 25.0});
+    auto &agent3 = fixture.AddAgent({3, "B", -1, 3.0, 5.0, 103.0});
+    // lane -2: the ids are not in the order of the lane, agent 5 is behind agent 4
+    fixture.AddAgent({4, "A", -2, 45.0, 10.0, 45.0});
+    fixture.AddAgent({5, "A", -2, 15.0, 15.0, 15.0});
+    // lane 1 is driven against s: agent 6 is behind agent 7 and faster
+    fixture.AddAgent({6, "A", 1, 70.0, 20.0, 70.0});
+    fixture.AddAgent({7, "A", 1, 40.0, 10.0, 40.0});
+
+    // agent 3 enters the world in the second time step
+    ON_CALL(agent2, GetObjectInFront(_, _)).WillByDefault(Return(&agent3));
+    const auto lines = fixture.Observe({0, 100}, [&agent3](int time)
+    {
+        ON_CALL(agent3, IsAgentInWorld()).WillByDefault(Return(time > 0));
+    });
+
+    // agent 1: gap 25 m - 10 m, closing with 10 m/s
+    // agent 2: no agent in front at 0 ms, then gap 103 m - 25 m - 5 m, closing with 5 m/s
+    // agent 3 and 4 lead their lanes, so they have no ttc and no column
+    // agent 5: gap 45 m - 20 m, closing with 5 m/s
+    // agent 6: gap 70 m - 45 m, closing with 10 m/s
+    // agent 7 leads lane 1
+    const std::vector<std::string> expectedLines
+    {
+        "RunID;AgentID;minimal TTC;0;100;",
+        "0;1;1.5;1.5;1.5;",
+        ";2;14.6;;14.6;",
+        ";5;5;5;5;",
+        ";6;2.5;2.5;2.5;",
+        ""
+    };
+    EXPECT_EQ(lines, expectedLines);
+}
+
+TEST(ObservationTtc, FrontAgentOnSameRoad_IsNotSearchedOnNextRoad)
+{
+    ObservationTtcFixture fixture;
+
+    // the lane stream finds agent 2 in front of agent 1, but it is on the same road and another lane
+    auto &agent1 = fixture.AddAgent({1, "A", -1, 5.0, 20.0, 5.0});
+    auto &agent2 = fixture.AddAgent({2, "A", -2, 25.0, 10.0, 25.0});
+    ON_CALL(agent1, GetObjectInFront(_, _)).WillByDefault(Return(&agent2));
+
+    const auto lines = fixture.Observe({0}, [](int) {});
+
+    const std::vector<std::string> expectedLines
+    {
+        "RunID;AgentID;minimal TTC;0;",
+        "0"
+    };
+    EXPECT_EQ(lines, expectedLines);
+}
+
+TEST(ObservationTtc, GapDoesNotClose_WritesInfiniteTtc)
+{
+    ObservationTtcFixture fixture;
+
+    fixture.AddAgent({1, "A", -1, 5.0, 10.0, 5.0});
+    fixture.AddAgent({2, "A", -1, 25.0, 20.0, 25.0});
+
+    const auto lines = fixture.Observe({0}, [](int) {});
+
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_EQ(lines[1], "0;1;inf;inf;");
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,30 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  ObservationTtc_UnitTests.pro
+# \brief This file contains tests for the result file of the Observation_Ttc
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS \
+            ../../../OpenPass_Source_Code/openPASS/Common \
+            ../../../OpenPass_Source_Code/openPASS/Interfaces \
+            ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare \
+            ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/scheduler \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules/Observation_Ttc
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/scheduler/runResult.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/Observation_Ttc/observation_ttc_implementation.cpp \
+    ObservationTtc_UnitTests.cpp
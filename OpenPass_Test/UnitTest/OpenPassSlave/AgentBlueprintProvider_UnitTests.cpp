@@ -0,0 +1,270 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "FakeConfigurationContainer.h"
+#include "FakeStochastics.h"
+#include "FakeSystemConfig.h"
+#include "FakeVehicleModels.h"
+
+#include "agentBlueprint.h"
+#include "agentBlueprintProvider.h"
+#include "agentType.h"
+#include "profiles.h"
+#include "sampler.h"
+#include "scenario.h"
+#include "slaveConfig.h"
+#include "CoreModules/Stochastics/stochastics_implementation.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+using ::testing::StrictMock;
+
+namespace {
+
+constexpr std::uint32_t seed = 42;
+
+//! Configuration of static agent profiles only, so that every common agent
+//! draws exactly one value: the name of its agent profile
+class StaticAgentConfiguration
+{
+public:
+    StaticAgentConfiguration()
+    {
+        for (const std::string agentProfileName : {"Car", "Truck", "Van", "Bus"})
+        {
+            AgentProfile agentProfile;
+            agentProfile.type = AgentProfileType::Static;
+            agentProfile.systemConfigFile = "systemConfig.xml";
+            agentProfile.systemId = 0;
+            agentProfile.vehicleModel = agentProfileName + "Model";
+            profiles.GetAgentProfiles().emplace(agentProfileName, agentProfile);
+        }
+
+        slaveConfig.GetTrafficConfig().regularLaneAgents = {{"Car", 0.4}, {"Truck", 0.2}, {"Van", 0.2}, {"Bus", 0.2}};
+        slaveConfig.GetTrafficConfig().rightMostLaneAgents = {{"Car", 0.1}, {"Truck", 0.6}, {"Van", 0.3}};
+
+        ScenarioEntity egoEntity;
+        egoEntity.catalogReference.entryName = "Car";
+        scenario.SetEgoEntity(egoEntity);
+        scenario.AddScenarioGroupsByEntityNames({{"ScenarioAgents", {}}});
+
+        systems.emplace(0, std::make_shared<SimulationSlave::AgentType>());
+        systemConfigs.emplace("systemConfig.xml", systemConfig);
+
+        ON_CALL(*systemConfig, GetSystems()).WillByDefault(ReturnRef(systems));
+        ON_CALL(vehicleModels, GetVehicleModel(_)).WillByDefault(Return(VehicleModelParameters{}));
+
+        ON_CALL(configurationContainer, GetProfiles()).WillByDefault(Return(&profiles));
+        ON_CALL(configurationContainer, GetSlaveConfig()).WillByDefault(Return(&slaveConfig));
+        ON_CALL(configurationContainer, GetScenario()).WillByDefault(Return(&scenario));
+        ON_CALL(configurationContainer, GetVehicleModels()).WillByDefault(Return(&vehicleModels));
+        ON_CALL(configurationContainer, GetSystemConfigs()).WillByDefault(ReturnRef(systemConfigs));
+    }
+
+    Profiles profiles;
+    Configuration::SlaveConfig slaveConfig;
+    Configuration::Scenario scenario;
+    std::map<int, std::shared_ptr<SimulationSlave::AgentTypeInterface>> systems;
+    std::shared_ptr<NiceMock<FakeSystemConfig>> systemConfig {std::make_shared<NiceMock<FakeSystemConfig>>()};
+    std::map<std::string, std::shared_ptr<SystemConfigInterface>> systemConfigs;
+    NiceMock<FakeVehicleModels> vehicleModels;
+    NiceMock<FakeConfigurationContainer> configurationContainer;
+};
+
+//! Samples a common agent for each lane category in the given order and
+//! returns the agent profile names separately for each lane category
+std::map<LaneCategory, std::vector<std::string>> SampleCommonAgents(AgentBlueprintProvider& agentBlueprintProvider,
+                                                                    const std::vector<LaneCategory>& laneCategories)
+{
+    std::map<LaneCategory, std::vector<std::string>> agentProfileNames;
+
+    for (const auto laneCategory : laneCategories)
+    {
+        AgentBlueprint agentBlueprint;
+        agentBlueprint.SetAgentCategory(AgentCategory::Common);
+        EXPECT_TRUE(agentBlueprintProvider.SampleAgent(agentBlueprint, laneCategory, 0));
+        agentProfileNames[laneCategory].push_back(agentBlueprint.GetAgentProfileName());
+    }
+
+    return agentProfileNames;
+}
+
+//! Two common agents on a regular lane, then one on the right most lane
+std::vector<LaneCategory> InterleavedLaneCategories(size_t numberOfAgents)
+{
+    std::vector<LaneCategory> laneCategories;
+    for (size_t i = 0; i < numberOfAgents; ++i)
+    {
+        laneCategories.push_back(i % 3 == 2 ? LaneCategory::RightMostLane : LaneCategory::RegularLane);
+    }
+    return laneCategories;
+}
+
+} // namespace
+
+TEST(AgentBlueprintProvider_SampleAgent, NthCommonAgent_DoesNotDependOnBlockSize)
+{
+    const auto laneCategories = InterleavedLaneCategories(100);
+    std::map<size_t, std::map<LaneCategory, std::vector<std::string>>> agentProfileNamesByBlockSize;
+
+    for (const size_t blockSize : {1, 7, 32})
+    {
+        StaticAgentConfiguration configuration;
+        StochasticsImplementation stochastics(nullptr);
+        StochasticsImplementation commonAgentStochastics(nullptr);
+        stochastics.InitGenerator(seed);
+        commonAgentStochastics.InitGenerator(seed);
+        const Sampler sampler(stochastics);
+
+        AgentBlueprintProvider agentBlueprintProvider(&configuration.configurationContainer, sampler,
+                                                      commonAgentStochastics, blockSize);
+        agentProfileNamesByBlockSize[blockSize] = SampleCommonAgents(agentBlueprintProvider, laneCategories);
+    }
+
+    const auto& expectedAgentProfileNames = agentProfileNamesByBlockSize.at(1);
+    EXPECT_THAT(agentProfileNamesByBlockSize.at(7), expectedAgentProfileNames);
+    EXPECT_THAT(agentProfileNamesByBlockSize.at(32), expectedAgentProfileNames);
+
+    const auto& regularLaneAgents = expectedAgentProfileNames.at(LaneCategory::RegularLane);
+    EXPECT_GT(std::set<std::string>(regularLaneAgents.cbegin(), regularLaneAgents.cend()).size(), 1);
+}
+
+TEST(AgentBlueprintProvider_SampleAgent, NthCommonAgent_DoesNotDependOnOtherLaneCategory)
+{
+    std::vector<LaneCategory> laneCategoriesInBlocks(60, LaneCategory::RegularLane);
+    laneCategoriesInBlocks.insert(laneCategoriesInBlocks.end(), 30, LaneCategory::RightMostLane);
+
+    std::vector<std::map<LaneCategory, std::vector<std::string>>> agentProfileNames;
+
+    for (const auto& laneCategories : {InterleavedLaneCategories(90), laneCategoriesInBlocks})
+    {
+        StaticAgentConfiguration configuration;
+        StochasticsImplementation stochastics(nullptr);
+        StochasticsImplementation commonAgentStochastics(nullptr);
+        stochastics.InitGenerator(seed);
+        commonAgentStochastics.InitGenerator(seed);
+        const Sampler sampler(stochastics);
+
+        AgentBlueprintProvider agentBlueprintProvider(&configuration.configurationContainer, sampler,
+                                                      commonAgentStochastics, 7);
+        agentProfileNames.push_back(SampleCommonAgents(agentBlueprintProvider, laneCategories));
+    }
+
+    EXPECT_THAT(agentProfileNames.at(1), agentProfileNames.at(0));
+}
+
+TEST(AgentBlueprintProvider_SampleAgent, EachInvocation_IsReproducibleAfterResetAndReInit)
+{
+    const auto laneCategories = InterleavedLaneCategories(20);
+    std::vector<std::map<LaneCategory, std::vector<std::string>>> secondInvocations;
+
+    // the first invocation spawns a different number of agents, leaving a different number of them presampled
+    for (const size_t numberOfAgentsInFirstInvocation : {3, 20})
+    {
+        StaticAgentConfiguration configuration;
+        StochasticsImplementation stochastics(nullptr);
+        StochasticsImplementation commonAgentStochastics(nullptr);
+        stochastics.InitGenerator(seed);
+        commonAgentStochastics.InitGenerator(seed);
+        const Sampler sampler(stochastics);
+
+        AgentBlueprintProvider agentBlueprintProvider(&configuration.configurationContainer, sampler,
+                                                      commonAgentStochastics, 8);
+        const auto firstInvocation = SampleCommonAgents(agentBlueprintProvider,
+                                     InterleavedLaneCategories(numberOfAgentsInFirstInvocation));
+
+        stochastics.ReInit();
+        commonAgentStochastics.ReInit();
+        agentBlueprintProvider.Reset();
+
+        secondInvocations.push_back(SampleCommonAgents(agentBlueprintProvider, laneCategories));
+    }
+
+    EXPECT_THAT(secondInvocations.at(1), secondInvocations.at(0));
+
+    StaticAgentConfiguration configuration;
+    StochasticsImplementation stochastics(nullptr);
+    StochasticsImplementation commonAgentStochastics(nullptr);
+    stochastics.InitGenerator(seed);
+    commonAgentStochastics.InitGenerator(seed);
+    const Sampler sampler(stochastics);
+
+    AgentBlueprintProvider agentBlueprintProvider(&configuration.configurationContainer, sampler,
+                                                  commonAgentStochastics, 8);
+    const auto firstInvocation = SampleCommonAgents(agentBlueprintProvider, laneCategories);
+
+    EXPECT_THAT(secondInvocations.at(0), ::testing::Ne(firstInvocation));
+}
+
+TEST(AgentBlueprintProvider_SampleAgent, CommonAgents_DoNotDrawFromMainStochastics)
+{
+    StaticAgentConfiguration configuration;
+    StrictMock<FakeStochastics> stochastics;
+    StochasticsImplementation commonAgentStochastics(nullptr);
+    commonAgentStochastics.InitGenerator(seed);
+    const Sampler sampler(stochastics);
+
+    AgentBlueprintProvider agentBlueprintProvider(&configuration.configurationContainer, sampler,
+                                                  commonAgentStochastics, 32);
+
+    AgentBlueprint egoBlueprint;
+    egoBlueprint.SetAgentCategory(AgentCategory::Ego);
+    EXPECT_TRUE(agentBlueprintProvider.SampleAgent(egoBlueprint, LaneCategory::RegularLane, 0));
+
+    SampleCommonAgents(agentBlueprintProvider, InterleavedLaneCategories(100));
+}
+
+TEST(AgentBlueprintProvider_SampleAgent, StaticAgentProfile_IsResolvedOnceAndShared)
+{
+    StaticAgentConfiguration configuration;
+    configuration.slaveConfig.GetTrafficConfig().regularLaneAgents = {{"Car", 1.0}};
+
+    EXPECT_CALL(*configuration.systemConfig, GetSystems()).Times(1);
+    EXPECT_CALL(configuration.vehicleModels, GetVehicleModel("CarModel")).Times(1);
+
+    StochasticsImplementation stochastics(nullptr);
+    StochasticsImplementation commonAgentStochastics(nullptr);
+    stochastics.InitGenerator(seed);
+    commonAgentStochastics.InitGenerator(seed);
+    const Sampler sampler(stochastics);
+
+    AgentBlueprintProvider agentBlueprintProvider(&configuration.configurationContainer, sampler,
+                                                  commonAgentStochastics, 32);
+
+    AgentBlueprint egoBlueprint;
+    egoBlueprint.SetAgentCategory(AgentCategory::Ego);
+    ASSERT_TRUE(agentBlueprintProvider.SampleAgent(egoBlueprint, LaneCategory::RegularLane, 0));
+    EXPECT_EQ(&egoBlueprint.GetAgentType(), configuration.systems.at(0).get());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        AgentBlueprint agentBlueprint;
+        ASSERT_TRUE(agentBlueprintProvider.SampleAgent(agentBlueprint, LaneCategory::RegularLane, 0));
+        EXPECT_EQ(agentBlueprint.GetAgentProfileName(), "Car");
+        EXPECT_EQ(&agentBlueprint.GetAgentType(), configuration.systems.at(0).get());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
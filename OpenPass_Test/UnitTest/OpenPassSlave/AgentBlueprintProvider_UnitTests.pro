@@ -0,0 +1,52 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  AgentBlueprintProvider_UnitTests.pro
+# \brief This file contains tests for presampling the common agents in the AgentBlueprintProvider
+#-----------------------------------------------------------------------------/
+
+QT += xml
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+SLAVE_DIR = ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS \
+            ../../../OpenPass_Source_Code/openPASS/Common \
+            ../../../OpenPass_Source_Code/openPASS/Interfaces \
+            ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare \
+            $$SLAVE_DIR/framework \
+            $$SLAVE_DIR/importer \
+            $$SLAVE_DIR/modelElements \
+            $$SLAVE_DIR/modelInterface \
+            $$SLAVE_DIR/observationInterface \
+            $$SLAVE_DIR/spawnPointInterface \
+            $$SLAVE_DIR/eventDetectorInterface
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare/log.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare/parameters.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/Stochastics/stochastics_implementation.cpp \
+    $$SLAVE_DIR/framework/agentBlueprintProvider.cpp \
+    $$SLAVE_DIR/framework/agentProfileSampler.cpp \
+    $$SLAVE_DIR/framework/dynamicAgentTypeGenerator.cpp \
+    $$SLAVE_DIR/framework/dynamicParametersSampler.cpp \
+    $$SLAVE_DIR/framework/dynamicProfileSampler.cpp \
+    $$SLAVE_DIR/framework/sampler.cpp \
+    $$SLAVE_DIR/importer/profiles.cpp \
+    $$SLAVE_DIR/importer/scenario.cpp \
+    $$SLAVE_DIR/importer/slaveConfig.cpp \
+    $$SLAVE_DIR/modelElements/agentBlueprint.cpp \
+    $$SLAVE_DIR/modelElements/agentType.cpp \
+    $$SLAVE_DIR/modelElements/componentType.cpp \
+    AgentBlueprintProvider_UnitTests.cpp
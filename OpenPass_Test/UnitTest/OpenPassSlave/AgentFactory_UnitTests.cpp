@@ -0,0 +1,213 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <list>
+#include <memory>
+
+#include "agent.h"
+#include "agentBlueprint.h"
+#include "agentFactory.h"
+#include "agentType.h"
+
+#include "FakeAgent.h"
+#include "FakeComponent.h"
+#include "FakeWorld.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using namespace SimulationSlave;
+
+namespace {
+
+//! Agent factory without model binding, the agents get their components added by the test
+class AgentFactoryWithFakeWorld
+{
+public:
+    AgentFactoryWithFakeWorld() :
+        agentFactory(nullptr, &world, nullptr, nullptr, nullptr)
+    {
+        ON_CALL(world, CreateAgentAdapterForAgent()).WillByDefault(Invoke([this]
+        {
+            adapters.emplace_back();
+            ON_CALL(adapters.back(), InitAgentParameter(_, _, _)).WillByDefault(Return(true));
+            return &adapters.back();
+        }));
+        ON_CALL(world, AddAgent(_, _)).WillByDefault(Return(true));
+    }
+
+    ~AgentFactoryWithFakeWorld()
+    {
+        agentFactory.SetRecycleAgents(false);
+        agentFactory.Clear();
+    }
+
+    //! Adds an agent of the given agent type, which gets one component
+    Agent *AddAgentWithComponent(const std::shared_ptr<AgentType> &agentType,
+                                 NiceMock<FakeComponent> *component)
+    {
+        blueprints.emplace_back();
+        blueprints.back().SetAgentType(agentType);
+
+        Agent *agent = agentFactory.AddAgent(&blueprints.back(), 0);
+        if (agent && agent->GetComponents().empty())
+        {
+            ON_CALL(*component, ReleaseFromLibrary()).WillByDefault(Return(true));
+            agent->AddComponent("component", component);
+        }
+        else
+        {
+            delete component;
+        }
+        return agent;
+    }
+
+    std::list<NiceMock<FakeAgent>> adapters;
+    std::list<AgentBlueprint> blueprints;
+    NiceMock<FakeWorld> world;
+    AgentFactory agentFactory;
+};
+
+//! Component of an agent which can be reused
+NiceMock<FakeComponent> *CreateResettableComponent()
+{
+    auto component = new NiceMock<FakeComponent>();
+    ON_CALL(*component, SupportsReset()).WillByDefault(Return(true));
+    return component;
+}
+
+} // namespace
+
+TEST(AgentFactory, ClearWithoutRecycling_DeletesAgents)
+{
+    AgentFactoryWithFakeWorld fixture;
+    const auto agentType = std::make_shared<AgentType>();
+    auto component = CreateResettableComponent();
+    fixture.AddAgentWithComponent(agentType, component);
+
+    EXPECT_CALL(*component, ReleaseFromLibrary()).WillOnce(Return(true));
+    EXPECT_CALL(*component, Reset(_)).Times(0);
+
+    fixture.agentFactory.Clear();
+
+    EXPECT_EQ(fixture.agentFactory.GetAgent(0), nullptr);
+}
+
+TEST(AgentFactory, ClearWithRecycling_KeepsAgentWhichSupportsReset)
+{
+    AgentFactoryWithFakeWorld fixture;
+    fixture.agentFactory.SetRecycleAgents(true);
+    const auto agentType = std::make_shared<AgentType>();
+    auto component = CreateResettableComponent();
+    fixture.AddAgentWithComponent(agentType, component);
+
+    EXPECT_CALL(*component, ReleaseFromLibrary()).Times(0);
+
+    fixture.agentFactory.Clear();
+
+    EXPECT_EQ(fixture.agentFactory.GetAgent(0), nullptr);
+    ::testing::Mock::VerifyAndClearExpectations(component);
+}
+
+TEST(AgentFactory, ClearWithRecycling_DeletesAgentWhichDoesNotSupportReset)
+{
+    AgentFactoryWithFakeWorld fixture;
+    fixture.agentFactory.SetRecycleAgents(true);
+    const auto agentType = std::make_shared<AgentType>();
+    auto component = new NiceMock<FakeComponent>();
+    ON_CALL(*component, SupportsReset()).WillByDefault(Return(false));
+    fixture.AddAgentWithComponent(agentType, component);
+
+    EXPECT_CALL(*component, ReleaseFromLibrary()).WillOnce(Return(true));
+
+    fixture.agentFactory.Clear();
+}
+
+TEST(AgentFactory, AddAgentOfSameAgentTypeAfterClear_ReusesKeptAgent)
+{
+    AgentFactoryWithFakeWorld fixture;
+    fixture.agentFactory.SetRecycleAgents(true);
+    const auto agentType = std::make_shared<AgentType>();
+    auto component = CreateResettableComponent();
+    Agent *keptAgent = fixture.AddAgentWithComponent(agentType, component);
+    fixture.agentFactory.Clear();
+    fixture.agentFactory.ResetIds();
+
+    AgentInterface *resetAdapter = nullptr;
+    EXPECT_CALL(*component, Reset(_)).WillOnce(Invoke([&resetAdapter](AgentInterface *agent)
+    {
+        resetAdapter = agent;
+    }));
+    EXPECT_CALL(*component, ReleaseFromLibrary()).Times(0);
+
+    Agent *reusedAgent = fixture.AddAgentWithComponent(agentType, CreateResettableComponent());
+
+    ASSERT_EQ(reusedAgent, keptAgent);
+    EXPECT_EQ(reusedAgent->GetId(), 0);
+    EXPECT_EQ(fixture.agentFactory.GetAgent(0), reusedAgent);
+    EXPECT_EQ(resetAdapter, &fixture.adapters.back());
+    EXPECT_EQ(reusedAgent->GetAgentAdapter(), &fixture.adapters.back());
+
+    ::testing::Mock::VerifyAndClearExpectations(component);
+}
+
+TEST(AgentFactory, AddAgentOfOtherAgentTypeWithEqualContent_DoesNotReuseKeptAgent)
+{
+    AgentFactoryWithFakeWorld fixture;
+    fixture.agentFactory.SetRecycleAgents(true);
+    const auto agentType = std::make_shared<AgentType>();
+    const auto otherAgentType = std::make_shared<AgentType>();
+    auto component = CreateResettableComponent();
+    fixture.AddAgentWithComponent(agentType, component);
+    fixture.agentFactory.Clear();
+
+    EXPECT_CALL(*component, Reset(_)).Times(0);
+
+    auto otherComponent = CreateResettableComponent();
+    Agent *otherAgent = fixture.AddAgentWithComponent(otherAgentType, otherComponent);
+
+    ASSERT_NE(otherAgent, nullptr);
+    EXPECT_EQ(otherAgent->GetComponents().at("component"), otherComponent);
+
+    // the kept agent was not reused by this invocation, so it is deleted by the next Clear()
+    EXPECT_CALL(*component, ReleaseFromLibrary()).WillOnce(Return(true));
+    fixture.agentFactory.Clear();
+}
+
+TEST(AgentFactory, ReleaseRecycledAgents_DeletesKeptAgents)
+{
+    AgentFactoryWithFakeWorld fixture;
+    fixture.agentFactory.SetRecycleAgents(true);
+    const auto agentType = std::make_shared<AgentType>();
+    auto component = CreateResettableComponent();
+    fixture.AddAgentWithComponent(agentType, component);
+    fixture.agentFactory.Clear();
+
+    EXPECT_CALL(*component, ReleaseFromLibrary()).WillOnce(Return(true));
+
+    fixture.agentFactory.ReleaseRecycledAgents();
+
+    auto newComponent = CreateResettableComponent();
+    Agent *agent = fixture.AddAgentWithComponent(agentType, newComponent);
+
+    ASSERT_NE(agent, nullptr);
+    EXPECT_EQ(agent->GetComponents().at("component"), newComponent);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
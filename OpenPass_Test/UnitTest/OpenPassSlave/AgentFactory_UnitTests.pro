@@ -0,0 +1,48 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  AgentFactory_UnitTests.pro
+# \brief This file contains tests for keeping, reusing and releasing agents in the AgentFactory
+#-----------------------------------------------------------------------------/
+
+QT += xml
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+SLAVE_DIR = ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS \
+            ../../../OpenPass_Source_Code/openPASS/Common \
+            ../../../OpenPass_Source_Code/openPASS/Interfaces \
+            ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare \
+            $$SLAVE_DIR/framework \
+            $$SLAVE_DIR/importer \
+            $$SLAVE_DIR/modelElements \
+            $$SLAVE_DIR/modelInterface \
+            $$SLAVE_DIR/observationInterface \
+            $$SLAVE_DIR/spawnPointInterface \
+            $$SLAVE_DIR/eventDetectorInterface
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/Common/vector2d.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare/log.cpp \
+    $$SLAVE_DIR/framework/agentFactory.cpp \
+    $$SLAVE_DIR/framework/libraryCache.cpp \
+    $$SLAVE_DIR/modelElements/agent.cpp \
+    $$SLAVE_DIR/modelElements/agentBlueprint.cpp \
+    $$SLAVE_DIR/modelElements/agentType.cpp \
+    $$SLAVE_DIR/modelElements/channel.cpp \
+    $$SLAVE_DIR/modelElements/component.cpp \
+    $$SLAVE_DIR/modelInterface/modelBinding.cpp \
+    $$SLAVE_DIR/modelInterface/modelLibrary.cpp \
+    AgentFactory_UnitTests.cpp
@@ -0,0 +1,267 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <istream>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "agent.h"
+#include "agentBlueprint.h"
+#include "checkpoint.h"
+#include "runResult.h"
+#include "spawnControl.h"
+#include "spawnPoint.h"
+
+#include "FakeAgent.h"
+#include "FakeAgentFactory.h"
+#include "FakeComponent.h"
+#include "FakeEventDetectorNetwork.h"
+#include "FakeEventNetwork.h"
+#include "FakeSpawnPoint.h"
+#include "FakeSpawnPointNetwork.h"
+#include "FakeWorld.h"
+
+using ::testing::_;
+using ::testing::Field;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+using namespace SimulationSlave;
+
+namespace {
+
+//! Returns the remaining content of a stream
+std::string ReadAll(std::istream &state)
+{
+    return std::string(std::istreambuf_iterator<char>(state), std::istreambuf_iterator<char>());
+}
+
+//! Action writing a fixed text into the stream passed to SaveState()
+auto WriteState(const std::string &text)
+{
+    return Invoke([text](std::ostream &state) { state << text; });
+}
+
+//! Spawn control with a single spawn point backed by a fake implementation
+class SpawnControlWithFakeSpawnPoint
+{
+public:
+    SpawnControlWithFakeSpawnPoint() :
+        library("", nullptr),
+        spawnPoint(nullptr, &spawnPointImplementation, &library)
+    {
+        ON_CALL(spawnPointNetwork, GetSpawnPoint()).WillByDefault(Return(&spawnPoint));
+        spawnControl = std::make_unique<SpawnControl>(&spawnPointNetwork, &world, 100);
+    }
+
+    NiceMock<FakeSpawnPoint> spawnPointImplementation;
+    NiceMock<FakeSpawnPointNetwork> spawnPointNetwork;
+    NiceMock<FakeWorld> world;
+    SpawnPointLibrary library;
+    SpawnPoint spawnPoint;
+    std::unique_ptr<SpawnControl> spawnControl;
+};
+
+} // namespace
+
+TEST(SpawnControl, SupportsCheckpoint_DependsOnSpawnPointImplementation)
+{
+    SpawnControlWithFakeSpawnPoint fixture;
+
+    ON_CALL(fixture.spawnPointImplementation, SupportsCheckpoint()).WillByDefault(Return(false));
+    EXPECT_FALSE(fixture.spawnControl->SupportsCheckpoint());
+
+    ON_CALL(fixture.spawnPointImplementation, SupportsCheckpoint()).WillByDefault(Return(true));
+    EXPECT_TRUE(fixture.spawnControl->SupportsCheckpoint());
+}
+
+TEST(SpawnControl, SaveState_ContainsStateOfSpawnPointImplementation)
+{
+    SpawnControlWithFakeSpawnPoint fixture;
+    EXPECT_CALL(fixture.spawnPointImplementation, SaveState(_)).WillOnce(WriteState("spawn point state"));
+
+    const auto checkpoints = fixture.spawnControl->SaveState();
+
+    ASSERT_EQ(checkpoints.size(), 1u);
+    EXPECT_EQ(checkpoints.front().implementationState, "spawn point state");
+    EXPECT_EQ(checkpoints.front().agentBlueprint, nullptr);
+    EXPECT_EQ(checkpoints.front().nextSpawnTime, 0);
+    EXPECT_EQ(checkpoints.front().holdbackTime, 0);
+}
+
+TEST(SpawnControl, RestoreState_PassesStateToSpawnPointImplementation)
+{
+    SpawnControlWithFakeSpawnPoint fixture;
+    std::string restoredState;
+    EXPECT_CALL(fixture.spawnPointImplementation, RestoreState(_))
+            .WillOnce(Invoke([&restoredState](std::istream &state) { restoredState = ReadAll(state); }));
+
+    fixture.spawnControl->RestoreState({{nullptr, 300, 200, "spawn point state"}});
+
+    EXPECT_EQ(restoredState, "spawn point state");
+}
+
+TEST(SpawnControl, RestoreState_RestoresPendingBlueprintAndSpawnTimes)
+{
+    SpawnControlWithFakeSpawnPoint fixture;
+    auto agentBlueprint = std::make_shared<AgentBlueprint>();
+    agentBlueprint->SetAgentProfileName("PendingProfile");
+
+    fixture.spawnControl->RestoreState({{agentBlueprint, 300, 200, ""}});
+    agentBlueprint->SetAgentProfileName("ChangedAfterRestore");
+    const auto checkpoints = fixture.spawnControl->SaveState();
+
+    ASSERT_EQ(checkpoints.size(), 1u);
+    ASSERT_NE(checkpoints.front().agentBlueprint, nullptr);
+    EXPECT_NE(checkpoints.front().agentBlueprint, agentBlueprint);
+    EXPECT_EQ(checkpoints.front().agentBlueprint->GetAgentProfileName(), "PendingProfile");
+    EXPECT_EQ(checkpoints.front().nextSpawnTime, 300);
+    EXPECT_EQ(checkpoints.front().holdbackTime, 200);
+}
+
+class CheckpointTest : public ::testing::Test
+{
+public:
+    CheckpointTest()
+    {
+        agentBlueprint->SetAgentProfileName("Profile");
+
+        ON_CALL(world, CreateAgentAdapterForAgent()).WillByDefault(Return(&agentAdapter));
+        agent = std::make_unique<Agent>(1, agentBlueprint.get(), 200, &world);
+        agent->AddComponent("Component", component);
+
+        ON_CALL(world, GetAgents()).WillByDefault(ReturnRef(worldAgents));
+        ON_CALL(agentFactory, GetAgent(1)).WillByDefault(Return(agent.get()));
+        ON_CALL(agentFactory, GetAgentBlueprint(1)).WillByDefault(Return(agentBlueprint));
+        ON_CALL(agentFactory, GetNextAgentId()).WillByDefault(Return(5));
+        ON_CALL(eventDetectorNetwork, GetEventDetectors()).WillByDefault(Return(std::vector<const EventDetector*>{}));
+
+        ON_CALL(agentAdapter, SupportsCheckpoint()).WillByDefault(Return(true));
+        ON_CALL(agentAdapter, GetSpawnTime()).WillByDefault(Return(200));
+        ON_CALL(agentAdapter, SaveState(_)).WillByDefault(WriteState("agent state"));
+        ON_CALL(*component, SupportsCheckpoint()).WillByDefault(Return(true));
+        ON_CALL(*component, SaveState()).WillByDefault(Return(ComponentCheckpoint{"component state", {}}));
+        ON_CALL(*component, ReleaseFromLibrary()).WillByDefault(Return(true));
+        ON_CALL(spawnControlFixture.spawnPointImplementation, SupportsCheckpoint()).WillByDefault(Return(true));
+
+        runResult.AddCollisionId(1);
+    }
+
+    NiceMock<FakeWorld> world;
+    NiceMock<FakeAgentFactory> agentFactory;
+    NiceMock<FakeEventNetwork> eventNetwork;
+    NiceMock<FakeEventDetectorNetwork> eventDetectorNetwork;
+    NiceMock<FakeAgent> agentAdapter;
+    NiceMock<FakeComponent>* component = new NiceMock<FakeComponent>();   // owned by agent
+    std::shared_ptr<AgentBlueprint> agentBlueprint = std::make_shared<AgentBlueprint>();
+    std::unique_ptr<Agent> agent;
+    std::map<int, AgentInterface*> worldAgents {{1, &agentAdapter}};
+    SpawnControlWithFakeSpawnPoint spawnControlFixture;
+    RunResult runResult;
+
+    Checkpoint checkpoint {300, &agentFactory, &world, &eventNetwork, &eventDetectorNetwork};
+};
+
+TEST_F(CheckpointTest, IsDue_BeforeCheckpointTime_ReturnsFalse)
+{
+    EXPECT_FALSE(checkpoint.IsDue(200));
+    EXPECT_TRUE(checkpoint.IsDue(300));
+}
+
+TEST_F(CheckpointTest, Save_ComponentWithoutCheckpointSupport_IsSkipped)
+{
+    ON_CALL(*component, SupportsCheckpoint()).WillByDefault(Return(false));
+    EXPECT_CALL(*component, SaveState()).Times(0);
+
+    EXPECT_FALSE(checkpoint.Save(300, *spawnControlFixture.spawnControl, runResult));
+    EXPECT_FALSE(checkpoint.IsSaved());
+    EXPECT_FALSE(checkpoint.IsDue(400));
+}
+
+TEST_F(CheckpointTest, Save_AgentWithoutCheckpointSupport_IsSkipped)
+{
+    ON_CALL(agentAdapter, SupportsCheckpoint()).WillByDefault(Return(false));
+
+    EXPECT_FALSE(checkpoint.Save(300, *spawnControlFixture.spawnControl, runResult));
+    EXPECT_FALSE(checkpoint.IsSaved());
+}
+
+TEST_F(CheckpointTest, Save_SpawnPointWithoutCheckpointSupport_IsSkipped)
+{
+    ON_CALL(spawnControlFixture.spawnPointImplementation, SupportsCheckpoint()).WillByDefault(Return(false));
+
+    EXPECT_FALSE(checkpoint.Save(300, *spawnControlFixture.spawnControl, runResult));
+    EXPECT_FALSE(checkpoint.IsSaved());
+}
+
+TEST_F(CheckpointTest, Save_AllModulesSupportCheckpoints_IsSaved)
+{
+    EXPECT_TRUE(checkpoint.Save(400, *spawnControlFixture.spawnControl, runResult));
+
+    EXPECT_TRUE(checkpoint.IsSaved());
+    EXPECT_EQ(checkpoint.GetTime(), 400);
+    EXPECT_FALSE(checkpoint.IsDue(500));
+}
+
+TEST_F(CheckpointTest, Restore_PassesSavedStatesToRestoredAgent)
+{
+    ASSERT_TRUE(checkpoint.Save(300, *spawnControlFixture.spawnControl, runResult));
+
+    NiceMock<FakeAgent> restoredAgentAdapter;
+    auto restoredComponent = new NiceMock<FakeComponent>();
+    ON_CALL(*restoredComponent, ReleaseFromLibrary()).WillByDefault(Return(true));
+    ON_CALL(world, CreateAgentAdapterForAgent()).WillByDefault(Return(&restoredAgentAdapter));
+    Agent restoredAgent(1, agentBlueprint.get(), 200, &world);
+    restoredAgent.AddComponent("Component", restoredComponent);
+
+    std::string restoredAgentState;
+    EXPECT_CALL(agentFactory, RestoreAgent(1, agentBlueprint.get(), 200)).WillOnce(Return(&restoredAgent));
+    EXPECT_CALL(restoredAgentAdapter, RestoreState(_))
+            .WillOnce(Invoke([&restoredAgentState](std::istream &state) { restoredAgentState = ReadAll(state); }));
+    EXPECT_CALL(*restoredComponent, RestoreState(Field(&ComponentCheckpoint::modelState, "component state")));
+    EXPECT_CALL(agentFactory, SetNextAgentId(5));
+    EXPECT_CALL(world, SyncGlobalData());
+    EXPECT_CALL(eventNetwork, RestoreState(_));
+
+    RunResult restoredRunResult;
+    std::list<const Agent*> restoredAgents;
+    EXPECT_TRUE(checkpoint.Restore(*spawnControlFixture.spawnControl, restoredRunResult, restoredAgents));
+
+    EXPECT_EQ(restoredAgentState, "agent state");
+    EXPECT_EQ(restoredAgents, (std::list<const Agent*>{&restoredAgent}));
+    EXPECT_EQ(*restoredRunResult.GetCollisionIds(), (std::list<int>{1}));
+}
+
+TEST_F(CheckpointTest, Restore_AgentCannotBeRestored_Fails)
+{
+    ASSERT_TRUE(checkpoint.Save(300, *spawnControlFixture.spawnControl, runResult));
+    ON_CALL(agentFactory, RestoreAgent(_, _, _)).WillByDefault(Return(nullptr));
+
+    RunResult restoredRunResult;
+    std::list<const Agent*> restoredAgents;
+    EXPECT_FALSE(checkpoint.Restore(*spawnControlFixture.spawnControl, restoredRunResult, restoredAgents));
+    EXPECT_TRUE(restoredAgents.empty());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,278 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "eventNetwork.h"
+#include "Common/loggedEvent.h"
+
+using namespace EventDefinitions;
+using SimulationSlave::EventNetwork;
+using SimulationSlave::EventNetworkState;
+
+namespace {
+
+std::shared_ptr<AgentBasedEvent> CreateAgentEvent(int time, int agentId)
+{
+    return std::make_shared<AgentBasedEvent>(time, "Test", "", EventType::AEBActive, agentId);
+}
+
+std::shared_ptr<CollisionEvent> CreateCollisionEvent(int time, int agentId, int opponentId)
+{
+    return std::make_shared<CollisionEvent>(time, "Test", "", EventType::Collision, true, agentId, opponentId);
+}
+
+std::vector<int> GetLoggedEventIds(EventNetwork &eventNetwork, EventCategory eventCategory = EventCategory::AgentBased)
+{
+    std::vector<int> ids;
+    eventNetwork.StreamLoggedEvents(eventCategory, [&ids](std::shared_ptr<EventInterface> event)
+    {
+        ids.push_back(event->GetId());
+    });
+    return ids;
+}
+
+std::vector<int> GetArchivedEventIds(EventNetwork &eventNetwork, EventCategory eventCategory = EventCategory::AgentBased)
+{
+    std::vector<int> ids;
+    for(const auto &event : (*eventNetwork.GetArchivedEvents())[eventCategory])
+    {
+        ids.push_back(event->GetId());
+    }
+    return ids;
+}
+
+} // namespace
+
+TEST(EventNetwork, RestoreState_RestoresActiveEventsAndIndexByAgent)
+{
+    EventNetwork eventNetwork;
+    const auto agentEvent = CreateAgentEvent(100, 1);
+    const auto collisionEvent = CreateCollisionEvent(200, 1, 2);
+    eventNetwork.InsertEvent(agentEvent);
+    eventNetwork.InsertEvent(collisionEvent);
+
+    const EventNetworkState state = eventNetwork.SaveState();
+    eventNetwork.Clear();
+    eventNetwork.RestoreState(state);
+
+    ASSERT_EQ(eventNetwork.GetActiveEventCategory(EventCategory::AgentBased)->size(), 1u);
+    EXPECT_EQ(eventNetwork.GetActiveEventCategory(EventCategory::AgentBased)->front(), agentEvent);
+
+    const auto &eventsOfAgent = eventNetwork.GetActiveEventsForAgent(EventCategory::AgentBased, 1);
+    ASSERT_EQ(eventsOfAgent.size(), 1u);
+    EXPECT_EQ(eventsOfAgent.front(), agentEvent);
+
+    ASSERT_EQ(eventNetwork.GetActiveEventsForAgent(EventCategory::Collision, 1).size(), 1u);
+    ASSERT_EQ(eventNetwork.GetActiveEventsForAgent(EventCategory::Collision, 2).size(), 1u);
+    EXPECT_EQ(eventNetwork.GetActiveEventsForAgent(EventCategory::Collision, 2).front(), collisionEvent);
+}
+
+TEST(EventNetwork, RestoreState_DropsEventsInsertedAfterSaving)
+{
+    EventNetwork eventNetwork;
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 1));
+
+    const EventNetworkState state = eventNetwork.SaveState();
+    eventNetwork.InsertEvent(CreateAgentEvent(200, 1));
+    eventNetwork.InsertEvent(CreateAgentEvent(200, 3));
+    eventNetwork.RestoreState(state);
+
+    EXPECT_EQ(eventNetwork.GetActiveEventCategory(EventCategory::AgentBased)->size(), 1u);
+    EXPECT_EQ(eventNetwork.GetActiveEventsForAgent(EventCategory::AgentBased, 1).size(), 1u);
+    EXPECT_TRUE(eventNetwork.GetActiveEventsForAgent(EventCategory::AgentBased, 3).empty());
+}
+
+TEST(EventNetwork, RestoreState_ContinuesEventIds)
+{
+    EventNetwork eventNetwork;
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 1));
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 2));
+
+    const EventNetworkState state = eventNetwork.SaveState();
+    eventNetwork.InsertEvent(CreateAgentEvent(200, 1));
+    eventNetwork.Clear();
+    eventNetwork.RestoreState(state);
+
+    const auto event = CreateAgentEvent(200, 1);
+    eventNetwork.InsertEvent(event);
+
+    EXPECT_EQ(event->GetId(), 2);
+}
+
+TEST(EventNetwork, RestoreState_RestoresArchivedEvents)
+{
+    EventNetwork eventNetwork;
+    const auto archivedEvent = CreateAgentEvent(100, 1);
+    eventNetwork.InsertEvent(archivedEvent);
+    eventNetwork.ClearActiveEvents();
+
+    const EventNetworkState state = eventNetwork.SaveState();
+    eventNetwork.Clear();
+    eventNetwork.RestoreState(state);
+
+    const auto &archivedEvents = *eventNetwork.GetArchivedEvents();
+    ASSERT_EQ(archivedEvents.count(EventCategory::AgentBased), 1u);
+    ASSERT_EQ(archivedEvents.at(EventCategory::AgentBased).size(), 1u);
+    EXPECT_EQ(archivedEvents.at(EventCategory::AgentBased).front(), archivedEvent);
+    EXPECT_TRUE(eventNetwork.GetActiveEvents()->empty());
+}
+
+TEST(EventNetwork, RestoreState_RestoresEventLog)
+{
+    EventNetwork eventNetwork;
+    eventNetwork.SetArchiveRetention(0, -1, testing::TempDir() + "EventNetwork_UnitTests_events.log");
+
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 1));
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 2));
+    eventNetwork.ClearActiveEvents();
+
+    const EventNetworkState state = eventNetwork.SaveState();
+    eventNetwork.InsertEvent(CreateAgentEvent(200, 1));
+    eventNetwork.ClearActiveEvents();
+    ASSERT_EQ(GetLoggedEventIds(eventNetwork).size(), 3u);
+
+    eventNetwork.Clear();
+    eventNetwork.RestoreState(state);
+
+    EXPECT_EQ(GetLoggedEventIds(eventNetwork), (std::vector<int>{0, 1}));
+}
+
+TEST(EventNetwork, StreamLoggedEvents_StreamsEventsOfRequestedCategory)
+{
+    EventNetwork eventNetwork;
+    eventNetwork.SetArchiveRetention(0, -1, testing::TempDir() + "EventNetwork_UnitTests_events.log");
+
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 1));
+    eventNetwork.InsertEvent(CreateCollisionEvent(100, 1, 2));
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 2));
+    eventNetwork.ClearActiveEvents();
+
+    EXPECT_EQ(GetLoggedEventIds(eventNetwork, EventCategory::AgentBased), (std::vector<int>{0, 2}));
+    EXPECT_EQ(GetLoggedEventIds(eventNetwork, EventCategory::Collision), (std::vector<int>{1}));
+    EXPECT_TRUE(GetLoggedEventIds(eventNetwork, EventCategory::ComponentStateChange).empty());
+}
+
+TEST(EventNetwork, StreamLoggedEvents_ReadsEventLogOfRequestedCategoryOnly)
+{
+    const std::string eventLogFile = testing::TempDir() + "EventNetwork_UnitTests_events.log";
+    EventNetwork eventNetwork;
+    eventNetwork.SetArchiveRetention(0, -1, eventLogFile);
+
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 1));
+    eventNetwork.InsertEvent(CreateCollisionEvent(100, 1, 2));
+    eventNetwork.ClearActiveEvents();
+
+    // a corrupted log of another category is not read
+    ASSERT_EQ(GetLoggedEventIds(eventNetwork, EventCategory::Collision), (std::vector<int>{1}));
+    std::ofstream(eventLogFile + "." + std::to_string(static_cast<int>(EventCategory::Collision))) << "corrupted\n";
+
+    EXPECT_EQ(GetLoggedEventIds(eventNetwork, EventCategory::AgentBased), (std::vector<int>{0}));
+    EXPECT_THROW(GetLoggedEventIds(eventNetwork, EventCategory::Collision), std::runtime_error);
+}
+
+TEST(EventNetwork, ApplyArchiveRetention_ExceedingMaxArchivedEvents_LogsOldestEventsOfAllCategories)
+{
+    EventNetwork eventNetwork;
+    eventNetwork.SetArchiveRetention(2, -1, testing::TempDir() + "EventNetwork_UnitTests_events.log");
+
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 1));
+    eventNetwork.InsertEvent(CreateCollisionEvent(100, 1, 2));
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 2));
+    eventNetwork.ClearActiveEvents();
+
+    EXPECT_EQ(GetLoggedEventIds(eventNetwork, EventCategory::AgentBased), (std::vector<int>{0}));
+    EXPECT_TRUE(GetLoggedEventIds(eventNetwork, EventCategory::Collision).empty());
+
+    eventNetwork.InsertEvent(CreateAgentEvent(200, 1));
+    eventNetwork.ClearActiveEvents();
+
+    EXPECT_EQ(GetLoggedEventIds(eventNetwork, EventCategory::AgentBased), (std::vector<int>{0}));
+    EXPECT_EQ(GetLoggedEventIds(eventNetwork, EventCategory::Collision), (std::vector<int>{1}));
+    EXPECT_EQ(GetArchivedEventIds(eventNetwork, EventCategory::AgentBased), (std::vector<int>{2, 3}));
+    EXPECT_TRUE(GetArchivedEventIds(eventNetwork, EventCategory::Collision).empty());
+}
+
+TEST(EventNetwork, ApplyArchiveRetention_OutsideArchivedEventsTimeWindow_LogsOlderEvents)
+{
+    EventNetwork eventNetwork;
+    eventNetwork.SetArchiveRetention(-1, 100, testing::TempDir() + "EventNetwork_UnitTests_events.log");
+
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 1));
+    eventNetwork.ClearActiveEvents();
+    eventNetwork.InsertEvent(CreateAgentEvent(150, 1));
+    eventNetwork.ClearActiveEvents();
+
+    EXPECT_TRUE(GetLoggedEventIds(eventNetwork).empty());
+
+    eventNetwork.InsertEvent(CreateAgentEvent(250, 1));
+    eventNetwork.ClearActiveEvents();
+
+    EXPECT_EQ(GetLoggedEventIds(eventNetwork), (std::vector<int>{0}));
+    EXPECT_EQ(GetArchivedEventIds(eventNetwork), (std::vector<int>{1, 2}));
+}
+
+TEST(EventNetwork, ApplyArchiveRetention_WithArchivedEventsClearedByCaller_LogsOnlyEventsExceedingTheLimit)
+{
+    EventNetwork eventNetwork;
+    eventNetwork.SetArchiveRetention(1, -1, testing::TempDir() + "EventNetwork_UnitTests_events.log");
+
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 1));
+    eventNetwork.ClearActiveEvents();
+    eventNetwork.GetArchivedEvents()->clear();
+
+    eventNetwork.InsertEvent(CreateAgentEvent(200, 1));
+    eventNetwork.InsertEvent(CreateAgentEvent(200, 2));
+    ASSERT_NO_THROW(eventNetwork.ClearActiveEvents());
+
+    EXPECT_EQ(GetLoggedEventIds(eventNetwork), (std::vector<int>{1}));
+    EXPECT_EQ(GetArchivedEventIds(eventNetwork), (std::vector<int>{2}));
+}
+
+TEST(EventNetwork, StreamLoggedEvents_WithNewlinesInStrings_RestoresLoggedEvent)
+{
+    EventNetwork eventNetwork;
+    eventNetwork.SetArchiveRetention(0, -1, testing::TempDir() + "EventNetwork_UnitTests_events.log");
+
+    const std::list<std::pair<std::string, std::string>> eventParameters {{"Reason", "first line\nsecond \"line\"\n"},
+                                                                          {"Multi\nline key", ""}};
+    eventNetwork.InsertEvent(std::make_shared<LoggedEvent>(0, 100, 7, "Test\nSource", "Sequence\n", EventType::AEBActive,
+                                                           eventParameters));
+    eventNetwork.InsertEvent(CreateAgentEvent(100, 1));
+    eventNetwork.ClearActiveEvents();
+
+    std::vector<std::shared_ptr<EventInterface>> loggedEvents;
+    ASSERT_NO_THROW(eventNetwork.StreamLoggedEvents(EventCategory::AgentBased,
+                                                    [&loggedEvents](std::shared_ptr<EventInterface> event)
+    {
+        loggedEvents.push_back(event);
+    }));
+
+    ASSERT_EQ(loggedEvents.size(), 2u);
+    EXPECT_EQ(loggedEvents.front()->GetId(), 0);
+    EXPECT_EQ(loggedEvents.front()->GetEventTime(), 100);
+    EXPECT_EQ(loggedEvents.front()->GetTriggeringEventId(), 7);
+    EXPECT_EQ(loggedEvents.front()->GetSource(), "Test\nSource");
+    EXPECT_EQ(loggedEvents.front()->GetSequenceName(), "Sequence\n");
+    EXPECT_EQ(loggedEvents.front()->GetEventParametersAsString(), eventParameters);
+    EXPECT_EQ(loggedEvents.back()->GetId(), 1);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
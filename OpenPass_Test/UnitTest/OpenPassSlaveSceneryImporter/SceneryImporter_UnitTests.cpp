@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <cstdio>
+#include <fstream>
+
 #include "sceneryImporter.h"
 
 #include "TestImporterHelper.h"
@@ -22,7 +25,7 @@ TEST(SceneryImporter_UnitTests, ParseRoadTypes)
 
 
     EXPECT_CALL(mockRoad, AddRoadType(_)).Times(2);
-    ASSERT_TRUE(SimulationSlave::SceneryImporter::ParseRoadTypes(documentRoot, &mockRoad));
+    ASSERT_TRUE(Importer::SceneryImporter::ParseRoadTypes(documentRoot, &mockRoad));
 }
 
 
@@ -38,7 +41,7 @@ TEST(SceneryImporter_UnitTests, ParseSignalsWithThreeValidSignals_DetectsThreeSi
     "</root>");
 
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     FakeRoad mockRoad;
 
     EXPECT_CALL(mockRoad, AddRoadSignal(_)).Times(3);
@@ -71,7 +74,7 @@ TEST(SceneryImporter_UnitTests, ParseSignalsWithValidSignal_ReturnsCorrectValues
     "  </signals>"
     "</root>");
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     FakeRoad mockRoad;
 
     ON_CALL(mockRoad, AddRoadSignal(_)).WillByDefault(Invoke(SignalInterceptor::intercept));
@@ -107,7 +110,7 @@ TEST(SceneryImporter_UnitTests, ParseSignalsWithMissingField_Fails)
     "  </signals>"
     "</root>");
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     FakeRoad mockRoad;
 
     ASSERT_FALSE(SceneryImporter::ParseSignals(documentRoot, &mockRoad));
@@ -122,7 +125,7 @@ TEST(SceneryImporter_UnitTests, ParseSignalsWithInvalidField_Fails)
     "  </signals>"
     "</root>");
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     FakeRoad mockRoad;
 
     ASSERT_FALSE(SceneryImporter::ParseSignals(documentRoot, &mockRoad));
@@ -136,7 +139,7 @@ TEST(SceneryImporter_UnitTests, ValidityWithThreeIncreasingLaneNumbers_DeliversT
     "  <validity fromLane=\"0\" toLane=\"2\" />"
     "</root>");
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     RoadElementValidity validitiy;
 
     ASSERT_TRUE(SceneryImporter::ParseElementValidity(documentRoot, validitiy));
@@ -154,7 +157,7 @@ TEST(SceneryImporter_UnitTests, ValidityWithThreeDecreasingLaneNumbers_DeliversT
     "  <validity fromLane=\"0\" toLane=\"-2\" />"
     "</root>");
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     RoadElementValidity validitiy;
 
     ASSERT_TRUE(SceneryImporter::ParseElementValidity(documentRoot, validitiy));
@@ -172,7 +175,7 @@ TEST(SceneryImporter_UnitTests, ValidityWithMissingFromLane_Fails)
     "  <validity toLane=\"0\" />"
     "</root>");
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     RoadElementValidity validitiy;
 
     ASSERT_FALSE(SceneryImporter::ParseElementValidity(documentRoot, validitiy));
@@ -185,7 +188,7 @@ TEST(SceneryImporter_UnitTests, ValidityWithMissingToLane_Fails)
     "  <validity fromLane=\"0\" />"
     "</root>");
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     RoadElementValidity validitiy;
 
     ASSERT_FALSE(SceneryImporter::ParseElementValidity(documentRoot, validitiy));
@@ -197,7 +200,7 @@ TEST(SceneryImporter_UnitTests, NoValidity_SetsAllValidityFlag)
     "<root>"
     "</root>");
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     RoadElementValidity validitiy;
 
     ASSERT_TRUE(SceneryImporter::ParseElementValidity(documentRoot, validitiy));
@@ -241,7 +244,7 @@ TEST(SceneryImporter_UnitTests, ParseObject_ThreeBarriersAreDetected)
     "  </objects>"
     "</root>");
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     FakeRoad mockRoad;
 
     EXPECT_CALL(mockRoad, AddRoadObject(_)).Times(3);
@@ -271,7 +274,7 @@ TEST(SceneryImporter_UnitTests, ParseObjectsWithValidObject_ReturnsCorrectValues
     "  </objects>"
     "</root>");
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     FakeRoad mockRoad;
 
     ON_CALL(mockRoad, AddRoadObject(_)).WillByDefault(Invoke(ObjectInterceptor::intercept));
@@ -303,7 +306,7 @@ TEST(SceneryImporter_UnitTests, ParseObjectsWithMissingField_Fails)
     "  </objects>"
     "</root>");         // validLength is missing
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     FakeRoad mockRoad;
 
     ASSERT_FALSE(SceneryImporter::ParseObjects(documentRoot, &mockRoad));
@@ -318,7 +321,7 @@ TEST(SceneryImporter_UnitTests, ParseObjectssWithInvalidField_Fails)
     "  </objects>"
     "</root>");   // s is negative
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     FakeRoad mockRoad;
 
     ASSERT_FALSE(SceneryImporter::ParseObjects(documentRoot, &mockRoad));
@@ -349,7 +352,7 @@ TEST(SceneryImporter_UnitTests, ParseRepeatWithNoOverridingOfOptionalParameters)
     object.radius = 0;
     std::list<RoadObjectSpecification> objectRepitions;
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     objectRepitions = SceneryImporter::ParseObjectRepeat(documentRoot, object);
 
     for(auto object : objectRepitions)
@@ -373,7 +376,7 @@ TEST(SceneryImporter_UnitTests, ParseRepeatTestOverridingOfObjectRepeat)
     object.radius = 0;
     std::list<RoadObjectSpecification> objectRepitions;
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     objectRepitions = SceneryImporter::ParseObjectRepeat(documentRoot, object);
 
     int distance = 50;
@@ -410,7 +413,7 @@ TEST(SceneryImporter_UnitTests, ParseRepeatOverridesAllOptionalParameters)
     object.radius = 0;
     std::list<RoadObjectSpecification> objectRepitions;
 
-    using namespace SimulationSlave;
+    using namespace Importer;
     objectRepitions = SceneryImporter::ParseObjectRepeat(documentRoot, object);
 
     RoadObjectSpecification firstObject = objectRepitions.front();
@@ -425,6 +428,69 @@ TEST(SceneryImporter_UnitTests, ParseRepeatOverridesAllOptionalParameters)
     ASSERT_EQ(firstObject.hdg, 0);
 }
 
+namespace
+{
+    //! Straight road of 100 m without lanes, the given elements are appended to the road
+    std::string CreateRoad(const std::string &id, const std::string &elements)
+    {
+        return "<road id=\"" + id + "\" length=\"100\" junction=\"-1\">"
+               "  <planView>"
+               "    <geometry s=\"0\" x=\"0\" y=\"0\" hdg=\"0\" length=\"100\"><line/></geometry>"
+               "  </planView>"
+               "  <lanes><laneSection s=\"0\"/></lanes>"
+               + elements +
+               "</road>";
+    }
+
+    //! Writes an OpenDRIVE file with the given roads and imports it
+    bool ImportScenery(const std::string &roads, Configuration::Scenery &scenery)
+    {
+        const std::string filename = ::testing::TempDir() + "/SceneryImporter_UnitTests.xodr";
+        std::ofstream(filename) << "<?xml version=\"1.0\"?><OpenDRIVE>" << roads << "</OpenDRIVE>";
+
+        const bool success = Importer::SceneryImporter::Import(filename, &scenery);
+        std::remove(filename.c_str());
+        return success;
+    }
+}
+
+TEST(SceneryImporter_UnitTests, ImportWithInvalidObject_KeepsRoadAndFollowingRoads)
+{
+    // validLength is missing
+    const std::string invalidObjects =
+    "  <objects>"
+    "    <object type=\"barrier\" name=\"obstacle\" id=\"b01\" s=\"10\" t=\"0\" zOffset=\"0\" orientation=\"none\" length=\"10\" width=\"2\" height=\"2\" hdg=\"0\" pitch=\"0\" roll=\"0\" />"
+    "  </objects>"
+    "  <type s=\"0\" type=\"motorway\" />";
+
+    Configuration::Scenery scenery;
+
+    ASSERT_TRUE(ImportScenery(CreateRoad("1", invalidObjects) + CreateRoad("2", ""), scenery));
+
+    ASSERT_EQ(scenery.GetRoads().size(), 2u);
+    EXPECT_TRUE(scenery.GetRoads().at("1")->GetRoadObjects().empty());
+    EXPECT_EQ(scenery.GetRoads().at("1")->GetRoadType(0), RoadTypeInformation::Motorway);
+    EXPECT_EQ(scenery.GetRoads().count("2"), 1u);
+}
+
+TEST(SceneryImporter_UnitTests, ImportWithInvalidRoad_KeepsFollowingRoads)
+{
+    const std::string roadWithoutPlanView = "<road id=\"2\" length=\"100\" junction=\"-1\"><lanes><laneSection s=\"0\"/></lanes></road>";
+
+    Configuration::Scenery scenery;
+
+    ASSERT_TRUE(ImportScenery(CreateRoad("1", "") + roadWithoutPlanView + CreateRoad("3", ""), scenery));
+    EXPECT_EQ(scenery.GetRoads().count("1"), 1u);
+    EXPECT_EQ(scenery.GetRoads().count("3"), 1u);
+}
+
+TEST(SceneryImporter_UnitTests, ImportWithMalformedXml_Fails)
+{
+    Configuration::Scenery scenery;
+
+    EXPECT_FALSE(ImportScenery(CreateRoad("1", "") + "<road id=\"2\">", scenery));
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -19,6 +19,7 @@ CONFIG += OPENPASS_TESTING
 include(../../Testing.pri)
 
 INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS \
             ../../../OpenPass_Source_Code/openPASS/Common \
             ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare \
             ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare/cephesMIT \
@@ -35,6 +36,8 @@ SOURCES += \
     ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare/cephesMIT/const.c \
     ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare/log.cpp \
     ../../../OpenPass_Source_Code/openPASS/CoreFramework/CoreShare/xmlParser.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/importer/connection.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/importer/junction.cpp \
     ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/importer/road.cpp \
     ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/importer/road/roadSignal.cpp \
     ../../../OpenPass_Source_Code/openPASS/CoreFramework/OpenPassSlave/importer/road/roadObject.cpp \
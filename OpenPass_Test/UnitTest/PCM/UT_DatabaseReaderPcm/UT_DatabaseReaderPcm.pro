@@ -0,0 +1,52 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+include(../../UT.pri)
+
+QT += sql
+
+Release:DESTDIR = $$DIR_RELEASE
+Debug:DESTDIR = $$DIR_DEBUG
+
+TARGET = tst_ut_databasereaderpcmtest
+
+PCM_DATA_DIR = $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data
+GENERATOR_DIR = $$MAIN_SRC_DIR/openPASS_GUI/openPASS-PCM/Models/ConfigurationGeneratorPcm
+
+INCLUDEPATH += . \
+               $$GENERATOR_DIR \
+               $$PCM_DATA_DIR \
+               $$MAIN_SRC_DIR/openPASS/Common_PCM \
+               $$MAIN_SRC_DIR/openPASS/Common
+
+HEADERS += $$GENERATOR_DIR/DatabaseReaderPcm.h \
+        $$GENERATOR_DIR/DataCachePcm.h \
+        tst_ut_databasereaderpcmtest.h
+
+SOURCES += $$GENERATOR_DIR/DatabaseReaderPcm.cpp \
+        $$GENERATOR_DIR/DataCachePcm.cpp \
+        $$PCM_DATA_DIR/pcm_globalData.cpp \
+        $$PCM_DATA_DIR/pcm_initialValues.cpp \
+        $$PCM_DATA_DIR/pcm_intendedCourse.cpp \
+        $$PCM_DATA_DIR/pcm_line.cpp \
+        $$PCM_DATA_DIR/pcm_lineContainer.cpp \
+        $$PCM_DATA_DIR/pcm_lineSegment.cpp \
+        $$PCM_DATA_DIR/pcm_marks.cpp \
+        $$PCM_DATA_DIR/pcm_object.cpp \
+        $$PCM_DATA_DIR/pcm_participantData.cpp \
+        $$PCM_DATA_DIR/pcm_point.cpp \
+        $$PCM_DATA_DIR/pcm_pointContainer.cpp \
+        $$PCM_DATA_DIR/pcm_trajectory.cpp \
+        $$PCM_DATA_DIR/pcm_viewObject.cpp \
+        $$MAIN_SRC_DIR/openPASS/Common/vector2d.cpp \
+        tst_ut_databasereaderpcmtest.cpp \
+        main.cpp \
+
+DEFINES += SRCDIR=\\\"$$PWD/\\\"
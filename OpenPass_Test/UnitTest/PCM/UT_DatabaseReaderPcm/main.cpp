@@ -0,0 +1,24 @@
+/*********************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+**********************************************************************/
+
+#include <QCoreApplication>
+#include <QStringList>
+#include <QDir>
+#include "tst_ut_databasereaderpcmtest.h"
+
+int main(int argc, char *argv[])
+{
+    // the SQLite driver is loaded as plugin
+    QCoreApplication application(argc, argv);
+    QStringList testCmd;
+    testCmd<<" "<<"-o"<<"QTestDatabaseReaderPcm_log.txt";
+    UT_DatabaseReaderPcmTest uT_DatabaseReaderPcmTest;
+    QTest::qExec(&uT_DatabaseReaderPcmTest, testCmd);
+}
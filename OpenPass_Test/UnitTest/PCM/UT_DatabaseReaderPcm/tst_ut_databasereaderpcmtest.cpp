@@ -0,0 +1,201 @@
+/*********************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+**********************************************************************/
+
+#include "tst_ut_databasereaderpcmtest.h"
+
+#include "pcm_helper.h"
+
+namespace {
+
+void Execute(QSqlDatabase &db, const QString &statement)
+{
+    QSqlQuery query(db);
+    QVERIFY2(query.exec(statement), qPrintable(query.lastError().text()));
+}
+
+void ReadParticipants(DatabaseReader &reader, const QString &pcmCase, std::vector<PCM_ParticipantData> &participants)
+{
+    QVERIFY(reader.ReadParticipantData(pcmCase, participants));
+}
+
+void ReadInitials(DatabaseReader &reader, const QString &pcmCase, std::vector<PCM_InitialValues> &initials)
+{
+    QVERIFY(reader.ReadDynamicsData(pcmCase, initials));
+}
+
+void CompareParticipants(const std::vector<PCM_ParticipantData> &actual, const std::vector<PCM_ParticipantData> &expected)
+{
+    QCOMPARE(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); i++)
+    {
+        QCOMPARE(actual.at(i).GetType(), expected.at(i).GetType());
+        QCOMPARE(actual.at(i).GetWidth(), expected.at(i).GetWidth());
+        QCOMPARE(actual.at(i).GetLength(), expected.at(i).GetLength());
+        QCOMPARE(actual.at(i).GetWeight(), expected.at(i).GetWeight());
+    }
+}
+
+void CompareInitials(const std::vector<PCM_InitialValues> &actual, const std::vector<PCM_InitialValues> &expected)
+{
+    QCOMPARE(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); i++)
+    {
+        QCOMPARE(actual.at(i).GetXpos(), expected.at(i).GetXpos());
+        QCOMPARE(actual.at(i).GetYpos(), expected.at(i).GetYpos());
+        QCOMPARE(actual.at(i).GetVx(), expected.at(i).GetVx());
+        QCOMPARE(actual.at(i).GetPsi(), expected.at(i).GetPsi());
+    }
+}
+
+} // namespace
+
+void UT_DatabaseReaderPcmTest::initTestCase()
+{
+    QVERIFY(directory.isValid());
+    QVERIFY(QSqlDatabase::isDriverAvailable("QSQLITE"));
+}
+
+QString UT_DatabaseReaderPcmTest::CreateDatabase(const QString &name, bool withGlobalData)
+{
+    const QString fileName = directory.filePath(name);
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", name);
+        db.setDatabaseName(fileName);
+        if (!db.open())
+        {
+            return QString();
+        }
+
+        Execute(db, "CREATE TABLE participant_data (FALL INTEGER, TYPEPCM TEXT, WIDTH TEXT, LENGTH TEXT, DISTCGFA TEXT, "
+                    "WEIGHT TEXT, HEIGHTCG TEXT, WHEELBASE TEXT, IXX TEXT, IYY TEXT, IZZ TEXT, MUE TEXT, TRACKWIDTH TEXT, "
+                    "HEIGHT TEXT, CGFRONT TEXT)");
+        Execute(db, "CREATE TABLE dynamics (FALL INTEGER, BETNR INTEGER, STEP INTEGER, XPOS REAL, YPOS REAL, "
+                    "VX REAL, VY REAL, AX REAL, AY REAL, PSI REAL)");
+
+        for (int i = 1; i < static_cast<int>(MarkType::NumberOfMarkTypes); i++)
+        {
+            const QString marksTable = QString::fromStdString(PCM_Helper::ConvertMarkTypeToDBString(static_cast<MarkType>(i)));
+            Execute(db, "CREATE TABLE " + marksTable + " (FALL INTEGER, LINENO INTEGER, POINTNO INTEGER, X REAL, Y REAL, Z REAL)");
+        }
+        Execute(db, "CREATE TABLE " + QString::fromStdString(PCM_Helper::ConvertObjectTypeToDBString(ObjectType::OBJECT))
+                    + " (FALL INTEGER, LINENO INTEGER, POINTNO INTEGER, X REAL, Y REAL, Z REAL, OBJTYPE INTEGER)");
+        Execute(db, "CREATE TABLE " + QString::fromStdString(PCM_Helper::ConvertObjectTypeToDBString(ObjectType::VIEWOBJECT))
+                    + " (FALL INTEGER, LINENO INTEGER, POINTNO INTEGER, X REAL, Y REAL, Z REAL)");
+        Execute(db, "CREATE TABLE " + QString::fromStdString(PCM_Helper::GetIntendedCourseDBString())
+                    + " (FALL INTEGER, BETNR INTEGER, POINTNO INTEGER, X REAL, Y REAL, Z REAL)");
+        if (withGlobalData)
+        {
+            Execute(db, "CREATE TABLE " + QString::fromStdString(PCM_Helper::GetGlobalDataDBString())
+                        + " (FALL INTEGER, OFFSETX REAL, OFFSETY REAL, PARTICIP INTEGER, SIMUVERS TEXT)");
+        }
+
+        for (int pcmCase : {1, 2})
+        {
+            for (int participant : {1, 2})
+            {
+                Execute(db, QString("INSERT INTO participant_data VALUES (%1, '%2', '1.8', '%3', '1.5', '1500', '0.5', "
+                                    "'2.7', '0', '0', '2500', '1', '1.6', '1.4', '1.2')")
+                                .arg(pcmCase).arg(participant).arg(4.0 + pcmCase * 0.1 + participant));
+                for (int step : {0, 1})
+                {
+                    Execute(db, QString("INSERT INTO dynamics VALUES (%1, %2, %3, %4, %5, 10, 0, 0, 0, %6)")
+                                    .arg(pcmCase).arg(participant).arg(step)
+                                    .arg(pcmCase * 10 + participant + step).arg(participant * 3.5).arg(0.1 * pcmCase));
+                }
+            }
+        }
+
+        db.close();
+    }
+    QSqlDatabase::removeDatabase(name);
+
+    return fileName;
+}
+
+void UT_DatabaseReaderPcmTest::testCase_prefetchedRowsMatchPerCaseQueries()
+{
+    const QString fileName = CreateDatabase("complete.sqlite", true);
+    QVERIFY(!fileName.isEmpty());
+
+    DatabaseReader reader;
+    QVERIFY(reader.OpenDataBase("QSQLITE", fileName));
+
+    std::vector<PCM_ParticipantData> participantsPerCase;
+    std::vector<PCM_InitialValues> initialsPerCase;
+    ReadParticipants(reader, "2", participantsPerCase);
+    ReadInitials(reader, "2", initialsPerCase);
+
+    const auto cache = reader.Prefetch({"1", "2"});
+    QVERIFY(cache != nullptr);
+    QCOMPARE(cache->GetCaseList(), QStringList({"1", "2"}));
+
+    reader.SetCache(cache);
+    QVERIFY(reader.IsCached("2"));
+
+    std::vector<PCM_ParticipantData> participantsCached;
+    std::vector<PCM_InitialValues> initialsCached;
+    ReadParticipants(reader, "2", participantsCached);
+    ReadInitials(reader, "2", initialsCached);
+
+    CompareParticipants(participantsCached, participantsPerCase);
+    CompareInitials(initialsCached, initialsPerCase);
+    QCOMPARE(initialsCached.size(), size_t(2));
+}
+
+void UT_DatabaseReaderPcmTest::testCase_prefetchedCasesAreReadWithoutDatabase()
+{
+    const QString fileName = CreateDatabase("closed.sqlite", true);
+    QVERIFY(!fileName.isEmpty());
+
+    DatabaseReader reader;
+    QVERIFY(reader.OpenDataBase("QSQLITE", fileName));
+    const auto cache = reader.Prefetch({"1"});
+    QVERIFY(cache != nullptr);
+    reader.CloseDataBase();
+
+    reader.SetCache(cache);
+
+    std::vector<PCM_ParticipantData> participants;
+    ReadParticipants(reader, "1", participants);
+    QCOMPARE(participants.size(), size_t(2));
+
+    std::vector<PCM_ParticipantData> uncachedParticipants;
+    QVERIFY(!reader.ReadParticipantData("2", uncachedParticipants));
+}
+
+void UT_DatabaseReaderPcmTest::testCase_failedPrefetchFallsBackToPerCaseQueries()
+{
+    const QString fileName = CreateDatabase("incomplete.sqlite", false);
+    QVERIFY(!fileName.isEmpty());
+
+    DatabaseReader reader;
+    QVERIFY(reader.OpenDataBase("QSQLITE", fileName));
+
+    const auto cache = reader.Prefetch({"1", "2"});
+    QVERIFY(cache != nullptr);
+    QVERIFY(!cache->ContainsCase(1));
+    QVERIFY(!cache->ContainsCase(2));
+
+    reader.SetCache(cache);
+    QVERIFY(!reader.IsCached("1"));
+
+    std::vector<PCM_ParticipantData> participants;
+    ReadParticipants(reader, "1", participants);
+    QCOMPARE(participants.size(), size_t(2));
+}
+
+void UT_DatabaseReaderPcmTest::testCase_failedOpenRemovesConnection()
+{
+    DatabaseReader reader;
+    QVERIFY(!reader.OpenDataBase("QSQLITE", directory.filePath("missingDirectory/missing.sqlite")));
+
+    QVERIFY(!reader.IsDataBaseOpen());
+    QVERIFY(QSqlDatabase::connectionNames().isEmpty());
+}
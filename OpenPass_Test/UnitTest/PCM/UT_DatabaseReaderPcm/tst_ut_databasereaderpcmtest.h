@@ -0,0 +1,43 @@
+/*********************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+**********************************************************************/
+
+#ifndef TST_UT_DATABASEREADERPCMTEST_H
+#define TST_UT_DATABASEREADERPCMTEST_H
+
+#include <QString>
+#include <QTemporaryDir>
+#include <QtTest>
+
+#include "DatabaseReaderPcm.h"
+
+class UT_DatabaseReaderPcmTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    UT_DatabaseReaderPcmTest() = default;
+    ~UT_DatabaseReaderPcmTest() = default;
+
+private slots:
+    void initTestCase();
+
+    void testCase_prefetchedRowsMatchPerCaseQueries();
+    void testCase_prefetchedCasesAreReadWithoutDatabase();
+    void testCase_failedPrefetchFallsBackToPerCaseQueries();
+    void testCase_failedOpenRemovesConnection();
+
+private:
+    //! Creates a SQLite copy of the PCM tables with two cases, optionally without the global data table
+    QString CreateDatabase(const QString &name, bool withGlobalData);
+
+    QTemporaryDir directory;
+};
+
+#endif // TST_UT_DATABASEREADERPCMTEST_H
@@ -235,6 +235,307 @@ void UT_Dynamics2TMTest::testCase1()
 
 }
 
+void UT_Dynamics2TMTest::testSolveLinear_data()
+{
+    QTest::addColumn<double>("a00");
+    QTest::addColumn<double>("a01");
+    QTest::addColumn<double>("a02");
+    QTest::addColumn<double>("a10");
+    QTest::addColumn<double>("a11");
+    QTest::addColumn<double>("a12");
+    QTest::addColumn<double>("a20");
+    QTest::addColumn<double>("a21");
+    QTest::addColumn<double>("a22");
+
+    QTest::addColumn<bool>("solvable");
+    QTest::addColumn<double>("x0");
+    QTest::addColumn<double>("x1");
+    QTest::addColumn<double>("x2");
+
+    // rhs is matrix * (1, -2, 3)
+    QTest::newRow("identity") << 1.0 << 0.0 << 0.0
+                              << 0.0 << 1.0 << 0.0
+                              << 0.0 << 0.0 << 1.0
+                              << true << 1.0 << -2.0 << 3.0;
+
+    QTest::newRow("coupled") << 2.0 << 1.0 << -1.0
+                             << -3.0 << -1.0 << 2.0
+                             << -2.0 << 1.0 << 2.0
+                             << true << 1.0 << -2.0 << 3.0;
+
+    QTest::newRow("singular") << 1.0 << 2.0 << 3.0
+                              << 2.0 << 4.0 << 6.0
+                              << 0.0 << 1.0 << 1.0
+                              << false << 0.0 << 0.0 << 0.0;
+
+    // det = 1e-8, below the singularity threshold
+    QTest::newRow("near singular") << 1.0 << 0.0 << 0.0
+                                   << 0.0 << 1e-4 << 0.0
+                                   << 0.0 << 0.0 << 1e-4
+                                   << false << 0.0 << 0.0 << 0.0;
+
+    QTest::newRow("NaN") << std::nan("") << 0.0 << 0.0
+                         << 0.0 << 1.0 << 0.0
+                         << 0.0 << 0.0 << 1.0
+                         << false << 0.0 << 0.0 << 0.0;
+}
+
+void UT_Dynamics2TMTest::testSolveLinear()
+{
+    QFETCH(double, a00);
+    QFETCH(double, a01);
+    QFETCH(double, a02);
+    QFETCH(double, a10);
+    QFETCH(double, a11);
+    QFETCH(double, a12);
+    QFETCH(double, a20);
+    QFETCH(double, a21);
+    QFETCH(double, a22);
+
+    QFETCH(bool, solvable);
+    QFETCH(double, x0);
+    QFETCH(double, x1);
+    QFETCH(double, x2);
+
+    const std::array<std::array<double, 3>, 3> matrix = {{{a00, a01, a02},
+                                                          {a10, a11, a12},
+                                                          {a20, a21, a22}}};
+    std::array<double, 3> rhs;
+    for (int row = 0; row < 3; ++row)
+    {
+        rhs[row] = matrix[row][0] * 1.0 + matrix[row][1] * -2.0 + matrix[row][2] * 3.0;
+    }
+
+    std::array<double, 3> solution = {42.0, 42.0, 42.0};
+    QCOMPARE(SolveLinear(matrix, rhs, solution), solvable);
+
+    if (solvable)
+    {
+        QCOMPARE((float)solution[0] + 1, (float)x0 + 1);
+        QCOMPARE((float)solution[1] + 1, (float)x1 + 1);
+        QCOMPARE((float)solution[2] + 1, (float)x2 + 1);
+    }
+    else
+    {
+        // the solution is left untouched
+        QCOMPARE(solution[0], 42.0);
+        QCOMPARE(solution[1], 42.0);
+        QCOMPARE(solution[2], 42.0);
+    }
+}
+
+void UT_Dynamics2TMTest::testLinearlyImplicitStep_data()
+{
+    QTest::addColumn<double>("damping");
+    QTest::addColumn<double>("timeStep");
+
+    QTest::newRow("moderate") << 10.0 << 0.01;
+    QTest::newRow("stiff") << 100.0 << 0.1;
+    QTest::newRow("very stiff") << 10000.0 << 0.25;
+}
+
+void UT_Dynamics2TMTest::testLinearlyImplicitStep()
+{
+    QFETCH(double, damping);
+    QFETCH(double, timeStep);
+
+    // decoupled linear damping a = -damping * v, the explicit step diverges for timeStep * damping > 2
+    const double perturbation = 1e-4;
+    std::array<double, 3> velocities = {1.0, -1.0, 0.5};
+
+    for (int step = 0; step < 20; ++step)
+    {
+        std::array<double, 3> accelerations;
+        std::array<std::array<double, 3>, 3> accelerationsPerturbed;
+        for (int row = 0; row < 3; ++row)
+        {
+            accelerations[row] = -damping * velocities[row];
+        }
+        for (int column = 0; column < 3; ++column)
+        {
+            accelerationsPerturbed[column] = accelerations;
+            accelerationsPerturbed[column][column] -= damping * perturbation;
+        }
+
+        const std::array<double, 3> delta = LinearlyImplicitStep(accelerations, accelerationsPerturbed,
+                                                                  perturbation, timeStep);
+
+        for (int row = 0; row < 3; ++row)
+        {
+            // implicit Euler: v_new = v / (1 + timeStep * damping), no overshoot for any step size
+            const double velocityExpected = velocities[row] / (1.0 + timeStep * damping);
+            velocities[row] += delta[row];
+
+            QCOMPARE((float)velocities[row] + 1, (float)velocityExpected + 1);
+            QVERIFY(velocities[row] * velocityExpected >= 0.0);
+        }
+    }
+}
+
+namespace {
+
+//! Vehicle of the stability tests, rolling without pedals and steering
+void InitVehicle(VehicleSimpleTT &vehicle, double weight, double velocity)
+{
+    vehicle.InitSetEngine(weight, 100000.0, -10000.0);
+    vehicle.InitSetGeometry(4.0, 0.0, 2.0, 0.0);
+    vehicle.InitSetTire(velocity, 10000.0, 8000.0, 0.1, 0.2, 1.0);
+}
+
+InputTwoTrack CreateInput(const VehicleSimpleTT &vehicle, double throttlePedal, double brakePedal)
+{
+    InputTwoTrack input;
+    input.throttlePedal = throttlePedal;
+    input.brakePedal = brakePedal;
+    input.brakeSuperpose = {0.0, 0.0, 0.0, 0.0};
+    input.angleTireFront = 0.0;
+    input.forceVertical = {vehicle.forceTireVerticalStatic[0],
+                           vehicle.forceTireVerticalStatic[1],
+                           vehicle.forceTireVerticalStatic[2],
+                           vehicle.forceTireVerticalStatic[3]};
+    return input;
+}
+
+} // namespace
+
+void UT_Dynamics2TMTest::testStabilityLargeCycleTime_data()
+{
+    QTest::addColumn<double>("cycleTime");
+    QTest::addColumn<double>("timeStepMax");
+
+    QTest::newRow("10 ms") << 0.01 << 0.02;
+    QTest::newRow("100 ms in substeps of 20 ms") << 0.1 << 0.02;
+    QTest::newRow("250 ms in substeps of 20 ms") << 0.25 << 0.02;
+    // the lateral slide decays with about 40 1/s, explicit steps above 25 ms overshoot it to the other side
+    QTest::newRow("100 ms in one step") << 0.1 << 0.1;
+    QTest::newRow("250 ms in one step") << 0.25 << 0.25;
+}
+
+void UT_Dynamics2TMTest::testStabilityLargeCycleTime()
+{
+    QFETCH(double, cycleTime);
+    QFETCH(double, timeStepMax);
+
+    const double weight = 1000.0;
+    const double inertiaYaw = 1500.0;
+
+    VehicleSimpleTT vehicle;
+    InitVehicle(vehicle, weight, 10.0);
+    const InputTwoTrack input = CreateInput(vehicle, 0.0, 0.0);
+
+    // rolling car with lateral slide and yaw rate, no pedals and steering
+    StateTwoTrack state;
+    state.velocity = Common::Vector2d(10.0, 1.0);
+    state.yawVelocity = 0.2;
+    const StateTwoTrack stateStart = state;
+    double velocityLateral = state.velocity.y;
+
+    for (double time = 0.0; time < 2.0; time += cycleTime)
+    {
+        StepLinearlyImplicitEuler(vehicle, weight, inertiaYaw, input, cycleTime, timeStepMax, state);
+
+        QVERIFY(std::isfinite(state.velocity.x) && std::isfinite(state.velocity.y) && std::isfinite(state.yawVelocity));
+
+        // roll friction and drag only slow the car down, lateral slide and yaw rate must not build up
+        QVERIFY(state.velocity.Length() <= stateStart.velocity.Length() && state.velocity.Length() > 9.0);
+        QVERIFY(std::fabs(state.yawVelocity) <= stateStart.yawVelocity);
+        QVERIFY(state.velocity.y >= 0.0 && state.velocity.y <= velocityLateral);
+        velocityLateral = state.velocity.y;
+    }
+
+    QVERIFY(std::fabs(state.yawVelocity) < 1e-3);
+    QVERIFY(state.velocity.y < 0.1);
+}
+
+void UT_Dynamics2TMTest::testZeroCrossing_data()
+{
+    QTest::addColumn<double>("cycleTime");
+    QTest::addColumn<bool>("implicit");
+
+    QTest::newRow("explicit") << 0.1 << false;
+    QTest::newRow("linearly implicit") << 0.1 << true;
+}
+
+void UT_Dynamics2TMTest::testZeroCrossing()
+{
+    QFETCH(double, cycleTime);
+    QFETCH(bool, implicit);
+
+    const double weight = 1000.0;
+    const double inertiaYaw = 1500.0;
+
+    VehicleSimpleTT vehicle;
+    InitVehicle(vehicle, weight, 0.1);
+    const InputTwoTrack input = CreateInput(vehicle, 0.0, 1.0);
+
+    // full braking at walking pace, the car has to stop instead of driving backwards
+    StateTwoTrack state;
+    state.velocity = Common::Vector2d(0.1, 0.0);
+    state.acceleration = Common::Vector2d(-5.0, 0.0);
+
+    for (int step = 0; step < 3; ++step)
+    {
+        if (implicit)
+        {
+            StepLinearlyImplicitEuler(vehicle, weight, inertiaYaw, input, cycleTime, cycleTime, state);
+        }
+        else
+        {
+            StepExplicitEuler(vehicle, weight, inertiaYaw, input, cycleTime, state);
+        }
+
+        QVERIFY(state.velocity.x >= 0.0);
+    }
+
+    QCOMPARE(state.velocity.x, 0.0);
+    QCOMPARE(state.acceleration.x, 0.0);
+    QVERIFY(state.position.x >= 0.0 && state.position.x <= 0.1 * cycleTime + 1e-9);
+}
+
+void UT_Dynamics2TMTest::testExplicitEulerStep()
+{
+    const double weight = 1000.0;
+    const double inertiaYaw = 1500.0;
+    const double cycleTime = 0.01;
+
+    VehicleSimpleTT vehicle;
+    InitVehicle(vehicle, weight, 10.0);
+    const InputTwoTrack input = CreateInput(vehicle, 0.5, 0.0);
+
+    StateTwoTrack state;
+    state.position = Common::Vector2d(1.0, 2.0);
+    state.velocity = Common::Vector2d(10.0, 0.0);
+    state.acceleration = Common::Vector2d(2.0, 0.0);
+    state.yawAngle = M_PI_2;
+
+    StepExplicitEuler(vehicle, weight, inertiaYaw, input, cycleTime, state);
+
+    // position with the previous velocity, heading north
+    QCOMPARE(state.position.x + 1, 1.0 + 1);
+    QCOMPARE(state.position.y, 2.0 + 10.0 * cycleTime);
+    // velocity with the previous acceleration
+    QCOMPARE(state.velocity.x, 10.0 + 2.0 * cycleTime);
+    // acceleration from the forces of the cycle
+    QCOMPARE(state.acceleration.x, vehicle.forceTotalXY.x / weight);
+    QCOMPARE(state.yawAngle, M_PI_2);
+}
+
+void UT_Dynamics2TMTest::benchmarkForceModel()
+{
+    VehicleSimpleTT vehicle;
+    InitVehicle(vehicle, 1000.0, 10.0);
+    const InputTwoTrack input = CreateInput(vehicle, 0.5, 0.0);
+    vehicle.SetVelocity(Common::Vector2d(10.0, 0.5), 0.1);
+
+    // one evaluation of the force model, done for every agent and every evaluation of the integrator
+    QBENCHMARK
+    {
+        vehicle.DriveTrain(input.throttlePedal, input.brakePedal, input.brakeSuperpose);
+        vehicle.EvaluateForceLocal(0.05, input.forceVertical);
+        vehicle.ForceGlobal();
+    }
+}
+
 void UT_Dynamics2TMTest::cleanupTestCase()
 {
     QVERIFY(true);
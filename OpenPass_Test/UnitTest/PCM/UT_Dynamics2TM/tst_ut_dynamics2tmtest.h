@@ -15,6 +15,7 @@
 #include <QtTest>
 #include <QtGlobal>
 #include "dynamics_twotrack_vehicle.h"
+#include "dynamics_twotrack_local.h"
 
 class UT_Dynamics2TMTest : public QObject
 {
@@ -31,6 +32,22 @@ private Q_SLOTS:
     void testCase1_data();
     void testCase1();
 
+    void testSolveLinear_data();
+    void testSolveLinear();
+
+    void testLinearlyImplicitStep_data();
+    void testLinearlyImplicitStep();
+
+    void testStabilityLargeCycleTime_data();
+    void testStabilityLargeCycleTime();
+
+    void testZeroCrossing_data();
+    void testZeroCrossing();
+
+    void testExplicitEulerStep();
+
+    void benchmarkForceModel();
+
     void cleanupTestCase();
 
 private:
@@ -20,6 +20,9 @@ INCLUDEPATH += . \
                $$MAIN_SRC_DIR/openPASS/Common
 
 HEADERS += $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_lineSegment.h \
+        $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_lineContainer.h \
+        $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_line.h \
+        $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_pointContainer.h \
         $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_point.h \
         $$MAIN_SRC_DIR/openPASS/Common/Vector2d.h \
         $$MAIN_SRC_DIR/openPASS/Common/CommonTools.h \
@@ -27,6 +30,9 @@ HEADERS += $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_lineSegment.h \
 
 
 SOURCES += $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_lineSegment.cpp\
+        $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_lineContainer.cpp \
+        $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_line.cpp \
+        $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_pointContainer.cpp \
         $$MAIN_SRC_DIR/openPASS/Common_PCM/PCM_Data/pcm_point.cpp \
         $$MAIN_SRC_DIR/openPASS/Common/Vector2d.cpp \
         tst_ut_pcm_linesegmenttest.cpp \
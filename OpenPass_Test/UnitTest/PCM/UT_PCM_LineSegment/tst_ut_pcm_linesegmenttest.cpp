@@ -241,3 +241,73 @@ void UT_PCM_LineSegmentTest::testCase_nearestPointInRange()
         }
     }
 }
+
+namespace {
+
+//! Zigzag lines along the x-axis, stacked in y-direction
+void AddZigzagLines(PCM_LineContainer &lineContainer)
+{
+    for (int lineNo = 0; lineNo < 5; lineNo++)
+    {
+        PCM_Line *line = new PCM_Line(lineNo);
+        for (int pointNo = 0; pointNo < 10; pointNo++)
+        {
+            line->AddPCM_Point(new PCM_Point(pointNo, 4.0 * pointNo, 7.0 * lineNo + 3.0 * (pointNo % 2), 0));
+        }
+        lineContainer.AddPCM_Line(line);
+    }
+}
+
+bool IsSamePoint(const PCM_Point &point, const PCM_Point &otherPoint)
+{
+    auto isSame = [](double value, double otherValue)
+    {
+        return (qIsInf(value) && qIsInf(otherValue)) || qFuzzyCompare(value + 1, otherValue + 1);
+    };
+    return isSame(point.GetX(), otherPoint.GetX()) && isSame(point.GetY(), otherPoint.GetY());
+}
+
+} // namespace
+
+void UT_PCM_LineSegmentTest::testCase_indexedNearestLineSegment_data()
+{
+    QTest::addColumn<double>("direction");
+    QTest::addColumn<double>("range");
+    QTest::addColumn<bool>("calculateSubLine");
+
+    QTest::newRow("no view direction") << double(INFINITY) << double(INFINITY) << false;
+    QTest::newRow("view direction only") << 0.3 << 0.0 << false;
+    QTest::newRow("view range") << -2.0 << 0.5 * M_PI << true;
+    QTest::newRow("view range greater 180") << 2.5 << 1.5 * M_PI << true;
+}
+
+void UT_PCM_LineSegmentTest::testCase_indexedNearestLineSegment()
+{
+    QFETCH(double, direction);
+    QFETCH(double, range);
+    QFETCH(bool, calculateSubLine);
+
+    PCM_LineContainer lineContainer;
+    AddZigzagLines(lineContainer);
+
+    PCM_LineContainer indexedLineContainer;
+    AddZigzagLines(indexedLineContainer);
+    indexedLineContainer.BuildSegmentIndex();
+
+    // the index has to find the same segment as the search over all segments
+    for (double sourcePointX = -10.0; sourcePointX <= 50.0; sourcePointX += 2.5)
+    {
+        for (double sourcePointY = -10.0; sourcePointY <= 40.0; sourcePointY += 2.5)
+        {
+            PCM_Point sourcePoint(-1, sourcePointX, sourcePointY, 0);
+
+            PCM_LineSegment lineSegment = lineContainer.GetNearestLineSegment(&sourcePoint, direction, range,
+                                                                              calculateSubLine);
+            PCM_LineSegment indexedLineSegment = indexedLineContainer.GetNearestLineSegment(&sourcePoint, direction,
+                                                                                            range, calculateSubLine);
+
+            QVERIFY(IsSamePoint(lineSegment.GetFirstPoint(), indexedLineSegment.GetFirstPoint()));
+            QVERIFY(IsSamePoint(lineSegment.GetSecondPoint(), indexedLineSegment.GetSecondPoint()));
+        }
+    }
+}
@@ -15,6 +15,7 @@
 #include <QtTest>
 
 #include "pcm_lineSegment.h"
+#include "pcm_lineContainer.h"
 #include "commonTools.h"
 
 class UT_PCM_LineSegmentTest : public QObject
@@ -34,6 +35,9 @@ private slots:
 
     void testCase_nearestPointInRange_data();
     void testCase_nearestPointInRange();
+
+    void testCase_indexedNearestLineSegment_data();
+    void testCase_indexedNearestLineSegment();
 };
 
 #endif // TST_UT_PCM_LINESEGMENTTEST_H
@@ -0,0 +1,218 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "visualObstruction.h"
+
+namespace {
+
+constexpr double resolution = 0.001;
+
+polygon_t CreateBox(double x, double y, double length, double width, double yaw = 0.0)
+{
+    const double cosYaw = std::cos(yaw);
+    const double sinYaw = std::sin(yaw);
+    const double halfLength = 0.5 * length;
+    const double halfWidth = 0.5 * width;
+
+    polygon_t box;
+    for (const auto& corner : {point_t{-halfLength, -halfWidth}, point_t{-halfLength, halfWidth},
+                               point_t{halfLength, halfWidth}, point_t{halfLength, -halfWidth},
+                               point_t{-halfLength, -halfWidth}})
+    {
+        bg::append(box, point_t{x + cosYaw * corner.x() - sinYaw * corner.y(),
+                                y + sinYaw * corner.x() + cosYaw * corner.y()});
+    }
+    bg::correct(box);
+    return box;
+}
+
+//! Visible fractions by the shadow-casting algorithm as reference
+std::vector<double> CalcShadowCastingFractions(const std::vector<polygon_t>& boxes, point_t sensorPosition,
+                                               double direction, double openingAngle, double range)
+{
+    multi_polygon_t brightArea{VisualObstruction::CalcInitialBrightArea(sensorPosition, direction, openingAngle, range)};
+    bg::correct(brightArea);
+
+    for (const auto& box : boxes)
+    {
+        multi_polygon_t newBrightArea;
+        bg::difference(brightArea, VisualObstruction::CalcObjectShadow(box, sensorPosition, range), newBrightArea);
+        brightArea = newBrightArea;
+    }
+
+    std::vector<double> fractions;
+    for (const auto& box : boxes)
+    {
+        fractions.push_back(VisualObstruction::CalcObjectVisibilityPercentage(box, brightArea));
+    }
+    return fractions;
+}
+
+//! Visible fractions by sampling the area of each object with rays from the sensor
+std::vector<double> CalcSampledFractions(const std::vector<polygon_t>& boxes, point_t sensorPosition,
+                                         double direction, double openingAngle, double range)
+{
+    constexpr int samples = 20;
+
+    std::vector<double> fractions;
+    for (size_t index = 0; index < boxes.size(); ++index)
+    {
+        const auto& corners = boxes[index].outer();
+        int visibleSamples = 0;
+        for (int u = 0; u < samples; ++u)
+        {
+            for (int v = 0; v < samples; ++v)
+            {
+                const double s = (u + 0.5) / samples;
+                const double t = (v + 0.5) / samples;
+                const point_t sample{corners[0].x() + s * (corners[1].x() - corners[0].x()) + t * (corners[3].x() - corners[0].x()),
+                                     corners[0].y() + s * (corners[1].y() - corners[0].y()) + t * (corners[3].y() - corners[0].y())};
+
+                const double angle = std::remainder(std::atan2(sample.y() - sensorPosition.y(), sample.x() - sensorPosition.x()) - direction, 2.0 * PI);
+                if (bg::distance(sensorPosition, sample) > range || std::abs(angle) > 0.5 * openingAngle)
+                {
+                    continue;
+                }
+
+                const bg::model::segment<point_t> lineOfSight{sensorPosition, sample};
+                bool isVisible = true;
+                for (size_t other = 0; other < boxes.size() && isVisible; ++other)
+                {
+                    isVisible = other == index || !bg::intersects(lineOfSight, boxes[other]);
+                }
+                visibleSamples += isVisible;
+            }
+        }
+        fractions.push_back(static_cast<double>(visibleSamples) / (samples * samples));
+    }
+    return fractions;
+}
+
+} // namespace
+
+TEST(AngularDepthBuffer_UnitTests, SingleObject_IsFullyVisible)
+{
+    AngularDepthBuffer depthBuffer({0.0, 0.0}, 0.0, 1.0, 100.0, resolution);
+    const auto fractions = depthBuffer.CalcVisibleFractions({CreateBox(20.0, 0.0, 4.0, 2.0)});
+
+    ASSERT_EQ(fractions.size(), 1u);
+    EXPECT_DOUBLE_EQ(fractions[0], 1.0);
+}
+
+TEST(AngularDepthBuffer_UnitTests, ObjectBehindWiderObject_IsHidden)
+{
+    AngularDepthBuffer depthBuffer({0.0, 0.0}, 0.0, 1.0, 100.0, resolution);
+    const auto fractions = depthBuffer.CalcVisibleFractions({CreateBox(40.0, 0.0, 4.0, 2.0),
+                                                             CreateBox(10.0, 0.0, 4.0, 2.0)});
+
+    ASSERT_EQ(fractions.size(), 2u);
+    EXPECT_DOUBLE_EQ(fractions[0], 0.0);
+    EXPECT_DOUBLE_EQ(fractions[1], 1.0);
+}
+
+TEST(AngularDepthBuffer_UnitTests, ObjectHalfBehindOtherObject_IsHalfVisible)
+{
+    AngularDepthBuffer depthBuffer({0.0, 0.0}, 0.0, 1.0, 100.0, resolution);
+    const auto fractions = depthBuffer.CalcVisibleFractions({CreateBox(10.0, 1.0, 0.5, 2.0),
+                                                             CreateBox(20.0, 0.0, 0.5, 4.0)});
+
+    ASSERT_EQ(fractions.size(), 2u);
+    EXPECT_DOUBLE_EQ(fractions[0], 1.0);
+    EXPECT_NEAR(fractions[1], 0.5, 0.02);
+}
+
+TEST(AngularDepthBuffer_UnitTests, ObjectOutsideOpeningAngle_IsHidden)
+{
+    AngularDepthBuffer depthBuffer({0.0, 0.0}, 0.0, 0.5, 100.0, resolution);
+    const auto fractions = depthBuffer.CalcVisibleFractions({CreateBox(0.0, 20.0, 4.0, 2.0),
+                                                             CreateBox(-20.0, 0.0, 4.0, 2.0)});
+
+    ASSERT_EQ(fractions.size(), 2u);
+    EXPECT_DOUBLE_EQ(fractions[0], 0.0);
+    EXPECT_DOUBLE_EQ(fractions[1], 0.0);
+}
+
+TEST(AngularDepthBuffer_UnitTests, FullCircle_DetectsObjectsBehindTheSensor)
+{
+    AngularDepthBuffer depthBuffer({0.0, 0.0}, 0.5, 2.0 * PI, 100.0, resolution);
+    const auto fractions = depthBuffer.CalcVisibleFractions({CreateBox(-20.0, 0.0, 4.0, 2.0),
+                                                             CreateBox(-40.0, 0.0, 4.0, 2.0),
+                                                             CreateBox(20.0, 0.0, 4.0, 2.0)});
+
+    ASSERT_EQ(fractions.size(), 3u);
+    EXPECT_DOUBLE_EQ(fractions[0], 1.0);
+    EXPECT_DOUBLE_EQ(fractions[1], 0.0);
+    EXPECT_DOUBLE_EQ(fractions[2], 1.0);
+}
+
+TEST(AngularDepthBuffer_UnitTests, ObjectNarrowerThanCell_IsVisible)
+{
+    AngularDepthBuffer depthBuffer({0.0, 0.0}, 0.0, 1.0, 100.0, 0.1);
+    const auto fractions = depthBuffer.CalcVisibleFractions({CreateBox(50.0, 0.0, 0.5, 0.5)});
+
+    ASSERT_EQ(fractions.size(), 1u);
+    EXPECT_DOUBLE_EQ(fractions[0], 1.0);
+}
+
+TEST(AngularDepthBuffer_UnitTests, PartialOcclusion_MatchesShadowCasting)
+{
+    const point_t sensorPosition{0.0, 0.0};
+    const std::vector<polygon_t> boxes{CreateBox(15.0, -0.5, 4.5, 1.9),
+                                       CreateBox(35.0, 0.6, 4.5, 1.9),
+                                       CreateBox(60.0, 2.0, 4.5, 1.9, 0.1)};
+
+    AngularDepthBuffer depthBuffer(sensorPosition, 0.0, 0.6, 100.0, resolution);
+    const auto fractions = depthBuffer.CalcVisibleFractions(boxes);
+    const auto expectedFractions = CalcShadowCastingFractions(boxes, sensorPosition, 0.0, 0.6, 100.0);
+
+    ASSERT_EQ(fractions.size(), expectedFractions.size());
+    for (size_t index = 0; index < boxes.size(); ++index)
+    {
+        EXPECT_NEAR(fractions[index], expectedFractions[index], 0.1) << "object " << index;
+    }
+}
+
+TEST(AngularDepthBuffer_UnitTests, TrafficScene_MatchesSampledVisibleArea)
+{
+    const point_t sensorPosition{0.0, 0.0};
+    const double direction = 0.0;
+    const double openingAngle = 0.6;
+    const double range = 150.0;
+
+    std::vector<polygon_t> boxes;
+    for (int lane = -1; lane <= 1; ++lane)
+    {
+        for (int vehicle = 0; vehicle < 5; ++vehicle)
+        {
+            const double x = 20.0 + 25.0 * vehicle + 8.0 * lane;
+            const double y = 3.5 * lane + 0.4 * (vehicle % 3 - 1);
+            boxes.push_back(CreateBox(x, y, 4.5, 1.9, 0.03 * (vehicle % 3 - 1)));
+        }
+    }
+
+    AngularDepthBuffer depthBuffer(sensorPosition, direction, openingAngle, range, resolution);
+    const auto fractions = depthBuffer.CalcVisibleFractions(boxes);
+    const auto expectedFractions = CalcSampledFractions(boxes, sensorPosition, direction, openingAngle, range);
+
+    ASSERT_EQ(fractions.size(), expectedFractions.size());
+    for (size_t index = 0; index < boxes.size(); ++index)
+    {
+        EXPECT_NEAR(fractions[index], expectedFractions[index], 0.1) << "object " << index;
+        EXPECT_EQ(fractions[index] < 0.001, expectedFractions[index] < 0.001) << "object " << index;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
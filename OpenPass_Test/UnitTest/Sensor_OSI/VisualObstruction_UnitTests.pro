@@ -0,0 +1,25 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  VisualObstruction_UnitTests.pro
+# \brief This file contains tests for the visual obstruction of the Sensor_OSI
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS/Common \
+            ../../../OpenPass_Source_Code/openPASS/Components/Sensor_OSI
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/Components/Sensor_OSI/visualObstruction.cpp \
+    VisualObstruction_UnitTests.cpp
@@ -0,0 +1,192 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "philox.h"
+#include "stochastics_implementation.h"
+
+namespace {
+
+using Block = std::array<std::uint32_t, 4>;
+
+std::vector<std::uint32_t> Draw(PhiloxEngine &engine, size_t count)
+{
+    std::vector<std::uint32_t> draws;
+    for (size_t index = 0; index < count; ++index)
+    {
+        draws.push_back(engine());
+    }
+    return draws;
+}
+
+std::vector<double> Draw(StochasticsInterface &stochastics, size_t count)
+{
+    std::vector<double> draws;
+    for (size_t index = 0; index < count; ++index)
+    {
+        draws.push_back(stochastics.GetUniformDistributed(0.0, 1.0));
+    }
+    return draws;
+}
+
+} // namespace
+
+// known answers of philox4x32-10 from kat_vectors of the Random123 distribution
+TEST(PhiloxEngine, Generate_MatchesRandom123KnownAnswers)
+{
+    EXPECT_EQ(PhiloxEngine::Generate({0x00000000, 0x00000000, 0x00000000, 0x00000000},
+                                     {0x00000000, 0x00000000}),
+              (Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+
+    EXPECT_EQ(PhiloxEngine::Generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                                     {0xffffffff, 0xffffffff}),
+              (Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+
+    EXPECT_EQ(PhiloxEngine::Generate({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                                     {0xa4093822, 0x299f31d0}),
+              (Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(PhiloxEngine, Draws_AreBlocksOfConsecutiveCounters)
+{
+    PhiloxEngine engine(42, 0x0000000700000003);
+    const std::vector<std::uint32_t> draws = Draw(engine, 8);
+
+    const std::array<std::uint32_t, 2> key {{42, 0x5354434B}}; // seed and salt of the engine
+    const Block first = PhiloxEngine::Generate({0, 0, 3, 7}, key);
+    const Block second = PhiloxEngine::Generate({1, 0, 3, 7}, key);
+
+    EXPECT_EQ(std::vector<std::uint32_t>(draws.begin(), draws.begin() + 4),
+              std::vector<std::uint32_t>(first.begin(), first.end()));
+    EXPECT_EQ(std::vector<std::uint32_t>(draws.begin() + 4, draws.end()),
+              std::vector<std::uint32_t>(second.begin(), second.end()));
+}
+
+TEST(PhiloxEngine, Restart_RepeatsStream)
+{
+    PhiloxEngine engine(42, 1);
+    const std::vector<std::uint32_t> draws = Draw(engine, 10);
+
+    engine.Restart();
+
+    EXPECT_EQ(Draw(engine, 10), draws);
+}
+
+TEST(PhiloxEngine, DifferentStreamsAndSeeds_DrawDifferentNumbers)
+{
+    PhiloxEngine engine(42, 1);
+    PhiloxEngine otherStream(42, 2);
+    PhiloxEngine otherSeed(43, 1);
+
+    const std::vector<std::uint32_t> draws = Draw(engine, 10);
+
+    EXPECT_NE(Draw(otherStream, 10), draws);
+    EXPECT_NE(Draw(otherSeed, 10), draws);
+}
+
+TEST(PhiloxEngine, Draws_DoNotDependOnOtherStreams)
+{
+    PhiloxEngine reference(42, 1);
+    const std::vector<std::uint32_t> expected = Draw(reference, 10);
+
+    PhiloxEngine engine(42, 1);
+    PhiloxEngine other(42, 2);
+    std::vector<std::uint32_t> draws;
+    for (size_t index = 0; index < 10; ++index)
+    {
+        Draw(other, index);
+        draws.push_back(engine());
+    }
+
+    EXPECT_EQ(draws, expected);
+}
+
+TEST(StochasticsStream, Draws_DoNotDependOnOtherStreamsOrParent)
+{
+    StochasticsImplementation referenceParent(nullptr);
+    referenceParent.InitGenerator(42);
+    const auto reference = referenceParent.CreateStream(1);
+    const std::vector<double> expected = Draw(*reference, 10);
+
+    StochasticsImplementation parent(nullptr);
+    parent.InitGenerator(42);
+    const auto other = parent.CreateStream(2);
+    Draw(*other, 5);
+    Draw(parent, 5);
+    const auto stream = parent.CreateStream(1);
+
+    std::vector<double> draws;
+    for (size_t index = 0; index < 10; ++index)
+    {
+        draws.push_back(stream->GetUniformDistributed(0.0, 1.0));
+        other->GetNormalDistributed(0.0, 1.0);
+        parent.GetUniformDistributed(0.0, 1.0);
+    }
+
+    EXPECT_EQ(draws, expected);
+}
+
+TEST(StochasticsStream, DrawOrderOfStreams_DoesNotChangeDraws)
+{
+    StochasticsImplementation parent(nullptr);
+    parent.InitGenerator(42);
+    const auto first = parent.CreateStream(1);
+    const auto second = parent.CreateStream(2);
+    const std::vector<double> firstDraws = Draw(*first, 10);
+    const std::vector<double> secondDraws = Draw(*second, 10);
+
+    StochasticsImplementation reorderedParent(nullptr);
+    reorderedParent.InitGenerator(42);
+    const auto reorderedSecond = reorderedParent.CreateStream(2);
+    const auto reorderedFirst = reorderedParent.CreateStream(1);
+
+    EXPECT_EQ(Draw(*reorderedSecond, 10), secondDraws);
+    EXPECT_EQ(Draw(*reorderedFirst, 10), firstDraws);
+}
+
+TEST(StochasticsStream, ReInit_RestartsStream)
+{
+    StochasticsImplementation parent(nullptr);
+    parent.InitGenerator(42);
+    const auto stream = parent.CreateStream(1);
+    const std::vector<double> draws = Draw(*stream, 10);
+
+    stream->ReInit();
+
+    EXPECT_EQ(Draw(*stream, 10), draws);
+}
+
+TEST(StochasticsStream, InitGeneratorOfParent_RekeysStream)
+{
+    StochasticsImplementation parent(nullptr);
+    parent.InitGenerator(42);
+    const auto stream = parent.CreateStream(1);
+    const std::vector<double> draws = Draw(*stream, 10);
+
+    parent.InitGenerator(43);
+    EXPECT_EQ(stream->GetRandomSeed(), 43u);
+    const std::vector<double> rekeyedDraws = Draw(*stream, 10);
+    EXPECT_NE(rekeyedDraws, draws);
+
+    StochasticsImplementation otherParent(nullptr);
+    otherParent.InitGenerator(43);
+    const auto otherStream = otherParent.CreateStream(1);
+    EXPECT_EQ(Draw(*otherStream, 10), rekeyedDraws);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,26 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  Stochastics_UnitTests.pro
+# \brief This file contains tests for the random number streams of the Stochastics module
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS \
+            ../../../OpenPass_Source_Code/openPASS/Interfaces \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules/Stochastics
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/Stochastics/stochastics_implementation.cpp \
+    Stochastics_UnitTests.cpp
@@ -0,0 +1,146 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <unordered_map>
+
+#include "AgentAdapter.h"
+#include "FakeAgent.h"
+#include "FakeMovingObject.h"
+#include "FakeWorld.h"
+#include "FakeWorldData.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace {
+
+//! The world data has no roads, so the agent is located nowhere and every query is answered by the fake world
+class AgentAdapterQueryCache : public ::testing::Test
+{
+public:
+    AgentAdapterQueryCache()
+    {
+        ON_CALL(fakeWorld, GetWorldData()).WillByDefault(Return(&fakeWorldData));
+        ON_CALL(fakeWorldData, AddMovingObject(_)).WillByDefault(ReturnRef(fakeMovingObject));
+        ON_CALL(fakeWorldData, GetRoads()).WillByDefault(ReturnRef(noRoads));
+        ON_CALL(fakeMovingObject, GetDimension()).WillByDefault(Return(OWL::Primitive::Dimension{5.0, 2.0, 1.5}));
+
+        agent = std::make_unique<AgentAdapter>(&fakeWorld, nullptr, localizationCache);
+    }
+
+    void SetVelocity(double velocity)
+    {
+        ON_CALL(fakeMovingObject, GetAbsVelocityDouble()).WillByDefault(Return(velocity));
+    }
+
+    NiceMock<FakeWorld> fakeWorld;
+    NiceMock<FakeWorldData> fakeWorldData;
+    NiceMock<FakeMovingObject> fakeMovingObject;
+    const std::unordered_map<OWL::Id, OWL::Interfaces::Road*> noRoads;
+    World::Localization::Cache localizationCache;
+    std::unique_ptr<AgentAdapter> agent;
+};
+
+} // namespace
+
+TEST_F(AgentAdapterQueryCache, RepeatedQueriesWithinTimestep_AskWorldOnce)
+{
+    NiceMock<FakeAgent> objectInFront;
+    AgentSurroundings surroundings;
+    surroundings.laneEgo.width = 3.5;
+
+    EXPECT_CALL(fakeWorld, GetLaneWidth(_, _, _)).Times(1).WillOnce(Return(3.5));
+    EXPECT_CALL(fakeWorld, GetNextObjectInLane(_, _, _, 100.0)).Times(1).WillOnce(Return(&objectInFront));
+    EXPECT_CALL(fakeWorld, GetSurroundings(_, _, _, _, _, 100.0)).Times(1).WillOnce(Return(surroundings));
+
+    for (int query = 0; query < 3; ++query)
+    {
+        EXPECT_DOUBLE_EQ(agent->GetLaneWidth(), 3.5);
+        EXPECT_EQ(agent->GetObjectInFront(100.0), &objectInFront);
+        EXPECT_DOUBLE_EQ(agent->GetSurroundings(100.0).laneEgo.width, 3.5);
+    }
+}
+
+TEST_F(AgentAdapterQueryCache, QueriesWithDifferentArguments_AreCachedSeparately)
+{
+    EXPECT_CALL(fakeWorld, GetLaneWidth(_, _, 0.0)).Times(1).WillOnce(Return(3.5));
+    EXPECT_CALL(fakeWorld, GetLaneWidth(_, _, 10.0)).Times(1).WillOnce(Return(3.0));
+
+    EXPECT_DOUBLE_EQ(agent->GetLaneWidth(0, 0.0), 3.5);
+    EXPECT_DOUBLE_EQ(agent->GetLaneWidth(0, 10.0), 3.0);
+    EXPECT_DOUBLE_EQ(agent->GetLaneWidth(0, 0.0), 3.5);
+    EXPECT_DOUBLE_EQ(agent->GetLaneWidth(0, 10.0), 3.0);
+}
+
+//! A stationary agent is not located again in Update(), but other agents may have moved
+TEST_F(AgentAdapterQueryCache, UpdateOfStationaryAgent_InvalidatesCache)
+{
+    SetVelocity(0.0);
+    NiceMock<FakeAgent> formerObjectInFront;
+    NiceMock<FakeAgent> newObjectInFront;
+
+    EXPECT_CALL(fakeWorld, GetLaneWidth(_, _, _)).Times(2)
+            .WillOnce(Return(3.5))
+            .WillOnce(Return(3.0));
+    EXPECT_CALL(fakeWorld, GetNextObjectInLane(_, _, _, 100.0)).Times(2)
+            .WillOnce(Return(&formerObjectInFront))
+            .WillOnce(Return(&newObjectInFront));
+
+    EXPECT_DOUBLE_EQ(agent->GetLaneWidth(), 3.5);
+    EXPECT_EQ(agent->GetObjectInFront(100.0), &formerObjectInFront);
+
+    EXPECT_CALL(fakeMovingObject, GetDimension()).Times(0);
+    ASSERT_TRUE(agent->Update());
+
+    EXPECT_DOUBLE_EQ(agent->GetLaneWidth(), 3.0);
+    EXPECT_EQ(agent->GetObjectInFront(100.0), &newObjectInFront);
+}
+
+TEST_F(AgentAdapterQueryCache, UpdateOfMovingAgent_InvalidatesCache)
+{
+    SetVelocity(10.0);
+
+    EXPECT_CALL(fakeWorld, GetLaneWidth(_, _, _)).Times(2)
+            .WillOnce(Return(3.5))
+            .WillOnce(Return(3.0));
+
+    EXPECT_DOUBLE_EQ(agent->GetLaneWidth(), 3.5);
+    agent->Update();
+    EXPECT_DOUBLE_EQ(agent->GetLaneWidth(), 3.0);
+}
+
+TEST_F(AgentAdapterQueryCache, LocateOfStationaryAgent_InvalidatesCache)
+{
+    SetVelocity(0.0);
+    AgentSurroundings formerSurroundings;
+    formerSurroundings.laneEgo.width = 3.5;
+    AgentSurroundings newSurroundings;
+    newSurroundings.laneEgo.width = 3.0;
+
+    EXPECT_CALL(fakeWorld, GetSurroundings(_, _, _, _, _, 100.0)).Times(2)
+            .WillOnce(Return(formerSurroundings))
+            .WillOnce(Return(newSurroundings));
+
+    EXPECT_DOUBLE_EQ(agent->GetSurroundings(100.0).laneEgo.width, 3.5);
+    agent->Locate();
+    EXPECT_DOUBLE_EQ(agent->GetSurroundings(100.0).laneEgo.width, 3.0);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,45 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  AgentAdapterQueryCache_UnitTests.pro
+# \brief This file contains tests for the query cache of the AgentAdapter
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+INCLUDEPATH += \
+            ../../TestClasses \
+            ../../../OpenPass_Source_Code/openPASS \
+            ../../../OpenPass_Source_Code/openPASS/Common \
+            ../../../OpenPass_Source_Code/openPASS/Interfaces \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/OWL \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/OWL/Fakes
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/Common/vector2d.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/AgentAdapter.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/WorldObjectAdapter.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/OWL/DataTypes.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/OWL/OpenDriveTypeMapper.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/Localization/CoverageCalculator.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/Localization/GeometryProcessor.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/Localization/LaneWalker.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/Localization/Localization.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/Localization/PointAggregator.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/Localization/PointLocator.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/Localization/PointQuery.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/Localization/PolygonSampler.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/Localization/SearchInitializer.cpp \
+    AgentAdapterQueryCache_UnitTests.cpp
+
+LIBS += -lopen_simulation_interface -lprotobuf
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "AgentOccupancyGrid.h"
+
+namespace {
+
+polygon_t CreateBox(double x, double y, double length, double width, double yaw = 0.0)
+{
+    const double cosYaw = std::cos(yaw);
+    const double sinYaw = std::sin(yaw);
+    const double halfLength = 0.5 * length;
+    const double halfWidth = 0.5 * width;
+
+    polygon_t box;
+    for (const auto& corner : {point_t{-halfLength, -halfWidth}, point_t{-halfLength, halfWidth},
+                               point_t{halfLength, halfWidth}, point_t{halfLength, -halfWidth},
+                               point_t{-halfLength, -halfWidth}})
+    {
+        bg::append(box, point_t{x + cosYaw * corner.x() - sinYaw * corner.y(),
+                                y + sinYaw * corner.x() + cosYaw * corner.y()});
+    }
+    return box;
+}
+
+} // namespace
+
+TEST(AgentOccupancyGrid, EmptyGrid_DoesNotIntersect)
+{
+    AgentOccupancyGrid grid;
+
+    EXPECT_FALSE(grid.Intersects(CreateBox(0.0, 0.0, 5.0, 2.0)));
+}
+
+TEST(AgentOccupancyGrid, OverlappingFootprint_Intersects)
+{
+    AgentOccupancyGrid grid;
+    grid.Insert(CreateBox(100.0, 3.0, 5.0, 2.0));
+
+    EXPECT_TRUE(grid.Intersects(CreateBox(103.0, 3.5, 5.0, 2.0)));
+    EXPECT_FALSE(grid.Intersects(CreateBox(106.0, 3.0, 5.0, 2.0)));
+    EXPECT_FALSE(grid.Intersects(CreateBox(100.0, 6.0, 5.0, 2.0)));
+}
+
+TEST(AgentOccupancyGrid, OverlappingEnvelopesOfRotatedBoxes_DoNotIntersect)
+{
+    AgentOccupancyGrid grid;
+    grid.Insert(CreateBox(0.0, 0.0, 10.0, 1.0, M_PI_4));
+
+    EXPECT_FALSE(grid.Intersects(CreateBox(3.0, -3.0, 1.0, 1.0)));
+    EXPECT_TRUE(grid.Intersects(CreateBox(3.0, 3.0, 1.0, 1.0)));
+}
+
+TEST(AgentOccupancyGrid, BoxSpanningSeveralCells_IsFoundInEachCell)
+{
+    AgentOccupancyGrid grid(2.0);
+    grid.Insert(CreateBox(-1.0, -1.0, 18.0, 3.0));
+
+    EXPECT_TRUE(grid.Intersects(CreateBox(-9.0, -1.0, 1.0, 1.0)));
+    EXPECT_TRUE(grid.Intersects(CreateBox(7.0, 0.0, 1.0, 1.0)));
+    EXPECT_FALSE(grid.Intersects(CreateBox(9.0, -1.0, 1.0, 1.0)));
+}
+
+TEST(AgentOccupancyGrid, Clear_RemovesAllBoxes)
+{
+    AgentOccupancyGrid grid;
+    grid.Insert(CreateBox(0.0, 0.0, 5.0, 2.0));
+    grid.Clear();
+
+    EXPECT_FALSE(grid.Intersects(CreateBox(0.0, 0.0, 5.0, 2.0)));
+}
+
+TEST(AgentOccupancyGrid, RandomTraffic_MatchesTestingAllBoxes)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> position(-200.0, 200.0);
+    std::uniform_real_distribution<double> yaw(-M_PI, M_PI);
+
+    AgentOccupancyGrid grid;
+    std::vector<polygon_t> boxes;
+    for (int i = 0; i < 300; ++i)
+    {
+        boxes.push_back(CreateBox(position(generator), position(generator), 4.5, 1.8, yaw(generator)));
+        grid.Insert(boxes.back());
+    }
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const polygon_t footprint = CreateBox(position(generator), position(generator), 12.0, 2.5, yaw(generator));
+        const bool expected = std::any_of(boxes.cbegin(), boxes.cend(), [&footprint](const polygon_t& box)
+        {
+            return bg::intersects(footprint, box);
+        });
+
+        EXPECT_EQ(grid.Intersects(footprint), expected);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
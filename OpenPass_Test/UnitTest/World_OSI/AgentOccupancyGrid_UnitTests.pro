@@ -0,0 +1,25 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  AgentOccupancyGrid_UnitTests.pro
+# \brief This file contains tests for the occupancy grid of the World_OSI
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/AgentOccupancyGrid.cpp \
+    AgentOccupancyGrid_UnitTests.cpp
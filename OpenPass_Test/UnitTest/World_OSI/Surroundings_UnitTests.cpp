@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright (c) 2019 in-tech GmbH
+*
+* This program and the accompanying materials are made
+* available under the terms of the Eclipse Public License 2.0
+* which is available at https://www.eclipse.org/legal/epl-2.0/
+*
+* SPDX-License-Identifier: EPL-2.0
+*******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "FakeAgent.h"
+#include "FakeLaneManager.h"
+#include "FakeWorldData.h"
+#include "WorldDataQuery.h"
+
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace {
+
+const std::string roadId {"TestRoadId"};
+const std::list<OWL::LaneType> endOfLaneTypes {OWL::LaneType::Driving, OWL::LaneType::Exit, OWL::LaneType::OnRamp,
+                                              OWL::LaneType::OffRamp, OWL::LaneType::Stop};
+
+WorldObjectInterface* GetLinkedObject(OWL::Interfaces::WorldObject* worldObject)
+{
+    return worldObject ? worldObject->GetLink<WorldObjectInterface>() : nullptr;
+}
+
+void PlaceObject(FakeMovingObject& object, FakeAgent& agent, double start, double end)
+{
+    object.SetLinkedObjectForTesting(static_cast<WorldObjectInterface*>(&agent));
+    ON_CALL(object, GetDistance(OWL::MeasurementPoint::RoadStart)).WillByDefault(Return(start));
+    ON_CALL(object, GetDistance(OWL::MeasurementPoint::RoadEnd)).WillByDefault(Return(end));
+}
+
+} // namespace
+
+//! Two sections of 100 m with the lanes -1 (left), -2 (ego) and -3 (right).
+//! The left lane ends with a shoulder in the second section.
+TEST(WorldDataQuery_GetSurroundings, ResultOfEachLane_EqualsTheIndividualQueries)
+{
+    FakeLaneManager laneManager(2, 3, 3.5, {100.0, 100.0});
+    const OWL::Interfaces::Road& road = *laneManager.GetRoads().begin()->second;
+    for (size_t col = 0; col < 2; ++col)
+    {
+        for (size_t row = 0; row < 3; ++row)
+        {
+            ON_CALL(laneManager.GetLane(col, row), GetRoad()).WillByDefault(ReturnRef(road));
+        }
+    }
+    ON_CALL(laneManager.GetLane(1, 0), GetLaneType()).WillByDefault(Return(OWL::LaneType::Shoulder));
+    ON_CALL(laneManager.GetLane(1, 2), GetLaneType()).WillByDefault(Return(OWL::LaneType::Exit));
+
+    const double frontDistance = 52.0;
+    const double referenceDistance = 50.0;
+    const double searchDistance = 200.0;
+    laneManager.SetWidth(0, 0, 3.0, referenceDistance);
+    laneManager.SetWidth(0, 2, 4.0, referenceDistance);
+
+    FakeAgent agentInFront, agentBehind, agentLeft;
+    FakeMovingObject objectInFront, objectBehind, objectLeft;
+    PlaceObject(objectInFront, agentInFront, 130.0, 135.0);
+    PlaceObject(objectBehind, agentBehind, 20.0, 25.0);
+    PlaceObject(objectLeft, agentLeft, 60.0, 65.0);
+    laneManager.AddWorldObject(1, 1, objectInFront);
+    laneManager.AddWorldObject(0, 1, objectBehind);
+    laneManager.AddWorldObject(0, 0, objectLeft);
+
+    const std::unordered_map<OWL::Id, OWL::Interfaces::TrafficSign*> trafficSigns;
+    FakeWorldData worldData;
+    ON_CALL(worldData, GetRoads()).WillByDefault(ReturnRef(laneManager.GetRoads()));
+    ON_CALL(worldData, GetRoadIdMapping()).WillByDefault(ReturnRef(laneManager.GetRoadIdMapping()));
+    ON_CALL(worldData, GetLaneIdMapping()).WillByDefault(ReturnRef(laneManager.GetLaneIdMapping()));
+    ON_CALL(worldData, GetTrafficSigns()).WillByDefault(ReturnRef(trafficSigns));
+
+    WorldDataQuery worldDataQuery(worldData);
+    const AgentSurroundings surroundings = worldDataQuery.GetSurroundings(roadId, -2, -2, frontDistance,
+                                           referenceDistance, searchDistance);
+
+    const std::vector<std::pair<OWL::OdId, const LaneSurroundings*>> lanes {{-2, &surroundings.laneEgo},
+                                                                          {-1, &surroundings.laneLeft},
+                                                                          {-3, &surroundings.laneRight}};
+    for (const auto& lane : lanes)
+    {
+        const OWL::OdId laneId = lane.first;
+        const LaneSurroundings& result = *lane.second;
+
+        EXPECT_EQ(result.objectInFront, GetLinkedObject(worldDataQuery.GetNextObjectInLane<OWL::Interfaces::WorldObject>(
+                                            roadId, laneId, frontDistance, searchDistance)));
+        EXPECT_EQ(result.objectBehind, GetLinkedObject(worldDataQuery.GetClosestObjectInUpstream<OWL::Interfaces::WorldObject>(
+                                           roadId, laneId, frontDistance, searchDistance)));
+        EXPECT_DOUBLE_EQ(result.width, worldDataQuery.GetLaneByOdId(roadId, laneId, referenceDistance).GetWidth(referenceDistance));
+        EXPECT_DOUBLE_EQ(result.distanceToEndOfLane, worldDataQuery.GetDistanceToEndOfLane(roadId, laneId, frontDistance,
+                         searchDistance, endOfLaneTypes));
+        EXPECT_TRUE(result.exists);
+    }
+
+    EXPECT_EQ(surroundings.laneEgo.objectInFront, static_cast<WorldObjectInterface*>(&agentInFront));
+    EXPECT_EQ(surroundings.laneEgo.objectBehind, static_cast<WorldObjectInterface*>(&agentBehind));
+    EXPECT_EQ(surroundings.laneLeft.objectInFront, static_cast<WorldObjectInterface*>(&agentLeft));
+    EXPECT_EQ(surroundings.laneRight.objectInFront, nullptr);
+
+    EXPECT_DOUBLE_EQ(surroundings.laneEgo.width, 3.5);
+    EXPECT_DOUBLE_EQ(surroundings.laneLeft.width, 3.0);
+    EXPECT_DOUBLE_EQ(surroundings.laneRight.width, 4.0);
+
+    EXPECT_DOUBLE_EQ(surroundings.laneEgo.distanceToEndOfLane, 148.0);
+    EXPECT_DOUBLE_EQ(surroundings.laneLeft.distanceToEndOfLane, 48.0);
+    EXPECT_DOUBLE_EQ(surroundings.laneRight.distanceToEndOfLane, 148.0);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,34 @@
+# /*********************************************************************
+# * Copyright (c) 2019 in-tech GmbH
+# *
+# * This program and the accompanying materials are made
+# * available under the terms of the Eclipse Public License 2.0
+# * which is available at https://www.eclipse.org/legal/epl-2.0/
+# *
+# * SPDX-License-Identifier: EPL-2.0
+# **********************************************************************/
+
+#-----------------------------------------------------------------------------
+# \file  Surroundings_UnitTests.pro
+# \brief This file contains tests for the surroundings query of the World_OSI
+#-----------------------------------------------------------------------------/
+
+CONFIG += OPENPASS_TESTING
+include(../../Testing.pri)
+
+INCLUDEPATH += \
+            ../../../OpenPass_Source_Code/openPASS \
+            ../../../OpenPass_Source_Code/openPASS/Common \
+            ../../../OpenPass_Source_Code/openPASS/Interfaces \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/OWL \
+            ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/OWL/Fakes
+
+SOURCES += \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/OWL/DataTypes.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/OWL/OpenDriveTypeMapper.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/WorldObjectAdapter.cpp \
+    ../../../OpenPass_Source_Code/openPASS/CoreModules/World_OSI/WorldDataQuery.cpp \
+    Surroundings_UnitTests.cpp
+
+LIBS += -lopen_simulation_interface -lprotobuf